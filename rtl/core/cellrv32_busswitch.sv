@@ -29,6 +29,7 @@ module cellrv32_busswitch #(
     output logic ca_bus_err_o,          // bus transfer error
     input  logic ca_bus_multi_en_i,     // bus multi-cycle access indicator
     output logic ca_bus_multi_rsp_o,    // bus multi-cycle response indicator
+    input  logic ca_bus_lock_i,         // exclusive access: do not grant port B (e.g. d-cache flush)
     // controller interface b //
     input  logic cb_bus_priv_i,         // current privilege level
     input  logic cb_bus_cached_i,       // set if cached transfer
@@ -51,7 +52,9 @@ module cellrv32_busswitch #(
     output logic p_bus_we_o,            // write enable
     output logic p_bus_re_o,            // read enable
     input  logic p_bus_ack_i,           // bus transfer acknowledge
-    input  logic p_bus_err_i            // bus transfer error
+    input  logic p_bus_err_i,           // bus transfer error
+    // status //
+    output logic arb_wait_o             // a controller port is waiting for the other port's access (HPM)
     );
 
     // access request //
@@ -139,12 +142,12 @@ module cellrv32_busswitch #(
                 end else if (ca_req_pending) begin
                     arbiter.bus_sel = 1'b0;
                     arbiter.state_nxt = A_RETIRE;
-                // current request from port B?
-                end else if (cb_req_current) begin
+                // current request from port B? (buffered while port A holds the lock)
+                end else if (cb_req_current && (~ca_bus_lock_i)) begin
                     arbiter.bus_sel = 1'b1;
                     arbiter.state_nxt = B_BUSY;
                 // pending request from port B?
-                end else if (cb_req_pending) begin
+                end else if (cb_req_pending && (~ca_bus_lock_i)) begin
                     arbiter.bus_sel = 1'b1;
                     arbiter.state_nxt = B_RETIRE;
                 end
@@ -210,6 +213,9 @@ module cellrv32_busswitch #(
 
     assign p_bus_src_o = arbiter.bus_sel;
 
+    // arbitration loss: the port that is currently *not* selected has a request //
+    assign arb_wait_o = (arbiter.bus_sel == 1'b0) ? (cb_req_current | cb_req_pending) : (ca_req_current | ca_req_pending);
+
     assign ca_bus_rdata_o = (arbiter.bus_sel == 1'b0) ? p_bus_rdata_i : '0;
     assign cb_bus_rdata_o = (arbiter.bus_sel == 1'b1) ? p_bus_rdata_i : '0;
 
@@ -19,21 +19,46 @@ module cellrv32_cpu #(
     parameter logic CPU_EXTENSION_RISCV_M = 1'b0,        // implement mul/div extension?
     parameter logic CPU_EXTENSION_RISCV_U = 1'b0,        // implement user mode extension?
     parameter logic CPU_EXTENSION_RISCV_V = 1'b0,        // implement vector extension?
+    parameter logic CPU_EXTENSION_RISCV_Zcmp = 1'b0,     // implement compressed push/pop/move extension (requires C)?
+    parameter logic CPU_EXTENSION_RISCV_Zcmt = 1'b0,     // implement compressed table-jump extension (requires C)?
     parameter logic CPU_EXTENSION_RISCV_Zfinx = 1'b0,    // implement 32-bit floating-point extension (using INT reg!)
     parameter logic CPU_EXTENSION_RISCV_Zhinx = 1'b0,    // implement 16-bit floating-point extension (using INT reg!)
     parameter logic CPU_EXTENSION_RISCV_Zicsr = 1'b0,    // implement CSR system?
     parameter logic CPU_EXTENSION_RISCV_Zicntr = 1'b0,   // implement base counters?
     parameter logic CPU_EXTENSION_RISCV_Zicond = 1'b0,   // implement conditional operations extension?
+    parameter logic CPU_EXTENSION_RISCV_Zicbop = 1'b0,   // implement cache-block prefetch hints?
+    parameter logic CPU_EXTENSION_RISCV_Zicboz = 1'b0,   // implement cache-block zero operation?
     parameter logic CPU_EXTENSION_RISCV_Zihpm = 1'b0,    // implement hardware performance monitors?
     parameter logic CPU_EXTENSION_RISCV_Zifencei = 1'b0, // implement instruction stream sync.?
+    parameter logic CPU_EXTENSION_RISCV_Zkn = 1'b0,      // implement scalar cryptography (NIST suite) extension?
     parameter logic CPU_EXTENSION_RISCV_Zmmul = 1'b0,    // implement multiply-only M sub-extension?
     parameter logic CPU_EXTENSION_RISCV_Zxcfu = 1'b0,    // implement custom (instr.) functions unit?
     parameter logic CPU_EXTENSION_RISCV_Sdext = 1'b0,    // implement external debug mode extension?
     parameter logic CPU_EXTENSION_RISCV_Sdtrig = 1'b0,   // implement trigger module extension?
+    parameter logic CPU_EXTENSION_RISCV_Sscofpmf = 1'b0, // implement HPM counter-overflow interrupt extension?
     /* Extension Options */
     parameter logic FAST_MUL_EN = 1'b0,                  // use DSPs for M extension's multiplier
     parameter logic FAST_SHIFT_EN = 1'b0,                // use barrel shifter for shift operations
+    parameter logic MULDIV_PERF = 1'b0,                  // pipelined DSP multiplier + radix-4 early-out divider
+    parameter logic FPU_PERF = 1'b0,                     // barrel-shift FPU normalizer/aligner + fused multiply-add (Zfinx)
     parameter int   CPU_IPB_ENTRIES = 1,                 // entries in instruction prefetch buffer, has to be a power of 2, min 1
+    parameter logic CPU_BP_EN = 1'b0,                    // implement dynamic branch prediction (BHT + BTB)?
+    parameter int   CPU_BP_BHT_ENTRIES = 64,             // branch history table entries, has to be a power of 2, min 2
+    parameter int   CPU_BP_BTB_ENTRIES = 16,             // branch target buffer entries, has to be a power of 2, min 2
+    parameter int   CPU_BP_RAS_DEPTH   = 4,              // return address stack entries, has to be zero or a power of 2, min 2
+    parameter logic CPU_PIPELINE_MODE  = 1'b0,           // overlap dispatch and write-back of single-cycle ALU operations?
+    parameter logic CPU_DUAL_ISSUE     = 1'b0,           // issue two independent simple ALU operations at once?
+    parameter logic CPU_FETCH_64BIT    = 1'b0,           // accept two instruction words per fetch (64-bit fetch path)?
+    parameter logic [4:0] CPU_FUSION   = 5'b00000,       // macro-op fusion: per-pattern enable (see fusion_*_c)
+    parameter logic CPU_HWLOOP         = 1'b0,           // implement zero-overhead hardware loops (two nested loop contexts)?
+    parameter logic CPU_FP16_SIMD      = 1'b0,           // implement packed-SIMD 2x FP16 operations + half-precision FMA (Zhinx)?
+    parameter logic CPU_PSIMD          = 1'b0,           // implement packed-SIMD integer DSP operations (P extension subset)?
+    parameter logic CPU_NB_LOAD        = 1'b0,           // continue execution of independent instructions while a load is pending?
+    parameter int   CPU_SB_DEPTH       = 0,              // store buffer entries, has to be zero or a power of 2
+    parameter logic CPU_MISALIGNED     = 1'b0,           // implement hardware support for misaligned loads/stores?
+    parameter logic CPU_IRQ_VECTORED   = 1'b0,           // vectored interrupts with priority/preemption levels and tail-chaining?
+    parameter logic CPU_RF_SHADOW      = 1'b0,           // shadow register bank for caller-saved registers (fast interrupt entry)?
+    parameter logic CPU_ICACHE_CTRL    = 1'b0,           // implement i-cache control CSRs (way locking, block preload)?
     parameter int   VLEN = 256,                          // max size of element vector
     parameter int   ELEN = 32,                           // size of vector register
     /* Physical Memory Protection (PMP) */
@@ -54,8 +79,20 @@ module cellrv32_cpu #(
     output logic i_bus_re_o,           // read request
     input  logic i_bus_ack_i,          // bus transfer acknowledge
     input  logic i_bus_err_i,          // bus transfer error
+    input  logic [31:0] i_bus_rdata2_i,// bus read data of next sequential word (64-bit fetch)
+    input  logic i_bus_wide_i,         // next sequential word is valid (64-bit fetch)
     output logic i_bus_fence_o,        // executed FENCEI operation
     output logic i_bus_priv_o,         // current effective privilege level
+    /* i-cache control */
+    output logic [7:0]  ic_lock_o,     // locked ways
+    output logic [2:0]  ic_way_o,      // preload target way
+    output logic        ic_fill_o,     // block preload request
+    output logic [31:0] ic_fill_addr_o,// preload address
+    input  logic        ic_busy_i,     // block preload pending
+    output logic        ic_hint_o,     // preload is a prefetch hint
+    /* d-cache prefetch hint */
+    output logic        dc_pref_o,     // prefetch.r/prefetch.w hint
+    output logic [31:0] dc_pref_addr_o,// hint address
     /* data bus interface */
     output logic [31:0] d_bus_addr_o , // bus access address
     input  logic [31:0] d_bus_rdata_i, // bus read data
@@ -66,6 +103,8 @@ module cellrv32_cpu #(
     input  logic d_bus_ack_i,          // bus transfer acknowledge
     input  logic d_bus_err_i,          // bus transfer error
     output logic d_bus_fence_o,        // executed FENCE operation
+    output logic d_bus_flush_o,        // write back and invalidate data cache (vector memory access)
+    output logic d_bus_zero_o,         // write is part of a cache-block zero operation
     output logic d_bus_priv_o,         // current effective privilege level
     output logic d_bus_multi_en_o,     // multi-cycle access in progress
     input  logic d_bus_multi_rsp_i,    // multi-cycle access response valid
@@ -77,6 +116,10 @@ module cellrv32_cpu #(
     input logic mtime_irq_i, // machine timer interrupt
     /* fast interrupts (custom) */
     input logic [15:0] firq_i,
+    /* SoC-level HPM events */
+    input logic [hpm_ext_width_c-1:0] hpm_ext_i,
+    /* instruction trace */
+    output trace_port_t trace_o,
     /* debug mode (halt) request */
     input logic db_halt_req_i
 );
@@ -86,27 +129,36 @@ module cellrv32_cpu #(
     // ----------------------------------------------------------------------------------------------
 
     /* local constants: additional register file read ports */
-    localparam logic regfile_rs3_en_c = CPU_EXTENSION_RISCV_Zxcfu | CPU_EXTENSION_RISCV_Zfinx; // 3rd register file read port (rs3)
-    localparam logic regfile_rs4_en_c = CPU_EXTENSION_RISCV_Zxcfu; // 4th register file read port (rs4)
+    localparam logic regfile_rs3_en_c = CPU_EXTENSION_RISCV_Zxcfu | CPU_EXTENSION_RISCV_Zfinx | (CPU_EXTENSION_RISCV_Zhinx & CPU_FP16_SIMD) | CPU_PSIMD | CPU_DUAL_ISSUE; // 3rd register file read port (rs3)
+    localparam logic regfile_rs4_en_c = CPU_EXTENSION_RISCV_Zxcfu | CPU_DUAL_ISSUE; // 4th register file read port (rs4)
+
+    /* local constant: 64-bit fetch (both words have to be covered by the same PMP granule) */
+    localparam logic fetch_64bit_c = CPU_FETCH_64BIT & ((PMP_NUM_REGIONS == 0) | (PMP_MIN_GRANULARITY >= 8));
 
     /* local constant: instruction prefetch buffer depth */
-    localparam logic ipb_override_c = (CPU_EXTENSION_RISCV_C == 1) & (CPU_IPB_ENTRIES < 2); // override IPB size: set to 2?
-    localparam int   ipb_depth_c    = cond_sel_natural_f(ipb_override_c, 2, CPU_IPB_ENTRIES);
+    localparam int   ipb_min_c      = cond_sel_natural_f(fetch_64bit_c, 4, cond_sel_natural_f((CPU_EXTENSION_RISCV_C == 1) | CPU_DUAL_ISSUE | (CPU_FUSION != 0), 2, 1));
+    localparam logic ipb_override_c = (CPU_IPB_ENTRIES < ipb_min_c); // override IPB size: set to minimum?
+    localparam int   ipb_depth_c    = cond_sel_natural_f(ipb_override_c, ipb_min_c, CPU_IPB_ENTRIES);
 
     /* local signals */
     ctrl_bus_t ctrl; // main control bus
     logic [XLEN-1:0] imm;     // immediate
+    logic [XLEN-1:0] imm2;    // immediate of second issue slot
     logic [XLEN-1:0] rs1;     // source register 1
     logic [XLEN-1:0] rs2;     // source register 2
     logic [XLEN-1:0] rs3;     // source register 3
     logic [XLEN-1:0] rs4;     // source register 4
     logic [XLEN-1:0] alu_res; // alu result
+    logic [XLEN-1:0] alu2_res;// second issue slot alu result
     logic [XLEN-1:0] alu_add; // alu address result
     logic [1:0]      alu_cmp; // comparator result
     logic [XLEN-1:0] mem_rdata;  // memory read data
     logic  cp_done;              // ALU co-prefetch operation done
     logic  alu_exc;              // ALU exception
     logic  bus_d_wait;           // wait for current bus data access
+    logic  bus_ld_ok;            // load request issued without alignment/PMP fault
+    logic  bus_sb_empty;         // store buffer is empty
+    logic  bus_sb_err;           // bus error while draining the store buffer
     logic  [XLEN-1:0] csr_rdata; // csr read data
     logic  [XLEN-1:0] mar;       // current memory address register
     logic  ma_load;              // misaligned load data address
@@ -128,6 +180,7 @@ module cellrv32_cpu #(
     vector_mem_resp mem_resp;
     logic           req_valid;
     logic           resp_valid;
+    logic           vec_stall; // vector memory request waiting for grant
 
     // Sanity Checks -----------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -140,7 +193,7 @@ module cellrv32_cpu #(
         // -------------------------------------------------------------------------------------------
         /* CPU ISA configuration */
         assert (1'b0)
-        else $info("CELLRV32 CPU CONFIG NOTE: Core ISA ('MARCH') = RV32 %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s",
+        else $info("CELLRV32 CPU CONFIG NOTE: Core ISA ('MARCH') = RV32 %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s",
                     cond_sel_string_f(CPU_EXTENSION_RISCV_E,        "E", "I"),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_M,        "M", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_C,        "C", ""),
@@ -150,14 +203,23 @@ module cellrv32_cpu #(
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zicsr,    "_Zicsr", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zicntr,   "_Zicntr", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zicond,   "_Zicond", ""),
+                    cond_sel_string_f(CPU_EXTENSION_RISCV_Zicbop,   "_Zicbop", ""),
+                    cond_sel_string_f(CPU_EXTENSION_RISCV_Zicboz,   "_Zicboz", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zifencei, "_Zifencei", ""),
+                    cond_sel_string_f(CPU_EXTENSION_RISCV_Zcmp,     "_Zcmp", ""),
+                    cond_sel_string_f(CPU_EXTENSION_RISCV_Zcmt,     "_Zcmt", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zfinx,    "_Zfinx", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zhinx,    "_Zhinx", ""),
+                    cond_sel_string_f(CPU_EXTENSION_RISCV_Zkn,      "_Zkn", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zihpm,    "_Zihpm", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zmmul,    "_Zmmul", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Zxcfu,    "_Zxcfu", ""),
                     cond_sel_string_f(CPU_EXTENSION_RISCV_Sdext,    "_Sdext", ""),
-                    cond_sel_string_f(CPU_EXTENSION_RISCV_Sdtrig,   "_Sdtrig", ""));
+                    cond_sel_string_f(CPU_EXTENSION_RISCV_Sdtrig,   "_Sdtrig", ""),
+                    cond_sel_string_f(CPU_EXTENSION_RISCV_Sscofpmf, "_Sscofpmf", ""),
+                    cond_sel_string_f(CPU_HWLOOP,                   "_Xhwloop", ""),
+                    cond_sel_string_f(CPU_FP16_SIMD,                "_Xhsimd", ""),
+                    cond_sel_string_f(CPU_PSIMD,                    "_Xpsimd", ""));
 
         // -------------------------------------------------------------------------------------------
         /* simulation notifier */
@@ -195,7 +257,83 @@ module cellrv32_cpu #(
         else $error("CELLRV32 CPU CONFIG ERROR! Number of entries in instruction prefetch buffer <CPU_IPB_ENTRIES> has to be a power of two.");
         //
         assert (ipb_override_c != 1)
-        else $warning("CELLRV32 CPU CONFIG WARNING! Overriding <CPU_IPB_ENTRIES> configuration (setting =2) because C ISA extension is enabled.");
+        else $warning("CELLRV32 CPU CONFIG WARNING! Overriding <CPU_IPB_ENTRIES> configuration (setting =%0d) because C ISA extension, dual-issue, macro-op fusion or 64-bit fetch is enabled.", ipb_min_c);
+
+        // -------------------------------------------------------------------------------------------
+        /* Dynamic branch prediction */
+        assert (!(CPU_BP_EN == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_BP_EN> enabled. Implementing branch predictor with %0d BHT and %0d BTB entries.", CPU_BP_BHT_ENTRIES, CPU_BP_BTB_ENTRIES);
+        //
+        assert ((CPU_BP_EN != 1'b1) || ((is_power_of_two_f(CPU_BP_BHT_ENTRIES) != 1'b0) && (CPU_BP_BHT_ENTRIES >= 2)))
+        else $error("CELLRV32 CPU CONFIG ERROR! Number of branch history table entries <CPU_BP_BHT_ENTRIES> has to be a power of two, min 2.");
+        //
+        assert ((CPU_BP_EN != 1'b1) || ((is_power_of_two_f(CPU_BP_BTB_ENTRIES) != 1'b0) && (CPU_BP_BTB_ENTRIES >= 2)))
+        else $error("CELLRV32 CPU CONFIG ERROR! Number of branch target buffer entries <CPU_BP_BTB_ENTRIES> has to be a power of two, min 2.");
+        //
+        assert ((CPU_BP_EN != 1'b1) || (CPU_BP_RAS_DEPTH == 0) || ((is_power_of_two_f(CPU_BP_RAS_DEPTH) != 1'b0) && (CPU_BP_RAS_DEPTH >= 2)))
+        else $error("CELLRV32 CPU CONFIG ERROR! Number of return address stack entries <CPU_BP_RAS_DEPTH> has to be zero or a power of two, min 2.");
+        //
+        assert ((CPU_BP_EN != 1'b1) || (CPU_BP_RAS_DEPTH == 0))
+        else $info("CELLRV32 CPU CONFIG NOTE: Implementing %0d-entry return address stack.", CPU_BP_RAS_DEPTH);
+
+        // -------------------------------------------------------------------------------------------
+        /* Pipelined execution */
+        assert (!(CPU_PIPELINE_MODE == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_PIPELINE_MODE> enabled. Overlapping dispatch and write-back of single-cycle ALU operations.");
+        //
+        assert (!(CPU_DUAL_ISSUE == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_DUAL_ISSUE> enabled. Implementing second issue slot for simple ALU operations.");
+        //
+        assert (!(fetch_64bit_c == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_FETCH_64BIT> enabled. Accepting two instruction words per fetch.");
+        //
+        assert (!((CPU_FETCH_64BIT == 1'b1) && (fetch_64bit_c == 1'b0)))
+        else $warning("CELLRV32 CPU CONFIG WARNING! <CPU_FETCH_64BIT> ignored as <PMP_MIN_GRANULARITY> is less than 8 bytes.");
+        //
+        assert (!(CPU_FUSION != 0))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_FUSION> enabled. Implementing macro-op fusion (pattern mask 0b%5b).", CPU_FUSION);
+        //
+        assert (!((CPU_HWLOOP == 1'b1) && (CPU_EXTENSION_RISCV_Zicsr == 1'b0)))
+        else $error("CELLRV32 CPU CONFIG ERROR! Hardware loops <CPU_HWLOOP> require the <CPU_EXTENSION_RISCV_Zicsr> extension (loop setup CSRs).");
+        //
+        assert (!((CPU_FP16_SIMD == 1'b1) && (CPU_EXTENSION_RISCV_Zhinx == 1'b0)))
+        else $warning("CELLRV32 CPU CONFIG WARNING! Packed-SIMD FP16 operations <CPU_FP16_SIMD> require the <CPU_EXTENSION_RISCV_Zhinx> extension.");
+        //
+        assert (!((CPU_FP16_SIMD == 1'b1) && (CPU_EXTENSION_RISCV_Zhinx == 1'b1)))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_FP16_SIMD> enabled. Implementing second FP16 lane and half-precision fused multiply-add.");
+        //
+        assert (!(CPU_PSIMD == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_PSIMD> enabled. Implementing packed-SIMD DSP unit (P extension subset, not ratified).");
+        //
+        assert (!(((CPU_EXTENSION_RISCV_Zcmp == 1'b1) || (CPU_EXTENSION_RISCV_Zcmt == 1'b1)) && (CPU_EXTENSION_RISCV_C == 1'b0)))
+        else $error("CELLRV32 CPU CONFIG ERROR! <CPU_EXTENSION_RISCV_Zcmp> and <CPU_EXTENSION_RISCV_Zcmt> require the <CPU_EXTENSION_RISCV_C> extension.");
+        //
+        assert (!((CPU_EXTENSION_RISCV_Zcmt == 1'b1) && (CPU_EXTENSION_RISCV_Zicsr == 1'b0)))
+        else $error("CELLRV32 CPU CONFIG ERROR! <CPU_EXTENSION_RISCV_Zcmt> requires the <CPU_EXTENSION_RISCV_Zicsr> extension (jvt CSR).");
+        //
+        assert (!(CPU_NB_LOAD == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_NB_LOAD> enabled. Implementing non-blocking loads (register scoreboard, one outstanding load).");
+        //
+        assert ((CPU_SB_DEPTH == 0) || (is_power_of_two_f(CPU_SB_DEPTH) != 1'b0))
+        else $error("CELLRV32 CPU CONFIG ERROR! Number of store buffer entries <CPU_SB_DEPTH> has to be zero or a power of two.");
+        //
+        assert (!(CPU_SB_DEPTH > 0))
+        else $info("CELLRV32 CPU CONFIG NOTE: Implementing %0d-entry store buffer (posted writes, imprecise store bus errors).", CPU_SB_DEPTH);
+        //
+        assert (!(CPU_MISALIGNED == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_MISALIGNED> enabled. Misaligned loads/stores are split into aligned bus accesses.");
+        //
+        assert (!((CPU_IRQ_VECTORED == 1'b1) && (CPU_EXTENSION_RISCV_Zicsr == 1'b0)))
+        else $error("CELLRV32 CPU CONFIG ERROR! Vectored interrupts <CPU_IRQ_VECTORED> require the <CPU_EXTENSION_RISCV_Zicsr> extension.");
+        //
+        assert (!(CPU_IRQ_VECTORED == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_IRQ_VECTORED> enabled. Implementing vectored interrupts with priority levels and tail-chaining.");
+        //
+        assert (!((CPU_RF_SHADOW == 1'b1) && (CPU_EXTENSION_RISCV_Zicsr == 1'b0)))
+        else $error("CELLRV32 CPU CONFIG ERROR! Shadow register bank <CPU_RF_SHADOW> requires the <CPU_EXTENSION_RISCV_Zicsr> extension.");
+        //
+        assert (!(CPU_RF_SHADOW == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <CPU_RF_SHADOW> enabled. Implementing shadow register bank for caller-saved registers (doubles register file depth).");
 
         // -------------------------------------------------------------------------------------------
         /* PMP */
@@ -227,6 +365,9 @@ module cellrv32_cpu #(
         //
         assert (!((CPU_EXTENSION_RISCV_Zicsr == 0) && (CPU_EXTENSION_RISCV_Zihpm == 1)))
         else $error("CELLRV32 CPU CONFIG ERROR! Hardware performance monitors extension <CPU_EXTENSION_RISCV_Zihpm> requires <CPU_EXTENSION_RISCV_Zicsr> extension to be enabled.");
+        //
+        assert (!((CPU_EXTENSION_RISCV_Sscofpmf == 1) && ((CPU_EXTENSION_RISCV_Zihpm == 0) || (HPM_NUM_CNTS == 0))))
+        else $error("CELLRV32 CPU CONFIG ERROR! Counter-overflow interrupt extension <CPU_EXTENSION_RISCV_Sscofpmf> requires <CPU_EXTENSION_RISCV_Zihpm> extension and at least one HPM counter.");
 
 
         // -------------------------------------------------------------------------------------------
@@ -246,6 +387,17 @@ module cellrv32_cpu #(
         /* fast multiplication option */
         assert (!(FAST_MUL_EN == 1'b1))
         else $info("CELLRV32 CPU CONFIG NOTE: <FAST_MUL_EN> enabled. Trying to infer DSP blocks for multiplications.");
+        //
+        assert (!(MULDIV_PERF == 1'b1))
+        else $info("CELLRV32 CPU CONFIG NOTE: <MULDIV_PERF> enabled. Implementing DSP multiplier and radix-4 early-out divider.");
+
+        // -------------------------------------------------------------------------------------------
+        /* fast FPU option */
+        assert (!((FPU_PERF == 1'b1) && (CPU_EXTENSION_RISCV_Zfinx == 1'b0)))
+        else $warning("CELLRV32 CPU CONFIG WARNING! <FPU_PERF> requires <CPU_EXTENSION_RISCV_Zfinx>.");
+        //
+        assert (!((FPU_PERF == 1'b1) && (CPU_EXTENSION_RISCV_Zfinx == 1'b1)))
+        else $info("CELLRV32 CPU CONFIG NOTE: <FPU_PERF> enabled. Implementing FPU barrel shifters and fused multiply-add.");
 
         // -------------------------------------------------------------------------------------------
         /* fast shift option */
@@ -283,21 +435,46 @@ module cellrv32_cpu #(
         .CPU_EXTENSION_RISCV_M(CPU_EXTENSION_RISCV_M), // implement mul/div extension?
         .CPU_EXTENSION_RISCV_U(CPU_EXTENSION_RISCV_U), // implement user mode extension?
         .CPU_EXTENSION_RISCV_V(CPU_EXTENSION_RISCV_V), // implement vector extension?
+        .CPU_EXTENSION_RISCV_Zcmp(CPU_EXTENSION_RISCV_Zcmp),         // implement compressed push/pop/move extension?
+        .CPU_EXTENSION_RISCV_Zcmt(CPU_EXTENSION_RISCV_Zcmt),         // implement compressed table-jump extension?
         .CPU_EXTENSION_RISCV_Zfinx(CPU_EXTENSION_RISCV_Zfinx),       // implement 32-bit floating-point extension (using INT reg!)
         .CPU_EXTENSION_RISCV_Zhinx(CPU_EXTENSION_RISCV_Zhinx),       // implement 16-bit floating-point extension (using INT reg!)
         .CPU_EXTENSION_RISCV_Zicsr(CPU_EXTENSION_RISCV_Zicsr),       // implement CSR system?
         .CPU_EXTENSION_RISCV_Zicntr(CPU_EXTENSION_RISCV_Zicntr),    // implement base counters?
         .CPU_EXTENSION_RISCV_Zicond(CPU_EXTENSION_RISCV_Zicond),     // implement conditional operations extension?
+        .CPU_EXTENSION_RISCV_Zicbop(CPU_EXTENSION_RISCV_Zicbop),     // implement cache-block prefetch hints?
+        .CPU_EXTENSION_RISCV_Zicboz(CPU_EXTENSION_RISCV_Zicboz),     // implement cache-block zero operation?
         .CPU_EXTENSION_RISCV_Zihpm(CPU_EXTENSION_RISCV_Zihpm),       // implement hardware performance monitors?
         .CPU_EXTENSION_RISCV_Zifencei(CPU_EXTENSION_RISCV_Zifencei), // implement instruction stream sync.?
+        .CPU_EXTENSION_RISCV_Zkn(CPU_EXTENSION_RISCV_Zkn),           // implement scalar cryptography (NIST suite) extension?
         .CPU_EXTENSION_RISCV_Zmmul(CPU_EXTENSION_RISCV_Zmmul),       // implement multiply-only M sub-extension?
         .CPU_EXTENSION_RISCV_Zxcfu(CPU_EXTENSION_RISCV_Zxcfu),       // implement custom (instr.) functions unit?
         .CPU_EXTENSION_RISCV_Sdext(CPU_EXTENSION_RISCV_Sdext),       // implement external debug mode extension?
         .CPU_EXTENSION_RISCV_Sdtrig(CPU_EXTENSION_RISCV_Sdtrig),     // implement trigger module extension?
+        .CPU_EXTENSION_RISCV_Sscofpmf(CPU_EXTENSION_RISCV_Sscofpmf), // implement HPM counter-overflow interrupt extension?
         /* Tuning Options */
         .FAST_MUL_EN(    FAST_MUL_EN),                  // use DSPs for M extension's multiplier
         .FAST_SHIFT_EN ( FAST_SHIFT_EN),                // use barrel shifter for shift operations
+        .MULDIV_PERF   ( MULDIV_PERF),                  // pipelined DSP multiplier + radix-4 early-out divider
+        .FPU_PERF      ( FPU_PERF),                     // barrel-shift FPU normalizer/aligner + fused multiply-add (Zfinx)
         .CPU_IPB_ENTRIES(ipb_depth_c),                  // entries is instruction prefetch buffer, has to be a power of 2, min 1
+        .CPU_BP_EN(CPU_BP_EN),                          // implement dynamic branch prediction (BHT + BTB)?
+        .CPU_BP_BHT_ENTRIES(CPU_BP_BHT_ENTRIES),        // branch history table entries, has to be a power of 2
+        .CPU_BP_BTB_ENTRIES(CPU_BP_BTB_ENTRIES),        // branch target buffer entries, has to be a power of 2
+        .CPU_BP_RAS_DEPTH(CPU_BP_RAS_DEPTH),            // return address stack entries, has to be zero or a power of 2
+        .CPU_PIPELINE_MODE(CPU_PIPELINE_MODE),          // overlap dispatch and write-back of single-cycle ALU operations?
+        .CPU_DUAL_ISSUE(CPU_DUAL_ISSUE),                // issue two independent simple ALU operations at once?
+        .CPU_FETCH_64BIT(fetch_64bit_c),                // accept two instruction words per fetch (64-bit fetch path)?
+        .CPU_FUSION(CPU_FUSION),                        // macro-op fusion: per-pattern enable
+        .CPU_HWLOOP(CPU_HWLOOP),                        // implement zero-overhead hardware loops?
+        .CPU_FP16_SIMD(CPU_FP16_SIMD),                  // implement packed-SIMD 2x FP16 operations?
+        .CPU_PSIMD(CPU_PSIMD),                          // implement packed-SIMD integer DSP operations?
+        .CPU_NB_LOAD(CPU_NB_LOAD),                      // implement non-blocking loads?
+        .CPU_SB_DEPTH(CPU_SB_DEPTH),                    // store buffer entries
+        .CPU_MISALIGNED(CPU_MISALIGNED),                // implement hardware support for misaligned accesses?
+        .CPU_IRQ_VECTORED(CPU_IRQ_VECTORED),            // implement vectored interrupt controller?
+        .CPU_RF_SHADOW(CPU_RF_SHADOW),                  // implement shadow register bank?
+        .CPU_ICACHE_CTRL(CPU_ICACHE_CTRL),              // implement i-cache control CSRs?
         /* Physical memory protection (PMP) */
         .PMP_NUM_REGIONS(    PMP_NUM_REGIONS),          // number of regions (0..16)
         .PMP_MIN_GRANULARITY(PMP_MIN_GRANULARITY),      // minimal region granularity in bytes, has to be a power of 2, min 4 bytes
@@ -315,21 +492,39 @@ module cellrv32_cpu #(
         .i_bus_re_o(i_bus_re_o),       // read enable
         .i_bus_ack_i(i_bus_ack_i),     // bus transfer acknowledge
         .i_bus_err_i(i_bus_err_i),     // bus transfer error
+        .i_bus_rdata2_i(i_bus_rdata2_i), // bus read data of next sequential word
+        .i_bus_wide_i(i_bus_wide_i),   // next sequential word is valid
         .i_pmp_fault_i(i_pmp_fault),   // instruction fetch pmp fault
         /* status input */
         .alu_cp_done_i(cp_done),   // ALU iterative operation done
         .alu_exc_i(alu_exc),       // ALU exception
         .bus_d_wait_i(bus_d_wait), // wait for bus
+        .bus_ld_ok_i(bus_ld_ok),   // load request issued without alignment/PMP fault
+        .bus_sb_empty_i(bus_sb_empty), // store buffer is empty
+        .bus_sb_err_i(bus_sb_err), // bus error while draining the store buffer
+        .vec_stall_i(vec_stall),   // vector memory request waiting for grant
+        .hpm_ext_i(hpm_ext_i),     // SoC-level HPM events
+        .ic_busy_i(ic_busy_i),     // i-cache block preload pending
         /* data input */
         .cmp_i(alu_cmp),      // comparator status
         .alu_add_i(alu_add),  // ALU address result
         .rs1_i(rs1),          // rf source 1
         .rs2_i(rs2),          // rf source 2
+        .mem_i(mem_rdata),    // memory read data
         /* data output */
         .imm_o(imm),          // immediate
+        .imm2_o(imm2),        // immediate of second issue slot
         .curr_pc_o(curr_pc),         // current PC (corresponding to current instruction)
         .next_pc_o(next_pc),         // next PC (corresponding to next instruction)
         .csr_rdata_o(csr_rdata),     // CSR read data
+        .trace_o(trace_o),           // instruction trace port
+        .ic_lock_o(ic_lock_o),       // i-cache: locked ways
+        .ic_way_o(ic_way_o),         // i-cache: preload target way
+        .ic_fill_o(ic_fill_o),       // i-cache: block preload request
+        .ic_fill_addr_o(ic_fill_addr_o), // i-cache: preload address
+        .ic_hint_o(ic_hint_o),       // i-cache: preload is a prefetch hint
+        .dc_pref_o(dc_pref_o),       // d-cache: prefetch hint
+        .dc_pref_addr_o(dc_pref_addr_o), // d-cache: hint address
         /* FPU interface */
         .fpu_flags_i(fpu_flags),     // exception flags
         /* debug mode (halt) request */
@@ -358,6 +553,9 @@ module cellrv32_cpu #(
     /* instruction fetch interface */
     assign i_bus_addr_o  = fetch_pc;
     assign i_bus_fence_o = ctrl.bus_fencei;
+
+    /* data cache flush before vector memory accesses */
+    assign d_bus_flush_o = ctrl.bus_dflush;
     assign i_bus_priv_o  = ctrl.cpu_priv;
 
     // Register File -----------------------------------------------------------------------------
@@ -366,7 +564,11 @@ module cellrv32_cpu #(
         .XLEN                  (XLEN),                  // data path width
         .CPU_EXTENSION_RISCV_E (CPU_EXTENSION_RISCV_E), // implement embedded RF extension?
         .RS3_EN                (regfile_rs3_en_c),      // enable 3rd read port
-        .RS4_EN                (regfile_rs4_en_c)       // enable 4th read port
+        .RS4_EN                (regfile_rs4_en_c),      // enable 4th read port
+        .PIPE_EN               (CPU_PIPELINE_MODE),     // separate write address + write-back bypass
+        .DUAL_EN               (CPU_DUAL_ISSUE),        // second write port for dual-issue
+        .NBL_EN                (CPU_NB_LOAD),           // late write port for non-blocking loads
+        .SHADOW_EN             (CPU_RF_SHADOW)          // shadow bank for caller-saved registers
     ) cellrv32_cpu_regfile_inst (
         /* global control */
         .clk_i  (clk_i),    // global clock, rising edge
@@ -377,6 +579,7 @@ module cellrv32_cpu #(
         .mem_i (mem_rdata), // memory read data
         .csr_i (csr_rdata), // CSR read data
         .pc2_i (next_pc),   // next PC
+        .alu2_i(alu2_res),  // second issue slot ALU result
         /* data output */
         .rs1_o (rs1),       // operand 1
         .rs2_o (rs2),       // operand 2
@@ -397,9 +600,15 @@ module cellrv32_cpu #(
         .CPU_EXTENSION_RISCV_Zhinx  (CPU_EXTENSION_RISCV_Zhinx),   // implement 16-bit floating-point extension (using INT reg!)
         .CPU_EXTENSION_RISCV_Zxcfu  (CPU_EXTENSION_RISCV_Zxcfu),   // implement custom (instr.) functions unit?
         .CPU_EXTENSION_RISCV_Zicond (CPU_EXTENSION_RISCV_Zicond),  // implement conditional operations extension?
+        .CPU_EXTENSION_RISCV_Zkn    (CPU_EXTENSION_RISCV_Zkn),     // implement scalar cryptography (NIST suite) extension?
         /* Extension Options */
         .FAST_MUL_EN                (FAST_MUL_EN),                 // use DSPs for M extension's multiplier
-        .FAST_SHIFT_EN              (FAST_SHIFT_EN)                // use barrel shifter for shift operations
+        .FAST_SHIFT_EN              (FAST_SHIFT_EN),               // use barrel shifter for shift operations
+        .MULDIV_PERF                (MULDIV_PERF),                 // pipelined DSP multiplier + radix-4 early-out divider
+        .FPU_PERF                   (FPU_PERF),                    // barrel-shift FPU normalizer/aligner + fused multiply-add (Zfinx)
+        .FP16_SIMD                  (CPU_FP16_SIMD),               // packed-SIMD 2x FP16 operations + fused multiply-add (Zhinx)
+        .PSIMD                      (CPU_PSIMD),                   // packed-SIMD integer DSP operations (P extension subset)
+        .DUAL_ISSUE_EN              (CPU_DUAL_ISSUE)               // implement second (simple) ALU for dual-issue
     ) cellrv32_cpu_alu_inst (
         /* global control */
         .clk_i       (clk_i),     // global clock, rising edge
@@ -412,9 +621,11 @@ module cellrv32_cpu #(
         .rs4_i       (rs4),       // rf source 4
         .pc_i        (curr_pc),   // current PC
         .imm_i       (imm),       // immediate
+        .imm2_i      (imm2),      // immediate of second issue slot
         /* data output */
         .cmp_o       (alu_cmp),   // comparator status
         .res_o       (alu_res),   // ALU result
+        .res2_o      (alu2_res),  // second issue slot ALU result
         .add_o       (alu_add),   // address computation result
         .fpu_flags_o (fpu_flags), // FPU exception flags
         /* vector memory interface */
@@ -428,12 +639,18 @@ module cellrv32_cpu #(
         .cp_done_o   (cp_done)    // iterative processing units done?
     );
 
+    /* vector unit stalled by the memory system (HPM event) */
+    assign vec_stall = req_valid & (~d_bus_multi_rsp_i);
+
     // Bus Interface (Load/Store Unit) -----------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     cellrv32_cpu_bus #(
         .XLEN                (XLEN),               // data path width
         .PMP_NUM_REGIONS     (PMP_NUM_REGIONS),    // number of regions (0..16)
-        .PMP_MIN_GRANULARITY (PMP_MIN_GRANULARITY) // minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+        .PMP_MIN_GRANULARITY (PMP_MIN_GRANULARITY),// minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+        .SB_DEPTH            (CPU_SB_DEPTH),       // store buffer entries, has to be zero or a power of 2
+        .MA_EN               (CPU_MISALIGNED),     // implement hardware support for misaligned accesses
+        .CBZ_EN              (CPU_EXTENSION_RISCV_Zicboz) // implement cache-block zero operation
     ) cellrv32_cpu_bus_inst (
         /* global control */
         .clk_i               (clk_i),         // global clock, rising edge
@@ -448,10 +665,13 @@ module cellrv32_cpu #(
         .rdata_o             (mem_rdata),     // read data
         .mar_o               (mar),           // current memory address register
         .d_wait_o            (bus_d_wait),    // wait for access to complete
+        .ld_ok_o             (bus_ld_ok),     // load request issued without alignment/PMP fault
         .ma_load_o           (ma_load),       // misaligned load data address
         .ma_store_o          (ma_store),      // misaligned store data address
         .be_load_o           (be_load),       // bus error on load data access
         .be_store_o          (be_store),      // bus error on store data access
+        .sb_empty_o          (bus_sb_empty),  // store buffer is empty
+        .sb_err_o            (bus_sb_err),    // bus error while draining the store buffer
         /* physical memory protection */
         .pmp_addr_i          (pmp_addr),      // addresses
         .pmp_ctrl_i          (pmp_ctrl),      // configurations
@@ -473,6 +693,7 @@ module cellrv32_cpu #(
         .d_bus_ack_i         (d_bus_ack_i),   // bus transfer acknowledge
         .d_bus_err_i         (d_bus_err_i),   // bus transfer error
         .d_bus_fence_o       (d_bus_fence_o), // fence operation
+        .d_bus_zero_o        (d_bus_zero_o),  // cache-block zero write
         .d_bus_priv_o        (d_bus_priv_o)   // current effective privilege level
     );
 
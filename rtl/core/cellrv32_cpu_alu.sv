@@ -1,7 +1,8 @@
 // ##################################################################################################
 // # << CELLRV32 - Arithmetical/Logical Unit >>                                                     #
 // # ********************************************************************************************** #
-// # Main data/address ALU and ALU co-processors (= multi-cycle function units).                    #
+// # Main data/address ALU and ALU co-processors (= multi-cycle function units). An optional simple #
+// # second ALU (add/sub/slt/logic/movb only) serves the second issue slot in dual-issue mode.      #
 // # ********************************************************************************************** #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
@@ -22,10 +23,16 @@ module cellrv32_cpu_alu #(
     parameter int CPU_EXTENSION_RISCV_Zhinx  = 0, // implement 16-bit floating-point extension (using INT reg!)
     parameter int CPU_EXTENSION_RISCV_Zxcfu  = 0, // implement custom (instr.) functions unit?
     parameter int CPU_EXTENSION_RISCV_Zicond = 0, // implement conditional operations extension?
+    parameter int CPU_EXTENSION_RISCV_Zkn    = 0, // implement scalar cryptography (NIST suite) extension?
     /* Extension Options */
     parameter int FAST_MUL_EN                = 0,  // use DSPs for M extension's multiplier
     parameter int FAST_SHIFT_EN              = 0,  // use barrel shifter for shift operations
-    parameter int VECTOR_FP_ALU              = 0   // Enable floating-point lanes
+    parameter int MULDIV_PERF                = 0,  // pipelined DSP multiplier + radix-4 early-out divider
+    parameter int FPU_PERF                   = 0,  // barrel-shift FPU normalizer/aligner + fused multiply-add (Zfinx)
+    parameter int FP16_SIMD                  = 0,  // packed-SIMD 2x FP16 operations + fused multiply-add (Zhinx)
+    parameter int PSIMD                      = 0,  // packed-SIMD integer DSP operations (P extension subset)
+    parameter int VECTOR_FP_ALU              = 0,  // Enable floating-point lanes
+    parameter int DUAL_ISSUE_EN              = 0   // implement second (simple) ALU for dual-issue
 )(
     /* global control */
     input  logic            clk_i,       // global clock, rising edge
@@ -38,9 +45,11 @@ module cellrv32_cpu_alu #(
     input  logic [XLEN-1:0] rs4_i,       // rf source 4
     input  logic [XLEN-1:0] pc_i,        // current PC
     input  logic [XLEN-1:0] imm_i,       // immediate
+    input  logic [XLEN-1:0] imm2_i,      // immediate of second issue slot
     /* data output */
     output logic [1:0]      cmp_o,       // comparator status
     output logic [XLEN-1:0] res_o,       // ALU result
+    output logic [XLEN-1:0] res2_o,      // second issue slot ALU result
     output logic [XLEN-1:0] add_o,       // address computation result
     output logic [4:0]      fpu_flags_o, // FPU exception flags
     /* vector memory interface */
@@ -77,10 +86,10 @@ module cellrv32_cpu_alu #(
     cp_monitor_t cp_monitor;
 
     /* co-processor interface */
-    typedef logic [XLEN-1:0] cp_data_if_t [6:0];
+    typedef logic [XLEN-1:0] cp_data_if_t [8:0];
     cp_data_if_t cp_result;   // co-processor result
-    logic [7:0] cp_start;     // trigger co-processor
-    logic [7:0] cp_valid;     // co-processor done
+    logic [8:0] cp_start;     // trigger co-processor
+    logic [8:0] cp_valid;     // co-processor done
     logic [4:0] vfpu32_flags; // vector fp32 flags
     logic [4:0] fpu32_flags;  // fp32 flags
     logic [4:0] fpu16_flags;  // fp16 flags
@@ -96,7 +105,7 @@ module cellrv32_cpu_alu #(
 
     // ALU Input Operand Select ------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
-    assign opa = (ctrl_i.alu_opa_mux == 1'b1) ? pc_i  : rs1_i;
+    assign opa = ((ctrl_i.alu_opa_mux == 1'b1) ? pc_i  : rs1_i) << ctrl_i.alu_opa_sh; // optional shift for fused shift-add
     assign opb = (ctrl_i.alu_opb_mux == 1'b1) ? imm_i : rs2_i;
 
     // Adder/Subtracter Core ---------------------------------------------------------------------
@@ -195,6 +204,44 @@ module cellrv32_cpu_alu #(
         endcase
     end : alu_core
 
+    // Second Issue Slot ALU (simple operations only) --------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] operands are provided by the register file's 3rd and 4th read port (rs3 = slot 2 rs1, rs4 = slot 2 rs2)
+    generate
+        if (DUAL_ISSUE_EN == 1) begin : alu2_enabled
+            logic [XLEN-1:0] opb2;
+            logic [XLEN:0]   addsub2_res;
+            //
+            assign opb2 = (ctrl_i.alu2_opb_mux == 1'b1) ? imm2_i : rs4_i;
+            //
+            always_comb begin : alu2_addsub
+                logic [XLEN:0] opa2_v, opb2_v;
+                opa2_v = {(rs3_i[$bits(rs3_i)-1] & (~ctrl_i.alu2_unsigned)), rs3_i}; // optional sign-extension
+                opb2_v = {(opb2[$bits(opb2)-1]   & (~ctrl_i.alu2_unsigned)), opb2};
+                if (ctrl_i.alu2_op[0] == 1'b1) begin // sub/slt
+                    addsub2_res = opa2_v - opb2_v;
+                end else begin
+                    addsub2_res = opa2_v + opb2_v;
+                end
+            end : alu2_addsub
+            //
+            always_comb begin : alu2_core
+                unique case (ctrl_i.alu2_op)
+                    alu_op_slt_c  : res2_o = {'0, addsub2_res[XLEN]};
+                    alu_op_movb_c : res2_o = opb2;
+                    alu_op_xor_c  : res2_o = rs3_i ^ opb2;
+                    alu_op_or_c   : res2_o = rs3_i | opb2;
+                    alu_op_and_c  : res2_o = rs3_i & opb2;
+                    default: begin
+                                    res2_o = addsub2_res[XLEN-1 : 0]; // add/sub
+                    end
+                endcase
+            end : alu2_core
+        end else begin : alu2_disabled
+            assign res2_o = '0;
+        end : alu2_disabled
+    endgenerate
+
     // **************************************************************************************************************************
     // ALU Co-Processors
     // **************************************************************************************************************************
@@ -247,7 +294,10 @@ module cellrv32_cpu_alu #(
     assign cp_res = cp_result[cp_sel_shifter_c]  | cp_result[cp_sel_muldiv_c] | 
                     cp_result[cp_sel_bitmanip_c] | cp_result[cp_sel_fpu32_c]  | 
                     cp_result[cp_sel_fpu16_c]    | cp_result[cp_sel_cfu_c]    | 
-                    cp_result[cp_sel_cond_c];
+                    cp_result[cp_sel_cond_c]     | cp_result[cp_sel_psimd_c];
+
+    /* the vector unit does not return a scalar result */
+    assign cp_result[cp_sel_vector_c] = '0;
 
     // -------------------------------------------------------------------------------------------
     // Co-Processor 0: Shifter Unit ('I'/'E' Base ISA) -------------------------------------------
@@ -278,7 +328,8 @@ module cellrv32_cpu_alu #(
             cellrv32_cpu_cp_muldiv #(
                 .XLEN        (XLEN                 ),
                 .FAST_MUL_EN (FAST_MUL_EN          ),
-                .DIVISION_EN (CPU_EXTENSION_RISCV_M)
+                .DIVISION_EN (CPU_EXTENSION_RISCV_M),
+                .MULDIV_PERF (MULDIV_PERF          )
             ) cellrv32_cpu_cp_muldiv_inst (
                 /* global control */
                 .clk_i   (clk_i                     ), // global clock, rising edge
@@ -303,13 +354,14 @@ module cellrv32_cpu_alu #(
     endgenerate
 
     // -------------------------------------------------------------------------------------------
-    // Co-Processor 2: Bit-Manipulation Unit ('B' Extension) -------------------------------------
+    // Co-Processor 2: Bit-Manipulation Unit ('B' and 'Zkn' Extensions) --------------------------
     // -------------------------------------------------------------------------------------------
     generate
-        if (CPU_EXTENSION_RISCV_B == 1'b1) begin : cellrv32_cpu_cp_bitmanip_inst_ON
+        if ((CPU_EXTENSION_RISCV_B == 1'b1) || (CPU_EXTENSION_RISCV_Zkn == 1'b1)) begin : cellrv32_cpu_cp_bitmanip_inst_ON
             cellrv32_cpu_cp_bitmanip #(
-                .XLEN          (XLEN         ),
-                .FAST_SHIFT_EN (FAST_SHIFT_EN)
+                .XLEN          (XLEN                   ),
+                .FAST_SHIFT_EN (FAST_SHIFT_EN          ),
+                .ZKN_EN        (CPU_EXTENSION_RISCV_Zkn)
             ) cellrv32_cpu_cp_bitmanip_inst (
                 /* global control */
                 .clk_i   ( clk_i                      ), // global clock, rising edge
@@ -329,7 +381,7 @@ module cellrv32_cpu_alu #(
     endgenerate
 
     generate
-        if (CPU_EXTENSION_RISCV_B == 1'b0) begin : cellrv32_cpu_cp_bitmanip_inst_OFF
+        if ((CPU_EXTENSION_RISCV_B == 1'b0) && (CPU_EXTENSION_RISCV_Zkn == 1'b0)) begin : cellrv32_cpu_cp_bitmanip_inst_OFF
             assign cp_result[cp_sel_bitmanip_c] = '0;
             assign cp_valid[cp_sel_bitmanip_c]  = 1'b0;
         end : cellrv32_cpu_cp_bitmanip_inst_OFF
@@ -341,7 +393,8 @@ module cellrv32_cpu_alu #(
     generate
        if (CPU_EXTENSION_RISCV_Zfinx == 1'b1) begin : cellrv32_cpu_cp_fpu32_inst_ON
            cellrv32_cpu_cp_fpu32 #(
-               .XLEN (XLEN)
+               .XLEN     (XLEN    ),
+               .FPU_PERF (FPU_PERF)
            ) cellrv32_cpu_cp_fpu32_inst (
                /* global control */
                .clk_i    (clk_i                    ), // global clock, rising edge
@@ -374,8 +427,15 @@ module cellrv32_cpu_alu #(
     // -------------------------------------------------------------------------------------------
     generate
        if (CPU_EXTENSION_RISCV_Zhinx == 1'b1) begin : cellrv32_cpu_cp_fpu16_inst_ON
+           /* lane interface */
+           logic [XLEN-1:0] lane_res   [0:1]; // lane result
+           logic [4:0]      lane_flags [0:1]; // lane exception flags
+           logic [1:0]      lane_valid;       // lane data output valid
+
+           /* lane 0: scalar operations and lower half of packed operations */
            cellrv32_cpu_cp_fpu16 #(
-               .XLEN (XLEN)
+               .XLEN      (XLEN     ),
+               .FP16_SIMD (FP16_SIMD)
            ) cellrv32_cpu_cp_fpu16_inst (
                /* global control */
                .clk_i    (clk_i                    ), // global clock, rising edge
@@ -388,10 +448,92 @@ module cellrv32_cpu_alu #(
                .rs2_i    (rs2_i                    ), // rf source 2
                .rs3_i    (rs3_i                    ), // rf source 3
                /* result and status */
-               .res_o    (cp_result[cp_sel_fpu16_c]), // operation result
-               .fflags_o (fpu16_flags              ), // exception flags
-               .valid_o  (cp_valid[cp_sel_fpu16_c] )  // data output valid
+               .res_o    (lane_res[0]              ), // operation result
+               .fflags_o (lane_flags[0]            ), // exception flags
+               .valid_o  (lane_valid[0]            )  // data output valid
            );
+
+           // Packed-SIMD: Second Lane ------------------------------------------------------------
+           // -------------------------------------------------------------------------------------
+           // [NOTE] Packed operations (fmt = 11) process the lower and upper 16-bit halves of the source
+           // registers in two independent FPU instances. The lanes may finish at different times (iterative
+           // alignment/normalization), so the CP "valid" signal is raised when the last lane is done. The
+           // lane results are only valid for one cycle and are buffered until then.
+           if (FP16_SIMD == 1) begin : fpu16_simd_enabled
+               logic        packed_op;        // current instruction is a packed operation
+               logic [1:0]  lane_done;        // lane has completed the current operation
+               logic [15:0] lane_buf   [0:1]; // buffered lane results
+               logic [4:0]  lane_fbuf;        // buffered lane exception flags
+               logic        simd_valid;       // all lanes done
+               logic        simd_out;         // packed result output enable
+
+               assign packed_op = (ctrl_i.ir_funct12[6:5] == float_packed_c) ? 1'b1 : 1'b0;
+
+               /* lane 1: upper half of packed operations */
+               cellrv32_cpu_cp_fpu16 #(
+                   .XLEN      (XLEN     ),
+                   .FP16_SIMD (FP16_SIMD)
+               ) cellrv32_cpu_cp_fpu16_lane1_inst (
+                   /* global control */
+                   .clk_i    (clk_i                                 ), // global clock, rising edge
+                   .rstn_i   (rstn_i                                ), // global reset, low-active, async
+                   .ctrl_i   (ctrl_i                                ), // main control bus
+                   .start_i  (cp_start[cp_sel_fpu16_c] & packed_op  ), // trigger operation
+                   /* data input */
+                   .cmp_i    (cmp                                   ), // comparator status
+                   .rs1_i    ({16'h0000, rs1_i[31:16]}              ), // rf source 1 (upper half)
+                   .rs2_i    ({16'h0000, rs2_i[31:16]}              ), // rf source 2 (upper half)
+                   .rs3_i    ({16'h0000, rs3_i[31:16]}              ), // rf source 3 (upper half)
+                   /* result and status */
+                   .res_o    (lane_res[1]                           ), // operation result
+                   .fflags_o (lane_flags[1]                         ), // exception flags
+                   .valid_o  (lane_valid[1]                         )  // data output valid
+               );
+
+               /* lane synchronization */
+               always_ff @(posedge clk_i or negedge rstn_i) begin : fpu16_lane_sync
+                   if (rstn_i == 1'b0) begin
+                       lane_done   <= '0;
+                       lane_buf[0] <= '0;
+                       lane_buf[1] <= '0;
+                       lane_fbuf   <= '0;
+                       simd_out    <= 1'b0;
+                   end else begin
+                       simd_out <= simd_valid & packed_op;
+                       if (cp_start[cp_sel_fpu16_c] == 1'b1) begin // new operation
+                           lane_done   <= '0;
+                           lane_buf[0] <= '0;
+                           lane_buf[1] <= '0;
+                           lane_fbuf   <= '0;
+                       end else begin
+                           lane_done   <= lane_done | lane_valid;
+                           // lane results/flags are zero unless they are valid
+                           lane_buf[0] <= lane_buf[0] | lane_res[0][15:0];
+                           lane_buf[1] <= lane_buf[1] | lane_res[1][15:0];
+                           lane_fbuf   <= lane_fbuf | lane_flags[0] | lane_flags[1];
+                       end
+                   end
+               end : fpu16_lane_sync
+
+               /* operation done: lane 0 only for scalar operations */
+               assign simd_valid = (|lane_valid) & (&(lane_done | lane_valid));
+               assign cp_valid[cp_sel_fpu16_c] = (packed_op == 1'b1) ? simd_valid : lane_valid[0];
+
+               /* result output: packed results are zero until all lanes are done */
+               assign cp_result[cp_sel_fpu16_c] = (packed_op == 1'b0) ? lane_res[0] :
+                                                  (simd_out  == 1'b1) ? {(lane_buf[1] | lane_res[1][15:0]), (lane_buf[0] | lane_res[0][15:0])} : '0;
+               assign fpu16_flags               = (packed_op == 1'b0) ? lane_flags[0] :
+                                                  (simd_out  == 1'b1) ? (lane_fbuf | lane_flags[0] | lane_flags[1]) : '0;
+           end : fpu16_simd_enabled
+
+           if (FP16_SIMD == 0) begin : fpu16_simd_disabled
+               assign lane_res[1]               = '0;
+               assign lane_flags[1]             = '0;
+               assign lane_valid[1]             = 1'b0;
+               assign cp_result[cp_sel_fpu16_c] = lane_res[0];
+               assign fpu16_flags               = lane_flags[0];
+               assign cp_valid[cp_sel_fpu16_c]  = lane_valid[0];
+           end : fpu16_simd_disabled
        end : cellrv32_cpu_cp_fpu16_inst_ON
     endgenerate
 
@@ -504,4 +646,35 @@ module cellrv32_cpu_alu #(
         end : cellrv32_cpu_cp_vector_inst_OFF
     endgenerate
 
+    // -------------------------------------------------------------------------------------------
+    // Co-Processor 8: Packed-SIMD DSP Unit ('Xpsimd', P Extension Subset) -----------------------
+    // -------------------------------------------------------------------------------------------
+    generate
+       if (PSIMD == 1) begin : cellrv32_cpu_cp_psimd_inst_ON
+           cellrv32_cpu_cp_psimd #(
+               .XLEN(XLEN)
+           ) cellrv32_cpu_cp_psimd_inst (
+               /* global control */
+               .clk_i   (clk_i                    ), // global clock, rising edge
+               .rstn_i  (rstn_i                   ), // global reset, low-active, async
+               .ctrl_i  (ctrl_i                   ), // main control bus
+               .start_i (cp_start[cp_sel_psimd_c] ), // trigger operation
+               /* data input */
+               .rs1_i   (rs1_i                    ), // rf source 1
+               .rs2_i   (rs2_i                    ), // rf source 2
+               .rs3_i   (rs3_i                    ), // rf source 3 (= rd, accumulator)
+               /* result and status */
+               .res_o   (cp_result[cp_sel_psimd_c]), // operation result
+               .valid_o (cp_valid[cp_sel_psimd_c] )  // data output valid
+           );
+       end : cellrv32_cpu_cp_psimd_inst_ON
+    endgenerate
+
+    generate
+       if (PSIMD == 0) begin : cellrv32_cpu_cp_psimd_inst_OFF
+           assign cp_result[cp_sel_psimd_c] = '0;
+           assign cp_valid[cp_sel_psimd_c]  = 1'b0;
+       end : cellrv32_cpu_cp_psimd_inst_OFF
+    endgenerate
+
 endmodule
@@ -0,0 +1,275 @@
+// ##################################################################################################
+// # << CELLRV32 - CPU Dynamic Branch Prediction Unit >>                                            #
+// # ********************************************************************************************** #
+// # Branch history table (BHT) with 2-bit saturating counters plus a direct-mapped branch target   #
+// # buffer (BTB). Both tables are indexed by the 32-bit-aligned address of the instruction fetch   #
+// # word that contains the *last* half-word of a branch/jump instruction.                          #
+// #                                                                                                #
+// # Lookup (fetch engine): combinatorial read using the current fetch address. A "taken"           #
+// # prediction is made if the BTB entry is valid, its tag matches and either the BHT counter is    #
+// # in one of the two "taken" states or the entry belongs to an unconditional jump. For 64-bit     #
+// # fetches both words are looked up; the first predicted-taken word is reported (lookup slot).    #
+// # Fetch words that end a hardware loop body are never predicted (the loop end has priority).     #
+// #                                                                                                #
+// # Check (execute engine): second combinatorial read port used to verify the predicted target of  #
+// # a predicted-taken branch/jump that is currently resolved.                                      #
+// #                                                                                                #
+// # Update (execute engine): counters are updated for every resolved (eligible) branch/jump; BTB   #
+// # entries are (re-)allocated for taken branches/jumps only. The whole BTB is invalidated by      #
+// # fence.i as the instruction stream might have been modified.                                    #
+// #                                                                                                #
+// # Return address stack (RAS, optional): calls push and returns pop a return address (RISC-V      #
+// # link register convention: rd/rs1 = x1/x5). A speculative copy is maintained by the fetch       #
+// # engine (BTB entries are tagged as call/return); the architectural copy is maintained by the    #
+// # execute engine when resolving jumps and is used to restore the speculative copy whenever the   #
+// # instruction fetch is restarted.                                                                #
+// # ********************************************************************************************** #
+`ifndef  _INCL_DEFINITIONS
+  `define _INCL_DEFINITIONS
+  import cellrv32_package::*;
+`endif // _INCL_DEFINITIONS
+
+module cellrv32_cpu_bp #(
+    parameter int XLEN        = 32, // data path width
+    parameter int BHT_ENTRIES = 64, // number of BHT entries, has to be a power of 2, min 2
+    parameter int BTB_ENTRIES = 16, // number of BTB entries, has to be a power of 2, min 2
+    parameter int RAS_DEPTH   = 0   // number of RAS entries, has to be zero or a power of 2, min 2
+) (
+    /* global control */
+    input  logic            clk_i,          // global clock, rising edge
+    input  logic            rstn_i,         // global reset, low-active, async
+    input  logic            clear_i,        // invalidate all BTB entries
+    input  logic            restore_i,      // instruction fetch restart: restore speculative RAS
+    /* lookup (instruction fetch) */
+    input  logic [XLEN-1:0] lookup_addr_i,  // fetch word address
+    input  logic            lookup_wide_i,  // 64-bit fetch: also look up next fetch word
+    input  logic            lookup_ack_i,   // fetched word is accepted
+    input  logic [1:0]      lookup_stop_i,  // fetch word i ends a hardware loop body: do not predict
+    output logic            lookup_taken_o, // predict: taken
+    output logic            lookup_slot_o,  // prediction belongs to: 0 = first word, 1 = second word
+    output logic [XLEN-1:0] lookup_target_o,// predicted target address
+    /* check (instruction execution) */
+    input  logic [XLEN-1:0] check_addr_i,   // fetch word address of branch/jump being resolved
+    output logic            check_hit_o,    // valid BTB entry for this address
+    output logic [XLEN-1:0] check_target_o, // according target address
+    /* update (instruction execution) */
+    input  logic            update_i,       // update prediction tables
+    input  logic            resolve_i,      // any branch/jump is being resolved
+    input  logic [XLEN-1:0] update_addr_i,  // fetch word address of branch/jump being resolved
+    input  logic            update_jump_i,  // unconditional jump
+    input  logic            update_call_i,  // call: push return address
+    input  logic            update_ret_i,   // return: pop return address
+    input  logic            update_taken_i, // branch taken / jump
+    input  logic [XLEN-1:0] update_target_i,// actual target address
+    input  logic [XLEN-1:0] update_link_i   // return address
+);
+    /* table geometry */
+    localparam int bht_idx_w_c = $clog2(BHT_ENTRIES);
+    localparam int btb_idx_w_c = $clog2(BTB_ENTRIES);
+    localparam int btb_tag_w_c = XLEN - (btb_idx_w_c + 2);
+    localparam int ras_size_c  = cond_sel_int_f((RAS_DEPTH > 1), RAS_DEPTH, 2);
+    localparam int ras_idx_w_c = $clog2(ras_size_c);
+
+    /* branch history table */
+    typedef logic [1:0] bht_t [0:BHT_ENTRIES-1];
+    bht_t bht;
+
+    /* branch target buffer */
+    typedef struct {
+        logic [BTB_ENTRIES-1:0] valid;                    // entry valid
+        logic [BTB_ENTRIES-1:0] jump;                     // entry belongs to unconditional jump
+        logic [BTB_ENTRIES-1:0] call;                     // entry belongs to a call (push return address)
+        logic [BTB_ENTRIES-1:0] ret;                      // entry belongs to a return (pop return address)
+        logic [btb_tag_w_c-1:0] tag    [0:BTB_ENTRIES-1]; // address tag
+        logic [XLEN-1:2]        target [0:BTB_ENTRIES-1]; // 32-bit-aligned target address
+    } btb_t;
+    //
+    btb_t btb;
+
+    /* return address stack */
+    typedef struct {
+        logic [XLEN-1:1]        stack [0:ras_size_c-1]; // return addresses
+        logic [ras_idx_w_c-1:0] ptr;                    // top-of-stack pointer
+        logic [ras_idx_w_c:0]   cnt;                    // number of valid entries
+    } ras_t;
+    //
+    ras_t ras_spec, ras_arch;
+
+    /* access */
+    logic [XLEN-1:0]        lookup_addr, lookup_addr2;
+    logic [bht_idx_w_c-1:0] lookup_bht_idx, update_bht_idx;
+    logic [btb_idx_w_c-1:0] lookup_btb_idx, update_btb_idx, check_btb_idx;
+    logic                   lookup_hit, lookup_taken, lookup_slot;
+    logic                   ras_spec_avail, ras_arch_avail;
+    logic [XLEN-1:0]        lookup_link;
+
+    // Branch History Table ----------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : bht_update
+        if (rstn_i == 1'b0) begin
+            for (int i = 0; i < BHT_ENTRIES; ++i) begin
+                bht[i] <= 2'b01; // weakly not-taken
+            end
+        end else if (update_i == 1'b1) begin
+            if ((update_taken_i == 1'b1) && (bht[update_bht_idx] != 2'b11)) begin
+                bht[update_bht_idx] <= bht[update_bht_idx] + 1'b1; // saturating increment
+            end else if ((update_taken_i == 1'b0) && (bht[update_bht_idx] != 2'b00)) begin
+                bht[update_bht_idx] <= bht[update_bht_idx] - 1'b1; // saturating decrement
+            end
+        end
+    end : bht_update
+
+    // Branch Target Buffer ----------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : btb_valid
+        if (rstn_i == 1'b0) begin
+            btb.valid <= '0;
+        end else if (clear_i == 1'b1) begin
+            btb.valid <= '0;
+        end else if ((update_i == 1'b1) && (update_taken_i == 1'b1)) begin
+            btb.valid[update_btb_idx] <= 1'b1;
+        end
+    end : btb_valid
+
+    /* tag & target memory - no reset required */
+    always_ff @( posedge clk_i ) begin : btb_update
+        if ((update_i == 1'b1) && (update_taken_i == 1'b1)) begin
+            btb.jump[update_btb_idx]   <= update_jump_i;
+            btb.call[update_btb_idx]   <= update_call_i & logic'(RAS_DEPTH > 0);
+            btb.ret[update_btb_idx]    <= update_ret_i  & logic'(RAS_DEPTH > 0);
+            btb.tag[update_btb_idx]    <= update_addr_i[XLEN-1 : btb_idx_w_c+2];
+            btb.target[update_btb_idx] <= update_target_i[XLEN-1:2];
+        end
+    end : btb_update
+
+    /* table indices */
+    assign lookup_bht_idx = lookup_addr[bht_idx_w_c+1 : 2];
+    assign update_bht_idx = update_addr_i[bht_idx_w_c+1 : 2];
+    assign lookup_btb_idx = lookup_addr[btb_idx_w_c+1 : 2];
+    assign update_btb_idx = update_addr_i[btb_idx_w_c+1 : 2];
+    assign check_btb_idx  = check_addr_i[btb_idx_w_c+1 : 2];
+
+    // Return Address Stack (RAS) ----------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    generate
+        if (RAS_DEPTH > 0) begin : ras_enabled
+
+            /* speculative stack - updated by instruction fetch */
+            always_ff @( posedge clk_i or negedge rstn_i ) begin : ras_spec_update
+                if (rstn_i == 1'b0) begin
+                    ras_spec.ptr <= '0;
+                    ras_spec.cnt <= '0;
+                end else if (restore_i == 1'b1) begin
+                    ras_spec <= ras_arch;
+                end else if ((lookup_ack_i == 1'b1) && (lookup_taken_o == 1'b1)) begin
+                    if (btb.call[lookup_btb_idx] == 1'b1) begin
+                        if (btb.ret[lookup_btb_idx] == 1'b1) begin // pop, then push: replace top
+                            ras_spec.stack[ras_spec.ptr] <= lookup_link[XLEN-1:1];
+                        end else begin // push
+                            ras_spec.stack[ras_spec.ptr + 1'b1] <= lookup_link[XLEN-1:1];
+                            ras_spec.ptr <= ras_spec.ptr + 1'b1;
+                            if (ras_spec.cnt != RAS_DEPTH) begin
+                                ras_spec.cnt <= ras_spec.cnt + 1'b1;
+                            end
+                        end
+                    end else if (btb.ret[lookup_btb_idx] == 1'b1) begin // pop
+                        ras_spec.ptr <= ras_spec.ptr - 1'b1;
+                        if (ras_spec.cnt != 0) begin
+                            ras_spec.cnt <= ras_spec.cnt - 1'b1;
+                        end
+                    end
+                end
+            end : ras_spec_update
+
+            /* architectural stack - updated by instruction execution */
+            always_ff @( posedge clk_i or negedge rstn_i ) begin : ras_arch_update
+                if (rstn_i == 1'b0) begin
+                    ras_arch.ptr <= '0;
+                    ras_arch.cnt <= '0;
+                end else if (resolve_i == 1'b1) begin
+                    if (update_call_i == 1'b1) begin
+                        if (update_ret_i == 1'b1) begin // pop, then push: replace top
+                            ras_arch.stack[ras_arch.ptr] <= update_link_i[XLEN-1:1];
+                        end else begin // push
+                            ras_arch.stack[ras_arch.ptr + 1'b1] <= update_link_i[XLEN-1:1];
+                            ras_arch.ptr <= ras_arch.ptr + 1'b1;
+                            if (ras_arch.cnt != RAS_DEPTH) begin
+                                ras_arch.cnt <= ras_arch.cnt + 1'b1;
+                            end
+                        end
+                    end else if (update_ret_i == 1'b1) begin // pop
+                        ras_arch.ptr <= ras_arch.ptr - 1'b1;
+                        if (ras_arch.cnt != 0) begin
+                            ras_arch.cnt <= ras_arch.cnt - 1'b1;
+                        end
+                    end
+                end
+            end : ras_arch_update
+
+            /* top of stack can be used as prediction? (non-empty and 32-bit-aligned) */
+            assign ras_spec_avail = (ras_spec.cnt != 0) && (ras_spec.stack[ras_spec.ptr][1] == 1'b0);
+            assign ras_arch_avail = (ras_arch.cnt != 0);
+
+        end : ras_enabled
+    endgenerate
+
+    generate
+        if (RAS_DEPTH == 0) begin : ras_disabled
+            assign ras_spec.ptr   = '0;
+            assign ras_spec.cnt   = '0;
+            assign ras_arch.ptr   = '0;
+            assign ras_arch.cnt   = '0;
+            assign ras_spec_avail = 1'b0;
+            assign ras_arch_avail = 1'b0;
+        end : ras_disabled
+    endgenerate
+
+    /* return address of a call that ends at the current fetch word */
+    assign lookup_link = {lookup_addr[XLEN-1:2] + 1'b1, 2'b00};
+
+    // Prediction --------------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    /* 64-bit fetch: use second word if the first one is not predicted taken */
+    assign lookup_addr2  = {lookup_addr_i[XLEN-1:2] + 1'b1, 2'b00};
+    always_comb begin : lookup_slot_select
+        logic [1:0] taken;
+        for (int i = 0; i < 2; ++i) begin
+            logic [XLEN-1:0]        addr;
+            logic [btb_idx_w_c-1:0] btb_idx;
+            logic [bht_idx_w_c-1:0] bht_idx;
+            addr     = (i == 0) ? lookup_addr_i : lookup_addr2;
+            btb_idx  = addr[btb_idx_w_c+1 : 2];
+            bht_idx  = addr[bht_idx_w_c+1 : 2];
+            taken[i] = (btb.valid[btb_idx] == 1'b1) && (btb.tag[btb_idx] == addr[XLEN-1 : btb_idx_w_c+2]) &&
+                       ((bht[bht_idx][1] == 1'b1) || (btb.jump[btb_idx] == 1'b1)) && (lookup_stop_i[i] == 1'b0);
+        end
+        lookup_slot = lookup_wide_i & (~lookup_stop_i[0]) & (~taken[0]) & taken[1]; // second word is dropped after a loop end
+    end : lookup_slot_select
+    assign lookup_addr   = (lookup_slot == 1'b1) ? lookup_addr2 : lookup_addr_i;
+    assign lookup_slot_o = lookup_slot;
+
+    assign lookup_hit   = (btb.valid[lookup_btb_idx] == 1'b1) && (btb.tag[lookup_btb_idx] == lookup_addr[XLEN-1 : btb_idx_w_c+2]);
+    assign lookup_taken = lookup_hit & (bht[lookup_bht_idx][1] | btb.jump[lookup_btb_idx]) & (~lookup_stop_i[lookup_slot]);
+
+    always_comb begin : prediction
+        lookup_taken_o  = lookup_taken;
+        lookup_target_o = {btb.target[lookup_btb_idx], 2'b00};
+        if ((RAS_DEPTH > 0) && (btb.ret[lookup_btb_idx] == 1'b1)) begin // return: use top of stack
+            if (ras_spec_avail == 1'b1) begin
+                lookup_target_o = {ras_spec.stack[ras_spec.ptr], 1'b0};
+            end else if (ras_spec.cnt != 0) begin // unaligned return address: cannot be predicted
+                lookup_taken_o = 1'b0;
+            end
+        end
+    end : prediction
+
+    /* verification of predicted target */
+    always_comb begin : check
+        check_hit_o    = (btb.valid[check_btb_idx] == 1'b1) && (btb.tag[check_btb_idx] == check_addr_i[XLEN-1 : btb_idx_w_c+2]);
+        check_target_o = {btb.target[check_btb_idx], 2'b00};
+        if ((RAS_DEPTH > 0) && (btb.ret[check_btb_idx] == 1'b1) && (ras_arch_avail == 1'b1)) begin
+            check_target_o = {ras_arch.stack[ras_arch.ptr], 1'b0};
+        end
+    end : check
+
+endmodule
@@ -2,6 +2,24 @@
 // # << CELLRV32 - (Data) Bus Interface Unit >>                                                     #
 // # ********************************************************************************************** #
 // # Data bus interface (load/store unit) and physical memory protection (PMP).                     #
+// #                                                                                                #
+// # The access type (funct3, load/store) is latched together with the address, so a pending load   #
+// # can complete while the CPU already executes subsequent instructions (non-blocking loads).      #
+// #                                                                                                #
+// # Optional store buffer (SB_DEPTH > 0): stores are retired as soon as they are written to the    #
+// # buffer and drained to the bus in the background. Loads wait until the buffer is empty unless   #
+// # the youngest buffered store to the same word provides all requested bytes (store-to-load       #
+// # forwarding, not for the IO region).                                                            #
+// #                                                                                                #
+// # Optional misaligned access support (MA_EN = 1): misaligned loads and stores do not raise an    #
+// # exception. Accesses that cross a word boundary are split into two aligned bus transactions.    #
+// #                                                                                                #
+// # Optional cache-block zero (CBZ_EN = 1, Zicboz): cbo.zero writes zero to the whole (naturally   #
+// # aligned) cbo_block_size_c block as back-to-back full-word writes that bypass the store buffer. #
+// # The CPU access completes with the response of the last word. Each word is checked by the PMP   #
+// # before it is written; a word without write permission aborts the block (store access fault).   #
+// # d_bus_zero_o marks the block writes so a data cache can allocate the block without a refill   #
+// # (only if the PMP cannot abort the sequence within a block, see PMP_MIN_GRANULARITY).           #
 // # ********************************************************************************************** #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
@@ -11,7 +29,10 @@
 module cellrv32_cpu_bus #(
     XLEN                = 32,  // data path width
     PMP_NUM_REGIONS     =  0,  // number of regions (0..16)
-    PMP_MIN_GRANULARITY =  4   // minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+    PMP_MIN_GRANULARITY =  4,  // minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+    SB_DEPTH            =  0,  // store buffer entries, has to be zero or a power of 2
+    MA_EN               =  0,  // implement hardware support for misaligned accesses
+    CBZ_EN              =  0   // implement cache-block zero operation (Zicboz)
 ) (
     /* global control */
     input  logic clk_i,       // global clock, rising edge
@@ -26,10 +47,13 @@ module cellrv32_cpu_bus #(
     output logic [XLEN-1:0] rdata_o, // read data
     output logic [XLEN-1:0] mar_o,   // current memory address register
     output logic d_wait_o ,  // wait for access to complete
+    output logic ld_ok_o,    // load request issued without alignment/PMP fault
     output logic ma_load_o,  // misaligned load data address
     output logic ma_store_o, // misaligned store data address
     output logic be_load_o,  // bus error on load data access
     output logic be_store_o, // bus error on store data access
+    output logic sb_empty_o, // store buffer is empty (all stores written to the bus)
+    output logic sb_err_o,   // bus error while draining the store buffer (imprecise)
     /* physical memory protection */
     input  logic [33:0] pmp_addr_i [15:0], // addresses
     input  logic [07:0] pmp_ctrl_i [15:0], // configs
@@ -51,6 +75,7 @@ module cellrv32_cpu_bus #(
     input  logic d_bus_ack_i,   // bus transfer acknowledge
     input  logic d_bus_err_i,   // bus transfer error
     output logic d_bus_fence_o, // fence operation
+    output logic d_bus_zero_o,  // write is part of a cache-block zero operation
     output logic d_bus_priv_o   // current effective privilege level
 );
 
@@ -69,6 +94,9 @@ module cellrv32_cpu_bus #(
     logic  data_sign;      // signed load
     logic  [XLEN-1:0] mar; // data memory address register
     logic misaligned;      // misaligned address
+    logic ma_cross;        // (misaligned) access crosses a word boundary
+    logic  [2:0] acc_funct3; // access size and sign of current access
+    logic  acc_store;        // current access is a store
 
     /* bus arbiter */
     typedef struct {
@@ -98,6 +126,77 @@ module cellrv32_cpu_bus #(
     //
     pmp_t pmp;
 
+    /* store buffer */
+    localparam int sb_size_c = cond_sel_int_f(SB_DEPTH > 0, SB_DEPTH, 1); // number of entries (at least one)
+    localparam int sb_idx_c  = cond_sel_int_f(SB_DEPTH > 1, $clog2(sb_size_c), 1); // entry index width
+    //
+    typedef struct {
+        logic [0:sb_size_c-1][XLEN-1:0]     addr; // buffered store: address
+        logic [0:sb_size_c-1][XLEN-1:0]     data; // buffered store: (lane-replicated) write data
+        logic [0:sb_size_c-1][(XLEN/8)-1:0] ben;  // buffered store: byte enable
+        logic [0:sb_size_c-1]               priv; // buffered store: effective privilege level
+        logic [sb_idx_c-1:0]   wp;       // write pointer
+        logic [sb_idx_c-1:0]   rp;       // read pointer (oldest entry)
+        logic [sb_idx_c:0]     level;    // number of buffered stores
+        logic                  req;      // CPU access active (new or on hold)
+        logic                  ok;       // CPU access without alignment/PMP fault
+        logic                  hold;     // CPU access has to wait (buffer full / not drained yet)
+        logic                  push;     // write store to buffer
+        logic                  fwd;      // load is served by the buffer
+        logic                  pop;      // buffered store has been written to the bus
+        logic                  ld;       // issue read request to bus
+        logic                  st;       // issue write request to bus (unbuffered store)
+        logic                  rd_pend;  // unbuffered CPU access pending on the bus
+        logic                  we;       // issue write request to bus
+        logic                  drain;    // buffered store pending on the bus
+        logic                  err;      // bus error while draining
+        logic [XLEN-1:0]       err_addr; // address of failed store
+        logic [(XLEN/8)-1:0]   ld_ben;   // bytes requested by load
+        logic                  fwd_hit;  // youngest store to the same word provides all requested bytes
+        logic [XLEN-1:0]       fwd_data; // forwarded data
+    } sbuf_t;
+    //
+    sbuf_t sb;
+    logic            cpu_ack;   // CPU access completed
+    logic [XLEN-1:0] rdata_raw; // read data (bus or store buffer)
+    logic [XLEN-1:0]     mo_wdata; // write data of CPU access
+    logic [(XLEN/8)-1:0] mo_ben;   // byte enable of CPU access
+
+    /* misaligned access: split into two aligned bus transactions */
+    typedef struct {
+        logic                phase;   // second transaction (next word)
+        logic                first;   // waiting for response of first transaction
+        logic                re;      // issue read request of second transaction
+        logic                we;      // issue write request of second transaction
+        logic                pmp_err; // PMP fault of second transaction
+        logic [XLEN-1:0]     addr;    // address of second transaction
+        logic [XLEN-1:0]     wdata;   // write data of second transaction
+        logic [(XLEN/8)-1:0] ben;     // byte enable of second transaction
+        logic [XLEN-1:0]     rdata;   // read data of first transaction
+    } mis_t;
+    //
+    mis_t ma;
+    logic [XLEN-1:0] rdata_algn; // read data, shifted to byte lane 0 if MA_EN
+    logic [1:0]      rdata_ofs;  // byte offset of read data
+    logic [XLEN-1:0] addr_pmp;   // address for PMP check
+    logic [XLEN-1:0] addr_pmp_ma; // address for PMP check of a (misaligned) load/store
+
+    /* cache-block zero: back-to-back full-word writes across the whole block */
+    localparam int cbz_cnt_c = $clog2(cbo_block_size_c/4); // word index width
+    //
+    typedef struct {
+        logic                 op;       // current access is a cbo.zero
+        logic                 more;     // waiting for response of a word that is not the last one
+        logic                 we;       // issue write request of next word
+        logic                 pmp_err;  // PMP fault of next word
+        logic [cbz_cnt_c-1:0] cnt;      // current word
+        logic [XLEN-1:0]      addr;     // address of current word
+        logic [XLEN-1:0]      addr_nxt; // address of next word (PMP check)
+    } cbz_t;
+    //
+    cbz_t cbz;
+    logic is_cbz; // cbo.zero in execution
+
     /* pmp faults */
     logic  if_pmp_fault; // pmp instruction access fault
     logic  ld_pmp_fault; // pmp load access fault
@@ -112,12 +211,16 @@ module cellrv32_cpu_bus #(
 
     assign is_vector = (ctrl_i.ir_opcode == opcode_vload_c || ctrl_i.ir_opcode == opcode_vstore_c) ? 1'b1 : 1'b0;
     assign addr_data = (is_vector == 1'b1) ? mem_req_i.address : addr_i;
+    assign is_cbz    = ((CBZ_EN == 1) && (ctrl_i.ir_opcode == opcode_fence_c)) ? 1'b1 : 1'b0; // only cbo.zero accesses memory
 
     // Access Address ----------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     always_ff @( posedge clk_i ) begin : mem_adr_reg
         if ((ctrl_i.bus_mo_we == 1'b1) || (req_valid_i == 1'b1)) begin
-            mar <= addr_data; // memory address register
+            mar        <= addr_data; // memory address register
+            acc_funct3 <= ctrl_i.ir_funct3;
+            acc_store  <= ctrl_i.ir_opcode[5] | is_cbz; // cbo.zero is a store
+            cbz.op     <= is_cbz;
             //
             unique case (ctrl_i.ir_funct3[1:0]) // alignment check
                 2'b00 : misaligned <= 1'b0; // byte
@@ -131,6 +234,22 @@ module cellrv32_cpu_bus #(
                     end
                 end
             endcase
+            //
+            ma_cross <= 1'b0;
+            if ((MA_EN == 1) && (is_vector == 1'b0)) begin // misaligned scalar accesses are handled in hardware
+                misaligned <= 1'b0;
+                unique case (ctrl_i.ir_funct3[1:0])
+                    2'b01   : ma_cross <= addr_data[1] & addr_data[0]; // half-word at byte 3
+                    2'b10   : ma_cross <= addr_data[1] | addr_data[0]; // word not at byte 0
+                    default : ma_cross <= 1'b0;
+                endcase
+            end
+            //
+            if (is_cbz == 1'b1) begin // cbo.zero: block-aligned full-word writes, never misaligned
+                mar[cbz_cnt_c+1 : 0] <= '0;
+                misaligned <= 1'b0;
+                ma_cross   <= 1'b0;
+            end
         end
         //
         vector_req_valid <= req_valid_i;
@@ -138,8 +257,7 @@ module cellrv32_cpu_bus #(
     end : mem_adr_reg
 
     /* address output */
-    assign d_bus_addr_o = mar;
-    assign mar_o        = mar; // for MTVAL CSR
+    assign mar_o = (sb.err == 1'b1) ? sb.err_addr : mar; // for MTVAL CSR
 
     // Write Data: Byte Enable and Alignment -----------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -148,40 +266,50 @@ module cellrv32_cpu_bus #(
         if (XLEN == 32) begin : mem_do_reg_rv32
             always_ff @( posedge clk_i ) begin : mem_do_reg
                 if ((ctrl_i.bus_mo_we == 1'b1) || (req_valid_i == 1'b1)) begin
-                    d_bus_ben_o <= '0; // default
+                    mo_ben <= '0; // default
                     //
                     // data size
                     if (is_vector == 1'b1) begin
-                        d_bus_wdata_o <= mem_req_i.data;
-                        d_bus_ben_o   <= '1; // full word
+                        mo_wdata <= mem_req_i.data;
+                        mo_ben   <= '1; // full word
+                    end else if (is_cbz == 1'b1) begin // cbo.zero
+                        mo_wdata <= '0;
+                        mo_ben   <= '1; // full word
+                    end else if (MA_EN == 1) begin // shift to byte lane(s); upper word is used if the access crosses a word boundary
+                        {ma.wdata, mo_wdata} <= {32'h0, wdata_i[31:0]} << {addr_data[1:0], 3'b000};
+                        unique case (ctrl_i.ir_funct3[1:0])
+                            2'b00   : {ma.ben, mo_ben} <= 8'b00000001 << addr_data[1:0]; // byte
+                            2'b01   : {ma.ben, mo_ben} <= 8'b00000011 << addr_data[1:0]; // half-word
+                            default : {ma.ben, mo_ben} <= 8'b00001111 << addr_data[1:0]; // word
+                        endcase
                     end else begin
                         unique case (ctrl_i.ir_funct3[1:0])
                             // byte
                             2'b00 : begin
                                 for (int i = 0; i < (XLEN/8); ++i) begin
-                                    d_bus_wdata_o[i*8 +: 8] <= wdata_i[7:0];
+                                    mo_wdata[i*8 +: 8] <= wdata_i[7:0];
                                 end
                                 //
-                                d_bus_ben_o[addr_data[1:0]] <= 1'b1;
+                                mo_ben[addr_data[1:0]] <= 1'b1;
                             end
                             // half-word
                             2'b01 : begin
                                 for (int i = 0; i < (XLEN/16); ++i) begin
-                                    d_bus_wdata_o[i*16 +: 16] <= wdata_i[15:0];
+                                    mo_wdata[i*16 +: 16] <= wdata_i[15:0];
                                 end
                                 //
                                 if (addr_data[1] == 1'b0) begin
-                                    d_bus_ben_o <= 4'b0011; // low half-word
+                                    mo_ben <= 4'b0011; // low half-word
                                 end else begin
-                                    d_bus_ben_o <= 4'b1100; // high half-word
+                                    mo_ben <= 4'b1100; // high half-word
                                 end
                             end
                             default: begin // word
                                 for (int i = 0; i < (XLEN/32); ++i) begin
-                                    d_bus_wdata_o[i*32 +: 32] <= wdata_i[31:0];
+                                    mo_wdata[i*32 +: 32] <= wdata_i[31:0];
                                 end
                                 //
-                                d_bus_ben_o <= '1; // full word
+                                mo_ben <= '1; // full word
                             end
                         endcase
                     end
@@ -203,44 +331,44 @@ module cellrv32_cpu_bus #(
     generate
         if (XLEN == 32) begin : mem_di_reg_rv32
             always_ff @( posedge clk_i ) begin : mem_di_reg
-                unique case (ctrl_i.ir_funct3[1:0])
+                unique case (acc_funct3[1:0])
                     // byte
                     2'b00 : begin
-                        unique case (mar[1:0])
+                        unique case (rdata_ofs)
                             // byte 0
                             2'b00 : begin
-                                rdata_o[07:00] <= d_bus_rdata_i[07:00];
-                                rdata_o[XLEN-1:08] <= (data_sign & d_bus_rdata_i[07]) ? '1 : '0; // sign extension
+                                rdata_o[07:00] <= rdata_algn[07:00];
+                                rdata_o[XLEN-1:08] <= (data_sign & rdata_algn[07]) ? '1 : '0; // sign extension
                             end
                             // byte 1
                             2'b01 : begin
-                                rdata_o[07:00] <= d_bus_rdata_i[15:08];
-                                rdata_o[XLEN-1:08] <= (data_sign & d_bus_rdata_i[15]) ? '1 : '0; // sign extension
+                                rdata_o[07:00] <= rdata_algn[15:08];
+                                rdata_o[XLEN-1:08] <= (data_sign & rdata_algn[15]) ? '1 : '0; // sign extension
                             end
                             // byte 2
                             2'b10 : begin
-                                rdata_o[07:00] <= d_bus_rdata_i[23:16];
-                                rdata_o[XLEN-1:08] <= (data_sign & d_bus_rdata_i[23]) ? '1 : '0; // sign extension
+                                rdata_o[07:00] <= rdata_algn[23:16];
+                                rdata_o[XLEN-1:08] <= (data_sign & rdata_algn[23]) ? '1 : '0; // sign extension
                             end
                             // byte 3
                             default: begin
-                                rdata_o[07:00] <= d_bus_rdata_i[31:24];
-                                rdata_o[XLEN-1:08] <= (data_sign & d_bus_rdata_i[31]) ? '1 : '0; // sign extension
+                                rdata_o[07:00] <= rdata_algn[31:24];
+                                rdata_o[XLEN-1:08] <= (data_sign & rdata_algn[31]) ? '1 : '0; // sign extension
                             end
                         endcase
                     end
                     // half-word
                     2'b01 : begin
-                        if (mar[1] == 1'b0) begin
-                            rdata_o[15:00] <= d_bus_rdata_i[15:00]; // low half-word
-                            rdata_o[XLEN-1:16] <= (data_sign & d_bus_rdata_i[15]) ? '1 : '0; // sign extension
+                        if (rdata_ofs[1] == 1'b0) begin
+                            rdata_o[15:00] <= rdata_algn[15:00]; // low half-word
+                            rdata_o[XLEN-1:16] <= (data_sign & rdata_algn[15]) ? '1 : '0; // sign extension
                         end else begin
-                            rdata_o[15:00] <= d_bus_rdata_i[31:16]; // high half-word
-                            rdata_o[XLEN-1:16] <= (data_sign & d_bus_rdata_i[31]) ? '1 : '0; // sign extension
+                            rdata_o[15:00] <= rdata_algn[31:16]; // high half-word
+                            rdata_o[XLEN-1:16] <= (data_sign & rdata_algn[31]) ? '1 : '0; // sign extension
                         end
                     end
                     default: begin // word
-                        rdata_o[XLEN-1:00] <= d_bus_rdata_i[XLEN-1:00]; // full word
+                        rdata_o[XLEN-1:00] <= rdata_algn[XLEN-1:00]; // full word
                     end
                 endcase
             end : mem_di_reg
@@ -255,7 +383,7 @@ module cellrv32_cpu_bus #(
     endgenerate
 
     /* sign extension */
-    assign data_sign = ~ctrl_i.ir_funct3[2]; // NOT unsigned LOAD (LBU, LHU)
+    assign data_sign = ~acc_funct3[2]; // NOT unsigned LOAD (LBU, LHU)
 
     // Access Arbiter ----------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -266,23 +394,28 @@ module cellrv32_cpu_bus #(
             arbiter.pmp_r_err <= 1'b0;
             arbiter.pmp_w_err <= 1'b0;
         end else begin
-            arbiter.pmp_r_err <= ld_pmp_fault;
-            arbiter.pmp_w_err <= st_pmp_fault;
-            //
             if (arbiter.pend == 1'b0) begin // idle
+                /* PMP faults are frozen once the access has started as the ALU output is not the access address anymore */
+                if (ctrl_i.bus_req == 1'b0) begin
+                    arbiter.pmp_r_err <= ld_pmp_fault;
+                    arbiter.pmp_w_err <= st_pmp_fault;
+                end
+                //
                 if (ctrl_i.bus_req == 1'b1) begin // start bus access
                     arbiter.pend <= 1'b1;
                 end
                 arbiter.err <= 1'b0;
             end else begin //  bus access in progress
                 /* accumulate bus errors */
-                if ((d_bus_err_i == 1'b1) || // bus error
-                   ((ctrl_i.ir_opcode[5] == 1'b1) && (arbiter.pmp_w_err == 1'b1)) || // PMP store fault
-                   ((ctrl_i.ir_opcode[5] == 1'b0) && (arbiter.pmp_r_err == 1'b1))) begin // PMP load fault
+                if (((d_bus_err_i == 1'b1) && (sb.drain == 1'b0)) || // bus error
+                   ((acc_store == 1'b1) && (arbiter.pmp_w_err == 1'b1)) || // PMP store fault
+                   ((acc_store == 1'b0) && (arbiter.pmp_r_err == 1'b1)) || // PMP load fault
+                   ((ma.phase  == 1'b1) && (ma.pmp_err        == 1'b1)) || // PMP fault of second transaction (misaligned access)
+                   (cbz.pmp_err == 1'b1)) begin // PMP fault of next word (cache-block zero)
                     arbiter.err <= 1'b1;
                 end
                 // wait for normal termination or start of trap handling
-                if ((d_bus_ack_i == 1'b1) || (ctrl_i.cpu_trap == 1'b1)) begin
+                if ((cpu_ack == 1'b1) || (ctrl_i.cpu_trap == 1'b1)) begin
                     arbiter.pend <= 1'b0;
                 end
             end
@@ -290,19 +423,31 @@ module cellrv32_cpu_bus #(
     end : data_access_arbiter
 
     /* wait for bus response */
-    assign d_wait_o = ~d_bus_ack_i;
+    assign d_wait_o = ~cpu_ack;
+
+    /* load request has been issued and can only fail by a bus error from now on (non-blocking loads) */
+    assign ld_ok_o = sb.ld;
 
     /* output data access error to controller */
-    assign ma_load_o  = ((arbiter.pend == 1'b1) && (ctrl_i.ir_opcode[5] == 1'b0) && (misaligned  == 1'b1)) ? 1'b1 : 1'b0;
-    assign be_load_o  = ((arbiter.pend == 1'b1) && (ctrl_i.ir_opcode[5] == 1'b0) && (arbiter.err == 1'b1)) ? 1'b1 : 1'b0;
-    assign ma_store_o = ((arbiter.pend == 1'b1) && (ctrl_i.ir_opcode[5] == 1'b1) && (misaligned  == 1'b1)) ? 1'b1 : 1'b0;
-    assign be_store_o = ((arbiter.pend == 1'b1) && (ctrl_i.ir_opcode[5] == 1'b1) && (arbiter.err == 1'b1)) ? 1'b1 : 1'b0;
+    assign ma_load_o  = ((arbiter.pend == 1'b1) && (acc_store == 1'b0) && (misaligned  == 1'b1)) ? 1'b1 : 1'b0;
+    assign be_load_o  = ((arbiter.pend == 1'b1) && (acc_store == 1'b0) && (arbiter.err == 1'b1)) ? 1'b1 : 1'b0;
+    assign ma_store_o = ((arbiter.pend == 1'b1) && (acc_store == 1'b1) && (misaligned  == 1'b1)) ? 1'b1 : 1'b0;
+    assign be_store_o = ((arbiter.pend == 1'b1) && (acc_store == 1'b1) && (arbiter.err == 1'b1)) ? 1'b1 : 1'b0;
 
     /* data bus control interface for both normal and vector (all source signals are driven by registers) */
-    assign d_bus_we_o    = (ctrl_i.bus_req | vector_req_valid) & ( ctrl_i.ir_opcode[5]) & (~misaligned) & (~arbiter.pmp_w_err);
-    assign d_bus_re_o    = (ctrl_i.bus_req | vector_req_valid) & (~ctrl_i.ir_opcode[5]) & (~misaligned) & (~arbiter.pmp_r_err);
+    assign d_bus_we_o    = sb.we | sb.st | ma.we | cbz.we | (vector_req_valid & ( ctrl_i.ir_opcode[5]) & (~misaligned) & (~arbiter.pmp_w_err));
+    assign d_bus_re_o    = sb.ld | ma.re | (vector_req_valid & (~ctrl_i.ir_opcode[5]) & (~misaligned) & (~arbiter.pmp_r_err));
     assign d_bus_fence_o = ctrl_i.bus_fence;
-    assign d_bus_priv_o  = ctrl_i.bus_priv;
+
+    /* address, data and privilege level of current bus access (buffered store or CPU access) */
+    assign d_bus_addr_o  = (sb.drain == 1'b1) ? sb.addr[sb.rp] : (ma.phase == 1'b1) ? ma.addr  : (cbz.op == 1'b1) ? cbz.addr : mar;
+    assign d_bus_wdata_o = (sb.drain == 1'b1) ? sb.data[sb.rp] : (ma.phase == 1'b1) ? ma.wdata : mo_wdata;
+    assign d_bus_ben_o   = (sb.drain == 1'b1) ? sb.ben[sb.rp]  : (ma.phase == 1'b1) ? ma.ben   : mo_ben;
+    assign d_bus_priv_o  = (sb.drain == 1'b1) ? sb.priv[sb.rp] : ctrl_i.bus_priv;
+
+    /* store buffer status */
+    assign sb_empty_o = (sb.level == 0) ? 1'b1 : 1'b0;
+    assign sb_err_o   = sb.err;
 
     /* vector request ticket and multi-access */
     assign d_bus_req_ticket_o = vector_req_ticket;
@@ -311,7 +456,286 @@ module cellrv32_cpu_bus #(
     /* vector memory response */
     assign mem_resp_o.data   = d_bus_rdata_i;
     assign mem_resp_o.ticket = d_bus_resp_ticket_i;
-    assign resp_valid_o      = d_bus_ack_i;
+    assign resp_valid_o      = d_bus_ack_i & (~sb.drain);
+
+    // Store Buffer ------------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] loads are never reordered with buffered stores: a load either gets all its bytes from the
+    // youngest buffered store to the same word or waits until the buffer has been drained. Bus errors
+    // of buffered stores are reported to the CPU as imprecise store access fault (see sb_err_o).
+    generate
+        if (SB_DEPTH > 0) begin : store_buffer_enabled
+            /* CPU access: write store to buffer, forward buffered data to load, or access bus directly */
+            assign sb.req  = ctrl_i.bus_req | sb.hold;
+            assign sb.ok   = (acc_store == 1'b1) ? ((~misaligned) & (~arbiter.pmp_w_err)) : ((~misaligned) & (~arbiter.pmp_r_err));
+            assign sb.push = sb.req & sb.ok & ( acc_store) & (~ma_cross) & (~cbz.op) & ((sb.level != SB_DEPTH) ? 1'b1 : 1'b0);
+            assign sb.st   = sb.req & sb.ok & ( acc_store) & ( ma_cross | cbz.op) & ((sb.level == 0) ? 1'b1 : 1'b0); // split store / block zero: bypass buffer
+            assign sb.fwd  = sb.req & sb.ok & (~acc_store) & sb.fwd_hit;
+            assign sb.ld   = sb.req & sb.ok & (~acc_store) & (~sb.fwd_hit) & ((sb.level == 0) ? 1'b1 : 1'b0);
+            assign sb.pop  = sb.drain & (d_bus_ack_i | d_bus_err_i);
+
+            /* CPU access done: bus response (not for a buffered store), store buffered or load forwarded */
+            assign cpu_ack   = (d_bus_ack_i & (~sb.drain) & (~ma.first) & (~cbz.more)) | sb.push | sb.fwd;
+            assign rdata_raw = (sb.fwd == 1'b1) ? sb.fwd_data : d_bus_rdata_i;
+
+            /* bytes requested by load */
+            always_comb begin : sb_load_ben
+                unique case (acc_funct3[1:0])
+                    2'b00   : sb.ld_ben = 4'b0001 << mar[1:0]; // byte
+                    2'b01   : sb.ld_ben = (mar[1] == 1'b0) ? 4'b0011 : 4'b1100; // half-word
+                    default : sb.ld_ben = '1; // word
+                endcase
+            end : sb_load_ben
+
+            /* store-to-load forwarding */
+            always_comb begin : sb_forward
+                logic [sb_idx_c-1:0] idx;
+                sb.fwd_hit  = 1'b0;
+                sb.fwd_data = '0;
+                for (int i = 0; i < SB_DEPTH; i++) begin // oldest to youngest: the youngest match wins
+                    idx = sb.rp + sb_idx_c'(i);
+                    if ((i < sb.level) && (sb.addr[idx][XLEN-1:2] == mar[XLEN-1:2])) begin
+                        sb.fwd_hit  = ((sb.ben[idx] & sb.ld_ben) == sb.ld_ben) ? 1'b1 : 1'b0;
+                        sb.fwd_data = sb.data[idx];
+                    end
+                end
+                if ((mar >= io_base_c) || (ma_cross == 1'b1)) begin // IO devices / split load: no forwarding, read from bus
+                    sb.fwd_hit = 1'b0;
+                end
+            end : sb_forward
+
+            /* buffer entries */
+            always_ff @( posedge clk_i ) begin : sb_data
+                if (sb.push == 1'b1) begin
+                    sb.addr[sb.wp] <= mar;
+                    sb.data[sb.wp] <= mo_wdata;
+                    sb.ben[sb.wp]  <= mo_ben;
+                    sb.priv[sb.wp] <= ctrl_i.bus_priv;
+                end
+                if ((sb.pop == 1'b1) && (d_bus_err_i == 1'b1) && (sb.err == 1'b0)) begin
+                    sb.err_addr <= sb.addr[sb.rp]; // first failed store
+                end
+            end : sb_data
+
+            /* buffer control */
+            always_ff @( posedge clk_i or negedge rstn_i ) begin : sb_ctrl
+                if (rstn_i == 1'b0) begin
+                    sb.wp      <= '0;
+                    sb.rp      <= '0;
+                    sb.level   <= '0;
+                    sb.hold    <= 1'b0;
+                    sb.rd_pend <= 1'b0;
+                    sb.we      <= 1'b0;
+                    sb.drain   <= 1'b0;
+                    sb.err     <= 1'b0;
+                end else begin
+                    /* CPU access has to wait (buffer full or not drained yet); aborted by trap */
+                    sb.hold <= sb.req & sb.ok & (~(sb.push | sb.fwd | sb.ld | sb.st)) & (~ctrl_i.cpu_trap);
+                    //
+                    /* unbuffered CPU access pending on the bus */
+                    if ((sb.ld == 1'b1) || (sb.st == 1'b1)) begin
+                        sb.rd_pend <= 1'b1;
+                    end else if (((d_bus_ack_i == 1'b1) && (ma.first == 1'b0) && (cbz.more == 1'b0)) || (d_bus_err_i == 1'b1) || (ctrl_i.cpu_trap == 1'b1)) begin
+                        sb.rd_pend <= 1'b0;
+                    end
+                    //
+                    /* drain: write oldest entry to bus */
+                    sb.we <= 1'b0;
+                    if (sb.drain == 1'b0) begin
+                        if ((sb.level != 0) && (sb.rd_pend == 1'b0)) begin
+                            sb.we    <= 1'b1;
+                            sb.drain <= 1'b1;
+                        end
+                    end else if (sb.pop == 1'b1) begin
+                        sb.drain <= 1'b0;
+                    end
+                    //
+                    /* pointers and fill level */
+                    if ((sb.push == 1'b1) && (SB_DEPTH > 1)) begin
+                        sb.wp <= sb.wp + 1'b1;
+                    end
+                    if ((sb.pop == 1'b1) && (SB_DEPTH > 1)) begin
+                        sb.rp <= sb.rp + 1'b1;
+                    end
+                    if ((sb.push == 1'b1) && (sb.pop == 1'b0)) begin
+                        sb.level <= sb.level + 1'b1;
+                    end else if ((sb.push == 1'b0) && (sb.pop == 1'b1)) begin
+                        sb.level <= sb.level - 1'b1;
+                    end
+                    //
+                    /* imprecise bus error: cleared when the CPU starts the trap handler */
+                    if (ctrl_i.cpu_trap == 1'b1) begin
+                        sb.err <= 1'b0;
+                    end else if ((sb.pop == 1'b1) && (d_bus_err_i == 1'b1)) begin
+                        sb.err <= 1'b1;
+                    end
+                end
+            end : sb_ctrl
+        end : store_buffer_enabled
+    endgenerate
+
+    generate
+        if (SB_DEPTH == 0) begin : store_buffer_disabled
+            /* direct bus access */
+            assign sb.req      = ctrl_i.bus_req;
+            assign sb.ok       = 1'b1;
+            assign sb.we       = ctrl_i.bus_req & ( acc_store) & (~misaligned) & (~arbiter.pmp_w_err);
+            assign sb.ld       = ctrl_i.bus_req & (~acc_store) & (~misaligned) & (~arbiter.pmp_r_err);
+            assign sb.st       = 1'b0;
+            assign cpu_ack     = d_bus_ack_i & (~ma.first) & (~cbz.more);
+            assign rdata_raw   = d_bus_rdata_i;
+            //
+            assign sb.addr     = '0;
+            assign sb.data     = '0;
+            assign sb.ben      = '0;
+            assign sb.priv     = '0;
+            assign sb.wp       = '0;
+            assign sb.rp       = '0;
+            assign sb.level    = '0;
+            assign sb.hold     = 1'b0;
+            assign sb.push     = 1'b0;
+            assign sb.fwd      = 1'b0;
+            assign sb.pop      = 1'b0;
+            assign sb.rd_pend  = 1'b0;
+            assign sb.drain    = 1'b0;
+            assign sb.err      = 1'b0;
+            assign sb.err_addr = '0;
+            assign sb.ld_ben   = '0;
+            assign sb.fwd_hit  = 1'b0;
+            assign sb.fwd_data = '0;
+        end : store_buffer_disabled
+    endgenerate
+
+    // Misaligned Access Support ---------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] an access that crosses a word boundary is split into two aligned bus transactions (first word and next
+    // word); the read data of both is merged before alignment/sign-extension. The PMP check of the second word is done
+    // while the first transaction is pending. The two transactions are not atomic: a fault of the second word does
+    // not undo a store to the first word.
+    generate
+        if (MA_EN == 1) begin : misaligned_enabled
+            /* access control */
+            always_ff @( posedge clk_i or negedge rstn_i ) begin : ma_ctrl
+                if (rstn_i == 1'b0) begin
+                    ma.phase   <= 1'b0;
+                    ma.re      <= 1'b0;
+                    ma.we      <= 1'b0;
+                    ma.pmp_err <= 1'b0;
+                    ma.rdata   <= '0;
+                end else begin
+                    ma.re <= 1'b0;
+                    ma.we <= 1'b0;
+                    if (ma.phase == 1'b0) begin
+                        if ((ma.first == 1'b1) && (d_bus_ack_i == 1'b1) && (sb.drain == 1'b0)) begin // first word done
+                            ma.phase   <= 1'b1;
+                            ma.rdata   <= d_bus_rdata_i;
+                            ma.pmp_err <= (acc_store == 1'b1) ? st_pmp_fault : ld_pmp_fault;
+                            ma.re      <= (~acc_store) & (~((acc_store == 1'b1) ? st_pmp_fault : ld_pmp_fault));
+                            ma.we      <= ( acc_store) & (~((acc_store == 1'b1) ? st_pmp_fault : ld_pmp_fault));
+                        end
+                    end else if ((cpu_ack == 1'b1) || (ctrl_i.cpu_trap == 1'b1)) begin // second word done or aborted
+                        ma.phase   <= 1'b0;
+                        ma.pmp_err <= 1'b0;
+                    end
+                end
+            end : ma_ctrl
+
+            /* first transaction of a split access in progress */
+            assign ma.first = ma_cross & (~ma.phase) & arbiter.pend;
+
+            /* second transaction: next word */
+            assign ma.addr = {mar[XLEN-1:2] + 1'b1, 2'b00};
+
+            /* PMP: check next word while the first transaction is pending */
+            assign addr_pmp_ma = ((ma_cross == 1'b1) && (arbiter.pend == 1'b1)) ? ma.addr : addr_data;
+
+            /* merge read data and shift to byte lane 0 */
+            always_comb begin : ma_rdata
+                logic [(2*XLEN)-1:0] tmp;
+                if (ma.phase == 1'b1) begin
+                    tmp = {rdata_raw, ma.rdata};
+                end else begin
+                    tmp = {{XLEN{1'b0}}, rdata_raw};
+                end
+                tmp        = tmp >> {mar[1:0], 3'b000};
+                rdata_algn = tmp[XLEN-1:0];
+            end : ma_rdata
+            assign rdata_ofs = 2'b00;
+        end : misaligned_enabled
+    endgenerate
+
+    generate
+        if (MA_EN == 0) begin : misaligned_disabled
+            assign ma.phase   = 1'b0;
+            assign ma.first   = 1'b0;
+            assign ma.re      = 1'b0;
+            assign ma.we      = 1'b0;
+            assign ma.pmp_err = 1'b0;
+            assign ma.addr    = '0;
+            assign ma.rdata   = '0;
+            assign addr_pmp_ma = addr_data;
+            assign rdata_algn  = rdata_raw;
+            assign rdata_ofs  = mar[1:0];
+        end : misaligned_disabled
+    endgenerate
+
+    // Cache-Block Zero (Zicboz) -----------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] the first word is written like a normal (unbuffered) store; each following word is requested as soon as
+    // the previous one has been acknowledged. Like the second word of a misaligned access, the PMP check of the next
+    // word is done while the current one is pending (the first word is checked before the access starts). A PMP fault
+    // or bus error aborts the sequence (store access fault), the words that have already been written are not restored.
+    generate
+        if (CBZ_EN == 1) begin : cbo_zero_enabled
+            always_ff @( posedge clk_i or negedge rstn_i ) begin : cbz_ctrl
+                if (rstn_i == 1'b0) begin
+                    cbz.we      <= 1'b0;
+                    cbz.pmp_err <= 1'b0;
+                    cbz.cnt     <= '0;
+                end else begin
+                    cbz.we <= 1'b0;
+                    if ((cbz.more == 1'b1) && (cbz.pmp_err == 1'b0) && (d_bus_ack_i == 1'b1) && (sb.drain == 1'b0)) begin // word done
+                        if (st_pmp_fault == 1'b1) begin // no write permission for next word: abort
+                            cbz.pmp_err <= 1'b1;
+                        end else begin // write next word
+                            cbz.we  <= 1'b1;
+                            cbz.cnt <= cbz.cnt + 1'b1;
+                        end
+                    end else if ((cpu_ack == 1'b1) || (ctrl_i.cpu_trap == 1'b1)) begin // block done or aborted
+                        cbz.pmp_err <= 1'b0;
+                        cbz.cnt     <= '0;
+                    end
+                end
+            end : cbz_ctrl
+
+            /* block write in progress and current word is not the last one */
+            assign cbz.more = cbz.op & arbiter.pend & ((&cbz.cnt) ? 1'b0 : 1'b1);
+
+            /* address of current and next word */
+            assign cbz.addr     = {mar[XLEN-1 : cbz_cnt_c+2], cbz.cnt,        2'b00};
+            assign cbz.addr_nxt = {mar[XLEN-1 : cbz_cnt_c+2], cbz.cnt + 1'b1, 2'b00};
+
+            /* block writes can be allocated without refill if the sequence cannot be aborted by the PMP within a block */
+            assign d_bus_zero_o = ((PMP_NUM_REGIONS == 0) || (PMP_MIN_GRANULARITY >= cbo_block_size_c)) ? (cbz.op & (~sb.drain)) : 1'b0;
+
+            /* PMP: first word of the block before the access starts, next word while the current one is pending */
+            assign addr_pmp = ((cbz.op == 1'b1) && (arbiter.pend == 1'b1)) ? cbz.addr_nxt :
+                              (is_cbz == 1'b1) ? {addr_data[XLEN-1 : cbz_cnt_c+2], {(cbz_cnt_c+2){1'b0}}} : addr_pmp_ma;
+        end : cbo_zero_enabled
+    endgenerate
+
+    generate
+        if (CBZ_EN == 0) begin : cbo_zero_disabled
+            assign cbz.more     = 1'b0;
+            assign cbz.we       = 1'b0;
+            assign cbz.pmp_err  = 1'b0;
+            assign cbz.cnt      = '0;
+            assign cbz.addr     = '0;
+            assign cbz.addr_nxt = '0;
+            assign addr_pmp     = addr_pmp_ma;
+            assign d_bus_zero_o = 1'b0;
+        end : cbo_zero_disabled
+    endgenerate
 
     // RISC-V Physical Memory Protection (PMP) ---------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -327,8 +751,8 @@ module cellrv32_cpu_bus #(
             end else begin // use previous entry as base and current entry as bound
                 pmp.i_cmp_ge[r] = (fetch_pc_i[XLEN-1 : pmp_lsb_c] >= pmp_addr_i[r-1][XLEN-1 : pmp_lsb_c]);
                 pmp.i_cmp_lt[r] = (fetch_pc_i[XLEN-1 : pmp_lsb_c] <  pmp_addr_i[r-0][XLEN-1 : pmp_lsb_c]);
-                pmp.d_cmp_ge[r] = ( addr_data[XLEN-1 : pmp_lsb_c] >= pmp_addr_i[r-1][XLEN-1 : pmp_lsb_c]);
-                pmp.d_cmp_lt[r] = ( addr_data[XLEN-1 : pmp_lsb_c] <  pmp_addr_i[r-0][XLEN-1 : pmp_lsb_c]);
+                pmp.d_cmp_ge[r] = (  addr_pmp[XLEN-1 : pmp_lsb_c] >= pmp_addr_i[r-1][XLEN-1 : pmp_lsb_c]);
+                pmp.d_cmp_lt[r] = (  addr_pmp[XLEN-1 : pmp_lsb_c] <  pmp_addr_i[r-0][XLEN-1 : pmp_lsb_c]);
             end
         end
     end : pmp_check_address
@@ -31,21 +31,46 @@ module cellrv32_cpu_control #(
     parameter CPU_EXTENSION_RISCV_M        = 0, // implement mul/div extension?
     parameter CPU_EXTENSION_RISCV_U        = 0, // implement user mode extension?
     parameter CPU_EXTENSION_RISCV_V        = 0, // implement vector extension?
+    parameter CPU_EXTENSION_RISCV_Zcmp     = 0, // implement compressed push/pop/move extension?
+    parameter CPU_EXTENSION_RISCV_Zcmt     = 0, // implement compressed table-jump extension?
     parameter CPU_EXTENSION_RISCV_Zfinx    = 0, // implement 32-bit floating-point extension (using INT reg!)
     parameter CPU_EXTENSION_RISCV_Zhinx    = 0, // implement 16-bit floating-point extension (using INT reg!)
     parameter CPU_EXTENSION_RISCV_Zicsr    = 0, // implement CSR system?
     parameter CPU_EXTENSION_RISCV_Zicntr   = 0, // implement base counters?
     parameter CPU_EXTENSION_RISCV_Zihpm    = 0, // implement hardware performance monitors?
     parameter CPU_EXTENSION_RISCV_Zifencei = 0, // implement instruction stream sync.?
+    parameter CPU_EXTENSION_RISCV_Zkn      = 0, // implement scalar cryptography (NIST suite) extension?
     parameter CPU_EXTENSION_RISCV_Zmmul    = 0, // implement multiply-only M sub-extension?
     parameter CPU_EXTENSION_RISCV_Zxcfu    = 0, // implement custom (instr.) functions unit?
     parameter CPU_EXTENSION_RISCV_Zicond   = 0, // implement conditional operations extension?
+    parameter CPU_EXTENSION_RISCV_Zicbop   = 0, // implement cache-block prefetch hints?
+    parameter CPU_EXTENSION_RISCV_Zicboz   = 0, // implement cache-block zero operation?
     parameter CPU_EXTENSION_RISCV_Sdext    = 0, // implement external debug mode extension?
     parameter CPU_EXTENSION_RISCV_Sdtrig   = 0, // implement trigger module extension?
+    parameter CPU_EXTENSION_RISCV_Sscofpmf = 0, // implement HPM counter-overflow interrupt extension?
     /* Tuning Options */
     parameter FAST_MUL_EN                  = 0, // use DSPs for M extension's multiplier
     parameter FAST_SHIFT_EN                = 0, // use barrel shifter for shift operations
+    parameter MULDIV_PERF                  = 0, // pipelined DSP multiplier + radix-4 early-out divider
+    parameter FPU_PERF                     = 0, // barrel-shift FPU normalizer/aligner + fused multiply-add (Zfinx)
     parameter CPU_IPB_ENTRIES              = 1, // entries in instruction prefetch buffer, has to be a power of 2, min 1
+    parameter CPU_BP_EN                    = 0, // implement dynamic branch prediction (BHT + BTB)?
+    parameter CPU_BP_BHT_ENTRIES           = 64,// branch history table entries, has to be a power of 2, min 2
+    parameter CPU_BP_BTB_ENTRIES           = 16,// branch target buffer entries, has to be a power of 2, min 2
+    parameter CPU_BP_RAS_DEPTH             = 4, // return address stack entries, has to be zero or a power of 2, min 2
+    parameter CPU_PIPELINE_MODE            = 0, // overlap dispatch of next instruction with write-back of single-cycle ALU operations?
+    parameter CPU_DUAL_ISSUE               = 0, // issue two independent simple ALU operations at once?
+    parameter CPU_FETCH_64BIT              = 0, // accept two instruction words per fetch (64-bit fetch path)?
+    parameter logic [4:0] CPU_FUSION       = 0, // macro-op fusion: per-pattern enable (see fusion_*_c)
+    parameter CPU_HWLOOP                   = 0, // implement zero-overhead hardware loops (two nested loop contexts)?
+    parameter CPU_FP16_SIMD                = 0, // implement packed-SIMD 2x FP16 operations + half-precision FMA (Zhinx)?
+    parameter CPU_PSIMD                    = 0, // implement packed-SIMD integer DSP operations (P extension subset)?
+    parameter CPU_NB_LOAD                  = 0, // continue execution of independent instructions while a load is pending?
+    parameter CPU_SB_DEPTH                 = 0, // store buffer entries, has to be zero or a power of 2
+    parameter CPU_MISALIGNED               = 0, // implement hardware support for misaligned loads/stores?
+    parameter CPU_IRQ_VECTORED             = 0, // vectored interrupts with priority/preemption levels and tail-chaining?
+    parameter CPU_RF_SHADOW                = 0, // shadow register bank for caller-saved registers (fast interrupt entry)?
+    parameter CPU_ICACHE_CTRL              = 0, // implement i-cache control CSRs (way locking, block preload)?
     /* Physical memory protection (PMP) */
     parameter PMP_NUM_REGIONS              = 0, // number of regions (0..16)
     parameter PMP_MIN_GRANULARITY          = 0, // minimal region granularity in bytes, has to be a power of 2, min 4 bytes
@@ -63,21 +88,41 @@ module cellrv32_cpu_control #(
     output logic            i_bus_re_o,    // read enable
     input  logic            i_bus_ack_i,   // bus transfer acknowledge
     input  logic            i_bus_err_i,   // bus transfer error
+    input  logic [31:0]     i_bus_rdata2_i,// bus read data of next sequential word (64-bit fetch)
+    input  logic            i_bus_wide_i,  // next sequential word is valid (64-bit fetch)
     input  logic            i_pmp_fault_i, // instruction fetch pmp fault
     /* status input */
     input logic alu_cp_done_i, // ALU iterative operation done
     input logic alu_exc_i,     // ALU exception
     input logic bus_d_wait_i,  // wait for bus
+    input logic bus_ld_ok_i,   // load request issued without alignment/PMP fault
+    input logic bus_sb_empty_i,// store buffer is empty
+    input logic bus_sb_err_i,  // bus error while draining the store buffer
+    input logic vec_stall_i,   // vector unit memory request waiting for grant
+    input logic [hpm_ext_width_c-1:0] hpm_ext_i, // SoC-level HPM events (caches, bus switch, XIP)
+    input logic ic_busy_i,     // i-cache block preload pending
     /* data input */
     input logic [1:0]      cmp_i,     // comparator status
     input logic [XLEN-1:0] alu_add_i, // ALU address result
     input logic [XLEN-1:0] rs1_i,     // rf source 1
     input logic [XLEN-1:0] rs2_i,     // rf source 2
+    input logic [XLEN-1:0] mem_i,     // memory read data (Zcmt jump table entry)
     /* data output */
     output logic [XLEN-1:0] imm_o,       // immediate
+    output logic [XLEN-1:0] imm2_o,      // immediate of second issue slot
     output logic [XLEN-1:0] curr_pc_o,   // current PC (corresponding to current instruction)
     output logic [XLEN-1:0] next_pc_o,   // next PC (corresponding to next instruction)
     output logic [XLEN-1:0] csr_rdata_o, // CSR read data
+    output trace_port_t     trace_o,     // instruction trace port
+    /* i-cache control */
+    output logic [7:0]      ic_lock_o,      // locked ways
+    output logic [2:0]      ic_way_o,       // preload target way
+    output logic            ic_fill_o,      // block preload request
+    output logic [XLEN-1:0] ic_fill_addr_o, // preload address
+    output logic            ic_hint_o,      // preload is a prefetch hint (no forced way, dropped if busy)
+    /* d-cache prefetch hint */
+    output logic            dc_pref_o,      // prefetch.r/prefetch.w hint
+    output logic [XLEN-1:0] dc_pref_addr_o, // hint address
     /* FPU interface */
     input logic [4:0] fpu_flags_i, // exception flags
     /* debug mode (halt) request */
@@ -102,6 +147,9 @@ module cellrv32_cpu_control #(
     localparam int hpm_cnt_lo_width_c = cond_sel_int_f((HPM_CNT_WIDTH < 32), HPM_CNT_WIDTH, 32);
     localparam int hpm_cnt_hi_width_c = cond_sel_int_f((HPM_CNT_WIDTH > 32), HPM_CNT_WIDTH-32, 0);
 
+    /* implemented interrupt sources (by mcause ID): MSI, MTI, MEI, LCOFI (Sscofpmf), FIRQ 0..15 */
+    localparam logic [31:0] irq_id_impl_c = 32'hffff0888 | ((CPU_EXTENSION_RISCV_Sscofpmf != 0) ? 32'h00002000 : 32'h0);
+
     /* instruction fetch engine */
     typedef enum logic[1:0] { IF_RESTART, 
                               IF_REQUEST, 
@@ -119,12 +167,14 @@ module cellrv32_cpu_control #(
         logic resp;    // bus response
         logic a_err;   // alignment error
         logic pmp_err; // PMP error
+        logic wide_rsp;// 64-bit fetch: bus response provides two words and IPB can take them
+        logic wide;    // 64-bit fetch: write both words to IPB
     } fetch_engine_t;
     //
     fetch_engine_t fetch_engine;
 
     /* instruction prefetch buffer (FIFO) interface */
-    typedef logic [0:1][(2+16)-1:0] ipb_data_t;
+    typedef logic [0:1][(5+16)-1:0] ipb_data_t; // hardware-loop end (2) + predicted-taken + bus error + alignment error + half-word
     //
     typedef struct packed {
         ipb_data_t  wdata;
@@ -133,6 +183,12 @@ module cellrv32_cpu_control #(
         ipb_data_t  rdata;
         logic [1:0] re;    // read enable
         logic [1:0] avail; // data available?
+        ipb_data_t  rdata2; // next entry (dual-issue only)
+        logic [1:0] re2;    // read two entries at once (dual-issue only)
+        logic [1:0] avail2; // at least two entries available? (dual-issue only)
+        ipb_data_t  wdata2; // next entry (64-bit fetch only)
+        logic [1:0] we2;    // write two entries at once (64-bit fetch only)
+        logic [1:0] free2;  // at least two free entries available? (64-bit fetch only)
     } ipb_t;
     //
     ipb_t ipb;
@@ -145,22 +201,143 @@ module cellrv32_cpu_control #(
         logic [15:0] ci_i16;
         logic [31:0] ci_i32;
         logic ci_ill;
-        logic [(4+32)-1:0] data; // 4-bit status + 32-bit instruction
+        logic [(7+32)-1:0] data; // 7-bit status + 32-bit instruction
         logic [1:0]        valid; // data word is valid when != 0
+        logic              hold;  // next instruction must not be dispatched yet
     } issue_engine_t;
     //
     issue_engine_t issue_engine;
 
+    /* dual-issue: second issue slot for simple single-cycle ALU operations */
+    typedef struct {
+        logic        pair;    // issue: IPB head and next instruction can be issued together
+        logic        dsp;     // execute: dispatch both instructions
+        logic [31:0] instr;   // issue: next instruction word from IPB
+        logic [31:0] i_reg;   // execute: second instruction word
+        logic        valid;   // execute: second issue slot is occupied (EXECUTE state only)
+        logic [2:0]  alu_op;  // execute: second slot ALU operation
+        logic        opb_mux; // execute: second slot ALU operand B = immediate
+    } dual_t;
+    //
+    dual_t dual;
+
+    /* macro-op fusion: two adjacent instructions executed as one operation */
+    typedef struct {
+        logic [31:0]     instr;   // issue: next instruction word from IPB
+        logic            pair;    // issue: IPB head and next instruction can be fused
+        logic [31:0]     i_reg;   // issue: synthesized (fused) instruction word
+        logic [XLEN-1:0] imm_nxt; // issue: fused immediate
+        logic            rr_nxt;  // issue: register-register address computation (indexed load)
+        logic [1:0]      sh_nxt;  // issue: operand A shift amount (shift-add)
+        logic            dsp;     // execute: dispatch fused instruction
+        logic            valid;   // execute: current instruction is a fused pair (EXECUTE state only)
+        logic [XLEN-1:0] imm;     // execute: fused immediate
+        logic            rr;      // execute: use RS2 instead of IMM for address computation
+        logic [1:0]      sh;      // execute: operand A shift amount
+    } fuse_t;
+    //
+    fuse_t fuse;
+
+    /* dynamic branch prediction */
+    typedef struct {
+        logic            taken;        // fetch: predict taken
+        logic            slot;         // fetch: prediction belongs to second word (64-bit fetch)
+        logic [XLEN-1:0] target;       // fetch: predicted target
+        logic            check_hit;    // execute: BTB entry available for current branch
+        logic [XLEN-1:0] check_target; // execute: BTB target for current branch
+        logic [XLEN-1:0] addr;         // execute: fetch word address of current branch
+        logic            eligible;     // execute: branch can be handled by the predictor
+        logic            update;       // execute: update predictor
+        logic            resolve;      // execute: resolving a (legal) branch/jump
+        logic            call;         // execute: current jump is a call (link register destination)
+        logic            ret;          // execute: current jump is a return (link register source)
+        logic            hit;          // execute: correctly predicted taken branch/jump
+    } bp_t;
+    //
+    bp_t bp;
+
+    /* hardware loops: two nested loop contexts (context 0 = inner loop) */
+    typedef struct {
+        logic [0:1][XLEN-1:0] start;    // loop body start address (32-bit aligned)
+        logic [0:1][XLEN-1:0] stop;     // address right after the loop body (32-bit aligned)
+        logic [0:1][XLEN-1:0] cnt;      // remaining iterations (architectural)
+        logic [0:1][XLEN-1:0] fcnt;     // fetch: remaining iterations (speculative, re-synchronized on fetch restart)
+        logic [1:0]           f_end;    // fetch: fetch word i (64-bit fetch) ends an active loop body, not predicted
+        logic [1:0]           f_dec;    // fetch: fetched word ends the body of loop context i
+        logic                 f_cut;    // fetch: first word ends a loop body, drop second word (64-bit fetch)
+        logic                 f_wrap;   // fetch: continue at loop start
+        logic [XLEN-1:0]      f_target; // fetch: loop start address
+        logic [1:0]           dec;      // execute: current instruction ends the body of loop context i
+        logic                 wrap;     // execute: current instruction jumps back to loop start
+        logic [XLEN-1:0]      target;   // execute: loop start address
+        logic                 commit;   // execute: loop-end instruction completes without change of control flow
+        logic                 jump;     // execute: PC <= loop start
+    } hwlp_t;
+    //
+    hwlp_t hwlp;
+
+    /* non-blocking loads: register scoreboard for a single outstanding load */
+    typedef struct {
+        logic            rel;   // execute: release current load, continue without waiting for the bus response
+        logic            pend;  // load is waiting for the bus response
+        logic            wb;    // late register file write-back of the load data
+        logic            busy;  // load outstanding (pending or writing back)
+        logic            err;   // outstanding load has been terminated by a bus error (imprecise exception)
+        logic [4:0]      rd;    // destination register of the outstanding load
+        logic [XLEN-1:0] pc;    // address of the outstanding load instruction (for xEPC)
+        logic            stall; // issue: next instruction has to wait for the outstanding load
+    } nbld_t;
+    //
+    nbld_t nbld;
+
+    /* Zcmp/Zcmt: micro-sequencer for compressed push/pop/move and table-jump macro-operations */
+    typedef struct {
+        logic            start;    // execute: start micro-sequence of the current macro-operation
+        logic            busy;     // micro-sequence in progress: dispatch micro-ops instead of new instructions
+        logic [15:0]     instr;    // compressed macro-operation
+        logic [4:0]      cnt;      // micro-op index
+        logic [31:0]     uop;      // next micro-op (32-bit instruction word)
+        logic            last;     // next micro-op is the last one of the sequence
+        logic            next;     // dispatch: next micro-op is issued
+        logic            stall;    // dispatch: next micro-op has to wait for outstanding loads / store buffer
+        logic            hold;     // execute: macro-operation not completed yet, keep PC and loop-end status
+        logic            bp_taken; // macro-operation was predicted as taken jump (applies to the last micro-op)
+        logic            imm_en;   // current micro-op uses the internal immediate (Zcmt)
+        logic [XLEN-1:0] imm;      // internal immediate: jump table entry address, then jump target
+        logic            cap;      // capture jump table entry from memory read data
+    } zcmp_t;
+    //
+    zcmp_t zcmp;
+
+    /* store buffer: next instruction has to wait until all buffered stores have been written to the bus */
+    logic sb_stall;
+
+    /* cache-block prefetch hints (Zicbop), address = ALU adder in the cycle after EXECUTE */
+    typedef struct {
+        logic ic_nxt; // prefetch.i
+        logic ic;
+        logic dc_nxt; // prefetch.r, prefetch.w
+        logic dc;
+        logic ok;     // hint address is cacheable
+    } pref_t;
+    //
+    pref_t pref;
+
     /* instruction decoding helper logic */
     typedef struct {
         logic is_v_op;
         logic is_f_op;  
+        logic is_f_fma;
         logic is_h_op; 
+        logic is_h_fma;
         logic is_m_mul;  
         logic is_m_div;  
         logic is_b_imm;  
         logic is_b_reg;  
         logic is_zicond; 
+        logic is_p_op;
+        logic is_pref;
+        logic is_cbz;
         logic rs1_zero; 
         logic rd_zero;   
     } decode_aux_t;
@@ -200,10 +377,26 @@ module cellrv32_cpu_control #(
         logic sleep_nxt;
         logic branched; // instruction fetch was reset
         logic branched_nxt;
+        logic bp_taken; // current instruction was predicted as taken branch/jump
+        logic bp_taken_nxt;
+        logic [1:0] lp; // current instruction ends the body of hardware loop context i (set by fetch)
+        logic [1:0] lp_nxt;
+        logic pipe_ok;  // pipelined mode: next instruction can be dispatched directly from EXECUTE
+        logic pipe_dsp; // pipelined mode: dispatching next instruction directly from EXECUTE
     } execute_engine_t;
     //
     execute_engine_t execute_engine;
 
+    /* instruction trace */
+    typedef struct {
+        logic            fused;      // current jump is a fused auipc+jalr pair (uninferable)
+        logic            trap_en;    // trap entered from outside of debug mode
+        logic [XLEN-1:0] trap_src;   // trap source address
+        logic [6:0]      trap_cause; // trap cause
+    } trace_ctrl_t;
+    //
+    trace_ctrl_t trace_ctrl;
+
     /* trap_ctrl_t */
     typedef struct packed {
         logic [exc_width_c-1:0] exc_buf;       // synchronous exception buffer (one bit per exception)
@@ -227,6 +420,22 @@ module cellrv32_cpu_control #(
     //
     trap_ctrl_t trap_ctrl;
 
+    /* vectored interrupt controller */
+    typedef struct packed {
+        logic       valid;    // at least one interrupt source pending and enabled
+        logic [4:0] id;       // arbitration winner: mcause identifier
+        logic [3:0] lvl;      // arbitration winner: interrupt level
+        logic       take;     // winner may preempt the current context
+        logic       chain;    // winner can be tail-chained on mret
+        logic       tail;     // trap environment is starting as tail-chained handler
+        logic [3:0] trap_lvl; // level of the interrupt that is being taken
+    } irqc_t;
+    //
+    irqc_t irqc;
+
+    /* shadow register bank */
+    logic shadow_sel; // trap being entered is an interrupt that uses the shadow bank
+
     /* CPU main control bus */
     ctrl_bus_t ctrl_nxt, ctrl;
 
@@ -265,8 +474,10 @@ module cellrv32_cpu_control #(
         logic        mie_mei;    // mie.MEIE: machine external interrupt enable (R/W)
         logic        mie_mti;    // mie.MEIE: machine timer interrupt enable (R/W)
         logic [15:0] mie_firq;   // mie.firq*e: fast interrupt enabled (R/W)
+        logic        mie_lcof;   // mie.LCOFIE: local counter-overflow interrupt enable (R/W)
         //
         logic [15:0] mip_firq_nclr;     // clear pending FIRQ (active-low)
+        logic        mip_lcof_nclr;     // clear pending LCOFI (active-low)
         //
         logic mcountinhibit_cy;         // mcounterinhibit.cy: inhibit auto-increment for [m]cycle[h]
         logic mcountinhibit_ir;         // mcounterinhibit.ir: inhibit auto-increment for [m]instret[h]
@@ -277,11 +488,16 @@ module cellrv32_cpu_control #(
         //
         logic [XLEN-1:0] mepc;   // mepc: machine exception pc (R/W)
         logic [5:0]      mcause; // mcause: machine trap cause (R/W)
-        logic [XLEN-1:0] mtvec;  // mtvec: machine trap-handler base address (R/W), bit 1:0 == 00
+        logic [XLEN-1:0] mtvec;  // mtvec: machine trap-handler base address (R/W), bit 1 == 0, bit 0 = vectored mode
         logic [XLEN-1:0] mtval;  // mtval: machine bad address or instruction (R/W)
         //
         mhpmevent_t    mhpmevent;    // mhpmevent*: machine performance-monitoring event selector (R/W)
         mhpmevent_rd_t mhpmevent_rd; // read data
+        logic [28:0]   mhpmevent_of;   // mhpmevent*h.OF: counter overflow, LCOFI pending if zero (R/W)
+        logic [28:0]   mhpmevent_minh; // mhpmevent*h.MINH: inhibit counting in machine mode (R/W)
+        logic [28:0]   mhpmevent_uinh; // mhpmevent*h.UINH: inhibit counting in user mode (R/W)
+        mhpmevent_rd_t mhpmeventh_rd;  // read data (high word)
+        logic [28:0]   mhpmcounter_wrap; // full-width counter wraps to zero
         //
         logic [XLEN-1:0] mscratch; // mscratch: scratch register (R/W)
         //
@@ -309,6 +525,23 @@ module cellrv32_cpu_control #(
         logic [2:0] frm;                 // frm (R/W): FPU rounding mode
         logic [4:0] fflags;              // fflags (R/W): FPU exception flags
         //
+        logic [XLEN-1:6] jvt;            // jvt (R/W): Zcmt jump vector table base address, jvt.mode = 0
+        //
+        logic [0:31][3:0] mirqctl;       // mirqctl0..3 (R/W): interrupt priority/level, one nibble per mcause ID
+        logic [2:0] mirq_nlbits;         // mirqcfg.nlbits (R/W): number of level bits in mirqctl (0 = no preemption levels)
+        logic [3:0] mirq_thresh;         // mirqcfg.thresh (R/W): interrupt level threshold
+        logic [3:0] mirq_mpil;           // mirqcfg.mpil (R/W): previous interrupt level
+        logic [3:0] mirq_mil;            // mirqcfg.mil (R/-): current interrupt level
+        //
+        logic [31:0] mshadowen;          // mshadowen (R/W): use shadow register bank for interrupt, one bit per mcause ID
+        logic rf_bank;                   // mshadowctl.bank (R/-): currently active register bank
+        logic rf_mpbank;                 // mshadowctl.mpbank (R/W): register bank of the interrupted context
+        //
+        logic [7:0] ic_lock;             // micachectl.lock (R/W): locked i-cache ways
+        logic [2:0] ic_way;              // micachectl.way (R/W): i-cache way for block preloads
+        logic [XLEN-1:0] ic_fill_addr;   // micachefill (R/W): i-cache block preload address
+        logic ic_fill;                   // micachefill written: preload request
+        //
         logic [$clog2(VLEN)-1:0] vstart; // vstart (R/W): vector start index
         logic [1:0] vxrm;                // vxrm (R/W): Vector Fixed-Point Rounding Mode
         logic vxsat;                     // vxsat (R/-): Vector Control and Status Register
@@ -346,6 +579,7 @@ module cellrv32_cpu_control #(
         logic [1:0]      instret;
         logic [28:0]     hpm_lo; 
         logic [28:0]     hpm_hi;
+        logic [28:0]     hpm_evh;
     } cnt_csr_we_t;
     //
     cnt_csr_we_t cnt_csr_we;
@@ -369,6 +603,7 @@ module cellrv32_cpu_control #(
     /* (hpm) counter events */
     logic [hpmcnt_event_size_c-1:0] cnt_event;
     logic [HPM_NUM_CNTS-1:0]        hpmcnt_trigger;
+    logic [8:0]                     cp_occ, cp_occ_buf; // co-processor currently processing (ALU_WAIT), one-hot
 
     /* illegal instruction check */
     logic illegal_cmd;
@@ -436,7 +671,15 @@ module cellrv32_cpu_control #(
               IF_PENDING : begin
                   // wait for bus response
                   if (fetch_engine.resp == 1'b1) begin
-                      fetch_engine.pc        <= fetch_engine.pc + 4;
+                      if (bp.taken == 1'b1) begin // predicted taken branch/jump: continue at predicted target
+                          fetch_engine.pc <= bp.target;
+                      end else if (hwlp.f_wrap == 1'b1) begin // end of hardware loop body: continue at loop start
+                          fetch_engine.pc <= hwlp.f_target;
+                      end else if (fetch_engine.wide == 1'b1) begin // two words fetched
+                          fetch_engine.pc <= fetch_engine.pc + 8;
+                      end else begin
+                          fetch_engine.pc <= fetch_engine.pc + 4;
+                      end
                       fetch_engine.unaligned <= 1'b0;
                       fetch_engine.pmp_err   <= 1'b0;
                       //
@@ -444,10 +687,12 @@ module cellrv32_cpu_control #(
                       if ((fetch_engine.restart == 1'b1) || (fetch_engine.reset == 1'b1)) begin
                           fetch_engine.state <= IF_RESTART;
                           // do not trigger new instruction fetch when a branch instruction is being executed (wait for branch destination)
-                      end else if (((execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c+2] == opcode_branch_c[6:2]) &&
+                          // - not required if the branch has already been predicted (fetch continues at predicted destination)
+                      end else if ((execute_engine.bp_taken == 1'b0) &&
+                                  (((execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c+2] == opcode_branch_c[6:2]) &&
                                     (execute_engine.i_reg[31] == 1'b1)) || // predict: taken if branching backwards
                                     (execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c+2] == opcode_jal_c[6:2]) ||      // always taken
-                                    (execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c+2] == opcode_jalr_c[6:2])) begin // always taken
+                                    (execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c+2] == opcode_jalr_c[6:2]))) begin // always taken
                           fetch_engine.state <= IF_WAIT;
                       end else begin // request next instruction word
                           fetch_engine.state <= IF_REQUEST;
@@ -486,14 +731,30 @@ module cellrv32_cpu_control #(
     // [NOTE] PMP and alignment-error will keep pending until the actually triggered bus access completes (or fails)
     assign fetch_engine.resp = ((i_bus_ack_i == 1'b1) || (i_bus_err_i == 1'b1)) ? 1'b1 : 1'b0;
 
+    /* 64-bit fetch: second (sequential) word is only used if the IPB can take both words */
+    // [NOTE] the second word is dropped if the first word is predicted taken or ends a hardware loop body
+    assign fetch_engine.wide_rsp = ((CPU_FETCH_64BIT == 1) && (i_bus_wide_i == 1'b1) && (ipb.free2 == 2'b11) &&
+                                    (fetch_engine.a_err == 1'b0)) ? 1'b1 : 1'b0;
+    assign fetch_engine.wide     = fetch_engine.wide_rsp & (~(bp.taken & (~bp.slot))) & (~hwlp.f_cut);
+
     /* IPB instruction data and status */
-    assign ipb.wdata[0] = {(i_bus_err_i | fetch_engine.pmp_err), fetch_engine.a_err, i_bus_rdata_i[15:00]};
-    assign ipb.wdata[1] = {(i_bus_err_i | fetch_engine.pmp_err), fetch_engine.a_err, i_bus_rdata_i[31:16]};
+    // [NOTE] a predicted branch/jump always ends in the high half-word of the fetched word
+    // [NOTE] unaligned start with 64-bit fetch: low half-word of the *second* word is the first low half-word to be written
+    // [NOTE] a hardware loop body always ends at a word boundary, so the loop-end marker is attached to the high half-word
+    assign ipb.wdata[0]  = {2'b00, 1'b0, (i_bus_err_i | fetch_engine.pmp_err), fetch_engine.a_err,
+                            ((fetch_engine.unaligned == 1'b1) && (fetch_engine.wide == 1'b1)) ? i_bus_rdata2_i[15:00] : i_bus_rdata_i[15:00]};
+    assign ipb.wdata[1]  = {(hwlp.f_cut == 1'b1) ? hwlp.f_dec : 2'b00, (bp.taken & (~bp.slot)),
+                            (i_bus_err_i | fetch_engine.pmp_err), fetch_engine.a_err, i_bus_rdata_i[31:16]};
+    assign ipb.wdata2[0] = {2'b00, 1'b0, (i_bus_err_i | fetch_engine.pmp_err), fetch_engine.a_err, i_bus_rdata2_i[15:00]};
+    assign ipb.wdata2[1] = {(hwlp.f_cut == 1'b0) ? hwlp.f_dec : 2'b00, (bp.taken & bp.slot),
+                            (i_bus_err_i | fetch_engine.pmp_err), fetch_engine.a_err, i_bus_rdata2_i[31:16]};
 
     /* IPB write enable */
-    assign ipb.we[0] = ((fetch_engine.state == IF_PENDING) && (fetch_engine.resp == 1'b1) &&
-                       ((fetch_engine.unaligned == 1'b0) || (CPU_EXTENSION_RISCV_C == 0))) ? 1'b1 : 1'b0;
-    assign ipb.we[1] = ((fetch_engine.state == IF_PENDING) && (fetch_engine.resp == 1'b1)) ? 1'b1 : 1'b0;
+    assign ipb.we[0]  = ((fetch_engine.state == IF_PENDING) && (fetch_engine.resp == 1'b1) &&
+                        ((fetch_engine.unaligned == 1'b0) || (CPU_EXTENSION_RISCV_C == 0) || (fetch_engine.wide == 1'b1))) ? 1'b1 : 1'b0;
+    assign ipb.we[1]  = ((fetch_engine.state == IF_PENDING) && (fetch_engine.resp == 1'b1)) ? 1'b1 : 1'b0;
+    assign ipb.we2[0] = ipb.we[0] & fetch_engine.wide & (~fetch_engine.unaligned);
+    assign ipb.we2[1] = ipb.we[1] & fetch_engine.wide;
 
     // Instruction Prefetch Buffer (FIFO) --------------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -506,7 +767,9 @@ module cellrv32_cpu_control #(
              .FIFO_WIDTH ($bits(ipb.wdata[i])), // size of data elements in fifo
              .FIFO_RSYNC (0),                   // we NEED to read data asynchronously
              .FIFO_SAFE  (0),                   // no safe access required (ensured by FIFO-external control)
-             .FIFO_GATE  (0)                    // no output gate required
+             .FIFO_GATE  (0),                   // no output gate required
+             .FIFO_PEEK  (CPU_DUAL_ISSUE | (|CPU_FUSION)), // dual-issue/fusion: access to second entry
+             .FIFO_WR2   (CPU_FETCH_64BIT)      // 64-bit fetch: write two entries at once
          ) prefetch_buffer_inst (
              /* control */
              .clk_i   (clk_i),                // clock, rising edge
@@ -517,14 +780,110 @@ module cellrv32_cpu_control #(
              .wdata_i (ipb.wdata[i]),         // write data
              .we_i    (ipb.we[i]),            // write enable
              .free_o  (ipb.free[i]),          // at least one entry is free when set
+             /* second write port */
+             .wdata2_i (ipb.wdata2[i]),       // write data of next entry
+             .we2_i    (ipb.we2[i]),          // write two entries at once
+             .free2_o  (ipb.free2[i]),        // at least two entries are free
              /* read port */
              .re_i    (ipb.re[i]),            // read enable
              .rdata_o (ipb.rdata[i]),         // read data
-             .avail_o (ipb.avail[i])          // data available when set
+             .avail_o (ipb.avail[i]),         // data available when set
+             /* peek port */
+             .re2_i    (ipb.re2[i]),          // read two entries at once
+             .rdata2_o (ipb.rdata2[i]),       // read data of next entry
+             .avail2_o (ipb.avail2[i])        // at least two entries available
          );
      end : prefetch_buffer
     endgenerate
 
+    // Dynamic Branch Prediction (BHT + BTB) -----------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    generate
+     if (CPU_BP_EN == 1) begin : branch_predictor_enabled
+         cellrv32_cpu_bp #(
+             .XLEN        (XLEN),               // data path width
+             .BHT_ENTRIES (CPU_BP_BHT_ENTRIES), // number of BHT entries, has to be a power of 2
+             .BTB_ENTRIES (CPU_BP_BTB_ENTRIES), // number of BTB entries, has to be a power of 2
+             .RAS_DEPTH   (CPU_BP_RAS_DEPTH)    // number of RAS entries, has to be zero or a power of 2
+         ) cellrv32_cpu_bp_inst (
+             /* global control */
+             .clk_i           (clk_i),                              // global clock, rising edge
+             .rstn_i          (rstn_i),                             // global reset, low-active, async
+             .clear_i         (ctrl.bus_fencei),                    // instruction stream might have changed
+             .restore_i       (logic'(fetch_engine.state == IF_RESTART)), // restore speculative RAS
+             /* lookup (instruction fetch) */
+             .lookup_addr_i   ({fetch_engine.pc[XLEN-1:2], 2'b00}), // fetch word address
+             .lookup_wide_i   (fetch_engine.wide_rsp),              // 64-bit fetch: also look up second word
+             .lookup_ack_i    (ipb.we[1]),                          // fetched word is written to IPB
+             .lookup_stop_i   (hwlp.f_end),                         // loop end has priority over prediction
+             .lookup_taken_o  (bp.taken),                           // predict: taken
+             .lookup_slot_o   (bp.slot),                            // prediction belongs to second word
+             .lookup_target_o (bp.target),                          // predicted target address
+             /* check (instruction execution) */
+             .check_addr_i    (bp.addr),                            // fetch word address of current branch
+             .check_hit_o     (bp.check_hit),                       // valid BTB entry
+             .check_target_o  (bp.check_target),                    // predicted target address
+             /* update (instruction execution) */
+             .update_i        (bp.update),                          // update prediction tables
+             .resolve_i       (bp.resolve),                         // update architectural RAS
+             .update_addr_i   (bp.addr),                            // fetch word address of current branch
+             .update_jump_i   (execute_engine.i_reg[instr_opcode_lsb_c+2]), // JAL/JALR
+             .update_call_i   (bp.call),                            // push return address
+             .update_ret_i    (bp.ret),                             // pop return address
+             .update_taken_i  (execute_engine.i_reg[instr_opcode_lsb_c+2] | execute_engine.branch_taken),
+             .update_target_i (alu_add_i),                          // actual branch/jump destination
+             .update_link_i   (execute_engine.next_pc)              // return address
+         );
+
+         /* fetch word that contains the last half-word of the current branch/jump */
+         assign bp.addr = {execute_engine.next_pc[XLEN-1:2] - 1'b1, 2'b00};
+
+         /* only branches that end at a word boundary and jump to a 32-bit-aligned destination are predicted */
+         assign bp.eligible = (execute_engine.next_pc[1] == 1'b0) && (alu_add_i[1] == 1'b0);
+
+         /* train predictor when resolving a (legal) branch/jump */
+         assign bp.resolve = ((execute_engine.state == BRANCH) && (trap_ctrl.exc_buf[exc_iillegal_c] == 1'b0)) ? 1'b1 : 1'b0;
+         assign bp.update  = bp.resolve & bp.eligible;
+
+         /* call/return hints (RISC-V link registers: x1 and x5) */
+         always_comb begin : bp_ras_hint
+             logic rd_link, rs1_link;
+             rd_link  = (execute_engine.i_reg[instr_rd_msb_c  : instr_rd_lsb_c ] == 5'b00001) || (execute_engine.i_reg[instr_rd_msb_c  : instr_rd_lsb_c ] == 5'b00101);
+             rs1_link = (execute_engine.i_reg[instr_rs1_msb_c : instr_rs1_lsb_c] == 5'b00001) || (execute_engine.i_reg[instr_rs1_msb_c : instr_rs1_lsb_c] == 5'b00101);
+             bp.call = 1'b0;
+             bp.ret  = 1'b0;
+             if (execute_engine.i_reg[instr_opcode_lsb_c+2] == 1'b1) begin // JAL/JALR
+                 bp.call = rd_link;
+                 if (execute_engine.i_reg[instr_opcode_lsb_c+3] == 1'b0) begin // JALR: might be a return
+                     bp.ret = rs1_link & (~(rd_link & (execute_engine.i_reg[instr_rd_msb_c : instr_rd_lsb_c] ==
+                                                       execute_engine.i_reg[instr_rs1_msb_c : instr_rs1_lsb_c])));
+                 end
+             end
+         end : bp_ras_hint
+
+         /* predicted-taken branch/jump with correct destination? */
+         assign bp.hit = ((execute_engine.bp_taken == 1'b1) && (bp.check_hit == 1'b1) &&
+                          (bp.check_target[XLEN-1:1] == alu_add_i[XLEN-1:1])) ? 1'b1 : 1'b0;
+     end : branch_predictor_enabled
+    endgenerate
+
+    generate
+     if (CPU_BP_EN == 0) begin : branch_predictor_disabled
+         assign bp.taken        = 1'b0;
+         assign bp.slot         = 1'b0;
+         assign bp.target       = '0;
+         assign bp.check_hit    = 1'b0;
+         assign bp.check_target = '0;
+         assign bp.addr         = '0;
+         assign bp.eligible     = 1'b0;
+         assign bp.update       = 1'b0;
+         assign bp.resolve      = 1'b0;
+         assign bp.call         = 1'b0;
+         assign bp.ret          = 1'b0;
+         assign bp.hit          = 1'b0;
+     end : branch_predictor_disabled
+    endgenerate
+
     // ****************************************************************************************************************************
     // Instruction Issue (decompress 16-bit instructions and assemble a 32-bit instruction word)
     // ****************************************************************************************************************************
@@ -536,7 +895,8 @@ module cellrv32_cpu_control #(
          always_ff @( posedge clk_i ) begin : issue_engine_fsm_sync
              if (fetch_engine.restart == 1'b1) begin
                   issue_engine.align <= execute_engine.pc[1]; // branch to unaligned address?
-             end else if (execute_engine.state == DISPATCH) begin
+             end else if (((execute_engine.state == DISPATCH) && (issue_engine.hold == 1'b0) && (zcmp.busy == 1'b0)) || // instruction taken from IPB
+                          (execute_engine.pipe_dsp == 1'b1)) begin
                  issue_engine.align <= (issue_engine.align & (~issue_engine.align_clr)) | issue_engine.align_set; // "RS" flip-flop
              end
          end : issue_engine_fsm_sync
@@ -552,10 +912,10 @@ module cellrv32_cpu_control #(
                  if (ipb.rdata[0][1:0] != 2'b11) begin // compressed
                       issue_engine.align_set = ipb.avail[0]; // start of next instruction word is NOT 32-bit-aligned
                       issue_engine.valid[0]  = ipb.avail[0];
-                      issue_engine.data      = {issue_engine.ci_ill, ipb.rdata[0][17:16], 1'b1, issue_engine.ci_i32};
+                      issue_engine.data      = {ipb.rdata[0][20:18], issue_engine.ci_ill, ipb.rdata[0][17:16], 1'b1, issue_engine.ci_i32};
                  end else begin // aligned uncompressed
                      issue_engine.valid = (ipb.avail[0] && ipb.avail[1]) ? '1 : '0;
-                     issue_engine.data  = {1'b0, (ipb.rdata[1][17:16] | ipb.rdata[0][17:16]),
+                     issue_engine.data  = {ipb.rdata[1][20:18], 1'b0, (ipb.rdata[1][17:16] | ipb.rdata[0][17:16]),
                                            1'b0,  ipb.rdata[1][15:00],  ipb.rdata[0][15:00]};
                  end
              /* start with HIGH half-word */
@@ -563,10 +923,10 @@ module cellrv32_cpu_control #(
                  if (ipb.rdata[1][1:0] != 2'b11) begin // compressed
                      issue_engine.align_clr = ipb.avail[1]; // start of next instruction word IS 32-bit-aligned again
                      issue_engine.valid[1]  = ipb.avail[1];
-                     issue_engine.data      = {issue_engine.ci_ill, ipb.rdata[1][17:16], 1'b1, issue_engine.ci_i32};
+                     issue_engine.data      = {ipb.rdata[1][20:18], issue_engine.ci_ill, ipb.rdata[1][17:16], 1'b1, issue_engine.ci_i32};
                  end else begin // unaligned uncompressed
                      issue_engine.valid = (ipb.avail[0] && ipb.avail[1]) ? '1 : '0;
-                     issue_engine.data  = {1'b0, (ipb.rdata[0][17:16] | ipb.rdata[1][17:16]),
+                     issue_engine.data  = {ipb.rdata[0][20:18], 1'b0, (ipb.rdata[0][17:16] | ipb.rdata[1][17:16]),
                                            1'b0,  ipb.rdata[0][15:00],  ipb.rdata[1][15:00]};
                  end
              end
@@ -577,20 +937,344 @@ module cellrv32_cpu_control #(
     generate
      if (CPU_EXTENSION_RISCV_C == 0) begin : issue_engine_disabled
          assign issue_engine.valid = (ipb.avail[0] == 1'b1) ? '1 : '0; // only use status flags from IPB[0]
-         assign issue_engine.data  = {1'b0, ipb.rdata[0][17:16], 1'b0, ipb.rdata[1][15:0], ipb.rdata[0][15:0]};
+         assign issue_engine.data  = {ipb.rdata[1][20:18], 1'b0, ipb.rdata[0][17:16], 1'b0, ipb.rdata[1][15:0], ipb.rdata[0][15:0]};
      end : issue_engine_disabled
     endgenerate
     
     /* update IPB FIFOs (ready-for-next)? */
-    assign ipb.re[0] = ((issue_engine.valid[0] == 1'b1) && (execute_engine.state == DISPATCH)) ? 1'b1 : 1'b0;
-    assign ipb.re[1] = ((issue_engine.valid[1] == 1'b1) && (execute_engine.state == DISPATCH)) ? 1'b1 : 1'b0;
+    assign ipb.re[0] = ((issue_engine.valid[0] == 1'b1) && (((execute_engine.state == DISPATCH) && (issue_engine.hold == 1'b0) && (zcmp.busy == 1'b0)) || (execute_engine.pipe_dsp == 1'b1))) ? 1'b1 : 1'b0;
+    assign ipb.re[1] = ((issue_engine.valid[1] == 1'b1) && (((execute_engine.state == DISPATCH) && (issue_engine.hold == 1'b0) && (zcmp.busy == 1'b0)) || (execute_engine.pipe_dsp == 1'b1))) ? 1'b1 : 1'b0;
+    assign ipb.re2   = {2{dual.dsp | fuse.dsp}}; // dual-issue / macro-op fusion: also read next entry
+
+    // Dual-Issue Pair Check ---------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] both instructions have to be 32-bit-aligned uncompressed simple ALU operations without
+    // fetch exceptions; the second one must not depend on the first one (RAW/WAW)
+    generate
+     if (CPU_DUAL_ISSUE == 1) begin : dual_issue_enabled
+         /* next instruction word (following an aligned uncompressed instruction) */
+         assign dual.instr = {ipb.rdata2[1][15:0], ipb.rdata2[0][15:0]};
+
+         always_comb begin : dual_issue_check
+             logic [4:0] rd1, rs1, rs2, rd2;
+             rd1  = issue_engine.data[instr_rd_msb_c  : instr_rd_lsb_c];
+             rs1  = dual.instr[instr_rs1_msb_c : instr_rs1_lsb_c];
+             rs2  = dual.instr[instr_rs2_msb_c : instr_rs2_lsb_c];
+             rd2  = dual.instr[instr_rd_msb_c  : instr_rd_lsb_c];
+             dual.pair = 1'b0;
+             if ((issue_engine.valid == 2'b11) && (ipb.avail2 == 2'b11) && // both instructions available
+                 ((issue_engine.align == 1'b0) || (CPU_EXTENSION_RISCV_C == 0)) && // aligned
+                 (issue_engine.data[38:32] == 7'b0000000) && // no loop end, not predicted, no fetch exceptions, not compressed
+                 (ipb.rdata2[0][20:16] == 5'b00000) && (ipb.rdata2[1][20:16] == 5'b00000) && // no loop end, not predicted, no fetch exceptions
+                 (is_simple_alu_f(issue_engine.data[31:0]) == 1'b1) && (is_simple_alu_f(dual.instr) == 1'b1) && // simple ALU operations only
+                 ((rd1 == 5'b00000) || ((rd1 != rs1) && (rd1 != rs2) && (rd1 != rd2))) && // independent
+                 ((CPU_EXTENSION_RISCV_E == 0) || ((rd1[4] | rs1[4] | rs2[4] | rd2[4] |
+                   issue_engine.data[instr_rs1_msb_c] | issue_engine.data[instr_rs2_msb_c]) == 1'b0)) && // legal RV32E registers
+                 (csr.dcsr_step == 1'b0) && (csr.tdata1_exe == 1'b0)) begin // no single-stepping, no armed trigger
+                 dual.pair = 1'b1;
+             end
+         end : dual_issue_check
+
+         /* second issue slot */
+         always_ff @( posedge clk_i or negedge rstn_i ) begin : dual_issue_reg
+             if (rstn_i == 1'b0) begin
+                 dual.valid <= 1'b0;
+                 dual.i_reg <= '0;
+             end else begin
+                 dual.valid <= dual.dsp; // EXECUTE is left after exactly one cycle
+                 if (dual.dsp == 1'b1) begin
+                     dual.i_reg <= dual.instr;
+                 end
+             end
+         end : dual_issue_reg
+
+         /* second slot ALU operation */
+         always_comb begin : dual_issue_decode
+             dual.opb_mux = (~dual.i_reg[instr_opcode_lsb_c+5]) | dual.i_reg[instr_opcode_lsb_c+2]; // ALUI or LUI
+             if (dual.i_reg[instr_opcode_lsb_c+2] == 1'b1) begin // LUI
+                 dual.alu_op = alu_op_movb_c;
+             end else begin
+                 unique case (dual.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c])
+                     funct3_subadd_c : dual.alu_op = (dual.i_reg[instr_opcode_lsb_c+5] & dual.i_reg[instr_funct7_msb_c-1]) ? alu_op_sub_c : alu_op_add_c;
+                     funct3_slt_c, funct3_sltu_c : dual.alu_op = alu_op_slt_c;
+                     funct3_xor_c    : dual.alu_op = alu_op_xor_c;
+                     funct3_or_c     : dual.alu_op = alu_op_or_c;
+                     default: begin
+                                       dual.alu_op = alu_op_and_c;
+                     end
+                 endcase
+             end
+         end : dual_issue_decode
+
+         /* second slot immediate (I-immediate or U-immediate) */
+         always_ff @( posedge clk_i ) begin : dual_issue_imm
+             if (dual.i_reg[instr_opcode_lsb_c+2] == 1'b1) begin // LUI
+                 imm2_o <= {dual.i_reg[31:12], 12'h000};
+             end else begin
+                 imm2_o <= {{(XLEN-11){dual.i_reg[31]}}, dual.i_reg[30:20]};
+             end
+         end : dual_issue_imm
+     end : dual_issue_enabled
+    endgenerate
+
+    generate
+     if (CPU_DUAL_ISSUE == 0) begin : dual_issue_disabled
+         assign dual.instr   = '0;
+         assign dual.pair    = 1'b0;
+         assign dual.valid   = 1'b0;
+         assign dual.i_reg   = '0;
+         assign dual.alu_op  = alu_op_add_c;
+         assign dual.opb_mux = 1'b0;
+         assign imm2_o       = '0;
+     end : dual_issue_disabled
+    endgenerate
+
+    // Macro-Op Fusion ---------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] both instructions have to be 32-bit-aligned uncompressed instructions without fetch exceptions;
+    // the pair is replaced by a single synthesized instruction (+ fused immediate) that writes the same result
+    generate
+     if (CPU_FUSION != 0) begin : fusion_enabled
+         /* next instruction word (following an aligned uncompressed instruction) */
+         assign fuse.instr = {ipb.rdata2[1][15:0], ipb.rdata2[0][15:0]};
+
+         always_comb begin : fusion_check
+             logic [31:0] a, b;
+             logic [4:0]  rd, rs1, rs2, oth;
+             logic        ok;
+             a   = issue_engine.data[31:0];
+             b   = fuse.instr;
+             rd  = a[instr_rd_msb_c  : instr_rd_lsb_c];
+             rs1 = a[instr_rs1_msb_c : instr_rs1_lsb_c];
+             rs2 = a[instr_rs2_msb_c : instr_rs2_lsb_c];
+             oth = (b[instr_rs1_msb_c : instr_rs1_lsb_c] == rd) ? b[instr_rs2_msb_c : instr_rs2_lsb_c] : b[instr_rs1_msb_c : instr_rs1_lsb_c];
+             /* common constraints */
+             ok = (issue_engine.valid == 2'b11) && (ipb.avail2 == 2'b11) && // both instructions available
+                  ((issue_engine.align == 1'b0) || (CPU_EXTENSION_RISCV_C == 0)) && // aligned
+                  (issue_engine.data[38:32] == 7'b0000000) && // no loop end, not predicted, no fetch exceptions, not compressed
+                  (ipb.rdata2[0][20:16] == 5'b00000) && (ipb.rdata2[1][20:16] == 5'b00000) && // no loop end, not predicted, no fetch exceptions
+                  (rd != 5'b00000) && (b[instr_rd_msb_c : instr_rd_lsb_c] == rd) && // same (non-zero) destination
+                  ((CPU_EXTENSION_RISCV_E == 0) || ((a[instr_rd_msb_c] | a[instr_rs1_msb_c] | a[instr_rs2_msb_c] |
+                    b[instr_rs1_msb_c] | b[instr_rs2_msb_c]) == 1'b0)) && // legal RV32E registers
+                  (csr.dcsr_step == 1'b0) && (csr.tdata1_exe == 1'b0); // no single-stepping, no armed trigger
+             /* defaults */
+             fuse.pair    = 1'b0;
+             fuse.i_reg   = a;
+             fuse.imm_nxt = {a[31:12], 12'h000} + {{(XLEN-11){b[31]}}, b[30:20]};
+             fuse.rr_nxt  = 1'b0;
+             fuse.sh_nxt  = 2'b00;
+             if (ok == 1'b1) begin
+                 // lui rd, hi; addi rd, rd, lo -> lui rd, (hi + lo)
+                 if ((CPU_FUSION[fusion_lui_addi_c] == 1'b1) &&
+                     (a[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_lui_c) &&
+                     (b[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_alui_c) && (b[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_subadd_c) &&
+                     (b[instr_rs1_msb_c : instr_rs1_lsb_c] == rd)) begin
+                     fuse.pair = 1'b1;
+                 end
+                 // auipc rd, hi; jalr rd, lo(rd) -> jal rd, (hi + lo); no misaligned targets when C is enabled
+                 if ((CPU_FUSION[fusion_auipc_jalr_c] == 1'b1) && (CPU_EXTENSION_RISCV_C == 1) &&
+                     (a[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_auipc_c) &&
+                     (b[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_jalr_c) && (b[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b000) &&
+                     (b[instr_rs1_msb_c : instr_rs1_lsb_c] == rd)) begin
+                     fuse.pair       = 1'b1;
+                     fuse.i_reg      = {20'h00000, rd, opcode_jal_c};
+                     fuse.imm_nxt[0] = 1'b0; // JALR clears the LSB
+                 end
+                 // slli rd, rs1, n; srli rd, rd, n -> andi rd, rs1, (-1 >> n)
+                 if ((CPU_FUSION[fusion_slli_srli_c] == 1'b1) &&
+                     (a[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_alui_c) && (a[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_sll_c) &&
+                     (b[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_alui_c) && (b[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_sr_c) &&
+                     (a[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000000) && (b[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000000) &&
+                     (a[24:20] == b[24:20]) && (b[instr_rs1_msb_c : instr_rs1_lsb_c] == rd)) begin
+                     fuse.pair    = 1'b1;
+                     fuse.i_reg   = {12'h000, rs1, funct3_and_c, rd, opcode_alui_c};
+                     fuse.imm_nxt = {XLEN{1'b1}} >> a[24:20];
+                 end
+                 // add rd, rs1, rs2; lX rd, 0(rd) -> lX rd, rs1 + rs2; rd must not be a source of the add (restartable)
+                 if ((CPU_FUSION[fusion_add_load_c] == 1'b1) &&
+                     (a[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_alu_c) && (a[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_subadd_c) &&
+                     (a[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000000) &&
+                     (b[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_load_c) && (b[31:20] == 12'h000) &&
+                     (b[instr_funct3_msb_c-1 : instr_funct3_lsb_c] != 2'b11) && (b[instr_funct3_msb_c : instr_funct3_lsb_c] != 3'b110) && // legal loads only
+                     (b[instr_rs1_msb_c : instr_rs1_lsb_c] == rd) && (rd != rs1) && (rd != rs2)) begin
+                     fuse.pair   = 1'b1;
+                     fuse.i_reg  = {7'b0000000, rs2, rs1, b[instr_funct3_msb_c : instr_funct3_lsb_c], rd, opcode_load_c};
+                     fuse.rr_nxt = 1'b1;
+                 end
+                 // slli rd, rs1, 1..3; add rd, rd, rs2 -> add rd, (rs1 << 1..3), rs2 (B extension provides shXadd)
+                 if ((CPU_FUSION[fusion_slli_add_c] == 1'b1) && (CPU_EXTENSION_RISCV_B == 0) &&
+                     (a[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_alui_c) && (a[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_sll_c) &&
+                     (a[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000000) && (a[24:22] == 3'b000) && (a[21:20] != 2'b00) &&
+                     (b[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_alu_c) && (b[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_subadd_c) &&
+                     (b[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000000) &&
+                     ((b[instr_rs1_msb_c : instr_rs1_lsb_c] == rd) ^ (b[instr_rs2_msb_c : instr_rs2_lsb_c] == rd))) begin
+                     fuse.pair   = 1'b1;
+                     fuse.i_reg  = {7'b0000000, oth, rs1, funct3_subadd_c, rd, opcode_alu_c};
+                     fuse.sh_nxt = a[21:20];
+                 end
+             end
+         end : fusion_check
+
+         /* fused instruction attributes */
+         always_ff @( posedge clk_i or negedge rstn_i ) begin : fusion_reg
+             if (rstn_i == 1'b0) begin
+                 fuse.valid <= 1'b0;
+                 fuse.imm   <= '0;
+                 fuse.rr    <= 1'b0;
+                 fuse.sh    <= '0;
+             end else begin
+                 fuse.valid <= fuse.dsp; // EXECUTE is left after exactly one cycle
+                 if (fuse.dsp == 1'b1) begin
+                     fuse.imm <= fuse.imm_nxt;
+                     fuse.rr  <= fuse.rr_nxt;
+                     fuse.sh  <= fuse.sh_nxt;
+                 end
+             end
+         end : fusion_reg
+     end : fusion_enabled
+    endgenerate
+
+    generate
+     if (CPU_FUSION == 0) begin : fusion_disabled
+         assign fuse.instr   = '0;
+         assign fuse.pair    = 1'b0;
+         assign fuse.i_reg   = '0;
+         assign fuse.imm_nxt = '0;
+         assign fuse.rr_nxt  = 1'b0;
+         assign fuse.sh_nxt  = '0;
+         assign fuse.valid   = 1'b0;
+         assign fuse.imm     = '0;
+         assign fuse.rr      = 1'b0;
+         assign fuse.sh      = '0;
+     end : fusion_disabled
+    endgenerate
+
+    // Zero-Overhead Hardware Loops --------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] the fetch engine wraps to the loop start when fetching the last word of a loop body and tags that word
+    // in the IPB; the execute engine only follows these tags, so it never has to redirect the instruction fetch.
+    // The fetch engine keeps a speculative copy of the loop counters that is re-synchronized on every fetch restart
+    // (branches, traps, writes to the loop CSRs); a loop body has to end at a 32-bit boundary.
+    generate
+     if (CPU_HWLOOP == 1) begin : hw_loop_enabled
+         /* fetch: check if the fetched word(s) end an active loop body */
+         always_comb begin : hw_loop_fetch
+             logic [1:0] hit0, hit1, hit;
+             for (int i = 0; i < 2; i++) begin
+                 hit0[i] = (hwlp.fcnt[i] != '0) && ((fetch_engine.pc[XLEN-1:2] + 1'b1) == hwlp.stop[i][XLEN-1:2]); // first word
+                 hit1[i] = (hwlp.fcnt[i] != '0) && ((fetch_engine.pc[XLEN-1:2] + 2'd2) == hwlp.stop[i][XLEN-1:2]); // second word
+             end
+             // [NOTE] the loop end has priority: the branch predictor does not predict a fetch word that ends a loop body,
+             // so a not-taken branch in the last slot of a loop body still wraps (a taken one redirects from execute)
+             hwlp.f_end[0] = (hit0 != 2'b00);
+             hwlp.f_end[1] = (hit1 != 2'b00) & fetch_engine.wide_rsp;
+             //
+             if (hit0 != 2'b00) begin
+                 hit = hit0;
+             end else if ((fetch_engine.wide_rsp == 1'b1) && ((bp.taken == 1'b0) || (bp.slot == 1'b1))) begin // 64-bit fetch: second word
+                 hit = hit1;
+             end else begin
+                 hit = 2'b00;
+             end
+             //
+             hwlp.f_cut    = (hit0 != 2'b00);
+             hwlp.f_dec[0] = hit[0];
+             hwlp.f_dec[1] = hit[1] & ((~hit[0]) | (hwlp.fcnt[0] == 1)); // outer loop only if inner loop terminates here
+             hwlp.f_wrap   = (hit[0] & (hwlp.fcnt[0] != 1)) | (hwlp.f_dec[1] & (hwlp.fcnt[1] != 1));
+             hwlp.f_target = (hit[0] & (hwlp.fcnt[0] != 1)) ? hwlp.start[0] : hwlp.start[1];
+         end : hw_loop_fetch
+
+         /* execute: loop-end instruction completes without a branch or exception */
+         assign hwlp.commit = ((hwlp.dec != 2'b00) && (trap_ctrl.exc_fire == 1'b0) &&
+                              (((execute_engine.state == DISPATCH) && (execute_engine.branched == 1'b0)) ||
+                                (execute_engine.state == TRAP_EXECUTE))) ? 1'b1 : 1'b0; // fence or loop CSR write
+         assign hwlp.jump   = hwlp.commit & hwlp.wrap;
+
+         always_ff @( posedge clk_i or negedge rstn_i ) begin : hw_loop_regs
+             if (rstn_i == 1'b0) begin
+                 hwlp.start  <= '0;
+                 hwlp.stop   <= '0;
+                 hwlp.cnt    <= '0;
+                 hwlp.fcnt   <= '0;
+                 hwlp.dec    <= '0;
+                 hwlp.wrap   <= 1'b0;
+                 hwlp.target <= '0;
+             end else begin
+                 /* loop-end status of the instruction in execution */
+                 if (execute_engine.state == EXECUTE) begin
+                     hwlp.dec <= execute_engine.lp & {2{~zcmp.hold}}; // Zcmp/Zcmt: only the last micro-op ends the loop body
+                     if ((execute_engine.lp[0] == 1'b1) && (hwlp.cnt[0] != 1)) begin // inner loop: next iteration
+                         hwlp.wrap   <= 1'b1;
+                         hwlp.target <= hwlp.start[0];
+                     end else begin // outer loop: next iteration (if inner loop terminates here)
+                         hwlp.wrap   <= execute_engine.lp[1] & (hwlp.cnt[1] != 1);
+                         hwlp.target <= hwlp.start[1];
+                     end
+                 end else if ((execute_engine.state == DISPATCH) || (execute_engine.state == BRANCHED) ||
+                              (execute_engine.state == TRAP_EXIT) || (execute_engine.state == TRAP_EXECUTE)) begin
+                     hwlp.dec <= '0;
+                 end
+                 //
+                 /* architectural loop counters */
+                 if (hwlp.commit == 1'b1) begin
+                     hwlp.cnt[0] <= hwlp.cnt[0] - hwlp.dec[0];
+                     hwlp.cnt[1] <= hwlp.cnt[1] - hwlp.dec[1];
+                 end
+                 //
+                 /* speculative loop counters */
+                 if (fetch_engine.state == IF_RESTART) begin
+                     hwlp.fcnt <= hwlp.cnt;
+                 end else if (ipb.we[1] == 1'b1) begin
+                     hwlp.fcnt[0] <= hwlp.fcnt[0] - hwlp.f_dec[0];
+                     hwlp.fcnt[1] <= hwlp.fcnt[1] - hwlp.f_dec[1];
+                 end
+                 //
+                 /* loop CSRs: software access (has priority over decrement) */
+                 if (csr.we == 1'b1) begin
+                     unique case (csr.addr)
+                         csr_lpstart0_c : hwlp.start[0] <= {csr.wdata[XLEN-1:2], 2'b00};
+                         csr_lpend0_c   : hwlp.stop[0]  <= {csr.wdata[XLEN-1:2], 2'b00};
+                         csr_lpcount0_c : hwlp.cnt[0]   <= csr.wdata;
+                         csr_lpstart1_c : hwlp.start[1] <= {csr.wdata[XLEN-1:2], 2'b00};
+                         csr_lpend1_c   : hwlp.stop[1]  <= {csr.wdata[XLEN-1:2], 2'b00};
+                         csr_lpcount1_c : hwlp.cnt[1]   <= csr.wdata;
+                         default: begin
+                             // do nothing
+                         end
+                     endcase
+                 end
+             end
+         end : hw_loop_regs
+     end : hw_loop_enabled
+    endgenerate
+
+    generate
+     if (CPU_HWLOOP == 0) begin : hw_loop_disabled
+         assign hwlp.start    = '0;
+         assign hwlp.stop     = '0;
+         assign hwlp.cnt      = '0;
+         assign hwlp.fcnt     = '0;
+         assign hwlp.f_end    = '0;
+         assign hwlp.f_dec    = '0;
+         assign hwlp.f_cut    = 1'b0;
+         assign hwlp.f_wrap   = 1'b0;
+         assign hwlp.f_target = '0;
+         assign hwlp.dec      = '0;
+         assign hwlp.wrap     = 1'b0;
+         assign hwlp.target   = '0;
+         assign hwlp.commit   = 1'b0;
+         assign hwlp.jump     = 1'b0;
+     end : hw_loop_disabled
+    endgenerate
 
     // Compressed Instructions Decoding ----------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     generate
      if (CPU_EXTENSION_RISCV_C == 1) begin : cellrv32_cpu_decompressor_inst_true
          cellrv32_cpu_decompressor #(
-             .FPU_ENABLE (CPU_EXTENSION_RISCV_Zfinx) //  floating-point instructions enabled
+             .FPU_ENABLE (CPU_EXTENSION_RISCV_Zfinx), //  floating-point instructions enabled
+             .ZCMP_EN    (CPU_EXTENSION_RISCV_Zcmp),  //  compressed push/pop/move instructions enabled
+             .ZCMT_EN    (CPU_EXTENSION_RISCV_Zcmt)   //  compressed table-jump instructions enabled
          ) cellrv32_cpu_decompressor_inst (
              .ci_instr16_i (issue_engine.ci_i16), // compressed instruction input
              .ci_illegal_o (issue_engine.ci_ill), // illegal compressed instruction
@@ -611,41 +1295,53 @@ module cellrv32_cpu_control #(
     // Immediate Generator -----------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     always_ff @( posedge clk_i ) begin : imm_gen
-     unique case (imm_opcode)
-         // S-immediate: store
-         opcode_store_c : begin
-             imm_o[XLEN-1:11] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
-             imm_o[10:05]     <= execute_engine.i_reg[30:25];
-             imm_o[04:00]     <= execute_engine.i_reg[11:07];
-         end
-         // B-immediate: conditional branches
-         opcode_branch_c : begin
-             imm_o[XLEN-1:12] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
-             imm_o[11]        <= execute_engine.i_reg[07];
-             imm_o[10:05]     <= execute_engine.i_reg[30:25];
-             imm_o[04:01]     <= execute_engine.i_reg[11:08];
-             imm_o[00]        <= 1'b0;
-         end
-         // U-immediate: lui, auipc
-         opcode_lui_c, opcode_auipc_c : begin
-             imm_o[XLEN-1:12] <= execute_engine.i_reg[31:12];
-             imm_o[11:00]     <= '0;
-         end
-         // J-immediate: unconditional jumps
-         opcode_jal_c : begin
-             imm_o[XLEN-1:20] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
-             imm_o[19:12]     <= execute_engine.i_reg[19:12];
-             imm_o[11]        <= execute_engine.i_reg[20];
-             imm_o[10:01]     <= execute_engine.i_reg[30:21];
-             imm_o[00]        <= 1'b0;
-         end
-         // I-immediate: ALU-immediate, loads, jump-and-link with register
-         default: begin
-             imm_o[XLEN-1:11] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
-             imm_o[10:01]     <= execute_engine.i_reg[30:21];
-             imm_o[00]        <= execute_engine.i_reg[20];
-         end
-     endcase
+     if (fuse.valid == 1'b1) begin // macro-op fusion: pre-computed immediate
+         imm_o <= fuse.imm;
+     end else if (zcmp.imm_en == 1'b1) begin // Zcmt micro-op: jump table entry address / jump target
+         imm_o <= zcmp.imm;
+     end else if (decode_aux.is_pref == 1'b1) begin // Zicbop: block offset = imm[11:5] (imm[4:0] encode the hint type)
+         imm_o[XLEN-1:11] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
+         imm_o[10:05]     <= execute_engine.i_reg[30:25];
+         imm_o[04:00]     <= '0;
+     end else if (decode_aux.is_cbz == 1'b1) begin // Zicboz: effective address = rs1
+         imm_o <= '0;
+     end else begin
+         unique case (imm_opcode)
+             // S-immediate: store
+             opcode_store_c : begin
+                 imm_o[XLEN-1:11] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
+                 imm_o[10:05]     <= execute_engine.i_reg[30:25];
+                 imm_o[04:00]     <= execute_engine.i_reg[11:07];
+             end
+             // B-immediate: conditional branches
+             opcode_branch_c : begin
+                 imm_o[XLEN-1:12] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
+                 imm_o[11]        <= execute_engine.i_reg[07];
+                 imm_o[10:05]     <= execute_engine.i_reg[30:25];
+                 imm_o[04:01]     <= execute_engine.i_reg[11:08];
+                 imm_o[00]        <= 1'b0;
+             end
+             // U-immediate: lui, auipc
+             opcode_lui_c, opcode_auipc_c : begin
+                 imm_o[XLEN-1:12] <= execute_engine.i_reg[31:12];
+                 imm_o[11:00]     <= '0;
+             end
+             // J-immediate: unconditional jumps
+             opcode_jal_c : begin
+                 imm_o[XLEN-1:20] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
+                 imm_o[19:12]     <= execute_engine.i_reg[19:12];
+                 imm_o[11]        <= execute_engine.i_reg[20];
+                 imm_o[10:01]     <= execute_engine.i_reg[30:21];
+                 imm_o[00]        <= 1'b0;
+             end
+             // I-immediate: ALU-immediate, loads, jump-and-link with register
+             default: begin
+                 imm_o[XLEN-1:11] <= (execute_engine.i_reg[31] == 1'b1) ? '1 : '0; // sign extension
+                 imm_o[10:01]     <= execute_engine.i_reg[30:21];
+                 imm_o[00]        <= execute_engine.i_reg[20];
+             end
+         endcase
+     end
     end : imm_gen
 
     /* the two LSBs are always "11" for 32-bit instructions */
@@ -661,6 +1357,268 @@ module cellrv32_cpu_control #(
      end
     end : branch_check
 
+    // Pipelined Dispatch Check ------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] the next instruction can only be dispatched while the current one is still in EXECUTE if no trap
+    // (exception, interrupt, debug-mode entry) can be triggered in between; this keeps all traps precise
+    assign execute_engine.pipe_ok = ((CPU_PIPELINE_MODE == 1)                  && // pipelined mode enabled
+                                     (issue_engine.valid         != 2'b00)     && // next instruction available
+                                     (execute_engine.sleep       == 1'b0)      && // not going to sleep
+                                     (trap_ctrl.instr_il         == 1'b0)      && // current instruction is not illegal
+                                     (trap_ctrl.exc_fire         == 1'b0)      && // no pending exception
+                                     (trap_ctrl.env_start        == 1'b0)      && // no pending trap
+                                     (trap_ctrl.irq_fire         == 1'b0)      && // no interrupt request (trap would start after current instruction)
+                                     (hw_trigger_fire            == 1'b0)      && // no hardware trigger firing
+                                     (csr.dcsr_step              == 1'b0)      && // not in single-stepping mode
+                                     (execute_engine.lp          == 2'b00)     && // current instruction does not end a hardware loop body
+                                     (nbld.busy                  == 1'b0)      && // no outstanding non-blocking load
+                                     (zcmp.busy                  == 1'b0)      && // no pending Zcmp/Zcmt micro-ops
+                                     (issue_engine.hold          == 1'b0)      && // next instruction is not on hold
+                                     (issue_engine.data[34]      == 1'b0)      && // no bus access fault during instruction fetch
+                                    ((issue_engine.data[33]      == 1'b0)      || (CPU_EXTENSION_RISCV_C == 1))) ? 1'b1 : 1'b0; // no misaligned fetch
+
+    // Non-Blocking Loads (Register Scoreboard) --------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] the bus interface supports a single outstanding data access, so the scoreboard tracks one load. A load
+    // leaves MEM_WAIT as soon as its request has been issued without alignment or PMP fault. Subsequent integer
+    // ALU, branch and jump instructions keep executing as long as they do not access the load's destination register;
+    // all other instructions (memory, CSR, system, co-processor operations) and trap entry wait in DISPATCH until the
+    // load data has been written back. A bus error of an outstanding load raises an imprecise load access fault
+    // (xEPC = address of the load, later instructions may have completed already).
+    generate
+     if (CPU_NB_LOAD == 1) begin : nb_load_enabled
+         /* issue: check next instruction against the outstanding load */
+         always_comb begin : nb_load_check
+             logic [6:0] opcode;
+             logic simple, dep;
+             opcode = issue_engine.data[instr_opcode_msb_c : instr_opcode_lsb_c];
+             simple = (opcode == opcode_alu_c)    || (opcode == opcode_alui_c) || (opcode == opcode_lui_c) || (opcode == opcode_auipc_c) ||
+                      (opcode == opcode_branch_c) || (opcode == opcode_jal_c)  || (opcode == opcode_jalr_c);
+             dep    = (issue_engine.data[instr_rs1_msb_c : instr_rs1_lsb_c] == nbld.rd) || // RAW
+                      (issue_engine.data[instr_rs2_msb_c : instr_rs2_lsb_c] == nbld.rd) || // RAW
+                      (issue_engine.data[instr_rd_msb_c  : instr_rd_lsb_c ] == nbld.rd);   // WAW
+             nbld.stall = nbld.busy & ((~simple) | dep |
+                                       execute_engine.sleep | trap_ctrl.exc_fire | trap_ctrl.env_start | // pending trap
+                                       issue_engine.data[34] | (issue_engine.data[33] & (~logic'(CPU_EXTENSION_RISCV_C)))); // fetch exception
+         end : nb_load_check
+
+         /* scoreboard */
+         always_ff @( posedge clk_i or negedge rstn_i ) begin : nb_load_scoreboard
+             if (rstn_i == 1'b0) begin
+                 nbld.pend <= 1'b0;
+                 nbld.wb   <= 1'b0;
+                 nbld.err  <= 1'b0;
+                 nbld.rd   <= '0;
+                 nbld.pc   <= '0;
+             end else begin
+                 nbld.wb <= 1'b0; // single write-back cycle
+                 //
+                 if (nbld.rel == 1'b1) begin // load released by the execute engine
+                     nbld.pend <= 1'b1;
+                     nbld.rd   <= execute_engine.i_reg[instr_rd_msb_c : instr_rd_lsb_c];
+                     nbld.pc   <= execute_engine.pc;
+                 end else if (nbld.pend == 1'b1) begin
+                     if (bus_d_wait_i == 1'b0) begin // bus response: aligned read data is available in the next cycle
+                         nbld.pend <= 1'b0;
+                         nbld.wb   <= 1'b1;
+                     end else if (be_load_i == 1'b1) begin // bus error: no write-back
+                         nbld.pend <= 1'b0;
+                         nbld.err  <= 1'b1;
+                     end
+                 end
+                 //
+                 if (trap_ctrl.env_start_ack == 1'b1) begin // (imprecise) exception has been taken
+                     nbld.err <= 1'b0;
+                 end
+             end
+         end : nb_load_scoreboard
+
+         assign nbld.busy = nbld.pend | nbld.wb;
+     end : nb_load_enabled
+    endgenerate
+
+    generate
+     if (CPU_NB_LOAD == 0) begin : nb_load_disabled
+         assign nbld.pend  = 1'b0;
+         assign nbld.wb    = 1'b0;
+         assign nbld.busy  = 1'b0;
+         assign nbld.err   = 1'b0;
+         assign nbld.rd    = '0;
+         assign nbld.pc    = '0;
+         assign nbld.stall = 1'b0;
+     end : nb_load_disabled
+    endgenerate
+
+    // Store Buffer Synchronization --------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] stores are retired as soon as they have been written to the store buffer of the bus unit. FENCE,
+    // SYSTEM (CSR, environment, xRET, WFI) and vector memory instructions as well as trap entry wait in DISPATCH
+    // until the buffer has been drained. A bus error of a buffered store raises an imprecise store access fault
+    // (xTVAL = address of the failed store, xEPC = last completed instruction).
+    generate
+     if (CPU_SB_DEPTH > 0) begin : sb_sync_enabled
+         always_comb begin : sb_sync_check
+             logic [6:0] opcode;
+             logic sync;
+             opcode   = issue_engine.data[instr_opcode_msb_c : instr_opcode_lsb_c];
+             sync     = (opcode == opcode_fence_c) || (opcode == opcode_system_c) || (opcode == opcode_vload_c) || (opcode == opcode_vstore_c);
+             sb_stall = (bus_sb_err_i & (~trap_ctrl.exc_buf[exc_saccess_c])) | // wait until the fault has been buffered
+                        ((~bus_sb_empty_i) & (sync | execute_engine.sleep | trap_ctrl.exc_fire | trap_ctrl.env_start)); // drain first
+         end : sb_sync_check
+     end : sb_sync_enabled
+    endgenerate
+
+    generate
+     if (CPU_SB_DEPTH == 0) begin : sb_sync_disabled
+         assign sb_stall = 1'b0;
+     end : sb_sync_disabled
+    endgenerate
+
+    /* dispatch hold */
+    assign issue_engine.hold = nbld.stall | sb_stall;
+
+    // Zcmp/Zcmt Micro-Sequencer -----------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] compressed push/pop/move and table-jump macro-operations are executed as a sequence of regular
+    // micro-ops (sw, lw, addi, jalr) that are dispatched in DISPATCH instead of reading the issue engine. The PC
+    // stays at the macro-operation until its last micro-op and the stack pointer is only modified at the end of the
+    // sequence, so an exception of a load/store micro-op restarts the whole macro-operation (xEPC = macro-op.).
+    // Interrupts are deferred until the sequence has completed. CM.JT/CM.JALT read the jump table entry via the
+    // data bus (a load checked by the PMP as data access) and jump to it using an internal immediate.
+    generate
+     if ((CPU_EXTENSION_RISCV_Zcmp == 1) || (CPU_EXTENSION_RISCV_Zcmt == 1)) begin : zcmp_enabled
+         /* next micro-op */
+         always_comb begin : zcmp_uop_gen
+             logic [4:0]  num;  // number of registers in rlist
+             logic [4:0]  nw;   // number of 16-byte blocks required to save rlist
+             logic [6:0]  adj;  // stack adjustment (bytes)
+             logic [4:0]  dif;  // transfer index - num (negative)
+             logic [11:0] offs; // stack offset of current register transfer
+             logic [4:0]  rreg; // register of current transfer
+             logic [4:0]  r1s, r2s;
+             logic        ret, retz;
+             //
+             num  = (zcmp.instr[7:4] == 4'hf) ? 5'd13 : ({1'b0, zcmp.instr[7:4]} - 5'd3); // {ra, s0..s11} or {ra, s0..s(rlist-5)}
+             nw   = (num + 5'd3) >> 2;
+             adj  = {nw[2:0], 4'b0000} + {1'b0, zcmp.instr[3:2], 4'b0000}; // stack_adj_base + spimm * 16
+             dif  = zcmp.cnt - num;
+             ret  = zcmp.instr[10];                     // CM.POPRET(Z)
+             retz = (zcmp.instr[10:9] == 2'b10);        // CM.POPRETZ
+             r1s  = (zcmp.instr[9:8] == 2'b00) ? {4'b0100, zcmp.instr[7]} : {2'b10, zcmp.instr[9:7]}; // sreg: s0, s1, s2..s7
+             r2s  = (zcmp.instr[4:3] == 2'b00) ? {4'b0100, zcmp.instr[2]} : {2'b10, zcmp.instr[4:2]};
+             //
+             unique case (zcmp.cnt)
+                 5'd0    : rreg = 5'd1; // ra
+                 5'd1    : rreg = 5'd8; // s0
+                 5'd2    : rreg = 5'd9; // s1
+                 default : rreg = zcmp.cnt + 5'd15; // s2..s11
+             endcase
+             //
+             if (zcmp.instr[12:11] == 2'b11) begin // CM.PUSH, CM.POP, CM.POPRETZ, CM.POPRET
+                 if (zcmp.instr[10:9] == 2'b00) begin // push: highest register at -4(sp)
+                     offs = {{5{dif[4]}}, dif, 2'b00};
+                 end else begin // pop: highest register at stack_adj-4(sp)
+                     offs = {5'b00000, adj} + {{5{dif[4]}}, dif, 2'b00};
+                 end
+                 //
+                 if (zcmp.cnt < num) begin // register transfer
+                     if (zcmp.instr[10:9] == 2'b00) begin
+                         zcmp.uop = {offs[11:5], rreg, 5'd2, funct3_sw_c, offs[4:0], opcode_store_c}; // sw rreg, offs(sp)
+                     end else begin
+                         zcmp.uop = {offs, 5'd2, funct3_lw_c, rreg, opcode_load_c}; // lw rreg, offs(sp)
+                     end
+                 end else if ((retz == 1'b1) && (dif == 5'd0)) begin
+                     zcmp.uop = {12'h000, 5'd0, funct3_subadd_c, 5'd10, opcode_alui_c}; // li a0, 0
+                 end else if (dif == {4'b0000, retz}) begin
+                     if (zcmp.instr[10:9] == 2'b00) begin
+                         zcmp.uop = {(12'h000 - {5'b00000, adj}), 5'd2, funct3_subadd_c, 5'd2, opcode_alui_c}; // addi sp, sp, -stack_adj
+                     end else begin
+                         zcmp.uop = {{5'b00000, adj}, 5'd2, funct3_subadd_c, 5'd2, opcode_alui_c}; // addi sp, sp, +stack_adj
+                     end
+                 end else begin
+                     zcmp.uop = {12'h000, 5'd1, 3'b000, 5'd0, opcode_jalr_c}; // ret
+                 end
+                 zcmp.last = (zcmp.cnt >= num) && (dif == ({4'b0000, ret} + {4'b0000, retz}));
+             end else if (zcmp.instr[12:10] == 3'b011) begin // CM.MVSA01, CM.MVA01S
+                 if (zcmp.instr[6] == 1'b1) begin // CM.MVA01S
+                     zcmp.uop = (zcmp.cnt[0] == 1'b0) ? {12'h000, r1s, funct3_subadd_c, 5'd10, opcode_alui_c} : // mv a0, r1s
+                                                        {12'h000, r2s, funct3_subadd_c, 5'd11, opcode_alui_c};  // mv a1, r2s
+                 end else begin // CM.MVSA01
+                     zcmp.uop = (zcmp.cnt[0] == 1'b0) ? {12'h000, 5'd10, funct3_subadd_c, r1s, opcode_alui_c} : // mv r1s, a0
+                                                        {12'h000, 5'd11, funct3_subadd_c, r2s, opcode_alui_c};  // mv r2s, a1
+                 end
+                 zcmp.last = zcmp.cnt[0];
+             end else begin // CM.JT, CM.JALT: load table entry, then jump (address/target via internal immediate)
+                 if (zcmp.cnt[0] == 1'b0) begin
+                     zcmp.uop = {12'h000, 5'd0, funct3_lw_c, 5'd0, opcode_load_c}; // lw x0, jvt.base+index*4(x0)
+                 end else begin
+                     zcmp.uop = {12'h000, 5'd0, 3'b000, {4'b0000, (zcmp.instr[9:7] != 3'b000)}, opcode_jalr_c}; // jalr x0/ra, target(x0)
+                 end
+                 zcmp.last = zcmp.cnt[0];
+             end
+         end : zcmp_uop_gen
+
+         /* sequence control */
+         always_ff @( posedge clk_i or negedge rstn_i ) begin : zcmp_sequencer
+             if (rstn_i == 1'b0) begin
+                 zcmp.busy     <= 1'b0;
+                 zcmp.instr    <= '0;
+                 zcmp.cnt      <= '0;
+                 zcmp.bp_taken <= 1'b0;
+                 zcmp.imm_en   <= 1'b0;
+                 zcmp.imm      <= '0;
+                 zcmp.cap      <= 1'b0;
+             end else begin
+                 if (zcmp.start == 1'b1) begin // macro-operation in EXECUTE
+                     zcmp.busy     <= 1'b1;
+                     zcmp.instr    <= execute_engine.i_reg[31:16];
+                     zcmp.cnt      <= '0;
+                     zcmp.bp_taken <= execute_engine.bp_taken;
+                 end else if (execute_engine.state == TRAP_ENTER) begin // exception: abort, macro-operation is restarted later
+                     zcmp.busy <= 1'b0;
+                 end else if (zcmp.next == 1'b1) begin // micro-op dispatched
+                     zcmp.busy <= ~zcmp.last;
+                     zcmp.cnt  <= zcmp.cnt + 1'b1;
+                 end
+                 //
+                 /* Zcmt: internal immediate */
+                 zcmp.cap <= ((execute_engine.state == MEM_WAIT) && (bus_d_wait_i == 1'b0) && (zcmp.imm_en == 1'b1)) ? 1'b1 : 1'b0;
+                 if (zcmp.next == 1'b1) begin
+                     zcmp.imm_en <= (zcmp.instr[12:10] == 3'b000) ? 1'b1 : 1'b0; // CM.JT / CM.JALT
+                 end else if ((execute_engine.state == DISPATCH) && (zcmp.busy == 1'b0)) begin
+                     zcmp.imm_en <= 1'b0;
+                 end
+                 if (zcmp.cap == 1'b1) begin // table entry read data available
+                     zcmp.imm <= {mem_i[XLEN-1:1], 1'b0}; // jump target
+                 end else if ((zcmp.next == 1'b1) && (zcmp.cnt[0] == 1'b0)) begin
+                     zcmp.imm <= {csr.jvt, 6'b000000} + {zcmp.instr[9:2], 2'b00}; // table entry address: jvt.base + index * 4
+                 end
+             end
+         end : zcmp_sequencer
+
+         /* wait for outstanding load / store buffer before dispatching the next micro-op */
+         assign zcmp.stall = nbld.busy | sb_stall;
+         /* macro-operation (or one of its micro-ops except the last one) in execution */
+         assign zcmp.hold  = zcmp.busy | ((execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_zcm_c) ? 1'b1 : 1'b0);
+     end : zcmp_enabled
+    endgenerate
+
+    generate
+     if ((CPU_EXTENSION_RISCV_Zcmp == 0) && (CPU_EXTENSION_RISCV_Zcmt == 0)) begin : zcmp_disabled
+         assign zcmp.busy     = 1'b0;
+         assign zcmp.instr    = '0;
+         assign zcmp.cnt      = '0;
+         assign zcmp.uop      = '0;
+         assign zcmp.last     = 1'b0;
+         assign zcmp.stall    = 1'b0;
+         assign zcmp.hold     = 1'b0;
+         assign zcmp.bp_taken = 1'b0;
+         assign zcmp.imm_en   = 1'b0;
+         assign zcmp.imm      = '0;
+         assign zcmp.cap      = 1'b0;
+     end : zcmp_disabled
+    endgenerate
+
     // Execute Engine FSM Sync -------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     always_ff @( posedge clk_i or negedge rstn_i) begin : execute_engine_fsm_sync
@@ -669,6 +1627,8 @@ module cellrv32_cpu_control #(
          execute_engine.state_prev  <= BRANCHED;
          execute_engine.state_prev2 <= BRANCHED;
          execute_engine.branched    <= 1'b1; // reset is a branch from "somewhere"
+         execute_engine.bp_taken    <= 1'b0;
+         execute_engine.lp          <= 2'b00;
          execute_engine.i_reg       <= '0;
          execute_engine.is_ci       <= 1'b0;
          execute_engine.is_ici      <= 1'b0;
@@ -683,6 +1643,8 @@ module cellrv32_cpu_control #(
          execute_engine.state_prev  <= execute_engine.state; // for HPMs only
          execute_engine.state_prev2 <= execute_engine.state_prev; // for HPMs only
          execute_engine.branched    <= execute_engine.branched_nxt;
+         execute_engine.bp_taken    <= execute_engine.bp_taken_nxt;
+         execute_engine.lp          <= execute_engine.lp_nxt;
          execute_engine.i_reg       <= execute_engine.i_reg_nxt;
          execute_engine.is_ci       <= execute_engine.is_ci_nxt;
          execute_engine.is_ici      <= execute_engine.is_ici_nxt;
@@ -704,7 +1666,11 @@ module cellrv32_cpu_control #(
 
          /* PC update */
          if (execute_engine.pc_we == 1'b1) begin
-             if (execute_engine.pc_mux_sel == 1'b0) begin
+             if (execute_engine.pipe_dsp == 1'b1) begin
+                 execute_engine.pc <= execute_engine.pc + execute_engine.next_pc_inc; // pipelined dispatch: next_pc is not available yet
+             end else if (hwlp.jump == 1'b1) begin
+                 execute_engine.pc <= hwlp.target; // end of hardware loop body: back to loop start
+             end else if (execute_engine.pc_mux_sel == 1'b0) begin
                  execute_engine.pc <= {execute_engine.next_pc[XLEN-1:1], 1'b0}; // normal (linear) increment OR trap enter/exit
              end else begin
                  execute_engine.pc <= {alu_add_i[XLEN-1:1], 1'b0}; // jump/taken_branch
@@ -719,6 +1685,8 @@ module cellrv32_cpu_control #(
                      execute_engine.next_pc <= CPU_DEBUG_PARK_ADDR; // debug mode enter; start at "parking loop" <normal_entry>
                  end else if ((debug_ctrl.running == 1'b1) && (CPU_EXTENSION_RISCV_Sdext == 1)) begin
                      execute_engine.next_pc <= CPU_DEBUG_EXC_ADDR; // debug mode enter: start at "parking loop" <exception_entry>
+                 end else if ((CPU_IRQ_VECTORED == 1) && (csr.mtvec[0] == 1'b1) && (trap_ctrl.cause[$bits(trap_ctrl.cause)-1] == 1'b1)) begin
+                     execute_engine.next_pc <= {csr.mtvec[XLEN-1:2], 2'b00} + {trap_ctrl.cause[4:0], 2'b00}; // vectored mode: interrupts start at base + 4*cause
                  end else begin // normal start of trap
                      execute_engine.next_pc <= {csr.mtvec[XLEN-1:2], 2'b00}; // trap enter
                  end
@@ -734,7 +1702,9 @@ module cellrv32_cpu_control #(
              // normal increment
              EXECUTE : execute_engine.next_pc <= execute_engine.pc + execute_engine.next_pc_inc; // next linear PC
              default: begin
-                 // do nothing
+                 if (hwlp.jump == 1'b1) begin // end of hardware loop body: next instruction is the first one of the loop body
+                     execute_engine.next_pc <= hwlp.target;
+                 end
              end
          endcase
      end
@@ -742,11 +1712,69 @@ module cellrv32_cpu_control #(
 
     /* PC increment for next linear instruction (+2 for compressed instr., +4 otherwise) */
     assign execute_engine.next_pc_inc[XLEN-1:4] = '0;
-    assign execute_engine.next_pc_inc[3:0] = ((execute_engine.is_ci == 1'b0) || (CPU_EXTENSION_RISCV_C == 0)) ? 4'h4 : 4'h2;
+    assign execute_engine.next_pc_inc[3:0] = (zcmp.hold == 1'b1) ? 4'h0 : // Zcmp/Zcmt: PC stays at the macro-operation until its last micro-op
+                                             ((dual.valid == 1'b1) || (fuse.valid == 1'b1)) ? 4'h8 : // dual-issue/fusion: two 32-bit instructions
+                                             ((execute_engine.is_ci == 1'b0) || (CPU_EXTENSION_RISCV_C == 0)) ? 4'h4 : 4'h2;
 
     /* PC output */
     assign curr_pc_o = {execute_engine.pc[XLEN-1:1], 1'b0}; // current PC
     assign next_pc_o = {execute_engine.next_pc[XLEN-1:1], 1'b0}; // next PC
+
+    // Instruction Trace Port --------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] Only events the trace decoder cannot infer from the program image are reported:
+    // conditional branch outcomes, indirect jumps, hardware loop wraps and trap entry/exit.
+    // Nothing is reported while the CPU is in debug mode (except for leaving it via dret).
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : trace_port
+        if (rstn_i == 1'b0) begin
+            trace_o               <= '0;
+            trace_ctrl.fused      <= 1'b0;
+            trace_ctrl.trap_en    <= 1'b0;
+            trace_ctrl.trap_src   <= '0;
+            trace_ctrl.trap_cause <= '0;
+        end else begin
+            /* defaults */
+            trace_o.br   <= 1'b0;
+            trace_o.jmp  <= 1'b0;
+            trace_o.trap <= 1'b0;
+            trace_o.tret <= 1'b0;
+            /* fused auipc+jalr is executed as JAL */
+            if (execute_engine.state == EXECUTE) begin
+                trace_ctrl.fused <= fuse.valid;
+            end
+            /* trap source: interrupted/faulting instruction or xRET of a tail-chained handler */
+            if (trap_ctrl.env_start_ack == 1'b1) begin
+                trace_ctrl.trap_en    <= ~debug_ctrl.running;
+                trace_ctrl.trap_src   <= (irqc.tail == 1'b1) ? {execute_engine.pc[XLEN-1:1], 1'b0} : trap_ctrl.epc;
+                trace_ctrl.trap_cause <= trap_ctrl.cause;
+            end
+            //
+            if ((execute_engine.state == BRANCH) && (trap_ctrl.exc_buf[exc_iillegal_c] == 1'b0) && (debug_ctrl.running == 1'b0)) begin
+                trace_o.br    <= ~execute_engine.i_reg[instr_opcode_lsb_c+2]; // conditional branch
+                trace_o.taken <= execute_engine.branch_taken;
+                trace_o.jmp   <= execute_engine.i_reg[instr_opcode_lsb_c+2] & ((~execute_engine.i_reg[instr_opcode_lsb_c+3]) | trace_ctrl.fused); // JALR only, JAL is inferable
+                trace_o.src   <= {execute_engine.pc[XLEN-1:1], 1'b0};
+                if ((execute_engine.i_reg[instr_opcode_lsb_c+2] == 1'b1) || (execute_engine.branch_taken == 1'b1)) begin
+                    trace_o.tgt <= {alu_add_i[XLEN-1:1], 1'b0};
+                end else begin
+                    trace_o.tgt <= {execute_engine.next_pc[XLEN-1:1], 1'b0};
+                end
+            end else if ((execute_engine.state == TRAP_EXECUTE) && (execute_engine.state_prev == TRAP_ENTER)) begin
+                trace_o.trap  <= trace_ctrl.trap_en;
+                trace_o.cause <= trace_ctrl.trap_cause;
+                trace_o.src   <= trace_ctrl.trap_src;
+                trace_o.tgt   <= {execute_engine.next_pc[XLEN-1:1], 1'b0}; // trap vector
+            end else if ((execute_engine.state == TRAP_EXECUTE) && (execute_engine.state_prev == TRAP_EXIT)) begin
+                trace_o.tret  <= 1'b1;
+                trace_o.src   <= {execute_engine.pc[XLEN-1:1], 1'b0}; // xRET instruction
+                trace_o.tgt   <= {execute_engine.next_pc[XLEN-1:1], 1'b0}; // xEPC
+            end else if ((hwlp.jump == 1'b1) && (debug_ctrl.running == 1'b0)) begin
+                trace_o.jmp   <= 1'b1;
+                trace_o.src   <= {execute_engine.pc[XLEN-1:1], 1'b0}; // last instruction of the loop body
+                trace_o.tgt   <= hwlp.target;
+            end
+        end
+    end : trace_port
     
     // CPU Control Bus Output --------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -755,25 +1783,48 @@ module cellrv32_cpu_control #(
      ctrl_o.rf_wb_en   = ctrl.rf_wb_en & (~trap_ctrl.exc_buf[exc_iillegal_c]); // no write if illegal instruction
      ctrl_o.rf_rs1     = execute_engine.i_reg[instr_rs1_msb_c : instr_rs1_lsb_c];
      ctrl_o.rf_rs2     = execute_engine.i_reg[instr_rs2_msb_c : instr_rs2_lsb_c];
-     ctrl_o.rf_rs3     = execute_engine.i_reg[instr_rs3_msb_c : instr_rs3_lsb_c];
-     ctrl_o.rf_rd      = execute_engine.i_reg[instr_rd_msb_c  : instr_rd_lsb_c ];
+     if (dual.valid == 1'b1) begin // dual-issue: 3rd and 4th read port provide second slot's operands
+         ctrl_o.rf_rs3   = dual.i_reg[instr_rs1_msb_c : instr_rs1_lsb_c];
+         ctrl_o.rf_rs4   = dual.i_reg[instr_rs2_msb_c : instr_rs2_lsb_c];
+     end else if ((CPU_PSIMD == 1) && (execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_psimd_c)) begin // packed-SIMD: rd is the accumulator (KMADA)
+         ctrl_o.rf_rs3   = execute_engine.i_reg[instr_rd_msb_c : instr_rd_lsb_c];
+         ctrl_o.rf_rs4   = {execute_engine.i_reg[instr_funct7_lsb_c+1 : instr_funct7_lsb_c], execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c]}; // not RISC-V-standard!
+     end else begin
+         ctrl_o.rf_rs3   = execute_engine.i_reg[instr_rs3_msb_c : instr_rs3_lsb_c];
+         ctrl_o.rf_rs4   = {execute_engine.i_reg[instr_funct7_lsb_c+1 : instr_funct7_lsb_c], execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c]}; // not RISC-V-standard!
+     end
+     ctrl_o.rf_wb2_en  = ctrl.rf_wb2_en & (~trap_ctrl.exc_buf[exc_iillegal_c]); // no write if illegal instruction
+     ctrl_o.rf_rd2     = ctrl.rf_rd2;
+     if (CPU_PIPELINE_MODE == 1) begin // i_reg might already contain the next instruction during write-back
+         ctrl_o.rf_rd    = ctrl.rf_rd;
+     end else begin
+         ctrl_o.rf_rd    = execute_engine.i_reg[instr_rd_msb_c  : instr_rd_lsb_c ];
+     end
      ctrl_o.rf_mux     = ctrl.rf_mux;
      ctrl_o.rf_zero_we = ctrl.rf_zero_we;
+     ctrl_o.rf_wbl_en  = nbld.wb;
+     ctrl_o.rf_rdl     = nbld.rd;
+     ctrl_o.rf_bank    = csr.rf_bank;
      /* alu */
      ctrl_o.alu_op       = ctrl.alu_op;
      ctrl_o.alu_opa_mux  = ctrl.alu_opa_mux;
      ctrl_o.alu_opb_mux  = ctrl.alu_opb_mux;
+     ctrl_o.alu_opa_sh   = ctrl.alu_opa_sh;
      ctrl_o.alu_unsigned = ctrl.alu_unsigned;
      ctrl_o.alu_frm      = csr.frm;
      ctrl_o.alu_reconfig = ctrl.alu_reconfig;
      ctrl_o.alu_vlmax    = csr.vlmax;
      ctrl_o.alu_vl       = csr.vl;
      ctrl_o.alu_cp_trig  = ctrl.alu_cp_trig;
+     ctrl_o.alu2_op      = ctrl.alu2_op;
+     ctrl_o.alu2_opb_mux = ctrl.alu2_opb_mux;
+     ctrl_o.alu2_unsigned= ctrl.alu2_unsigned;
      /* bus interface */
      ctrl_o.bus_req    = ctrl.bus_req;
      ctrl_o.bus_mo_we  = ctrl.bus_mo_we;
      ctrl_o.bus_fence  = ctrl.bus_fence;
      ctrl_o.bus_fencei = ctrl.bus_fencei;
+     ctrl_o.bus_dflush = ctrl.bus_dflush;
      //
      // effective privilege level for loads and stores in M-mode
      if (csr.mstatus_mprv == 1'b1) begin
@@ -802,12 +1853,17 @@ module cellrv32_cpu_control #(
      /* defaults */
      decode_aux.is_v_op   = 1'b0;
      decode_aux.is_f_op   = 1'b0;
+     decode_aux.is_f_fma  = 1'b0;
      decode_aux.is_h_op   = 1'b0;
+     decode_aux.is_h_fma  = 1'b0;
      decode_aux.is_m_mul  = 1'b0;
      decode_aux.is_m_div  = 1'b0;
      decode_aux.is_b_imm  = 1'b0;
      decode_aux.is_b_reg  = 1'b0;
      decode_aux.is_zicond = 1'b0;
+     decode_aux.is_p_op   = 1'b0;
+     decode_aux.is_pref   = 1'b0;
+     decode_aux.is_cbz    = 1'b0;
      decode_aux.rs1_zero  = 1'b0;
      decode_aux.rd_zero   = 1'b0;
      //
@@ -836,7 +1892,8 @@ module cellrv32_cpu_control #(
          /* register-register operation */
          if (((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0110000) && (execute_engine.i_reg[instr_funct3_msb_c-1 : instr_funct3_lsb_c] == 2'b01))  || // ROR / ROL
               ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000101) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] != 3'b000)) || // MIN[U] / MAX[U] / CMUL[H/R]
-              ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b100)) || // ZEXTH
+              ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b100)  &&
+                                                                                                (execute_engine.i_reg[instr_funct12_lsb_c+4 : instr_funct12_lsb_c] == 5'b00000)) || // ZEXTH
               ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0100100) && (execute_engine.i_reg[instr_funct3_msb_c-1 : instr_funct3_lsb_c] == 2'b01))  || // BCLR / BEXT
               ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0110100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b001)) || // BINV
               ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0010100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b001)) || // BSET
@@ -851,6 +1908,40 @@ module cellrv32_cpu_control #(
              decode_aux.is_b_reg = 1'b1;
          end
      end
+
+     /* is scalar cryptography instruction? (Zbkb, Zbkc, Zbkx, Zkne, Zknd, Zknh) */
+     /* these share the bit-manipulation co-processor and its is_b_* decoding flags */
+     if (CPU_EXTENSION_RISCV_Zkn == 1) begin
+         /* register-immediate operation */
+         if (((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0110000) && (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b101)) || // RORI
+             ((execute_engine.i_reg[instr_funct12_msb_c : instr_funct12_lsb_c] == 12'h698)  && (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b101)) || // REV8
+             ((execute_engine.i_reg[instr_funct12_msb_c : instr_funct12_lsb_c] == 12'h687)  && (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b101)) || // BREV8
+             ((execute_engine.i_reg[instr_funct12_msb_c : instr_funct12_lsb_c] == 12'h08f)  && (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b001)) || // ZIP
+             ((execute_engine.i_reg[instr_funct12_msb_c : instr_funct12_lsb_c] == 12'h08f)  && (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b101)) || // UNZIP
+             ((execute_engine.i_reg[instr_funct12_msb_c : instr_funct12_lsb_c+2] == 10'b0001000000) &&
+              (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b001))) begin // SHA256SIG0/1 / SHA256SUM0/1
+             decode_aux.is_b_imm = 1'b1;
+         end
+         //
+         /* register-register operation */
+         if (((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0110000) && (execute_engine.i_reg[instr_funct3_msb_c-1 : instr_funct3_lsb_c] == 2'b01))  || // ROR / ROL
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0100000) &&
+             ((execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b111) ||       // ANDN
+              (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b110) ||       // ORN
+              (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b100))) ||     // XNOR
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b100)) || // PACK
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b111)) || // PACKH
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000101) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b001)) || // CLMUL
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000101) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b011)) || // CLMULH
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0010100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b100)) || // XPERM8
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0010100) && (execute_engine.i_reg[instr_funct3_msb_c   : instr_funct3_lsb_c] == 3'b010)) || // XPERM4
+             ((execute_engine.i_reg[instr_funct7_msb_c-2 : instr_funct7_lsb_c+3] == 2'b10) && (execute_engine.i_reg[instr_funct7_lsb_c] == 1'b1) &&
+              (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b000)) || // AES32ES[M]I / AES32DS[M]I
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c+3] == 4'b0101) && (execute_engine.i_reg[instr_funct7_lsb_c+2 : instr_funct7_lsb_c+1] != 2'b10) &&
+              (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b000))) begin // SHA512SUM0R/SUM1R/SIG0L/SIG0H/SIG1L/SIG1H
+             decode_aux.is_b_reg = 1'b1;
+         end
+     end
      
      /* single-precision floating-point operations (Zfinx) */
      /* half-precision floating-point operations (Zhinx) */
@@ -874,6 +1965,40 @@ module cellrv32_cpu_control #(
                 decode_aux.is_h_op = 1'b1;
             end
         end
+        // packed half-precision operations (custom, fmt = 11): FADD / FSUB / FMUL / FMIN / FMAX only
+        if ((CPU_FP16_SIMD == 1) && (execute_engine.i_reg[instr_funct7_lsb_c+1 : instr_funct7_lsb_c] == float_packed_c)) begin
+            if (((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c+3] == 4'b0000))  || // FADD.PH / FSUB.PH
+                ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c+2] == 5'b00010)) || // FMUL.PH
+                ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c+2] == 5'b00101)  && (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_msb_c-1] == 2'b00))) begin // FMIN.PH / FMAX.PH
+                decode_aux.is_h_op = 1'b1;
+            end
+        end
+        // FMADD.S / FMSUB.S / FNMSUB.S / FNMADD.S (opcode selects the operation)
+        if ((FPU_PERF == 1) && (execute_engine.i_reg[instr_funct7_lsb_c+1 : instr_funct7_lsb_c] == float_single_c)) begin
+            decode_aux.is_f_fma = 1'b1;
+        end
+        // FMADD.H / FMSUB.H / FNMSUB.H / FNMADD.H and their packed (.PH) versions
+        if ((CPU_FP16_SIMD == 1) && ((execute_engine.i_reg[instr_funct7_lsb_c+1 : instr_funct7_lsb_c] == float_half_c) ||
+                                 (execute_engine.i_reg[instr_funct7_lsb_c+1 : instr_funct7_lsb_c] == float_packed_c))) begin
+            decode_aux.is_h_fma = 1'b1;
+        end
+     end
+
+     /* packed-SIMD DSP operations (P extension subset) */
+     if (CPU_PSIMD == 1) begin // packed-SIMD unit implemented at all?
+        if (((execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b000) && (execute_engine.i_reg[instr_funct7_lsb_c+1] == 1'b0) &&
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_msb_c-1] == 2'b00) ||                         // [U]RADD / [U]RSUB / [U]KADD / [U]KSUB (8/16)
+              (execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c+3] == 4'b0100))) ||                     // ADD / SUB (8/16)
+            ((execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b000) && (execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b1010110) &&
+             ((execute_engine.i_reg[instr_rs2_msb_c : instr_rs2_msb_c-1] == 2'b01) ||                                // [S|Z]UNPKD810 / 820 / 830 / 831
+              ((execute_engine.i_reg[instr_rs2_msb_c : instr_rs2_msb_c-1] == 2'b10) && (execute_engine.i_reg[instr_rs2_lsb_c+1 : instr_rs2_lsb_c] == 2'b11)))) || // [S|Z]UNPKD832
+            ((execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b001) && (execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_msb_c-1] == 2'b00) &&
+             (execute_engine.i_reg[instr_funct7_lsb_c+2 : instr_funct7_lsb_c] == 3'b111)) ||                          // PKBB16 / PKBT16 / PKTB16 / PKTT16
+            ((execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == 3'b001) &&
+             ((execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0011100) ||                         // KMDA
+              (execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0100100)))) begin                   // KMADA
+            decode_aux.is_p_op = 1'b1;
+        end
      end
 
      /* vector operations (V) */
@@ -971,6 +2096,25 @@ module cellrv32_cpu_control #(
          decode_aux.is_zicond = 1'b1;
      end
 
+     /* cache-block prefetch hints (Zicbop): ORI with rd = x0 and imm[4:0] = hint type */
+     if ((CPU_EXTENSION_RISCV_Zicbop == 1) && (fuse.valid == 1'b0) &&
+         (execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_alui_c) &&
+         (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_or_c) &&
+         (execute_engine.i_reg[instr_rd_msb_c : instr_rd_lsb_c] == 5'b00000) &&
+         ((execute_engine.i_reg[instr_rs2_msb_c : instr_rs2_lsb_c] == pref_i_c) ||
+          (execute_engine.i_reg[instr_rs2_msb_c : instr_rs2_lsb_c] == pref_r_c) ||
+          (execute_engine.i_reg[instr_rs2_msb_c : instr_rs2_lsb_c] == pref_w_c))) begin
+         decode_aux.is_pref = 1'b1;
+     end
+
+     /* cache-block zero (Zicboz) */
+     if ((CPU_EXTENSION_RISCV_Zicboz == 1) &&
+         (execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_fence_c) &&
+         (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_cbo_c) &&
+         (execute_engine.i_reg[instr_imm12_msb_c : instr_imm12_lsb_c] == funct12_cbo_zero_c)) begin
+         decode_aux.is_cbz = 1'b1;
+     end
+
      /* register/uimm5 checks */
      if (execute_engine.i_reg[instr_rs1_msb_c : instr_rs1_lsb_c] == 5'b00000) begin
          decode_aux.rs1_zero = 1'b1;
@@ -993,8 +2137,18 @@ module cellrv32_cpu_control #(
      execute_engine.is_ici_nxt   = 1'b0;
      execute_engine.sleep_nxt    = execute_engine.sleep;
      execute_engine.branched_nxt = execute_engine.branched;
+     execute_engine.bp_taken_nxt = execute_engine.bp_taken;
+     execute_engine.lp_nxt       = execute_engine.lp;
      execute_engine.pc_mux_sel   = 1'b0;
      execute_engine.pc_we        = 1'b0;
+     execute_engine.pipe_dsp     = 1'b0;
+     dual.dsp                    = 1'b0;
+     fuse.dsp                    = 1'b0;
+     nbld.rel                    = 1'b0;
+     zcmp.start                  = 1'b0;
+     zcmp.next                   = 1'b0;
+     pref.ic_nxt                 = 1'b0;
+     pref.dc_nxt                 = 1'b0;
 
      /* instruction dispatch defaults */
      fetch_engine.reset = 1'b0;
@@ -1019,6 +2173,7 @@ module cellrv32_cpu_control #(
      ctrl_nxt.rf_mux = rf_mux_alu_c;    // default RF input: ALU
      ctrl_nxt.alu_cp_trig  = '0;
      ctrl_nxt.alu_reconfig = 1'b0;
+     ctrl_nxt.rf_rd        = execute_engine.i_reg[instr_rd_msb_c : instr_rd_lsb_c]; // buffered for pipelined write-back
 
      /* ALU sign control */
      if (execute_engine.i_reg[instr_opcode_lsb_c+4] == 1'b1) begin // ALU ops
@@ -1035,28 +2190,52 @@ module cellrv32_cpu_control #(
              /* update PC and compressed instruction status flags */
              execute_engine.pc_mux_sel = 1'b0; // next PC
              execute_engine.pc_we      = ~execute_engine.branched; // update PC with next_pc if there was no actual branch
-             execute_engine.is_ci_nxt  = issue_engine.data[32];    // this is a de-compressed instruction
-             execute_engine.is_ici_nxt = issue_engine.data[35];    // this is an illegal compressed instruction
              //
-             if ((issue_engine.valid[0] == 1'b1) || (issue_engine.valid[1] == 1'b1)) begin // instruction available?
-                  /* update IR *only* if we have a new instruction word available as this register must not contain non-defined values */
-                  execute_engine.i_reg_nxt = issue_engine.data[31:0]; // <has to stay here>
-                  /* clear branch flipflop */
-                  execute_engine.branched_nxt = 1'b0;
-                  /* instruction fetch exceptions */
-                  trap_ctrl.instr_ma = issue_engine.data[33] & (~CPU_EXTENSION_RISCV_C); // misaligned instruction fetch (if C disabled)
-                  trap_ctrl.instr_be = issue_engine.data[34]; // bus access fault during instruction fetch
-                  /* any reason to go to trap state? */
-                  if ((execute_engine.sleep  == 1'b1) ||     // enter sleep state
-                      (trap_ctrl.exc_fire    == 1'b1) ||     // exception during LAST instruction (e.g. illegal instruction)
-                      (trap_ctrl.env_start   == 1'b1) ||     // pending trap (IRQ or late exception)
-                     ((issue_engine.data[33] == 1'b1) && 
-                      (CPU_EXTENSION_RISCV_C == 0))   ||     // misaligned instruction fetch address (if C disabled) during instruction fetch
-                      (issue_engine.data[34] == 1'b1)) begin // bus access fault during instruction fetch
-                     execute_engine.state_nxt = TRAP_ENTER;
-                  end else begin
-                     execute_engine.state_nxt = EXECUTE;
-                  end
+             if (zcmp.busy == 1'b1) begin // Zcmp/Zcmt: issue next micro-op of the current macro-operation
+                 execute_engine.is_ci_nxt    = 1'b1; // still executing the compressed macro-operation
+                 execute_engine.bp_taken_nxt = zcmp.bp_taken & zcmp.last; // prediction applies to the final jump
+                 if (zcmp.stall == 1'b0) begin
+                     execute_engine.i_reg_nxt    = zcmp.uop;
+                     execute_engine.branched_nxt = 1'b0;
+                     if (trap_ctrl.exc_fire == 1'b1) begin // exception during last micro-op (interrupts are deferred)
+                         execute_engine.state_nxt = TRAP_ENTER;
+                     end else begin
+                         zcmp.next                = 1'b1;
+                         execute_engine.state_nxt = EXECUTE;
+                     end
+                 end
+             end else begin
+                 execute_engine.is_ci_nxt  = issue_engine.data[32];    // this is a de-compressed instruction
+                 execute_engine.is_ici_nxt = issue_engine.data[35];    // this is an illegal compressed instruction
+                 execute_engine.bp_taken_nxt = issue_engine.data[36] & logic'(CPU_BP_EN); // predicted as taken branch/jump
+                 execute_engine.lp_nxt       = issue_engine.data[38:37] & {2{logic'(CPU_HWLOOP)}}; // ends a hardware loop body
+                 //
+                 if (((issue_engine.valid[0] == 1'b1) || (issue_engine.valid[1] == 1'b1)) && // instruction available?
+                      (issue_engine.hold == 1'b0)) begin // and not waiting for an outstanding load or the store buffer
+                      /* update IR *only* if we have a new instruction word available as this register must not contain non-defined values */
+                      execute_engine.i_reg_nxt = issue_engine.data[31:0]; // <has to stay here>
+                      /* clear branch flipflop */
+                      execute_engine.branched_nxt = 1'b0;
+                      /* instruction fetch exceptions */
+                      trap_ctrl.instr_ma = issue_engine.data[33] & (~CPU_EXTENSION_RISCV_C); // misaligned instruction fetch (if C disabled)
+                      trap_ctrl.instr_be = issue_engine.data[34]; // bus access fault during instruction fetch
+                      /* any reason to go to trap state? */
+                      if ((execute_engine.sleep  == 1'b1) ||     // enter sleep state
+                          (trap_ctrl.exc_fire    == 1'b1) ||     // exception during LAST instruction (e.g. illegal instruction)
+                          (trap_ctrl.env_start   == 1'b1) ||     // pending trap (IRQ or late exception)
+                         ((issue_engine.data[33] == 1'b1) && 
+                          (CPU_EXTENSION_RISCV_C == 0))   ||     // misaligned instruction fetch address (if C disabled) during instruction fetch
+                          (issue_engine.data[34] == 1'b1)) begin // bus access fault during instruction fetch
+                         execute_engine.state_nxt = TRAP_ENTER;
+                      end else begin
+                         execute_engine.state_nxt = EXECUTE;
+                         dual.dsp                 = dual.pair & (~nbld.busy); // dual-issue: dispatch next instruction to second issue slot
+                         fuse.dsp                 = fuse.pair & (~nbld.busy); // macro-op fusion: dispatch fused instruction
+                         if (fuse.pair == 1'b1) begin
+                             execute_engine.i_reg_nxt = fuse.i_reg;
+                         end
+                      end
+                 end
              end
          end
          // --------------------------------------------------------------
@@ -1070,8 +2249,12 @@ module cellrv32_cpu_control #(
          // --------------------------------------------------------------
          // Return from trap environment and get xEPC
          TRAP_EXIT : begin
-             trap_ctrl.env_end        = 1'b1;
-             execute_engine.state_nxt = TRAP_EXECUTE;
+             if (irqc.chain == 1'b1) begin // tail-chaining: directly start the next interrupt handler
+                 execute_engine.state_nxt = TRAP_ENTER;
+             end else begin
+                 trap_ctrl.env_end        = 1'b1;
+                 execute_engine.state_nxt = TRAP_EXECUTE;
+             end
          end
          // --------------------------------------------------------------
          // Process trap environment
@@ -1134,7 +2317,7 @@ module cellrv32_cpu_control #(
                          execute_engine.state_nxt              = ALU_WAIT;
                      //
                      /* EXT: co-processor BIT-MANIPULATION operation (multi-cycle) */
-                     end else if ((CPU_EXTENSION_RISCV_B == 1) &&
+                     end else if (((CPU_EXTENSION_RISCV_B == 1) || (CPU_EXTENSION_RISCV_Zkn == 1)) &&
                                 (((execute_engine.i_reg[instr_opcode_lsb_c+5] == opcode_alu_c[5])  && (decode_aux.is_b_reg == 1'b1)) || // register operation
                                  ((execute_engine.i_reg[instr_opcode_lsb_c+5] == opcode_alui_c[5]) && (decode_aux.is_b_imm == 1'b1)))) begin
                          
@@ -1159,6 +2342,13 @@ module cellrv32_cpu_control #(
                      end else begin
                          ctrl_nxt.rf_wb_en        = 1'b1; // valid RF write-back
                          execute_engine.state_nxt = DISPATCH;
+                         execute_engine.pipe_dsp  = execute_engine.pipe_ok; // pipelined mode: dispatch next instruction right away
+                     end
+                     //
+                     /* EXT: cache-block prefetch hint (executed as ORI to x0, the ALU adder provides the hint address) */
+                     if (decode_aux.is_pref == 1'b1) begin
+                         pref.ic_nxt = ~execute_engine.i_reg[instr_rs2_lsb_c]; // prefetch.i
+                         pref.dc_nxt =  execute_engine.i_reg[instr_rs2_lsb_c]; // prefetch.r, prefetch.w
                      end
                  end
                  // --------------------------------------------------------------
@@ -1175,6 +2365,7 @@ module cellrv32_cpu_control #(
                      // 
                      ctrl_nxt.rf_wb_en        = 1'b1; // valid RF write-back
                      execute_engine.state_nxt = DISPATCH;
+                     execute_engine.pipe_dsp  = execute_engine.pipe_ok & execute_engine.i_reg[instr_opcode_lsb_c+5]; // LUI only (AUIPC needs the current PC)
                  end
                  // --------------------------------------------------------------
                  // scalar load/store
@@ -1189,6 +2380,7 @@ module cellrv32_cpu_control #(
                      ctrl_nxt.alu_cp_trig[cp_sel_vector_c] = 1'b1; // trigger VECTOR CP
                      //
                      if (CPU_EXTENSION_RISCV_V == 1) begin
+                        ctrl_nxt.bus_dflush      = 1'b1; // vector accesses bypass the d-cache: write back and invalidate it first
                         execute_engine.state_nxt = ALU_WAIT;
                      end else begin
                         execute_engine.state_nxt = DISPATCH;
@@ -1218,7 +2410,13 @@ module cellrv32_cpu_control #(
                          ctrl_nxt.bus_fencei = 1'b1; // FENCE.I
                      end
                      //
-                     execute_engine.state_nxt = TRAP_EXECUTE; // use TRAP_EXECUTE to "modify" PC (PC <= PC)
+                     if (decode_aux.is_cbz == 1'b1) begin // CBO.ZERO: block store, address = RS1 (+ zero immediate)
+                         ctrl_nxt.alu_opb_mux     = 1'b1; // use IMM as ALU.OPB
+                         ctrl_nxt.bus_mo_we       = 1'b1; // write memory output registers (data & address)
+                         execute_engine.state_nxt = MEM_REQ;
+                     end else begin
+                         execute_engine.state_nxt = TRAP_EXECUTE; // use TRAP_EXECUTE to "modify" PC (PC <= PC)
+                     end
                  end
                  // --------------------------------------------------------------
                  // half/single-precision floating-point operations
@@ -1232,6 +2430,33 @@ module cellrv32_cpu_control #(
                      end
                  end
                  // --------------------------------------------------------------
+                 // half/single-precision fused multiply-add operations (R4-type)
+                 opcode_fmadd_c, opcode_fmsub_c, opcode_fnmsub_c, opcode_fnmadd_c : begin
+                     if (((CPU_EXTENSION_RISCV_Zfinx == 1) && (FPU_PERF == 1)) || ((CPU_EXTENSION_RISCV_Zhinx == 1) && (CPU_FP16_SIMD == 1))) begin
+                         ctrl_nxt.alu_cp_trig[cp_sel_fpu32_c] = decode_aux.is_f_fma; // trigger FPU CP3
+                         ctrl_nxt.alu_cp_trig[cp_sel_fpu16_c] = decode_aux.is_h_fma; // trigger FPU CP4
+                         execute_engine.state_nxt = ALU_WAIT;
+                     end else begin
+                         execute_engine.state_nxt = DISPATCH;
+                     end
+                 end
+                 // --------------------------------------------------------------
+                 // packed-SIMD DSP operations
+                 opcode_psimd_c : begin
+                     if (CPU_PSIMD == 1) begin
+                         ctrl_nxt.alu_cp_trig[cp_sel_psimd_c] = 1'b1; // trigger PSIMD CP
+                         execute_engine.state_nxt = ALU_WAIT;
+                     end else begin
+                         execute_engine.state_nxt = DISPATCH;
+                     end
+                 end
+                 // --------------------------------------------------------------
+                 // compressed push/pop/move and table-jump macro-operations: start micro-sequence
+                 opcode_zcm_c : begin
+                     zcmp.start               = ~trap_ctrl.instr_il; // micro-ops are issued in DISPATCH
+                     execute_engine.state_nxt = DISPATCH;
+                 end
+                 // --------------------------------------------------------------
                  // CFU: custom RISC-V instructions
                  opcode_cust0_c, opcode_cust1_c, opcode_cust2_c, opcode_cust3_c : begin
                      if (CPU_EXTENSION_RISCV_Zxcfu == 1) begin
@@ -1282,6 +2507,34 @@ module cellrv32_cpu_control #(
                      execute_engine.state_nxt = DISPATCH;
                  end
              endcase
+             //
+             /* pipelined mode: overlap dispatch of next instruction with write-back of current single-cycle operation */
+             if (execute_engine.pipe_dsp == 1'b1) begin
+                 execute_engine.pc_we        = 1'b1; // PC <= PC + instruction size
+                 execute_engine.is_ci_nxt    = issue_engine.data[32];
+                 execute_engine.is_ici_nxt   = issue_engine.data[35];
+                 execute_engine.bp_taken_nxt = issue_engine.data[36] & logic'(CPU_BP_EN);
+                 execute_engine.lp_nxt       = issue_engine.data[38:37] & {2{logic'(CPU_HWLOOP)}};
+                 execute_engine.i_reg_nxt    = (fuse.pair == 1'b1) ? fuse.i_reg : issue_engine.data[31:0];
+                 execute_engine.state_nxt    = EXECUTE;
+                 dual.dsp                    = dual.pair;
+                 fuse.dsp                    = fuse.pair;
+             end
+             //
+             /* macro-op fusion: operand modifiers of the fused operation */
+             if (fuse.valid == 1'b1) begin
+                 ctrl_nxt.alu_opa_sh = fuse.sh; // shift-add
+                 if (fuse.rr == 1'b1) begin
+                     ctrl_nxt.alu_opb_mux = 1'b0; // indexed load: address = RS1 + RS2
+                 end
+             end
+             //
+             /* dual-issue: second issue slot (simple single-cycle ALU operation, write-back together with first slot) */
+             ctrl_nxt.rf_wb2_en     = dual.valid;
+             ctrl_nxt.rf_rd2        = dual.i_reg[instr_rd_msb_c : instr_rd_lsb_c];
+             ctrl_nxt.alu2_op       = dual.alu_op;
+             ctrl_nxt.alu2_opb_mux  = dual.opb_mux;
+             ctrl_nxt.alu2_unsigned = dual.i_reg[instr_funct3_lsb_c]; // SLTIU, SLTU
          end
          // --------------------------------------------------------------
          // wait for multi-cycle ALU operation (ALU co-processor) to finish
@@ -1303,8 +2556,17 @@ module cellrv32_cpu_control #(
              execute_engine.pc_we      = 1'b1; // update PC with destination; will be overridden again in DISPATCH if branch not taken
              //
              if ((execute_engine.i_reg[instr_opcode_lsb_c+2] == 1'b1) || (execute_engine.branch_taken == 1'b1)) begin // JAL/JALR or taken branch
-                 fetch_engine.reset       = 1'b1; // reset instruction fetch starting at modified PC
-                 execute_engine.state_nxt = BRANCHED;
+                 if (bp.hit == 1'b1) begin // correctly predicted: instruction fetch already continued at destination
+                     execute_engine.branched_nxt = 1'b1; // do not override PC in DISPATCH
+                     execute_engine.state_nxt    = DISPATCH;
+                 end else begin
+                     fetch_engine.reset       = 1'b1; // reset instruction fetch starting at modified PC
+                     execute_engine.state_nxt = BRANCHED;
+                 end
+             end else if (execute_engine.bp_taken == 1'b1) begin // mispredicted as taken: restart at next linear PC
+                 execute_engine.pc_mux_sel = 1'b0; // PC <= next_pc
+                 fetch_engine.reset        = 1'b1; // reset instruction fetch starting at modified PC
+                 execute_engine.state_nxt  = BRANCHED;
              end else begin
                  execute_engine.state_nxt = DISPATCH;
              end
@@ -1345,11 +2607,16 @@ module cellrv32_cpu_control #(
                  trap_ctrl.exc_buf[exc_iillegal_c]) begin // illegal instruction
                  execute_engine.state_nxt = DISPATCH; // abort!
              end else if (bus_d_wait_i == 1'b0) begin // wait for bus to finish transaction
-                 if (execute_engine.i_reg[instr_opcode_msb_c-1] == 1'b0) begin // load
+                 if ((execute_engine.i_reg[instr_opcode_msb_c-1] == 1'b0) && (decode_aux.is_cbz == 1'b0)) begin // load
                      ctrl_nxt.rf_wb_en = 1'b1; // data write-back
                  end 
                  //
                  execute_engine.state_nxt = DISPATCH;
+             end else if ((CPU_NB_LOAD == 1) && (bus_ld_ok_i == 1'b1) && // load request issued without alignment/PMP fault
+                          (execute_engine.i_reg[instr_opcode_msb_c : instr_opcode_lsb_c] == opcode_load_c) &&
+                          (zcmp.imm_en == 1'b0)) begin // Zcmt jump table entry is required right away
+                 nbld.rel                 = 1'b1; // data is written back by the scoreboard
+                 execute_engine.state_nxt = DISPATCH;
              end
          end
          // --------------------------------------------------------------
@@ -1389,6 +2656,10 @@ module cellrv32_cpu_control #(
                      (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_csrrwi_c) || // CSRRWI: always write CSR
                      (decode_aux.rs1_zero == 1'b0)) begin // CSRR(S/C)(I): write CSR if rs1/imm5 is NOT zero
                      csr.we_nxt = 1'b1;
+                     //
+                     if ((CPU_HWLOOP == 1) && (csr.addr[11:5] == csr_class_hwloop_c)) begin // hardware loop setup
+                         execute_engine.state_nxt = TRAP_EXECUTE; // re-synchronize instruction fetch (PC <= next_pc)
+                     end
                  end
                  //
                  ctrl_nxt.rf_wb_en = 1'b1; // valid RF write-back
@@ -1418,6 +2689,11 @@ module cellrv32_cpu_control #(
              csr_reg_valid = logic'(CPU_EXTENSION_RISCV_Zfinx); // valid if FPU implemented
          end
          // --------------------------------------------------------------
+         /* compressed table-jump CSR */
+         csr_jvt_c : begin
+             csr_reg_valid = logic'(CPU_EXTENSION_RISCV_Zcmt); // valid if Zcmt implemented
+         end
+         // --------------------------------------------------------------
          /* vector CSRs */
          csr_vstart_c, csr_vxsat_c, csr_vxrm_c, csr_vcsr_c,
          csr_vl_c, csr_vtype_c, csr_vlenb_c : begin
@@ -1473,6 +2749,15 @@ module cellrv32_cpu_control #(
              csr_reg_valid = logic'(CPU_EXTENSION_RISCV_Zihpm); // valid if Zihpm implemented
          end
          // --------------------------------------------------------------
+         // HPM counter-overflow CSRs
+         csr_mhpmevent3h_c   , csr_mhpmevent4h_c   , csr_mhpmevent5h_c   , csr_mhpmevent6h_c   , csr_mhpmevent7h_c   , csr_mhpmevent8h_c    , // event configuration HIGH
+         csr_mhpmevent9h_c   , csr_mhpmevent10h_c  , csr_mhpmevent11h_c  , csr_mhpmevent12h_c  , csr_mhpmevent13h_c  , csr_mhpmevent14h_c   ,
+         csr_mhpmevent15h_c  , csr_mhpmevent16h_c  , csr_mhpmevent17h_c  , csr_mhpmevent18h_c  , csr_mhpmevent19h_c  , csr_mhpmevent20h_c   ,
+         csr_mhpmevent21h_c  , csr_mhpmevent22h_c  , csr_mhpmevent23h_c  , csr_mhpmevent24h_c  , csr_mhpmevent25h_c  , csr_mhpmevent26h_c   ,
+         csr_mhpmevent27h_c  , csr_mhpmevent28h_c  , csr_mhpmevent29h_c  , csr_mhpmevent30h_c  , csr_mhpmevent31h_c  , csr_scountovf_c : begin
+             csr_reg_valid = logic'(CPU_EXTENSION_RISCV_Sscofpmf); // valid if Sscofpmf implemented
+         end
+         // --------------------------------------------------------------
          // counter and timer CSRs
          csr_cycle_c, csr_cycleh_c, csr_instret_c, csr_instreth_c : begin
              csr_reg_valid = logic'(CPU_EXTENSION_RISCV_Zicntr); // valid if Zicntr implemented
@@ -1490,6 +2775,27 @@ module cellrv32_cpu_control #(
              csr_reg_valid = logic'(CPU_EXTENSION_RISCV_Sdtrig); // valid if trigger module implemented
          end
          // --------------------------------------------------------------
+         // vectored interrupt controller CSRs
+         csr_mirqctl0_c, csr_mirqctl1_c, csr_mirqctl2_c, csr_mirqctl3_c, csr_mirqcfg_c : begin
+             csr_reg_valid = logic'(CPU_IRQ_VECTORED); // valid if vectored interrupt controller implemented
+         end
+         // --------------------------------------------------------------
+         // shadow register bank CSRs
+         csr_mshadowen_c, csr_mshadowctl_c : begin
+             csr_reg_valid = logic'(CPU_RF_SHADOW); // valid if shadow register bank implemented
+         end
+         // --------------------------------------------------------------
+         // i-cache control CSRs
+         csr_micachectl_c, csr_micachefill_c : begin
+             csr_reg_valid = logic'(CPU_ICACHE_CTRL); // valid if i-cache implemented
+         end
+         // --------------------------------------------------------------
+         // hardware loop CSRs
+         csr_lpstart0_c, csr_lpend0_c, csr_lpcount0_c,
+         csr_lpstart1_c, csr_lpend1_c, csr_lpcount1_c : begin
+             csr_reg_valid = logic'(CPU_HWLOOP); // valid if hardware loops implemented
+         end
+         // --------------------------------------------------------------
          // undefined / not implemented
          default: begin
              csr_reg_valid = 1'b0; // invalid access
@@ -1609,7 +2915,7 @@ module cellrv32_cpu_control #(
                     (execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000000))) || // valid base ALU instruction?
             (((CPU_EXTENSION_RISCV_M == 1) || (CPU_EXTENSION_RISCV_Zmmul == 1)) && (decode_aux.is_m_mul == 1'b1)) || // valid MUL instruction?
             ((CPU_EXTENSION_RISCV_M == 1) && (decode_aux.is_m_div == 1'b1)) || // valid DIV instruction?
-            ((CPU_EXTENSION_RISCV_B == 1) && (decode_aux.is_b_reg == 1'b1)) || // valid BITMANIP register instruction?
+            (((CPU_EXTENSION_RISCV_B == 1) || (CPU_EXTENSION_RISCV_Zkn == 1)) && (decode_aux.is_b_reg == 1'b1)) || // valid BITMANIP register instruction?
             ((CPU_EXTENSION_RISCV_Zicond == 1) && (decode_aux.is_zicond == 1'b1))) begin // valid CONDITIONAL instruction?
                  illegal_cmd = 1'b0;
              end else begin
@@ -1631,7 +2937,7 @@ module cellrv32_cpu_control #(
                    (execute_engine.i_reg[instr_funct7_msb_c : instr_funct7_lsb_c] == 7'b0000000)) ||
                   ((execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c] == funct3_sr_c) &&
                    ((execute_engine.i_reg[instr_funct7_msb_c-2 : instr_funct7_lsb_c] == 5'b00000) && (execute_engine.i_reg[instr_funct7_msb_c] == 1'b0)))) || // valid base ALUI instruction?
-                 ((CPU_EXTENSION_RISCV_B == 1) && (decode_aux.is_b_imm == 1'b1))) begin
+                 (((CPU_EXTENSION_RISCV_B == 1) || (CPU_EXTENSION_RISCV_Zkn == 1)) && (decode_aux.is_b_imm == 1'b1))) begin
                  illegal_cmd = 1'b0;
              end else begin
                  illegal_cmd = 1'b1;
@@ -1640,11 +2946,12 @@ module cellrv32_cpu_control #(
              illegal_reg = execute_engine.i_reg[instr_rs1_msb_c] | execute_engine.i_reg[instr_rd_msb_c]; // illegal 'E' register?
          end
          // --------------------------------------------------------------
-         // check FENCE.funct3, ignore all remaining bit-fields
+         // check FENCE.funct3 (and the CBO.ZERO encoding), ignore all remaining bit-fields
          opcode_fence_c : begin
              case (execute_engine.i_reg[instr_funct3_msb_c : instr_funct3_lsb_c])
                  funct3_fence_c  : illegal_cmd = 1'b0; // FENCE
                  funct3_fencei_c : illegal_cmd = ~(logic'(CPU_EXTENSION_RISCV_Zifencei)); // FENCE.I
+                 funct3_cbo_c    : illegal_cmd = ~(decode_aux.is_cbz & decode_aux.rd_zero); // CBO.ZERO
                  default: begin
                                    illegal_cmd = 1'b1;
                  end
@@ -1709,6 +3016,38 @@ module cellrv32_cpu_control #(
              end
          end
          // --------------------------------------------------------------
+         // floating point operations - fused multiply-add (three operands)
+         opcode_fmadd_c, opcode_fmsub_c, opcode_fnmsub_c, opcode_fnmadd_c : begin
+             if (((CPU_EXTENSION_RISCV_Zfinx == 1) && (FPU_PERF == 1) && (decode_aux.is_f_fma == 1'b1)) || // single-precision
+                 ((CPU_EXTENSION_RISCV_Zhinx == 1) && (CPU_FP16_SIMD == 1) && (decode_aux.is_h_fma == 1'b1))) begin // half-precision / packed
+                 illegal_cmd = 1'b0;
+                 illegal_reg = execute_engine.i_reg[instr_rs3_msb_c] | execute_engine.i_reg[instr_rs2_msb_c] |
+                               execute_engine.i_reg[instr_rs1_msb_c] | execute_engine.i_reg[instr_rd_msb_c]; // illegal 'E' register?
+             end else begin
+                 illegal_cmd = 1'b1;
+                 illegal_reg = 1'b0;
+             end
+         end
+         // --------------------------------------------------------------
+         // packed-SIMD DSP operations
+         opcode_psimd_c : begin
+             illegal_cmd = ~((CPU_PSIMD == 1) && (decode_aux.is_p_op == 1'b1)); // valid packed-SIMD instruction?
+             illegal_reg = execute_engine.i_reg[instr_rd_msb_c] | execute_engine.i_reg[instr_rs1_msb_c] |
+                           (execute_engine.i_reg[instr_rs2_msb_c] & (~execute_engine.i_reg[instr_funct7_msb_c])); // illegal 'E' register? (rs2 field selects the bytes for UNPKD)
+         end
+         // --------------------------------------------------------------
+         // compressed push/pop/move and table-jump macro-operations (encoding already checked by the decompressor)
+         opcode_zcm_c : begin
+             illegal_cmd = ~(logic'(CPU_EXTENSION_RISCV_Zcmp) | logic'(CPU_EXTENSION_RISCV_Zcmt));
+             if (execute_engine.i_reg[28:27] == 2'b11) begin // CM.PUSH/POP*: rlist > 6 uses s2..s11
+                 illegal_reg = execute_engine.i_reg[23] | (&execute_engine.i_reg[22:20]); // illegal 'E' register?
+             end else if (execute_engine.i_reg[28:26] == 3'b011) begin // CM.MV*: sreg 2..7 = s2..s7
+                 illegal_reg = execute_engine.i_reg[25] | execute_engine.i_reg[24] | execute_engine.i_reg[20] | execute_engine.i_reg[19]; // illegal 'E' register?
+             end else begin
+                 illegal_reg = 1'b0;
+             end
+         end
+         // --------------------------------------------------------------
          // custom instructions (CFU)
          opcode_cust0_c, opcode_cust1_c, opcode_cust2_c, opcode_cust3_c : begin
              illegal_cmd = ~(logic'(CPU_EXTENSION_RISCV_Zxcfu)); // CFU extension implemented?
@@ -1756,7 +3095,8 @@ module cellrv32_cpu_control #(
  
           /* load/store/instruction bus access error */
           trap_ctrl.exc_buf[exc_laccess_c] <= (trap_ctrl.exc_buf[exc_laccess_c] | be_load_i)          & (~trap_ctrl.env_start_ack);
-          trap_ctrl.exc_buf[exc_saccess_c] <= (trap_ctrl.exc_buf[exc_saccess_c] | be_store_i)         & (~trap_ctrl.env_start_ack);
+          trap_ctrl.exc_buf[exc_saccess_c] <= (trap_ctrl.exc_buf[exc_saccess_c] | be_store_i |
+                                              (bus_sb_err_i & (execute_engine.state == DISPATCH))) & (~trap_ctrl.env_start_ack); // incl. imprecise store buffer fault
           trap_ctrl.exc_buf[exc_iaccess_c] <= (trap_ctrl.exc_buf[exc_iaccess_c] | trap_ctrl.instr_be) & (~trap_ctrl.env_start_ack);
  
           /* illegal instruction & environment call */
@@ -1796,6 +3136,14 @@ module cellrv32_cpu_control #(
           for (int i = 0; i <= 15; ++i) begin
              trap_ctrl.irq_pnd[irq_firq_0_c+i] <= (trap_ctrl.irq_pnd[irq_firq_0_c+i] & csr.mip_firq_nclr[i]) | firq_i[i];
           end // i
+
+          /* local counter-overflow interrupt: set when a counter wraps while its OF flag is still cleared */
+          if (CPU_EXTENSION_RISCV_Sscofpmf == 1) begin
+              trap_ctrl.irq_pnd[irq_lcofi_irq_c] <= (trap_ctrl.irq_pnd[irq_lcofi_irq_c] & csr.mip_lcof_nclr) |
+                                                    (|(csr.mhpmcounter_wrap & (~csr.mhpmevent_of)));
+          end else begin
+              trap_ctrl.irq_pnd[irq_lcofi_irq_c] <= 1'b0;
+          end
           
          /* debug-mode entry */
          trap_ctrl.irq_pnd[irq_db_halt_c] <= 1'b0; // unused
@@ -1817,6 +3165,9 @@ module cellrv32_cpu_control #(
              trap_ctrl.irq_buf[irq_firq_0_c+i] <= (trap_ctrl.irq_pnd[irq_firq_0_c+i] & csr.mie_firq[i]) | (trap_ctrl.env_start & trap_ctrl.irq_buf[irq_firq_0_c+i]);
          end // i
 
+         /* local counter-overflow interrupt */
+         trap_ctrl.irq_buf[irq_lcofi_irq_c] <= (trap_ctrl.irq_pnd[irq_lcofi_irq_c] & csr.mie_lcof) | (trap_ctrl.env_start & trap_ctrl.irq_buf[irq_lcofi_irq_c]);
+
          /* debug-mode entry */
          if (CPU_EXTENSION_RISCV_Sdext == 1) begin
              trap_ctrl.irq_buf[irq_db_halt_c] <= debug_ctrl.trig_halt | (trap_ctrl.env_start & trap_ctrl.irq_buf[irq_db_halt_c]);
@@ -1837,7 +3188,9 @@ module cellrv32_cpu_control #(
          if (trap_ctrl.env_start == 1'b0) begin // no started trap handler yet
              if (((trap_ctrl.exc_fire == 1'b1)) || // exception firing
                   // trigger IRQ only in EXECUTE or TRAP_ENTER (e.g. during sleep) state to continue execution even on permanent interrupt request
-                 ((trap_ctrl.irq_fire == 1'b1) && ((execute_engine.state == EXECUTE) || (execute_engine.state == TRAP_ENTER)))) begin
+                 ((trap_ctrl.irq_fire == 1'b1) && ((execute_engine.state == EXECUTE) || (execute_engine.state == TRAP_ENTER))) ||
+                  // tail-chaining: start next interrupt handler instead of returning from the current one
+                 ((irqc.chain == 1'b1) && (execute_engine.state == TRAP_EXIT))) begin
                  trap_ctrl.env_start <= 1'b1; // now execute engine can start trap handler
              end
          end else begin // trap environment ready to start
@@ -1855,7 +3208,7 @@ module cellrv32_cpu_control #(
 
     /* any interrupt? */
     assign trap_ctrl.irq_fire = ((
-                                 ((|trap_ctrl.irq_buf[irq_firq_15_c : irq_msi_irq_c]) == 1'b1) && // pending IRQ
+                                 (irqc.take == 1'b1) && // pending IRQ (that is allowed to preempt the current interrupt level)
                                  ((csr.mstatus_mie == 1'b1) || (csr.privilege == priv_mode_u_c)) && // take IRQ when in M-mode and MIE=1 OR when in U-mode
                                  (debug_ctrl.running == 1'b0) && // no machine IRQs when in debug-mode
                                  (csr.dcsr_step == 1'b0) // no machine IRQs when in single-stepping mode
@@ -1865,7 +3218,9 @@ module cellrv32_cpu_control #(
 
     /* exception program counter (for updating xCAUSE CSRs) */
     assign trap_ctrl.epc = (((trap_ctrl.cause[$bits(trap_ctrl.cause)-1]) == 1'b1) || (trap_ctrl.cause == trap_iba_c)) ?
-                             {execute_engine.pc[XLEN-1 : 1], 1'b0} : {execute_engine.pc_last[XLEN-1 : 1], 1'b0};
+                             {execute_engine.pc[XLEN-1 : 1], 1'b0} :
+                           ((nbld.err == 1'b1) && (trap_ctrl.cause == trap_lbe_c)) ? // bus error of a non-blocking load
+                             {nbld.pc[XLEN-1 : 1], 1'b0} : {execute_engine.pc_last[XLEN-1 : 1], 1'b0};
 
     //  Trap Priority Encoder ---------------------------------------------------------------------
     //  -------------------------------------------------------------------------------------------
@@ -1885,6 +3240,8 @@ module cellrv32_cpu_control #(
                          (trap_ctrl.exc_buf[exc_db_hw_c]     == 1'b1) ? trap_db_trig_c  : // hardware trigger (sync)
                          (trap_ctrl.exc_buf[exc_db_break_c]  == 1'b1) ? trap_db_break_c : // break instruction (sync)
                          (trap_ctrl.irq_buf[irq_db_step_c]   == 1'b1) ? trap_db_step_c  : // single stepping (async)
+                         /* vectored interrupt controller: programmable priority */
+                         ((CPU_IRQ_VECTORED == 1) && (irqc.valid == 1'b1)) ? {2'b10, irqc.id} :
                          /* CELLRV32-specific fast interrupts */
                          (trap_ctrl.irq_buf[irq_firq_0_c]    == 1'b1) ? trap_firq0_c  : // fast interrupt channel 0
                          (trap_ctrl.irq_buf[irq_firq_1_c]    == 1'b1) ? trap_firq1_c  : // fast interrupt channel 1
@@ -1906,9 +3263,103 @@ module cellrv32_cpu_control #(
                          (trap_ctrl.irq_buf[irq_mei_irq_c]   == 1'b1) ? trap_mei_c : // machine external interrupt (MEI)
                          (trap_ctrl.irq_buf[irq_msi_irq_c]   == 1'b1) ? trap_msi_c : // machine SW interrupt (MSI)
                          (trap_ctrl.irq_buf[irq_mti_irq_c]   == 1'b1) ? trap_mti_c : // machine timer interrupt (MTI)
+                         (trap_ctrl.irq_buf[irq_lcofi_irq_c] == 1'b1) ? trap_lcofi_c : // local counter-overflow interrupt (LCOFI)
                          6'b000000; // don't care
     end : trap_encoder
 
+    // Vectored Interrupt Controller -------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // Each interrupt source has a 4-bit control nibble (mirqctl*, indexed by mcause ID). The pending
+    // source with the largest nibble wins the arbitration; ties are resolved by the default fixed
+    // priority. The upper mirqcfg.nlbits bits of the nibble define the preemption level (lower
+    // bits filled with ones): an interrupt is only taken if its level exceeds the current level
+    // (mirqcfg.mil) and the threshold (mirqcfg.thresh). If mirqcfg.nlbits is zero there are no
+    // levels at all and every enabled interrupt is taken (standard RISC-V behavior).
+    // On mret the next interrupt is directly started (tail-chaining) if it would be taken right
+    // after the return anyway; mepc, mstatus and the privilege mode of the interrupted context
+    // are kept and the refetch of the interrupted code is skipped.
+    generate
+     if (CPU_IRQ_VECTORED == 1) begin : irqc_enabled
+
+         /* default fixed priority (mcause IDs), used as tie-break */
+         localparam int irq_order_c [0:19] = '{16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, // FIRQ 0..15
+                                               11, 3, 7, 13}; // MEI, MSI, MTI, LCOFI
+
+         /* priority arbitration */
+         always_comb begin : irqc_arbiter
+             logic [31:0] pnd_v;
+             logic [3:0]  ctl_v;
+             // pending and enabled sources by mcause ID
+             pnd_v        = '0;
+             pnd_v[03]    = trap_ctrl.irq_buf[irq_msi_irq_c];
+             pnd_v[07]    = trap_ctrl.irq_buf[irq_mti_irq_c];
+             pnd_v[11]    = trap_ctrl.irq_buf[irq_mei_irq_c];
+             pnd_v[13]    = trap_ctrl.irq_buf[irq_lcofi_irq_c];
+             pnd_v[31:16] = trap_ctrl.irq_buf[irq_firq_15_c : irq_firq_0_c];
+             //
+             irqc.valid = 1'b0;
+             irqc.id    = '0;
+             ctl_v      = '0;
+             for (int i = 0; i <= 19; ++i) begin
+                 if ((pnd_v[irq_order_c[i]] == 1'b1) && ((irqc.valid == 1'b0) || (csr.mirqctl[irq_order_c[i]] > ctl_v))) begin
+                     irqc.valid = 1'b1;
+                     irqc.id    = 5'(irq_order_c[i]);
+                     ctl_v      = csr.mirqctl[irq_order_c[i]];
+                 end
+             end
+             irqc.lvl = ctl_v | (4'b1111 >> csr.mirq_nlbits);
+         end : irqc_arbiter
+
+         /* preemption: winner's level has to exceed the current level and the threshold */
+         assign irqc.take = irqc.valid & ((csr.mirq_nlbits == 3'b000) |
+                            ((irqc.lvl > csr.mirq_mil) & (irqc.lvl > csr.mirq_thresh)));
+
+         /* tail-chaining: winner would be taken right after mret (restored level, MIE and privilege) */
+         assign irqc.chain = irqc.valid & (~trap_ctrl.exc_fire) & (~debug_ctrl.running) & (~csr.dcsr_step) &
+                             (~trap_ctrl.irq_buf[irq_db_halt_c]) & (~trap_ctrl.irq_buf[irq_db_step_c]) &
+                             (csr.mstatus_mpie | ((csr.mstatus_mpp == priv_mode_u_c) & logic'(CPU_EXTENSION_RISCV_U))) &
+                             ((csr.mirq_nlbits == 3'b000) | ((irqc.lvl > csr.mirq_mpil) & (irqc.lvl > csr.mirq_thresh)));
+
+         /* trap entry */
+         always_ff @( posedge clk_i or negedge rstn_i ) begin : irqc_tail
+             if (rstn_i == 1'b0) begin
+                 irqc.tail     <= 1'b0;
+                 irqc.trap_lvl <= '0;
+             end else begin
+                 irqc.trap_lvl <= irqc.lvl; // sampled together with the trap cause
+                 if (execute_engine.state == TRAP_EXIT) begin
+                     irqc.tail <= irqc.chain;
+                 end else if (trap_ctrl.env_start_ack == 1'b1) begin
+                     irqc.tail <= 1'b0;
+                 end
+             end
+         end : irqc_tail
+
+     end : irqc_enabled
+    endgenerate
+
+    generate
+     if (CPU_IRQ_VECTORED == 0) begin : irqc_disabled
+         assign irqc.valid    = 1'b0;
+         assign irqc.id       = '0;
+         assign irqc.lvl      = '0;
+         assign irqc.take     = |trap_ctrl.irq_buf[irq_lcofi_irq_c : irq_msi_irq_c];
+         assign irqc.chain    = 1'b0;
+         assign irqc.tail     = 1'b0;
+         assign irqc.trap_lvl = '0;
+     end : irqc_disabled
+    endgenerate
+
+    // Shadow Register Bank Select ---------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // Interrupts enabled in mshadowen switch the caller-saved registers (ra, t0..t6, a0..a7) to
+    // the shadow bank on trap entry; mret switches back to the bank of the interrupted context
+    // (mshadowctl.mpbank). Exceptions always stay in the current bank as their handlers need the
+    // arguments of the trapping context (e.g. ecall). There is only one shadow bank: a handler
+    // that re-enables interrupts has to save mshadowctl (like mepc/mstatus) and must not be
+    // preempted by another shadow-bank interrupt.
+    assign shadow_sel = (CPU_RF_SHADOW == 1) ? (trap_ctrl.cause[$bits(trap_ctrl.cause)-1] & csr.mshadowen[trap_ctrl.cause[4:0]]) : 1'b0;
+
     // ****************************************************************************************************************************
     // Control and Status Registers (CSRs)
     // ****************************************************************************************************************************
@@ -1995,6 +3446,7 @@ module cellrv32_cpu_control #(
          csr.mie_mei           <= 1'b0;
          csr.mie_mti           <= 1'b0;
          csr.mie_firq          <= '0;
+         csr.mie_lcof          <= 1'b0;
          csr.mtvec             <= '0;
          csr.mscratch          <= 32'h19880704;
          csr.mepc              <= '0;
@@ -2002,6 +3454,7 @@ module cellrv32_cpu_control #(
          csr.mtval             <= '0;
          //
          csr.mip_firq_nclr     <= '0;
+         csr.mip_lcof_nclr     <= 1'b0;
          //
          csr.pmpcfg            <= '0;
          csr.pmpaddr           <= '0;
@@ -2015,6 +3468,23 @@ module cellrv32_cpu_control #(
          csr.fflags            <= '0;
          csr.frm               <= '0;
          //
+         csr.jvt               <= '0;
+         //
+         csr.mirqctl           <= '0;
+         csr.mirq_nlbits       <= '0;
+         csr.mirq_thresh       <= '0;
+         csr.mirq_mpil         <= '0;
+         csr.mirq_mil          <= '0;
+         //
+         csr.mshadowen         <= '0;
+         csr.rf_bank           <= 1'b0;
+         csr.rf_mpbank         <= 1'b0;
+         //
+         csr.ic_lock           <= '0;
+         csr.ic_way            <= '0;
+         csr.ic_fill_addr      <= '0;
+         csr.ic_fill           <= 1'b0;
+         //
          csr.vstart            <= '0;
          csr.vxrm              <= 2'b00;
          csr.vxsat             <= 1'b0;
@@ -2046,6 +3516,8 @@ module cellrv32_cpu_control #(
 
          /* defaults */
          csr.mip_firq_nclr <= '1; // active low
+         csr.mip_lcof_nclr <= 1'b1; // active low
+         csr.ic_fill       <= 1'b0; // single-shot
 
          if (CPU_EXTENSION_RISCV_Zicsr == 1) begin
              // ********************************************************************************
@@ -2067,6 +3539,11 @@ module cellrv32_cpu_control #(
                      end
                  end
                  // ----------------------------------------------------------------------
+                 /* user compressed table-jump CSR */
+                 if ((CPU_EXTENSION_RISCV_Zcmt == 1) && (csr.addr == csr_jvt_c)) begin
+                     csr.jvt <= csr.wdata[XLEN-1:6]; // R/W: jvt - jump vector table base address (jvt.mode is hardwired to zero)
+                 end
+                 // ----------------------------------------------------------------------
                  /* vector CSRs */
                     if (CPU_EXTENSION_RISCV_V == 1) begin // vector CSR class
                         if (csr.addr[11:4] == csr_class_vector_c) begin
@@ -2117,10 +3594,11 @@ module cellrv32_cpu_control #(
                          csr.mie_mti  <= csr.wdata[07]; // machine TIMER IRQ enable
                          csr.mie_mei  <= csr.wdata[11]; // machine EXT IRQ enable
                          csr.mie_firq <= csr.wdata[31:16]; // fast interrupt channels 0..15
+                         csr.mie_lcof <= csr.wdata[13] & logic'(CPU_EXTENSION_RISCV_Sscofpmf); // local counter-overflow IRQ enable
                      end
                      /* R/W: mtvec - machine trap-handler base address (for ALL exceptions) */
                      if (csr.addr[2:0] == csr_mtvec_c[2:0]) begin
-                         csr.mtvec <= {csr.wdata[XLEN-1 : 2], 2'b00}; // mtvec.MODE=0
+                         csr.mtvec <= {csr.wdata[XLEN-1 : 2], 1'b0, csr.wdata[0] & logic'(CPU_IRQ_VECTORED)}; // mtvec.MODE=0 (direct) or 1 (vectored)
                      end
                  end 
                  // ----------------------------------------------------------------------
@@ -2145,6 +3623,49 @@ module cellrv32_cpu_control #(
                      /* R/C: mip - machine interrupt pending */
                      if (csr.addr[3:0] == csr_mip_c[3:0]) begin
                          csr.mip_firq_nclr <= csr.wdata[31:16]; // set low to clear according bit (FIRQs only)
+                         csr.mip_lcof_nclr <= csr.wdata[13];    // set low to clear LCOFIP
+                     end
+                 end
+                 // ----------------------------------------------------------------------
+                 // vectored interrupt controller
+                 if ((CPU_IRQ_VECTORED == 1) && (csr.addr[11:3] == csr_class_irqctl_c)) begin
+                     /* R/W: mirqctl* - interrupt priority/level (one nibble per mcause ID) */
+                     if (csr.addr[2] == 1'b0) begin
+                         for (int i = 0; i < 8; ++i) begin
+                             csr.mirqctl[{csr.addr[1:0], i[2:0]}] <= csr.wdata[i*4 +: 4];
+                         end
+                     end
+                     /* R/W: mirqcfg - interrupt level configuration */
+                     if (csr.addr[2:0] == csr_mirqcfg_c[2:0]) begin
+                         csr.mirq_nlbits <= (csr.wdata[2:0] > 3'd4) ? 3'd4 : csr.wdata[2:0]; // max. 4 level bits
+                         csr.mirq_thresh <= csr.wdata[11:8];
+                         csr.mirq_mpil   <= csr.wdata[19:16];
+                     end
+                 end
+                 // ----------------------------------------------------------------------
+                 // shadow register bank
+                 if (CPU_RF_SHADOW == 1) begin
+                     /* R/W: mshadowen - per-interrupt shadow bank enable */
+                     if (csr.addr == csr_mshadowen_c) begin
+                         csr.mshadowen <= csr.wdata & irq_id_impl_c; // interrupts only
+                     end
+                     /* R/W: mshadowctl - bank of the interrupted context */
+                     if (csr.addr == csr_mshadowctl_c) begin
+                         csr.rf_mpbank <= csr.wdata[1];
+                     end
+                 end
+                 // ----------------------------------------------------------------------
+                 // i-cache control
+                 if (CPU_ICACHE_CTRL == 1) begin
+                     /* R/W: micachectl - way locking */
+                     if (csr.addr == csr_micachectl_c) begin
+                         csr.ic_lock <= csr.wdata[7:0];
+                         csr.ic_way  <= csr.wdata[10:8];
+                     end
+                     /* R/W: micachefill - block preload address, write triggers preload */
+                     if (csr.addr == csr_micachefill_c) begin
+                         csr.ic_fill_addr <= csr.wdata;
+                         csr.ic_fill      <= 1'b1;
                      end
                  end
                  // ----------------------------------------------------------------------
@@ -2201,13 +3722,23 @@ module cellrv32_cpu_control #(
                      if ((HPM_NUM_CNTS > 0) && (CPU_EXTENSION_RISCV_Zihpm == 1)) begin
                          for (int i = 0; i < HPM_NUM_CNTS; ++i) begin
                              if (csr.addr[4:0] == (i+3)) begin
-                                 csr.mhpmevent[i] <= csr.wdata[$bits(csr.mhpmevent[i])-1 : 0];
+                                 csr.mhpmevent[i][31:0] <= csr.wdata;
                              end
                              //
                              csr.mhpmevent[i][hpmcnt_event_never_c] <= 1'b0; // would be used for "TIME"
                          end
                      end
                  end
+                 /* R/W: mhpmevent*h - extended event selector (events 32+, Sscofpmf only); OF/MINH/UINH are handled by the counters */
+                 if (csr.addr[11:5] == csr_cnt_setuph_c) begin
+                     if ((HPM_NUM_CNTS > 0) && (CPU_EXTENSION_RISCV_Zihpm == 1) && (CPU_EXTENSION_RISCV_Sscofpmf == 1)) begin
+                         for (int i = 0; i < HPM_NUM_CNTS; ++i) begin
+                             if (csr.addr[4:0] == (csr_mhpmevent3h_c[4:0] + i)) begin
+                                 csr.mhpmevent[i][hpmcnt_event_size_c-1 : 32] <= csr.wdata[hpmcnt_event_size_c-33 : 0];
+                             end
+                         end
+                     end
+                 end
                  // ----------------------------------------------------------------------
                  // debug mode CSRs
                  if (CPU_EXTENSION_RISCV_Sdext == 1) begin
@@ -2282,7 +3813,9 @@ module cellrv32_cpu_control #(
                          /* trap cause ID */
                          csr.mcause <= {trap_ctrl.cause[$bits(trap_ctrl.cause)-1], trap_ctrl.cause[4:0]}; // type + identifier
                          /* trap PC */
-                         csr.mepc <= trap_ctrl.epc;
+                         if (irqc.tail == 1'b0) begin // tail-chained handler returns to the interrupted context
+                             csr.mepc <= trap_ctrl.epc;
+                         end
                          /* trap value */
                          unique case (trap_ctrl.cause)
                              // misaligned instruction address OR instruction access error
@@ -2299,10 +3832,30 @@ module cellrv32_cpu_control #(
                              end
                          endcase
                          /* update privilege level and interrupt enable stack */
-                         csr.privilege    <= priv_mode_m_c; // execute trap in machine mode
-                         csr.mstatus_mie  <= 1'b0; // disable interrupts
-                         csr.mstatus_mpie <= csr.mstatus_mie; // backup previous mie state
-                         csr.mstatus_mpp  <= csr.privilege; // backup previous privilege mode
+                         if (irqc.tail == 1'b0) begin // keep the stack of the interrupted context when tail-chaining
+                             csr.privilege    <= priv_mode_m_c; // execute trap in machine mode
+                             csr.mstatus_mie  <= 1'b0; // disable interrupts
+                             csr.mstatus_mpie <= csr.mstatus_mie; // backup previous mie state
+                             csr.mstatus_mpp  <= csr.privilege; // backup previous privilege mode
+                         end
+                         /* update interrupt level stack */
+                         if (CPU_IRQ_VECTORED == 1) begin
+                             if (trap_ctrl.cause[$bits(trap_ctrl.cause)-1] == 1'b1) begin // interrupt: enter level of new handler
+                                 csr.mirq_mil <= irqc.trap_lvl;
+                             end
+                             if (irqc.tail == 1'b0) begin
+                                 csr.mirq_mpil <= csr.mirq_mil; // backup previous level
+                             end
+                         end
+                         /* update register bank stack */
+                         if (CPU_RF_SHADOW == 1) begin
+                             if (irqc.tail == 1'b0) begin
+                                 csr.rf_mpbank <= csr.rf_bank; // backup bank of the interrupted context
+                                 csr.rf_bank   <= csr.rf_bank | shadow_sel;
+                             end else begin // tail-chaining: re-select starting from the interrupted context
+                                 csr.rf_bank   <= csr.rf_mpbank | shadow_sel;
+                             end
+                         end
                      end
 
                     // -- DEBUG MODE entry: write dpc and dcsr - no update when already in debug-mode! --
@@ -2346,6 +3899,13 @@ module cellrv32_cpu_control #(
                          //
                           csr.mstatus_mie  <= csr.mstatus_mpie; // restore global IRQ enable flag
                           csr.mstatus_mpie <= 1'b1;
+                          if (CPU_IRQ_VECTORED == 1) begin
+                              csr.mirq_mil <= csr.mirq_mpil; // restore previous interrupt level
+                          end
+                          if (CPU_RF_SHADOW == 1) begin
+                              csr.rf_bank   <= csr.rf_mpbank; // restore register bank of the interrupted context
+                              csr.rf_mpbank <= 1'b0;
+                          end
                      end
                  end // trap exit
              end // hardware csr access
@@ -2398,6 +3958,21 @@ module cellrv32_cpu_control #(
                csr.dscratch0    <= '0;
              end
      
+             /* no shadow register bank */
+             if (CPU_RF_SHADOW == 0) begin
+               csr.mshadowen <= '0;
+               csr.rf_bank   <= 1'b0;
+               csr.rf_mpbank <= 1'b0;
+             end
+
+             /* no i-cache control */
+             if (CPU_ICACHE_CTRL == 0) begin
+               csr.ic_lock      <= '0;
+               csr.ic_way       <= '0;
+               csr.ic_fill_addr <= '0;
+               csr.ic_fill      <= 1'b0;
+             end
+
              /* no trigger module */
              if (CPU_EXTENSION_RISCV_Sdtrig == 0) begin
                csr.tdata1_exe    <= 1'b0;
@@ -2460,6 +4035,15 @@ module cellrv32_cpu_control #(
                  end
              end
              // -- --------------------------------------------------------------------
+             /* compressed table-jump CSR */
+             // -- --------------------------------------------------------------------
+             // jvt (r/w): jump vector table base address and mode (always 0 = jump table mode)
+             csr_jvt_c : begin
+                 if (CPU_EXTENSION_RISCV_Zcmt) begin
+                     csr.rdata[XLEN-1:6] <= csr.jvt;
+                 end
+             end
+             // -- --------------------------------------------------------------------
              /* vector CSRs */
              // -- --------------------------------------------------------------------
              // vstart (r/w): vector start index 
@@ -2537,11 +4121,12 @@ module cellrv32_cpu_control #(
                  csr.rdata[03]    <= csr.mie_msi; // machine software IRQ enable
                  csr.rdata[07]    <= csr.mie_mti; // machine timer IRQ enable
                  csr.rdata[11]    <= csr.mie_mei; // machine external IRQ enable
+                 csr.rdata[13]    <= csr.mie_lcof; // local counter-overflow IRQ enable
                  csr.rdata[31:16] <= csr.mie_firq;
              end
              // mtvec (r/w): machine trap-handler base address (for ALL exceptions)
              csr_mtvec_c : begin
-                 csr.rdata <= {csr.mtvec[XLEN-1:2], 2'b00}; // mtvec.MODE=0
+                 csr.rdata <= {csr.mtvec[XLEN-1:2], 1'b0, csr.mtvec[0]}; // mtvec.MODE: direct or vectored
              end
              // mcounteren (r/-): machine counter enable register
              csr_mcounteren_c : begin
@@ -2579,6 +4164,7 @@ module cellrv32_cpu_control #(
                  csr.rdata[03]    <= trap_ctrl.irq_pnd[irq_msi_irq_c];
                  csr.rdata[07]    <= trap_ctrl.irq_pnd[irq_mti_irq_c];
                  csr.rdata[11]    <= trap_ctrl.irq_pnd[irq_mei_irq_c];
+                 csr.rdata[13]    <= trap_ctrl.irq_pnd[irq_lcofi_irq_c];
                  csr.rdata[31:16] <= trap_ctrl.irq_pnd[irq_firq_15_c : irq_firq_0_c];
              end
              // -- --------------------------------------------------------------------
@@ -2654,6 +4240,43 @@ module cellrv32_cpu_control #(
              csr_mhpmevent30_c : if ((HPM_NUM_CNTS > 27) && (CPU_EXTENSION_RISCV_Zihpm)) begin csr.rdata <= csr.mhpmevent_rd[27]; end
              csr_mhpmevent31_c : if ((HPM_NUM_CNTS > 28) && (CPU_EXTENSION_RISCV_Zihpm)) begin csr.rdata <= csr.mhpmevent_rd[28]; end
              // -- --------------------------------------------------------------------
+             /* HPM event selector, high word (r/w): overflow flag and mode filter (Sscofpmf) */
+             csr_mhpmevent3h_c : if ((HPM_NUM_CNTS > 00) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[00]; end
+             csr_mhpmevent4h_c : if ((HPM_NUM_CNTS > 01) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[01]; end
+             csr_mhpmevent5h_c : if ((HPM_NUM_CNTS > 02) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[02]; end
+             csr_mhpmevent6h_c : if ((HPM_NUM_CNTS > 03) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[03]; end
+             csr_mhpmevent7h_c : if ((HPM_NUM_CNTS > 04) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[04]; end
+             csr_mhpmevent8h_c : if ((HPM_NUM_CNTS > 05) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[05]; end
+             csr_mhpmevent9h_c : if ((HPM_NUM_CNTS > 06) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[06]; end
+             csr_mhpmevent10h_c: if ((HPM_NUM_CNTS > 07) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[07]; end
+             csr_mhpmevent11h_c: if ((HPM_NUM_CNTS > 08) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[08]; end
+             csr_mhpmevent12h_c: if ((HPM_NUM_CNTS > 09) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[09]; end
+             csr_mhpmevent13h_c: if ((HPM_NUM_CNTS > 10) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[10]; end
+             csr_mhpmevent14h_c: if ((HPM_NUM_CNTS > 11) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[11]; end
+             csr_mhpmevent15h_c: if ((HPM_NUM_CNTS > 12) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[12]; end
+             csr_mhpmevent16h_c: if ((HPM_NUM_CNTS > 13) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[13]; end
+             csr_mhpmevent17h_c: if ((HPM_NUM_CNTS > 14) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[14]; end
+             csr_mhpmevent18h_c: if ((HPM_NUM_CNTS > 15) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[15]; end
+             csr_mhpmevent19h_c: if ((HPM_NUM_CNTS > 16) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[16]; end
+             csr_mhpmevent20h_c: if ((HPM_NUM_CNTS > 17) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[17]; end
+             csr_mhpmevent21h_c: if ((HPM_NUM_CNTS > 18) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[18]; end
+             csr_mhpmevent22h_c: if ((HPM_NUM_CNTS > 19) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[19]; end
+             csr_mhpmevent23h_c: if ((HPM_NUM_CNTS > 20) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[20]; end
+             csr_mhpmevent24h_c: if ((HPM_NUM_CNTS > 21) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[21]; end
+             csr_mhpmevent25h_c: if ((HPM_NUM_CNTS > 22) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[22]; end
+             csr_mhpmevent26h_c: if ((HPM_NUM_CNTS > 23) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[23]; end
+             csr_mhpmevent27h_c: if ((HPM_NUM_CNTS > 24) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[24]; end
+             csr_mhpmevent28h_c: if ((HPM_NUM_CNTS > 25) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[25]; end
+             csr_mhpmevent29h_c: if ((HPM_NUM_CNTS > 26) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[26]; end
+             csr_mhpmevent30h_c: if ((HPM_NUM_CNTS > 27) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[27]; end
+             csr_mhpmevent31h_c: if ((HPM_NUM_CNTS > 28) && (CPU_EXTENSION_RISCV_Sscofpmf)) begin csr.rdata <= csr.mhpmeventh_rd[28]; end
+             // scountovf (r/-): counter overflow flags (machine-mode only as there is no S-mode)
+             csr_scountovf_c : begin
+                 if ((HPM_NUM_CNTS > 0) && (CPU_EXTENSION_RISCV_Sscofpmf == 1)) begin
+                     csr.rdata[(HPM_NUM_CNTS+3)-1 : 3] <= csr.mhpmevent_of[HPM_NUM_CNTS-1 : 0];
+                 end
+             end
+             // -- --------------------------------------------------------------------
              /* counters and timers */
              csr_cycle_c   , csr_mcycle_c    : if (CPU_EXTENSION_RISCV_Zicntr) begin csr.rdata <= csr.mcycle;    end
              csr_cycleh_c  , csr_mcycleh_c   : if (CPU_EXTENSION_RISCV_Zicntr) begin csr.rdata <= csr.mcycleh;   end
@@ -2737,6 +4360,52 @@ module cellrv32_cpu_control #(
              csr_tdata1_c : if (CPU_EXTENSION_RISCV_Sdtrig) begin csr.rdata <= csr.tdata1_rd;   end // tdata1 (r/w): match control
              csr_tdata2_c : if (CPU_EXTENSION_RISCV_Sdtrig) begin csr.rdata <= csr.tdata2;      end // tdata2 (r/w): address-compare
              csr_tinfo_c  : if (CPU_EXTENSION_RISCV_Sdtrig) begin csr.rdata <= 32'h00000004;    end // tinfo (r/w): address-match trigger only
+             // -- --------------------------------------------------------------------
+             /* vectored interrupt controller CSRs */
+             csr_mirqctl0_c, csr_mirqctl1_c, csr_mirqctl2_c, csr_mirqctl3_c : begin // mirqctl* (r/w): interrupt priority/level
+                 if (CPU_IRQ_VECTORED) begin
+                     for (int i = 0; i < 8; ++i) begin
+                         if (irq_id_impl_c[{csr.addr[1:0], i[2:0]}] == 1'b1) begin // unimplemented sources read as zero
+                             csr.rdata[i*4 +: 4] <= csr.mirqctl[{csr.addr[1:0], i[2:0]}];
+                         end
+                     end
+                 end
+             end
+             csr_mirqcfg_c : begin // mirqcfg (r/w): interrupt level configuration
+                 if (CPU_IRQ_VECTORED) begin
+                     csr.rdata[02:00] <= csr.mirq_nlbits;
+                     csr.rdata[11:08] <= csr.mirq_thresh;
+                     csr.rdata[19:16] <= csr.mirq_mpil;
+                     csr.rdata[27:24] <= csr.mirq_mil; // read-only
+                 end
+             end
+             // -- --------------------------------------------------------------------
+             /* shadow register bank CSRs */
+             csr_mshadowen_c  : if (CPU_RF_SHADOW) begin csr.rdata <= csr.mshadowen; end // mshadowen (r/w): per-interrupt bank enable
+             csr_mshadowctl_c : begin // mshadowctl (r/w): bank status
+                 if (CPU_RF_SHADOW) begin
+                     csr.rdata[0] <= csr.rf_bank; // read-only
+                     csr.rdata[1] <= csr.rf_mpbank;
+                 end
+             end
+             // -- --------------------------------------------------------------------
+             /* i-cache control CSRs */
+             csr_micachectl_c : begin // micachectl (r/w): way locking
+                 if (CPU_ICACHE_CTRL) begin
+                     csr.rdata[07:00] <= csr.ic_lock;
+                     csr.rdata[10:08] <= csr.ic_way;
+                     csr.rdata[31]    <= ic_busy_i | csr.ic_fill; // read-only
+                 end
+             end
+             csr_micachefill_c : if (CPU_ICACHE_CTRL) begin csr.rdata <= csr.ic_fill_addr; end // micachefill (r/w): block preload address
+             // -- --------------------------------------------------------------------
+             /* hardware loop CSRs */
+             csr_lpstart0_c : if (CPU_HWLOOP) begin csr.rdata <= hwlp.start[0]; end // lpstart0 (r/w): inner loop body start address
+             csr_lpend0_c   : if (CPU_HWLOOP) begin csr.rdata <= hwlp.stop[0];  end // lpend0 (r/w): inner loop body end address
+             csr_lpcount0_c : if (CPU_HWLOOP) begin csr.rdata <= hwlp.cnt[0];   end // lpcount0 (r/w): inner loop remaining iterations
+             csr_lpstart1_c : if (CPU_HWLOOP) begin csr.rdata <= hwlp.start[1]; end // lpstart1 (r/w): outer loop body start address
+             csr_lpend1_c   : if (CPU_HWLOOP) begin csr.rdata <= hwlp.stop[1];  end // lpend1 (r/w): outer loop body end address
+             csr_lpcount1_c : if (CPU_HWLOOP) begin csr.rdata <= hwlp.cnt[1];   end // lpcount1 (r/w): outer loop remaining iterations
              
              // -- --------------------------------------------------------------------
              /* CELLRV32-specific (RISC-V "custom") read-only CSRs */
@@ -2752,6 +4421,7 @@ module cellrv32_cpu_control #(
                  csr.rdata[03] <= logic'(CPU_EXTENSION_RISCV_Zxcfu);    // Zxcfu: custom RISC-V instructions
                  csr.rdata[04] <= logic'(CPU_EXTENSION_RISCV_Zicond);   // Zicond: conditional operations
                  csr.rdata[05] <= logic'(CPU_EXTENSION_RISCV_Zfinx);    // Zfinx: FPU using x registers, "F-alternative"
+                 csr.rdata[06] <= logic'(CPU_EXTENSION_RISCV_Zkn);      // Zkn: scalar cryptography (NIST suite)
 
                  csr.rdata[07] <= logic'(CPU_EXTENSION_RISCV_Zicntr);   // Zicntr: base instructions, cycle and time CSRs
                  csr.rdata[08] <= logic'(PMP_NUM_REGIONS > 0);          // PMP: physical memory protection (Zspmp)
@@ -2760,9 +4430,26 @@ module cellrv32_cpu_control #(
                  csr.rdata[11] <= logic'(CPU_EXTENSION_RISCV_Sdtrig);   // Sdtrig: trigger module
 
                  csr.rdata[12] <= logic'(CPU_EXTENSION_RISCV_Zhinx);    // Zhinx: FPU using x registers, "ZFH-alternative"
+
+                 csr.rdata[14] <= logic'(CPU_HWLOOP);                   // Xhwloop: zero-overhead hardware loops
+                 csr.rdata[15] <= logic'(CPU_EXTENSION_RISCV_Zhinx & CPU_FP16_SIMD); // Xhsimd: packed-SIMD 2x FP16 + FMA.H
+                 csr.rdata[16] <= logic'(CPU_PSIMD);                    // Xpsimd: packed-SIMD integer DSP (P extension subset)
+                 csr.rdata[17] <= logic'(CPU_EXTENSION_RISCV_Zcmp);     // Zcmp: compressed push/pop/move
+                 csr.rdata[18] <= logic'(CPU_EXTENSION_RISCV_Zcmt);     // Zcmt: compressed table jumps
+                 // FPU tuning option
+                 csr.rdata[19] <= logic'(CPU_EXTENSION_RISCV_Zfinx & FPU_PERF); // barrel-shift FPU + fused multiply-add
                  // misc 
                  csr.rdata[20] <= logic'(is_simulation_c);              // is this a simulation?
                  // tuning options 
+                 csr.rdata[21] <= logic'(MULDIV_PERF);                  // DSP multiplier + radix-4 early-out divider
+                 csr.rdata[22] <= logic'(CPU_MISALIGNED);               // misaligned loads/stores in hardware
+                 csr.rdata[23] <= logic'(CPU_SB_DEPTH > 0);             // store buffer
+                 csr.rdata[24] <= logic'(CPU_NB_LOAD);                  // non-blocking loads
+                 csr.rdata[25] <= logic'(CPU_FUSION != 0);              // macro-op fusion
+                 csr.rdata[26] <= logic'(CPU_FETCH_64BIT);              // 64-bit instruction fetch
+                 csr.rdata[27] <= logic'(CPU_DUAL_ISSUE);               // dual-issue of simple ALU operations
+                 csr.rdata[28] <= logic'(CPU_PIPELINE_MODE);            // pipelined dispatch
+                 csr.rdata[29] <= logic'(CPU_BP_EN);                    // dynamic branch prediction (BHT + BTB)
                  csr.rdata[30] <= logic'(FAST_MUL_EN);                  // DSP-based multiplication (M extensions only)
                  csr.rdata[31] <= logic'(FAST_SHIFT_EN);                // parallel logic for shifts (barrel shifters)
              end
@@ -2782,6 +4469,35 @@ module cellrv32_cpu_control #(
     /* CSR read data output */
     assign csr_rdata_o = csr.is_vsetvl ? csr.vl_update_nxt : csr.rdata;
 
+    /* i-cache control; an explicit block preload (micachefill) wins over a prefetch hint */
+    assign ic_lock_o      = csr.ic_lock;
+    assign ic_way_o       = csr.ic_way;
+    assign ic_fill_o      = csr.ic_fill | (pref.ic & pref.ok);
+    assign ic_fill_addr_o = (csr.ic_fill == 1'b1) ? csr.ic_fill_addr : alu_add_i;
+    assign ic_hint_o      = ~csr.ic_fill;
+
+    // Cache-Block Prefetch Hints (Zicbop) -------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] the hint is issued in the cycle after EXECUTE, when the ALU adder provides RS1 + offset (same timing
+    // as the memory address register of a load/store). Hints are only issued in machine mode, as there is no PMP
+    // check for them; a hint that cannot be accepted right away is dropped.
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : prefetch_hint
+        if (rstn_i == 1'b0) begin
+            pref.ic <= 1'b0;
+            pref.dc <= 1'b0;
+        end else begin
+            pref.ic <= pref.ic_nxt & csr.privilege_eff;
+            pref.dc <= pref.dc_nxt & csr.privilege_eff;
+        end
+    end : prefetch_hint
+
+    /* no hints to the upper address page (bootloader ROM, on-chip debugger, IO devices) */
+    assign pref.ok = (alu_add_i[XLEN-1 : XLEN-4] != dcache_uc_page_c) ? 1'b1 : 1'b0;
+
+    /* d-cache prefetch hint */
+    assign dc_pref_o      = pref.dc & pref.ok;
+    assign dc_pref_addr_o = alu_add_i;
+
     // ****************************************************************************************************************************
     // CPU Counters / HPMs
     // ****************************************************************************************************************************
@@ -2795,6 +4511,7 @@ module cellrv32_cpu_control #(
          cnt_csr_we.instret   <= '0;
          cnt_csr_we.hpm_lo    <= '0;
          cnt_csr_we.hpm_hi    <= '0;
+         cnt_csr_we.hpm_evh   <= '0;
          cnt_csr_we.wdata     <= '0;
          /* counters */
          csr.mcycle           <= '0;
@@ -2806,12 +4523,16 @@ module cellrv32_cpu_control #(
          csr.mhpmcounter_ovfl <= '0;
          csr.mhpmcounter      <= '0;
          csr.mhpmcounterh     <= '0;
+         csr.mhpmevent_of     <= '0;
+         csr.mhpmevent_minh   <= '0;
+         csr.mhpmevent_uinh   <= '0;
        end else begin
          /* write enable - defaults */
          cnt_csr_we.cycle   <= '0;
          cnt_csr_we.instret <= '0;
          cnt_csr_we.hpm_lo  <= '0;
          cnt_csr_we.hpm_hi  <= '0;
+         cnt_csr_we.hpm_evh <= '0;
 
          /* write enable - access decoder */
          if (csr.we == 1'b1) begin
@@ -2839,6 +4560,15 @@ module cellrv32_cpu_control #(
                      end
                  end
              end
+             //
+             /* csr_mhpmevent3h_c (Sscofpmf) - the OF flag has to be updated together with the counters */
+             if (csr.addr[11:5] == csr_cnt_setuph_c) begin
+                 for (int i = 0; i <= 28; ++i) begin
+                     if (csr.addr[4:0] == (csr_mhpmevent3h_c[4:0] + i)) begin
+                         cnt_csr_we.hpm_evh[i] <= 1'b1;
+                     end
+                 end
+             end
          end
          // ----------------------------------------------------------------------
          /* [machine] standard CPU counters (cycle & instret) */
@@ -2919,6 +4649,20 @@ module cellrv32_cpu_control #(
              end else begin
                  csr.mhpmcounterh[i] <= '0;
              end
+             /* mhpmevent*h - overflow flag and privilege-mode filter */
+             if ((CPU_EXTENSION_RISCV_Sscofpmf == 1) && (CPU_EXTENSION_RISCV_Zihpm == 1)) begin
+                 if (cnt_csr_we.hpm_evh[i] == 1'b1) begin // write access
+                     csr.mhpmevent_of[i]   <= cnt_csr_we.wdata[31];
+                     csr.mhpmevent_minh[i] <= cnt_csr_we.wdata[30];
+                     csr.mhpmevent_uinh[i] <= cnt_csr_we.wdata[28] & logic'(CPU_EXTENSION_RISCV_U);
+                 end else if (csr.mhpmcounter_wrap[i] == 1'b1) begin // sticky until cleared by software
+                     csr.mhpmevent_of[i]   <= 1'b1;
+                 end
+             end else begin
+                 csr.mhpmevent_of[i]   <= 1'b0;
+                 csr.mhpmevent_minh[i] <= 1'b0;
+                 csr.mhpmevent_uinh[i] <= 1'b0;
+             end
          end // loop
        end
     end : csr_counters
@@ -2926,7 +4670,7 @@ module cellrv32_cpu_control #(
     /* counter increment */
     always_comb begin : cnt_increment
        csr.mcycle_nxt      = ({1'b0, csr.mcycle}   + 1);
-       csr.minstret_nxt    = ({1'b0, csr.minstret} + 1);
+       csr.minstret_nxt    = ({1'b0, csr.minstret} + 1 + dual.valid + fuse.valid); // two instructions retired when dual-issued or fused
        csr.mhpmcounter_nxt = '0;
        //
        for (int i = 0; i < HPM_NUM_CNTS; ++i) begin
@@ -2934,16 +4678,36 @@ module cellrv32_cpu_control #(
        end
     end : cnt_increment
 
+    /* full-width HPM counter overflow (wrap-around to zero) */
+    always_comb begin : cnt_wrap
+       csr.mhpmcounter_wrap = '0;
+       //
+       if ((HPM_NUM_CNTS != 0) && (CPU_EXTENSION_RISCV_Sscofpmf == 1)) begin
+          for (int i = 0; i < HPM_NUM_CNTS; ++i) begin
+             if (hpm_cnt_hi_width_c > 0) begin // high word is incremented by the low word's carry
+                 csr.mhpmcounter_wrap[i] = csr.mhpmcounter_ovfl[i][0] & (&csr.mhpmcounterh[i][hpm_cnt_hi_width_c-1 : 0]) & (~cnt_csr_we.hpm_hi[i]);
+             end else begin // low word only
+                 csr.mhpmcounter_wrap[i] = csr.mhpmcounter_nxt[i][hpm_cnt_lo_width_c] & (~csr.mcountinhibit_hpm[i]) & hpmcnt_trigger[i] & (~cnt_csr_we.hpm_lo[i]);
+             end
+          end
+       end
+    end : cnt_wrap
+
     /* hpm counter read */
     always_comb begin : hpm_connect
        csr.mhpmevent_rd    = '0;
+       csr.mhpmeventh_rd   = '0;
        csr.mhpmcounter_rd  = '0;
        csr.mhpmcounterh_rd = '0;
        //
        if ((HPM_NUM_CNTS != 0) && (CPU_EXTENSION_RISCV_Zihpm == 1)) begin
           for (int i = 0; i < HPM_NUM_CNTS; ++i) begin
-             csr.mhpmevent_rd[i][hpmcnt_event_size_c-1 : 0] = csr.mhpmevent[i];
+             csr.mhpmevent_rd[i] = csr.mhpmevent[i][31:0];
              csr.mhpmevent_rd[i][hpmcnt_event_never_c] = 1'b0; // "TIME" is always zero
+             csr.mhpmeventh_rd[i][hpmcnt_event_size_c-33 : 0] = csr.mhpmevent[i][hpmcnt_event_size_c-1 : 32]; // extended event selector
+             csr.mhpmeventh_rd[i][31] = csr.mhpmevent_of[i];   // OF
+             csr.mhpmeventh_rd[i][30] = csr.mhpmevent_minh[i]; // MINH
+             csr.mhpmeventh_rd[i][28] = csr.mhpmevent_uinh[i]; // UINH
              //
              if (hpm_cnt_lo_width_c > 0) begin
                  csr.mhpmcounter_rd[i][hpm_cnt_lo_width_c-1 : 0] = csr.mhpmcounter[i][hpm_cnt_lo_width_c-1 : 0];
@@ -2965,9 +4729,10 @@ module cellrv32_cpu_control #(
        //
        if (HPM_NUM_CNTS != 0) begin
            for (int i = 0; i < HPM_NUM_CNTS; ++i) begin
-               /* do not increment if CPU is in debug mode */
+               /* do not increment if CPU is in debug mode or counting is inhibited for the current privilege mode */
                if ((|(cnt_event & csr.mhpmevent[i][$bits(cnt_event)-1 : 0]) == 1'b1) && 
-                   (debug_ctrl.running == 1'b0)) begin
+                   (debug_ctrl.running == 1'b0) &&
+                   (((csr.privilege == priv_mode_m_c) ? csr.mhpmevent_minh[i] : csr.mhpmevent_uinh[i]) == 1'b0)) begin
                  hpmcnt_trigger[i] <= 1'b1;
                end else begin
                  hpmcnt_trigger[i] <= 1'b0;
@@ -2979,26 +4744,64 @@ module cellrv32_cpu_control #(
     /* RISC-V-specific counter event triggers */
     assign cnt_event[hpmcnt_event_cy_c]      = (execute_engine.sleep == 1'b0) ? 1'b1 : 1'b0; // active cycle
     assign cnt_event[hpmcnt_event_never_c]   = 1'b0; // "never" (position would be TIME)
-    assign cnt_event[hpmcnt_event_ir_c]      = (execute_engine.state == EXECUTE) ? 1'b1: 1'b0; // any executed instruction
+    assign cnt_event[hpmcnt_event_ir_c]      = ((execute_engine.state == EXECUTE) && (zcmp.hold == 1'b0)) ? 1'b1: 1'b0; // any executed instruction (Zcmp/Zcmt: last micro-op only)
 
     /* CELLRV32-specific counter event triggers */
-    assign cnt_event[hpmcnt_event_cir_c]     = ((execute_engine.state == EXECUTE)    && (execute_engine.is_ci      == 1'b1)      ) ? 1'b1 : 1'b0; // executed compressed instruction
+    assign cnt_event[hpmcnt_event_cir_c]     = ((execute_engine.state == EXECUTE)    && (execute_engine.is_ci      == 1'b1)       && (zcmp.hold == 1'b0)) ? 1'b1 : 1'b0; // executed compressed instruction
     assign cnt_event[hpmcnt_event_wait_if_c] = ((fetch_engine.state   == IF_PENDING) && (fetch_engine.state_prev   == IF_PENDING)) ? 1'b1 : 1'b0; // instruction fetch memory wait cycle
     assign cnt_event[hpmcnt_event_wait_ii_c] = ((execute_engine.state == DISPATCH)   && (execute_engine.state_prev == DISPATCH)  ) ? 1'b1 : 1'b0; // instruction issue wait cycle
     assign cnt_event[hpmcnt_event_wait_mc_c] = ((execute_engine.state == ALU_WAIT)                                               ) ? 1'b1 : 1'b0; // multi-cycle alu-operation wait cycle
 
-    assign cnt_event[hpmcnt_event_load_c]    = ((ctrl.bus_req == 1'b1)             && (execute_engine.i_reg[instr_opcode_msb_c-1] == 1'b0)) ? 1'b1 : 1'b0; // load operation
-    assign cnt_event[hpmcnt_event_store_c]   = ((ctrl.bus_req == 1'b1)             && (execute_engine.i_reg[instr_opcode_msb_c-1] == 1'b1)) ? 1'b1 : 1'b0; // store operation
+    assign cnt_event[hpmcnt_event_load_c]    = ((ctrl.bus_req == 1'b1)             && (execute_engine.i_reg[instr_opcode_msb_c-1] == 1'b0) && (decode_aux.is_cbz == 1'b0)) ? 1'b1 : 1'b0; // load operation
+    assign cnt_event[hpmcnt_event_store_c]   = ((ctrl.bus_req == 1'b1)             && ((execute_engine.i_reg[instr_opcode_msb_c-1] == 1'b1) || (decode_aux.is_cbz == 1'b1))) ? 1'b1 : 1'b0; // store operation (including CBO.ZERO)
     assign cnt_event[hpmcnt_event_wait_ls_c] = ((execute_engine.state == MEM_WAIT) && (execute_engine.state_prev2 == MEM_WAIT)            ) ? 1'b1 : 1'b0; // load/store memory wait cycle
 
     assign cnt_event[hpmcnt_event_jump_c]    = ((execute_engine.state == BRANCH)   && (execute_engine.i_reg[instr_opcode_lsb_c+2] == 1'b1)) ? 1'b1 : 1'b0; // jump (unconditional)
     assign cnt_event[hpmcnt_event_branch_c]  = ((execute_engine.state == BRANCH)   && (execute_engine.i_reg[instr_opcode_lsb_c+2] == 1'b0)) ? 1'b1 : 1'b0; // branch (conditional, taken or not taken)
-    assign cnt_event[hpmcnt_event_tbranch_c] = ((execute_engine.state == BRANCHED) && (execute_engine.state_prev == BRANCH) &&
+    assign cnt_event[hpmcnt_event_tbranch_c] = ((execute_engine.state == BRANCH)   && (execute_engine.branch_taken == 1'b1) &&
                                                 (execute_engine.i_reg[instr_opcode_lsb_c+2] == 1'b0)) ? 1'b1 : 1'b0; // taken branch (conditional)
 
     assign cnt_event[hpmcnt_event_trap_c]    = (trap_ctrl.env_start_ack == 1'b1) ? 1'b1 : 1'b0; // entered trap
     assign cnt_event[hpmcnt_event_illegal_c] = ((trap_ctrl.env_start_ack == 1'b1) && (trap_ctrl.cause == trap_iil_c)) ? 1'b1 : 1'b0; // illegal operation
 
+    assign cnt_event[hpmcnt_event_ras_hit_c]  = ((CPU_BP_RAS_DEPTH > 0) && (bp.resolve == 1'b1) && (bp.ret == 1'b1) && (bp.hit == 1'b1)) ? 1'b1 : 1'b0; // correctly predicted return
+    assign cnt_event[hpmcnt_event_ras_miss_c] = ((CPU_BP_RAS_DEPTH > 0) && (bp.resolve == 1'b1) && (bp.ret == 1'b1) && (bp.hit == 1'b0)) ? 1'b1 : 1'b0; // mispredicted return
+
+    assign cnt_event[hpmcnt_event_dual_c]   = ((execute_engine.state == EXECUTE) && (dual.valid == 1'b1)) ? 1'b1 : 1'b0; // dual-issued cycle
+    assign cnt_event[hpmcnt_event_single_c] = ((execute_engine.state == EXECUTE) && (dual.valid == 1'b0)) ? 1'b1 : 1'b0; // single-issued cycle
+    assign cnt_event[hpmcnt_event_fused_c]  = ((execute_engine.state == EXECUTE) && (fuse.valid == 1'b1)) ? 1'b1 : 1'b0; // fused instruction pair
+    assign cnt_event[hpmcnt_event_nbl_c]    = ((execute_engine.state == EXECUTE) && (nbld.busy  == 1'b1)) ? 1'b1 : 1'b0; // hit-under-miss execution
+
+    assign cnt_event[hpmcnt_event_ic_hit_c]  = hpm_ext_i[hpm_ext_ic_hit_c];  // i-cache hit
+    assign cnt_event[hpmcnt_event_ic_miss_c] = hpm_ext_i[hpm_ext_ic_miss_c]; // i-cache miss
+    assign cnt_event[hpmcnt_event_br_miss_c] = ((execute_engine.state == BRANCH) && (execute_engine.state_nxt == BRANCHED)) ? 1'b1 : 1'b0; // front-end flush (redirect not predicted)
+
+    assign cnt_event[hpmcnt_event_vec_bsy_c] = ((execute_engine.state == ALU_WAIT) && (cp_occ[cp_sel_vector_c] == 1'b1)) ? 1'b1 : 1'b0; // vector unit busy
+    assign cnt_event[hpmcnt_event_vec_stl_c] = vec_stall_i; // vector memory request not granted
+    assign cnt_event[hpmcnt_event_cp_alu_c]  = ((execute_engine.state == ALU_WAIT) && ((cp_occ[cp_sel_shifter_c] | cp_occ[cp_sel_bitmanip_c] | cp_occ[cp_sel_cond_c]) == 1'b1)) ? 1'b1 : 1'b0;
+    assign cnt_event[hpmcnt_event_cp_md_c]   = ((execute_engine.state == ALU_WAIT) && (cp_occ[cp_sel_muldiv_c] == 1'b1)) ? 1'b1 : 1'b0;
+    assign cnt_event[hpmcnt_event_cp_fpu_c]  = ((execute_engine.state == ALU_WAIT) && ((cp_occ[cp_sel_fpu32_c] | cp_occ[cp_sel_fpu16_c]) == 1'b1)) ? 1'b1 : 1'b0;
+    assign cnt_event[hpmcnt_event_cp_cst_c]  = ((execute_engine.state == ALU_WAIT) && ((cp_occ[cp_sel_cfu_c] | cp_occ[cp_sel_psimd_c]) == 1'b1)) ? 1'b1 : 1'b0;
+
+    assign cnt_event[hpmcnt_event_arb_c]     = hpm_ext_i[hpm_ext_arb_c]; // bus switch arbitration wait
+    assign cnt_event[hpmcnt_event_xip_c]     = hpm_ext_i[hpm_ext_xip_c]; // XIP access wait
+
+    assign cnt_event[hpmcnt_event_ic_evict_c] = hpm_ext_i[hpm_ext_ic_evict_c]; // i-cache block replaced
+    assign cnt_event[hpmcnt_event_ic_wait_c]  = hpm_ext_i[hpm_ext_ic_wait_c];  // i-cache miss-handling cycle
+
+    /* co-processor occupancy: the one-hot trigger is only active in the first ALU_WAIT cycle */
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : cp_occupancy
+       if (rstn_i == 1'b0) begin
+           cp_occ_buf <= '0;
+       end else if (execute_engine.state_nxt != ALU_WAIT) begin
+           cp_occ_buf <= '0;
+       end else if (|ctrl.alu_cp_trig) begin
+           cp_occ_buf <= ctrl.alu_cp_trig;
+       end
+    end : cp_occupancy
+
+    assign cp_occ = ctrl.alu_cp_trig | cp_occ_buf;
+
     // ****************************************************************************************************************************
     // CPU Debug Mode (Part of the On-Chip Debugger)
     // ****************************************************************************************************************************
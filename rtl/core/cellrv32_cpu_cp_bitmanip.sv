@@ -7,6 +7,14 @@
 // # - Zbs: Single-bit instructions                                                                 #
 // # - Zbc: Carry-less multiplication instructions                                                  #
 // #                                                                                                #
+// # Optional scalar cryptography sub-extensions (Zkn, ZKN_EN generic):                             #
+// # - Zbkb: Bit-manipulation for cryptography (PACK, PACKH, BREV8, ZIP, UNZIP + Zbb subset)        #
+// # - Zbkc: Carry-less multiplication for cryptography (CLMUL, CLMULH; shared with Zbc)            #
+// # - Zbkx: Crossbar permutations (XPERM8, XPERM4)                                                 #
+// # - Zkne/Zknd: AES encryption/decryption (AES32ESI, AES32ESMI, AES32DSI, AES32DSMI)              #
+// # - Zknh: SHA-2 hash functions (SHA256SIG0/1, SHA256SUM0/1, SHA512* RV32 variants)               #
+// # All crypto instructions are single-cycle and data-independent (no table lookups in memory).    #
+// #                                                                                                #
 // # Processor/CPU configuration generic FAST_MUL_EN is also used to enable implementation of fast  #
 // # (full-parallel) logic for all shift-related B-instructions (ROL, ROR[I], CLZ, CTZ, CPOP).      #
 // # ***********************************************************************************************#
@@ -17,7 +25,8 @@
 
 module cellrv32_cpu_cp_bitmanip #(
     parameter XLEN          = 32, // data path width
-    parameter FAST_SHIFT_EN = 1   // use barrel shifter for shift operations
+    parameter FAST_SHIFT_EN = 1,  // use barrel shifter for shift operations
+    parameter ZKN_EN        = 0   // implement scalar cryptography (Zkn) instructions
 ) (
     /* global control */
     input logic                   clk_i,   // global clock, rising edge
@@ -77,8 +86,21 @@ module cellrv32_cpu_cp_bitmanip #(
     localparam int op_clmul_c  = 22;
     localparam int op_clmulh_c = 23;
     localparam int op_clmulr_c = 24;
+    /* Zbkb - packing and bit/byte permutations */
+    localparam int op_packh_c  = 25;
+    localparam int op_brev8_c  = 26;
+    localparam int op_zip_c    = 27;
+    localparam int op_unzip_c  = 28;
+    /* Zbkx - crossbar permutations */
+    localparam int op_xperm8_c = 29;
+    localparam int op_xperm4_c = 30;
+    /* Zkne/Zknd - AES (32-bit) */
+    localparam int op_aes_c    = 31; // encrypt/decrypt, with/without MixColumns
+    /* Zknh - SHA-2 */
+    localparam int op_sha256_c = 32; // sig0/sig1/sum0/sum1
+    localparam int op_sha512_c = 33; // sum0r/sum1r/sig0l/sig0h/sig1l/sig1h
     //
-    localparam int op_width_c = 25;
+    localparam int op_width_c = 34;
 
   /* controller */
   typedef enum logic[2:0] { S_IDLE, 
@@ -88,7 +110,7 @@ module cellrv32_cpu_cp_bitmanip #(
                             S_BUSY_CLMUL
                             } ctrl_state_t;
   ctrl_state_t ctrl_state;
-  logic [op_width_c-1:0] cmd, cmd_buf;
+  logic [op_width_c-1:0] cmd_dec, cmd, cmd_buf;
   logic valid;
 
   /* operand buffers */
@@ -133,15 +155,61 @@ module cellrv32_cpu_cp_bitmanip #(
   } clmultiplier_t;
   clmultiplier_t clmul;
 
+  /* scalar cryptography */
+  logic [7:0]      aes_si, aes_so;
+  logic [31:0]     aes_mix;
+  logic [XLEN-1:0] sha256_res, sha512_res;
+
+  /* AES forward S-box */
+  localparam logic [7:0] aes_sbox_c [0:255] = '{
+    8'h63, 8'h7c, 8'h77, 8'h7b, 8'hf2, 8'h6b, 8'h6f, 8'hc5, 8'h30, 8'h01, 8'h67, 8'h2b, 8'hfe, 8'hd7, 8'hab, 8'h76,
+    8'hca, 8'h82, 8'hc9, 8'h7d, 8'hfa, 8'h59, 8'h47, 8'hf0, 8'had, 8'hd4, 8'ha2, 8'haf, 8'h9c, 8'ha4, 8'h72, 8'hc0,
+    8'hb7, 8'hfd, 8'h93, 8'h26, 8'h36, 8'h3f, 8'hf7, 8'hcc, 8'h34, 8'ha5, 8'he5, 8'hf1, 8'h71, 8'hd8, 8'h31, 8'h15,
+    8'h04, 8'hc7, 8'h23, 8'hc3, 8'h18, 8'h96, 8'h05, 8'h9a, 8'h07, 8'h12, 8'h80, 8'he2, 8'heb, 8'h27, 8'hb2, 8'h75,
+    8'h09, 8'h83, 8'h2c, 8'h1a, 8'h1b, 8'h6e, 8'h5a, 8'ha0, 8'h52, 8'h3b, 8'hd6, 8'hb3, 8'h29, 8'he3, 8'h2f, 8'h84,
+    8'h53, 8'hd1, 8'h00, 8'hed, 8'h20, 8'hfc, 8'hb1, 8'h5b, 8'h6a, 8'hcb, 8'hbe, 8'h39, 8'h4a, 8'h4c, 8'h58, 8'hcf,
+    8'hd0, 8'hef, 8'haa, 8'hfb, 8'h43, 8'h4d, 8'h33, 8'h85, 8'h45, 8'hf9, 8'h02, 8'h7f, 8'h50, 8'h3c, 8'h9f, 8'ha8,
+    8'h51, 8'ha3, 8'h40, 8'h8f, 8'h92, 8'h9d, 8'h38, 8'hf5, 8'hbc, 8'hb6, 8'hda, 8'h21, 8'h10, 8'hff, 8'hf3, 8'hd2,
+    8'hcd, 8'h0c, 8'h13, 8'hec, 8'h5f, 8'h97, 8'h44, 8'h17, 8'hc4, 8'ha7, 8'h7e, 8'h3d, 8'h64, 8'h5d, 8'h19, 8'h73,
+    8'h60, 8'h81, 8'h4f, 8'hdc, 8'h22, 8'h2a, 8'h90, 8'h88, 8'h46, 8'hee, 8'hb8, 8'h14, 8'hde, 8'h5e, 8'h0b, 8'hdb,
+    8'he0, 8'h32, 8'h3a, 8'h0a, 8'h49, 8'h06, 8'h24, 8'h5c, 8'hc2, 8'hd3, 8'hac, 8'h62, 8'h91, 8'h95, 8'he4, 8'h79,
+    8'he7, 8'hc8, 8'h37, 8'h6d, 8'h8d, 8'hd5, 8'h4e, 8'ha9, 8'h6c, 8'h56, 8'hf4, 8'hea, 8'h65, 8'h7a, 8'hae, 8'h08,
+    8'hba, 8'h78, 8'h25, 8'h2e, 8'h1c, 8'ha6, 8'hb4, 8'hc6, 8'he8, 8'hdd, 8'h74, 8'h1f, 8'h4b, 8'hbd, 8'h8b, 8'h8a,
+    8'h70, 8'h3e, 8'hb5, 8'h66, 8'h48, 8'h03, 8'hf6, 8'h0e, 8'h61, 8'h35, 8'h57, 8'hb9, 8'h86, 8'hc1, 8'h1d, 8'h9e,
+    8'he1, 8'hf8, 8'h98, 8'h11, 8'h69, 8'hd9, 8'h8e, 8'h94, 8'h9b, 8'h1e, 8'h87, 8'he9, 8'hce, 8'h55, 8'h28, 8'hdf,
+    8'h8c, 8'ha1, 8'h89, 8'h0d, 8'hbf, 8'he6, 8'h42, 8'h68, 8'h41, 8'h99, 8'h2d, 8'h0f, 8'hb0, 8'h54, 8'hbb, 8'h16
+  };
+
+  /* AES inverse S-box */
+  localparam logic [7:0] aes_inv_sbox_c [0:255] = '{
+    8'h52, 8'h09, 8'h6a, 8'hd5, 8'h30, 8'h36, 8'ha5, 8'h38, 8'hbf, 8'h40, 8'ha3, 8'h9e, 8'h81, 8'hf3, 8'hd7, 8'hfb,
+    8'h7c, 8'he3, 8'h39, 8'h82, 8'h9b, 8'h2f, 8'hff, 8'h87, 8'h34, 8'h8e, 8'h43, 8'h44, 8'hc4, 8'hde, 8'he9, 8'hcb,
+    8'h54, 8'h7b, 8'h94, 8'h32, 8'ha6, 8'hc2, 8'h23, 8'h3d, 8'hee, 8'h4c, 8'h95, 8'h0b, 8'h42, 8'hfa, 8'hc3, 8'h4e,
+    8'h08, 8'h2e, 8'ha1, 8'h66, 8'h28, 8'hd9, 8'h24, 8'hb2, 8'h76, 8'h5b, 8'ha2, 8'h49, 8'h6d, 8'h8b, 8'hd1, 8'h25,
+    8'h72, 8'hf8, 8'hf6, 8'h64, 8'h86, 8'h68, 8'h98, 8'h16, 8'hd4, 8'ha4, 8'h5c, 8'hcc, 8'h5d, 8'h65, 8'hb6, 8'h92,
+    8'h6c, 8'h70, 8'h48, 8'h50, 8'hfd, 8'hed, 8'hb9, 8'hda, 8'h5e, 8'h15, 8'h46, 8'h57, 8'ha7, 8'h8d, 8'h9d, 8'h84,
+    8'h90, 8'hd8, 8'hab, 8'h00, 8'h8c, 8'hbc, 8'hd3, 8'h0a, 8'hf7, 8'he4, 8'h58, 8'h05, 8'hb8, 8'hb3, 8'h45, 8'h06,
+    8'hd0, 8'h2c, 8'h1e, 8'h8f, 8'hca, 8'h3f, 8'h0f, 8'h02, 8'hc1, 8'haf, 8'hbd, 8'h03, 8'h01, 8'h13, 8'h8a, 8'h6b,
+    8'h3a, 8'h91, 8'h11, 8'h41, 8'h4f, 8'h67, 8'hdc, 8'hea, 8'h97, 8'hf2, 8'hcf, 8'hce, 8'hf0, 8'hb4, 8'he6, 8'h73,
+    8'h96, 8'hac, 8'h74, 8'h22, 8'he7, 8'had, 8'h35, 8'h85, 8'he2, 8'hf9, 8'h37, 8'he8, 8'h1c, 8'h75, 8'hdf, 8'h6e,
+    8'h47, 8'hf1, 8'h1a, 8'h71, 8'h1d, 8'h29, 8'hc5, 8'h89, 8'h6f, 8'hb7, 8'h62, 8'h0e, 8'haa, 8'h18, 8'hbe, 8'h1b,
+    8'hfc, 8'h56, 8'h3e, 8'h4b, 8'hc6, 8'hd2, 8'h79, 8'h20, 8'h9a, 8'hdb, 8'hc0, 8'hfe, 8'h78, 8'hcd, 8'h5a, 8'hf4,
+    8'h1f, 8'hdd, 8'ha8, 8'h33, 8'h88, 8'h07, 8'hc7, 8'h31, 8'hb1, 8'h12, 8'h10, 8'h59, 8'h27, 8'h80, 8'hec, 8'h5f,
+    8'h60, 8'h51, 8'h7f, 8'ha9, 8'h19, 8'hb5, 8'h4a, 8'h0d, 8'h2d, 8'he5, 8'h7a, 8'h9f, 8'h93, 8'hc9, 8'h9c, 8'hef,
+    8'ha0, 8'he0, 8'h3b, 8'h4d, 8'hae, 8'h2a, 8'hf5, 8'hb0, 8'hc8, 8'heb, 8'hbb, 8'h3c, 8'h83, 8'h53, 8'h99, 8'h61,
+    8'h17, 8'h2b, 8'h04, 8'h7e, 8'hba, 8'h77, 8'hd6, 8'h26, 8'he1, 8'h69, 8'h14, 8'h63, 8'h55, 8'h21, 8'h0c, 8'h7d
+  };
+
   // Sub-Extension Configuration ---------------------------------------------------------------
   // -------------------------------------------------------------------------------------------
   initial begin
     assert (1'b0)
-    else $info("CELLRV32 CPU: Implementing bit-manipulation (B) sub-extensions %s %s %s %s",
+    else $info("CELLRV32 CPU: Implementing bit-manipulation (B) sub-extensions %s %s %s %s %s",
                 cond_sel_string_f(zba_en_c, "Zba ", ""),
                 cond_sel_string_f(zbb_en_c, "Zbb ", ""),
                 cond_sel_string_f(zbc_en_c, "Zbc ", ""),
-                cond_sel_string_f(zbs_en_c, "Zbs ", ""));
+                cond_sel_string_f(zbs_en_c, "Zbs ", ""),
+                cond_sel_string_f(ZKN_EN,   "Zbkb Zbkc Zbkx Zkne Zknd Zknh ", ""));
   end
   
   // Instruction Decoding (One-Hot) ------------------------------------------------------------
@@ -150,40 +218,61 @@ module cellrv32_cpu_cp_bitmanip #(
   // A more precise decoding as well as a valid-instruction-check is performed by the CPU control unit.
 
   /* Zbb - Basic bit-manipulation instructions */
-  assign cmd[op_andn_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[1 : 0] == 2'b11)) ? 1'b1 : 1'b0;
-  assign cmd[op_orn_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[1 : 0] == 2'b10)) ? 1'b1 : 1'b0;
-  assign cmd[op_xnor_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[1 : 0] == 2'b00)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_andn_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[1 : 0] == 2'b11)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_orn_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[1 : 0] == 2'b10)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_xnor_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[1 : 0] == 2'b00)) ? 1'b1 : 1'b0;
   //
-  assign cmd[op_max_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 1] == 2'b11)) ? 1'b1 : 1'b0;
-  assign cmd[op_min_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 1] == 2'b10)) ? 1'b1 : 1'b0;
-  assign cmd[op_zexth_c] = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_max_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 1] == 2'b11)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_min_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 1] == 2'b10)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_zexth_c] = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b0)) ? 1'b1 : 1'b0;
   //
-  assign cmd[op_orcb_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b101)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_orcb_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b101)) ? 1'b1 : 1'b0;
   //
-  assign cmd[op_clz_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b000) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
-  assign cmd[op_ctz_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b001) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
-  assign cmd[op_cpop_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b010) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
-  assign cmd[op_sextb_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b100) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
-  assign cmd[op_sexth_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b101) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
-  assign cmd[op_rol_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 0] == 3'b001) && (ctrl_i.ir_opcode[5] == 1'b1)) ? 1'b1 : 1'b0;
-  assign cmd[op_ror_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 0] == 3'b101) && (ctrl_i.ir_funct3[2] == 1'b1)) ? 1'b1 : 1'b0;
-  assign cmd[op_rev8_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b101)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_clz_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b000) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_ctz_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b001) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_cpop_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b010) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_sextb_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b100) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_sexth_c]  = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct12[2 : 0] == 3'b101) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_rol_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 0] == 3'b001) && (ctrl_i.ir_opcode[5] == 1'b1)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_ror_c]    = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 0] == 3'b101) && (ctrl_i.ir_funct3[2] == 1'b1)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_rev8_c]   = ((zbb_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b101)) ? 1'b1 : 1'b0;
 
   /* Zba - Address generation instructions */
-  assign cmd[op_sh1add_c] = ((zba_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 1] == 2'b01)) ? 1'b1 : 1'b0;
-  assign cmd[op_sh2add_c] = ((zba_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 1] == 2'b10)) ? 1'b1 : 1'b0;
-  assign cmd[op_sh3add_c] = ((zba_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 1] == 2'b11)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_sh1add_c] = ((zba_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 1] == 2'b01)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_sh2add_c] = ((zba_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 1] == 2'b10)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_sh3add_c] = ((zba_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b0) && (ctrl_i.ir_funct3[2 : 1] == 2'b11)) ? 1'b1 : 1'b0;
 
   /* Zbs - Single-bit instructions */
-  assign cmd[op_bclr_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
-  assign cmd[op_bext_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b1)) ? 1'b1 : 1'b0;
-  assign cmd[op_binv_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
-  assign cmd[op_bset_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_bclr_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_bext_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b10) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b1)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_binv_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b11) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_bset_c]   = ((zbs_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b01) && (ctrl_i.ir_funct12[7] == 1'b1) && (ctrl_i.ir_funct3[2] == 1'b0)) ? 1'b1 : 1'b0;
 
   /* Zbc - Carry-less multiplication instructions */
-  assign cmd[op_clmul_c]  = ((zbc_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b001)) ? 1'b1 : 1'b0;
-  assign cmd[op_clmulh_c] = ((zbc_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b011)) ? 1'b1 : 1'b0;
-  assign cmd[op_clmulr_c] = ((zbc_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b010)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_clmul_c]  = ((zbc_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b001)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_clmulh_c] = ((zbc_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b011)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_clmulr_c] = ((zbc_en_c == 1'b1) && (ctrl_i.ir_funct12[10 : 9] == 2'b00) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3[2 : 0] == 3'b010)) ? 1'b1 : 1'b0;
+
+  /* Zbkb - Bit-manipulation for cryptography (PACK is ZEXT.H with rs2 != x0) */
+  assign cmd_dec[op_packh_c]  = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b1) && (ctrl_i.ir_funct12[11:5] == 7'b0000100) && (ctrl_i.ir_funct3 == 3'b111)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_brev8_c]  = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct12 == 12'h687) && (ctrl_i.ir_funct3 == 3'b101)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_zip_c]    = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct12 == 12'h08f) && (ctrl_i.ir_funct3 == 3'b001)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_unzip_c]  = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct12 == 12'h08f) && (ctrl_i.ir_funct3 == 3'b101)) ? 1'b1 : 1'b0;
+
+  /* Zbkx - Crossbar permutation instructions */
+  assign cmd_dec[op_xperm8_c] = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b1) && (ctrl_i.ir_funct12[11:5] == 7'b0010100) && (ctrl_i.ir_funct3 == 3'b100)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_xperm4_c] = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b1) && (ctrl_i.ir_funct12[11:5] == 7'b0010100) && (ctrl_i.ir_funct3 == 3'b010)) ? 1'b1 : 1'b0;
+
+  /* Zkne/Zknd - AES: funct7 = bs & 1 0 dec mix 1 */
+  assign cmd_dec[op_aes_c]    = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b1) && (ctrl_i.ir_funct12[9:8] == 2'b10) && (ctrl_i.ir_funct12[5] == 1'b1) && (ctrl_i.ir_funct3 == 3'b000)) ? 1'b1 : 1'b0;
+
+  /* Zknh - SHA-256 (funct12 = 0x10x) and SHA-512 (funct7 = 0101xxx) */
+  assign cmd_dec[op_sha256_c] = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b0) && (ctrl_i.ir_funct12[11:2] == 10'b0001000000) && (ctrl_i.ir_funct3 == 3'b001)) ? 1'b1 : 1'b0;
+  assign cmd_dec[op_sha512_c] = ((ZKN_EN == 1) && (ctrl_i.ir_opcode[5] == 1'b1) && (ctrl_i.ir_funct12[11:8] == 4'b0101) && (ctrl_i.ir_funct3 == 3'b000)) ? 1'b1 : 1'b0;
+
+  /* the (minimal) Zb* decoding above also matches some of the crypto instructions - crypto operations have priority */
+  assign cmd[op_clmulr_c:0]            = ((|cmd_dec[op_width_c-1:op_packh_c]) == 1'b1) ? '0 : cmd_dec[op_clmulr_c:0];
+  assign cmd[op_width_c-1:op_packh_c]  = cmd_dec[op_width_c-1:op_packh_c];
   
   // Co-Processor Controller -------------------------------------------------------------------
   // -------------------------------------------------------------------------------------------
@@ -420,8 +509,7 @@ module cellrv32_cpu_cp_bitmanip #(
   assign res_int[op_sextb_c][7:0]       = rs1_reg[7:0]; // sign-extend byte
   assign res_int[op_sexth_c][XLEN-1:16] = (rs1_reg[15] == 1'b1) ? '1 : '0;
   assign res_int[op_sexth_c][15:0]      = rs1_reg[15:0]; // sign-extend half-word
-  assign res_int[op_zexth_c][XLEN-1:16] = '0;
-  assign res_int[op_zexth_c][15:0]      = rs1_reg[15:0]; // zero-extend half-word
+  assign res_int[op_zexth_c] = {rs2_reg[15:0], rs1_reg[15:0]}; // zero-extend half-word (rs2 = x0) or PACK (Zbkb)
 
   /* rotate right/left */
   assign res_int[op_ror_c] = shifter.sreg;
@@ -455,6 +543,95 @@ module cellrv32_cpu_cp_bitmanip #(
   assign res_int[op_clmulh_c] = clmul.prod[63 : 32];
   assign res_int[op_clmulr_c] = bit_rev_f(clmul.prod[31 : 0]);
 
+  /* Zbkb - pack low bytes, bit-reverse in bytes, bit-interleave/de-interleave */
+  assign res_int[op_packh_c] = {16'h0000, rs2_reg[7:0], rs1_reg[7:0]};
+  generate
+        for (k = 0; k < (XLEN/8); ++k) begin : brev8_loop
+            assign res_int[op_brev8_c][k*8+7 : k*8] = {<<{rs1_reg[k*8+7 : k*8]}};
+        end : brev8_loop
+        for (k = 0; k < (XLEN/2); ++k) begin : zip_loop
+            assign res_int[op_zip_c][2*k]       = rs1_reg[k];
+            assign res_int[op_zip_c][2*k+1]     = rs1_reg[k+XLEN/2];
+            assign res_int[op_unzip_c][k]        = rs1_reg[2*k];
+            assign res_int[op_unzip_c][k+XLEN/2] = rs1_reg[2*k+1];
+        end : zip_loop
+  endgenerate
+
+  /* Zbkx - crossbar permutations: rs2 holds the indices, rs1 is the lookup table */
+  generate
+        for (k = 0; k < (XLEN/8); ++k) begin : xperm8_loop
+            assign res_int[op_xperm8_c][k*8+7 : k*8] = (rs2_reg[k*8+7 : k*8+2] == '0) ? rs1_reg[8*rs2_reg[k*8+1 : k*8] +: 8] : '0;
+        end : xperm8_loop
+        for (k = 0; k < (XLEN/4); ++k) begin : xperm4_loop
+            assign res_int[op_xperm4_c][k*4+3 : k*4] = (rs2_reg[k*4+3] == 1'b0) ? rs1_reg[4*rs2_reg[k*4+2 : k*4] +: 4] : '0;
+        end : xperm4_loop
+  endgenerate
+
+  /* Zkne/Zknd - AES: single S-box lookup of byte "bs" of rs2 (+ partial MixColumns), rotated back into place */
+  function automatic logic [7:0] aes_xt2_f(input logic [7:0] x); // multiply by 2 in GF(2^8)
+    aes_xt2_f = {x[6:0], 1'b0} ^ ((x[7] == 1'b1) ? 8'h1b : 8'h00);
+  endfunction : aes_xt2_f
+
+  function automatic logic [7:0] aes_gfmul_f(input logic [7:0] x, input logic [3:0] c); // multiply by 4-bit constant
+    logic [7:0] x2, x4, x8;
+    x2 = aes_xt2_f(x);
+    x4 = aes_xt2_f(x2);
+    x8 = aes_xt2_f(x4);
+    aes_gfmul_f = (c[0] ? x : 8'h00) ^ (c[1] ? x2 : 8'h00) ^ (c[2] ? x4 : 8'h00) ^ (c[3] ? x8 : 8'h00);
+  endfunction : aes_gfmul_f
+
+  always_comb begin : aes_core
+    aes_si = rs2_reg[8*ctrl_i.ir_funct12[11:10] +: 8];
+    // funct7[2] = decrypt; funct7[1] = with MixColumns
+    if (ctrl_i.ir_funct12[7] == 1'b1) begin
+        aes_so = aes_inv_sbox_c[aes_si];
+        if (ctrl_i.ir_funct12[6] == 1'b1) begin
+            aes_mix = {aes_gfmul_f(aes_so, 4'hb), aes_gfmul_f(aes_so, 4'hd), aes_gfmul_f(aes_so, 4'h9), aes_gfmul_f(aes_so, 4'he)};
+        end else begin
+            aes_mix = {24'h000000, aes_so};
+        end
+    end else begin
+        aes_so = aes_sbox_c[aes_si];
+        if (ctrl_i.ir_funct12[6] == 1'b1) begin
+            aes_mix = {aes_gfmul_f(aes_so, 4'h3), aes_so, aes_so, aes_gfmul_f(aes_so, 4'h2)};
+        end else begin
+            aes_mix = {24'h000000, aes_so};
+        end
+    end
+  end : aes_core
+
+  assign res_int[op_aes_c] = rs1_reg ^ ((aes_mix << (8*ctrl_i.ir_funct12[11:10])) | (aes_mix >> (32 - 8*ctrl_i.ir_funct12[11:10])));
+
+  /* Zknh - SHA-256 sigma functions */
+  always_comb begin : sha256_core
+    unique case (ctrl_i.ir_funct12[1:0])
+        2'b00 : sha256_res = {rs1_reg[1:0],  rs1_reg[31:2]}  ^ {rs1_reg[12:0], rs1_reg[31:13]} ^ {rs1_reg[21:0], rs1_reg[31:22]}; // sum0
+        2'b01 : sha256_res = {rs1_reg[5:0],  rs1_reg[31:6]}  ^ {rs1_reg[10:0], rs1_reg[31:11]} ^ {rs1_reg[24:0], rs1_reg[31:25]}; // sum1
+        2'b10 : sha256_res = {rs1_reg[6:0],  rs1_reg[31:7]}  ^ {rs1_reg[17:0], rs1_reg[31:18]} ^ (rs1_reg >> 3);  // sig0
+        default : sha256_res = {rs1_reg[16:0], rs1_reg[31:17]} ^ {rs1_reg[18:0], rs1_reg[31:19]} ^ (rs1_reg >> 10); // sig1
+    endcase
+  end : sha256_core
+
+  assign res_int[op_sha256_c] = sha256_res;
+
+  /* Zknh - SHA-512 sigma functions (RV32: each instruction computes one half of the 64-bit result) */
+  always_comb begin : sha512_core
+    unique case (ctrl_i.ir_funct12[6:5])
+        2'b00 : sha512_res = (rs1_reg << 25) ^ (rs1_reg << 30) ^ (rs1_reg >> 28) ^
+                             (rs2_reg >> 7)  ^ (rs2_reg >> 2)  ^ (rs2_reg << 4);  // sum0r
+        2'b01 : sha512_res = (rs1_reg << 23) ^ (rs1_reg >> 14) ^ (rs1_reg >> 18) ^
+                             (rs2_reg >> 9)  ^ (rs2_reg << 18) ^ (rs2_reg << 14); // sum1r
+        2'b10 : sha512_res = (rs1_reg >> 1)  ^ (rs1_reg >> 7)  ^ (rs1_reg >> 8)  ^
+                             (rs2_reg << 31) ^ (rs2_reg << 24) ^
+                             ((ctrl_i.ir_funct12[7] == 1'b0) ? (rs2_reg << 25) : '0); // sig0l / sig0h
+        default : sha512_res = (rs1_reg << 3)  ^ (rs1_reg >> 6)  ^ (rs1_reg >> 19) ^
+                               (rs2_reg >> 29) ^ (rs2_reg << 13) ^
+                               ((ctrl_i.ir_funct12[7] == 1'b0) ? (rs2_reg << 26) : '0); // sig1l / sig1h
+    endcase
+  end : sha512_core
+
+  assign res_int[op_sha512_c] = sha512_res;
+
   // Output Selector ------------------------------------------------------------------------
   // -------------------------------------------------------------------------------------------
   assign res_out[op_andn_c]  = (cmd_buf[op_andn_c]  == 1'b1) ? res_int[op_andn_c] : '0;
@@ -485,6 +662,16 @@ module cellrv32_cpu_cp_bitmanip #(
   assign res_out[op_clmul_c ] = (cmd_buf[op_clmul_c ] == 1'b1) ? res_int[op_clmul_c ] : '0;
   assign res_out[op_clmulh_c] = (cmd_buf[op_clmulh_c] == 1'b1) ? res_int[op_clmulh_c] : '0;
   assign res_out[op_clmulr_c] = (cmd_buf[op_clmulr_c] == 1'b1) ? res_int[op_clmulr_c] : '0;
+  //
+  assign res_out[op_packh_c]  = (cmd_buf[op_packh_c]  == 1'b1) ? res_int[op_packh_c]  : '0;
+  assign res_out[op_brev8_c]  = (cmd_buf[op_brev8_c]  == 1'b1) ? res_int[op_brev8_c]  : '0;
+  assign res_out[op_zip_c]    = (cmd_buf[op_zip_c]    == 1'b1) ? res_int[op_zip_c]    : '0;
+  assign res_out[op_unzip_c]  = (cmd_buf[op_unzip_c]  == 1'b1) ? res_int[op_unzip_c]  : '0;
+  assign res_out[op_xperm8_c] = (cmd_buf[op_xperm8_c] == 1'b1) ? res_int[op_xperm8_c] : '0;
+  assign res_out[op_xperm4_c] = (cmd_buf[op_xperm4_c] == 1'b1) ? res_int[op_xperm4_c] : '0;
+  assign res_out[op_aes_c]    = (cmd_buf[op_aes_c]    == 1'b1) ? res_int[op_aes_c]    : '0;
+  assign res_out[op_sha256_c] = (cmd_buf[op_sha256_c] == 1'b1) ? res_int[op_sha256_c] : '0;
+  assign res_out[op_sha512_c] = (cmd_buf[op_sha512_c] == 1'b1) ? res_int[op_sha512_c] : '0;
 
   // Output Gate -------------------------------------------------------------------------------
   // -------------------------------------------------------------------------------------------
@@ -499,7 +686,10 @@ module cellrv32_cpu_cp_bitmanip #(
                  res_out[op_orcb_c]   | res_out[op_rev8_c]   |
                  res_out[op_sh1add_c] | // res_out(op_sh2add_c) and res_out(op_sh3add_c) are unused here
                  res_out[op_bclr_c]   | res_out[op_bext_c]   | res_out[op_binv_c]  | res_out[op_bset_c] |
-                 res_out[op_clmul_c]  | res_out[op_clmulh_c] | res_out[op_clmulr_c];
+                 res_out[op_clmul_c]  | res_out[op_clmulh_c] | res_out[op_clmulr_c] |
+                 res_out[op_packh_c]  | res_out[op_brev8_c]  | res_out[op_zip_c]   | res_out[op_unzip_c] |
+                 res_out[op_xperm8_c] | res_out[op_xperm4_c] |
+                 res_out[op_aes_c]    | res_out[op_sha256_c] | res_out[op_sha512_c];
     end
   end : output_gate
 
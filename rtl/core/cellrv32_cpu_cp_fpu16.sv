@@ -13,6 +13,12 @@
 // #   actual FPU core.                                                                            #
 // # * Signaling NaNs (sNaN) will not be generated by the hardware at all. However, if inserted by #
 // #   the programmer they are handled correctly.                                                  #
+// #                                                                                               #
+// # FP16_SIMD = true:                                                                             #
+// # * FMADD.H, FMSUB.H, FNMSUB.H and FNMADD.H (R4 opcodes) are implemented. The product is added  #
+// #   to the third operand without intermediate rounding.                                         #
+// # * Packed-SIMD operations (2x FP16 in one x register) use one instance of this unit per 16-bit #
+// #   lane; the lanes are combined in the ALU.                                                    #
 // # ********************************************************************************************* #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
@@ -20,7 +26,8 @@
 `endif // _INCL_DEFINITIONS
 
 module cellrv32_cpu_cp_fpu16 #(
-    parameter XLEN = 32 // data path width
+    parameter XLEN      = 32, // data path width
+    parameter FP16_SIMD = 0   // implement fused multiply-add (packed-SIMD lane)
 ) (
     /* global control */
     input logic             clk_i,     // global clock, rising edge
@@ -49,6 +56,7 @@ module cellrv32_cpu_cp_fpu16 #(
     const logic [3:0] op_mul_c    = 4'b0111;
     const logic [3:0] op_div_c    = 4'b1000;
     const logic [3:0] op_sqrt_c   = 4'b1001;
+    const logic [3:0] op_fma_c    = 4'b1010;
 
     /* commands (one-hot) */
     typedef struct {
@@ -62,6 +70,7 @@ module cellrv32_cpu_cp_fpu16 #(
         logic instr_mul;   
         logic instr_div;
         logic instr_sqrt;
+        logic instr_fma;
         logic [3:0] funct;
     } cmd_t;
     //
@@ -88,6 +97,8 @@ module cellrv32_cpu_cp_fpu16 #(
         logic [09:0] rs1_class; // operand 1 number class
         logic [15:0] rs2;       // operand 2
         logic [09:0] rs2_class; // operand 2 number class
+        logic [15:0] rs3;       // operand 3
+        logic [09:0] rs3_class; // operand 3 number class
         logic [02:0] frm;       // rounding mode
     } fpu_operands_t;
     //
@@ -114,6 +125,7 @@ module cellrv32_cpu_cp_fpu16 #(
     fu_interface_t fu_min_max;    
     fu_interface_t fu_addsub;      
     fu_interface_t fu_mul;    
+    fu_interface_t fu_fma;
     logic fu_div_start;   
     logic fu_sqrt_start;      
     logic fu_core_done; // FU operation completed
@@ -235,6 +247,49 @@ module cellrv32_cpu_cp_fpu16 #(
     //
     addsub_t addsub;
 
+    /* fused multiply-add unit */
+    typedef struct packed {
+        /* input operands */
+        logic        p_zero;     // product is zero
+        logic        p_sign;     // product sign (incl. negation)
+        logic [06:0] p_exp;      // product exponent (signed)
+        logic [25:0] p_man;      // product mantissa (bit 24 = hidden one)
+        logic        c_sign;     // addend sign (incl. negation)
+        logic [06:0] c_exp;      // addend exponent
+        logic [25:0] c_man;      // addend mantissa (bit 24 = hidden one)
+        logic        p_big;      // product has the larger exponent
+        logic [06:0] exp_diff;   // exponent difference
+        logic [25:0] align_man;  // smaller mantissa, aligned
+        logic        align_s;    // smaller mantissa, shifted-out bits
+        /* alignment stage */
+        logic        sub;        // effective subtraction
+        logic        big_sign;   // sign of the operand with the larger exponent
+        logic [06:0] exp;        // larger exponent
+        logic [25:0] man_hi;     // mantissa with the larger exponent
+        logic [25:0] man_lo;     // aligned mantissa with the smaller exponent
+        logic        sticky;     // sticky bit of man_lo
+        /* adder stage */
+        logic [27:0] sum;        // mantissa sum incl. carry (bit 25 = hidden one) and sticky bit
+        logic        sum_sign;
+        logic [06:0] sum_exp;
+        logic [04:0] sum_lzc;    // leading zeros of the sum
+        /* normalization stage */
+        logic [27:0] res_man;    // leading one at bit 27
+        logic [06:0] res_exp;
+        logic        res_sign;
+        logic [09:0] res_class;
+        logic [04:0] res_flags;
+        /* special cases */
+        logic [09:0] class_data;
+        logic [04:0] flags;
+        /* arbitration */
+        logic        start;
+        logic [05:0] latency;    // unit latency
+        logic        done;
+    } fma_t;
+    //
+    fma_t fma;
+
     /* normalizer interface (normalization & rounding and int-to-float) */
     typedef struct {
         logic start;
@@ -268,9 +323,11 @@ module cellrv32_cpu_cp_fpu16 #(
     assign cmd.instr_mul    = (ctrl_i.ir_funct12[11:7] == 5'b00010) && (ctrl_i.ir_opcode == opcode_fop_c) ? 1'b1 : 1'b0;
     assign cmd.instr_div    = (ctrl_i.ir_funct12[11:7] == 5'b00011) && (ctrl_i.ir_opcode == opcode_fop_c) ? 1'b1 : 1'b0;
     assign cmd.instr_sqrt   = (ctrl_i.ir_funct12[11:7] == 5'b01011) && (ctrl_i.ir_opcode == opcode_fop_c) ? 1'b1 : 1'b0;
+    assign cmd.instr_fma    = ((FP16_SIMD == 1) && (ctrl_i.ir_opcode[6:4] == 3'b100) && (ctrl_i.ir_opcode[1:0] == 2'b11)) ? 1'b1 : 1'b0;
 
     /* binary re-encoding */
-    assign cmd.funct = (cmd.instr_mul      == 1'b1) ? op_mul_c    :
+    assign cmd.funct = (cmd.instr_fma      == 1'b1) ? op_fma_c    :
+                       (cmd.instr_mul      == 1'b1) ? op_mul_c    :
                        (cmd.instr_addsub   == 1'b1) ? op_addsub_c :
                        (cmd.instr_minmax   == 1'b1) ? op_minmax_c :
                        (cmd.instr_sgnj     == 1'b1) ? op_sgnj_c   :
@@ -294,13 +351,18 @@ module cellrv32_cpu_cp_fpu16 #(
     assign op_data[1][14:10] = rs2_i[14:10];
     assign op_data[1][09:00] = (rs2_i[14:10] == 5'b00000) ? '0 : rs2_i[09:0]; // flush mantissa to zero if subnormal
 
+    /* rs3 */
+    assign op_data[2][15]    = rs3_i[15];
+    assign op_data[2][14:10] = rs3_i[14:10];
+    assign op_data[2][09:00] = (rs3_i[14:10] == 5'b00000) ? '0 : rs3_i[09:0]; // flush mantissa to zero if subnormal
+
     // Number Classifier -------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     logic op_m_all_zero_v, op_e_all_zero_v, op_e_all_one_v;
     logic op_is_zero_v, op_is_inf_v, op_is_denorm_v, op_is_nan_v;
     //
     always_comb begin : number_classifier
-        for (int i = 0; i < 2; ++i) begin
+        for (int i = 0; i < 3; ++i) begin
             /* check for all-zero/all-one */
             op_m_all_zero_v = 1'b0;
             op_e_all_zero_v = 1'b0;
@@ -350,6 +412,8 @@ module cellrv32_cpu_cp_fpu16 #(
             fpu_operands.rs1_class <= '0;
             fpu_operands.rs2       <= '0;
             fpu_operands.rs2_class <= '0;
+            fpu_operands.rs3       <= '0;
+            fpu_operands.rs3_class <= '0;
             funct_ff               <= '0;
             cmp_ff                 <= '0;
         end else begin
@@ -379,6 +443,8 @@ module cellrv32_cpu_cp_fpu16 #(
                         fpu_operands.rs1_class <= op_class[0];
                         fpu_operands.rs2       <= op_data[1];
                         fpu_operands.rs2_class <= op_class[1];
+                        fpu_operands.rs3       <= op_data[2];
+                        fpu_operands.rs3_class <= op_class[2];
                         /* execute! */
                         ctrl_engine.start <= 1'b1;
                         ctrl_engine.state <= S_BUSY;
@@ -415,6 +481,7 @@ module cellrv32_cpu_cp_fpu16 #(
     assign fu_mul.start         = ctrl_engine.start & cmd.instr_mul;
     assign fu_div_start         = ctrl_engine.start & cmd.instr_div;
     assign fu_sqrt_start        = ctrl_engine.start & cmd.instr_sqrt;
+    assign fu_fma.start         = ctrl_engine.start & cmd.instr_fma;
 
     // ****************************************************************************************************************************
     // FPU Core - Functional Units
@@ -628,7 +695,7 @@ module cellrv32_cpu_cp_fpu16 #(
     assign multiplier.exp_sum = {1'b0, fpu_operands.rs1[14:10]} + {1'b0, fpu_operands.rs2[14:10]};
 
     /* latency */
-    assign multiplier.start = fu_mul.start;
+    assign multiplier.start = fu_mul.start | fu_fma.start; // FMA uses the multiplier's product
     assign multiplier.done  = multiplier.latency[$bits(multiplier.latency)-1];
     //assign fu_mul.done      = multiplier.done;
 
@@ -1427,6 +1494,165 @@ module cellrv32_cpu_cp_fpu16 #(
     assign fu_addsub.result = '0;
     assign fu_addsub.flags  = '0;
 
+    // Fused Multiply-Add Core (FMADD, FMSUB, FNMSUB, FNMADD) ------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] The product is taken from the multiplier core (full 22-bit precision). The operand with the
+    // smaller exponent is aligned in a single step inside a 26-bit window; the sticky bit covers all bits
+    // shifted out of it. The sum is then shifted to its leading one and rounded once by the normalizer.
+    generate
+        if (FP16_SIMD == 1) begin : fma_enabled
+
+            /* input operands */
+            assign fma.p_zero = fpu_operands.rs1_class[fp_class_pos_zero_c] | fpu_operands.rs1_class[fp_class_neg_zero_c] |
+                                fpu_operands.rs2_class[fp_class_pos_zero_c] | fpu_operands.rs2_class[fp_class_neg_zero_c];
+            assign fma.p_sign = multiplier.sign ^ ctrl_i.ir_opcode[3]; // negate product: FNMSUB, FNMADD
+            assign fma.p_exp  = multiplier.exp_res;
+            assign fma.p_man  = (fma.p_zero == 1'b1) ? '0 : {multiplier.product, 4'b0000};
+            assign fma.c_sign = fpu_operands.rs3[15] ^ ctrl_i.ir_opcode[2]; // negate addend: FMSUB, FNMADD
+            assign fma.c_exp  = {2'b00, fpu_operands.rs3[14:10]};
+            assign fma.c_man  = (fpu_operands.rs3_class[fp_class_pos_zero_c] | fpu_operands.rs3_class[fp_class_neg_zero_c]) ?
+                                '0 : {2'b01, fpu_operands.rs3[09:0], 14'b0};
+
+            /* find operand with larger exponent; a zero operand is always the smaller one */
+            assign fma.p_big    = (fpu_operands.rs3_class[fp_class_pos_zero_c] | fpu_operands.rs3_class[fp_class_neg_zero_c]) |
+                                  ((~fma.p_zero) & ($signed(fma.p_exp) >= $signed(fma.c_exp)));
+            assign fma.exp_diff = (fma.p_big == 1'b1) ? (fma.p_exp - fma.c_exp) : (fma.c_exp - fma.p_exp);
+
+            /* alignment shifter */
+            always_comb begin : fma_align
+                logic [25:0] man_v;
+                logic [57:0] shift_v;
+                man_v   = (fma.p_big == 1'b1) ? fma.c_man : fma.p_man;
+                shift_v = {man_v, 32'b0} >> fma.exp_diff[4:0];
+                if (fma.exp_diff > 31) begin // everything shifted out (also: zero operand with "negative" difference)
+                    fma.align_man = '0;
+                    fma.align_s   = |man_v;
+                end else begin
+                    fma.align_man = shift_v[57:32];
+                    fma.align_s   = |shift_v[31:0];
+                end
+            end : fma_align
+
+            /* leading zero counter */
+            always_comb begin : fma_lzc
+                fma.sum_lzc = 5'd28;
+                for (int i = 0; i < 28; ++i) begin
+                    if (fma.sum[i] == 1'b1) begin
+                        fma.sum_lzc = 5'(27 - i);
+                    end
+                end
+            end : fma_lzc
+
+            /* pipeline */
+            always_ff @( posedge clk_i ) begin : fma_core
+                /* align stage (product is valid) */
+                fma.sub      <= fma.p_sign ^ fma.c_sign;
+                fma.big_sign <= (fma.p_big == 1'b1) ? fma.p_sign : fma.c_sign;
+                fma.exp      <= (fma.p_big == 1'b1) ? fma.p_exp  : fma.c_exp;
+                fma.man_hi   <= (fma.p_big == 1'b1) ? fma.p_man  : fma.c_man;
+                fma.man_lo   <= fma.align_man;
+                fma.sticky   <= fma.align_s;
+                /* adder stage */
+                if (fma.sub == 1'b0) begin // add magnitudes
+                    fma.sum      <= {1'b0, fma.man_hi, 1'b0} + {1'b0, fma.man_lo, fma.sticky};
+                    fma.sum_sign <= fma.big_sign;
+                end else if ({fma.man_hi, 1'b0} >= {fma.man_lo, fma.sticky}) begin // subtract smaller magnitude
+                    fma.sum      <= {1'b0, fma.man_hi, 1'b0} - {1'b0, fma.man_lo, fma.sticky};
+                    fma.sum_sign <= fma.big_sign;
+                end else begin
+                    fma.sum      <= {1'b0, fma.man_lo, fma.sticky} - {1'b0, fma.man_hi, 1'b0};
+                    fma.sum_sign <= ~fma.big_sign;
+                end
+                fma.sum_exp <= fma.exp;
+                /* normalization stage: move leading one to bit 27 */
+                fma.res_man   <= fma.sum << fma.sum_lzc;
+                fma.res_exp   <= fma.sum_exp + 7'd2 - {2'b00, fma.sum_lzc};
+                fma.res_class <= fma.class_data;
+                fma.res_flags <= fma.flags;
+                if ((fma.class_data[fp_class_snan_c]     | fma.class_data[fp_class_qnan_c]    |
+                     fma.class_data[fp_class_pos_inf_c]  | fma.class_data[fp_class_neg_inf_c] |
+                     fma.class_data[fp_class_pos_zero_c] | fma.class_data[fp_class_neg_zero_c]) == 1'b0) begin // finite result
+                    if (fma.sum_lzc == 5'd28) begin // exact cancellation: +0 (-0 when rounding down)
+                        fma.res_sign <= (fpu_operands.frm == 3'b010) ? 1'b1 : 1'b0;
+                        fma.res_class[fp_class_pos_zero_c] <= (fpu_operands.frm == 3'b010) ? 1'b0 : 1'b1;
+                        fma.res_class[fp_class_neg_zero_c] <= (fpu_operands.frm == 3'b010) ? 1'b1 : 1'b0;
+                    end else begin
+                        fma.res_sign <= fma.sum_sign;
+                        if ($signed(fma.sum_exp + 7'd2 - {2'b00, fma.sum_lzc}) >= $signed(7'd31)) begin // overflow
+                            fma.res_flags[fp_exc_of_c] <= 1'b1;
+                        end else if ($signed(fma.sum_exp + 7'd2 - {2'b00, fma.sum_lzc}) <= $signed(7'd0)) begin // underflow
+                            fma.res_flags[fp_exc_uf_c] <= 1'b1;
+                        end
+                    end
+                end else begin
+                    fma.res_sign <= fma.sum_sign;
+                end
+                /* latency shift register: multiplier (3) + align + add + normalize */
+                fma.latency <= {fma.latency[$bits(fma.latency)-2:0], fma.start};
+            end : fma_core
+
+            /* latency */
+            assign fma.start   = fu_fma.start;
+            assign fma.done    = fma.latency[$bits(fma.latency)-1];
+            assign fu_fma.done = fma.done;
+
+            /* result class */
+            always_comb begin : fma_class_core
+                // declare local variable
+                logic p_nan_v, p_inf_v, p_zero_v, c_nan_v, c_inf_v, c_zero_v, z_neg_v;
+                /* minions */
+                p_nan_v  = multiplier.res_class[fp_class_qnan_c]; // includes any NaN input and +/-inf * +/-zero
+                p_inf_v  = multiplier.res_class[fp_class_pos_inf_c]  | multiplier.res_class[fp_class_neg_inf_c];
+                p_zero_v = multiplier.res_class[fp_class_pos_zero_c] | multiplier.res_class[fp_class_neg_zero_c];
+                c_nan_v  = fpu_operands.rs3_class[fp_class_snan_c]     | fpu_operands.rs3_class[fp_class_qnan_c];
+                c_inf_v  = fpu_operands.rs3_class[fp_class_pos_inf_c]  | fpu_operands.rs3_class[fp_class_neg_inf_c];
+                c_zero_v = fpu_operands.rs3_class[fp_class_pos_zero_c] | fpu_operands.rs3_class[fp_class_neg_zero_c];
+                z_neg_v  = (fma.p_sign & fma.c_sign) | ((fma.p_sign ^ fma.c_sign) & (fpu_operands.frm == 3'b010)); // sign of zero + zero
+
+                /* NaN */
+                fma.class_data[fp_class_snan_c] = fpu_operands.rs1_class[fp_class_snan_c] | fpu_operands.rs2_class[fp_class_snan_c] |
+                                                  fpu_operands.rs3_class[fp_class_snan_c]; // any input is sNaN
+                fma.class_data[fp_class_qnan_c] = p_nan_v | c_nan_v |
+                                                  (p_inf_v & c_inf_v & (fma.p_sign ^ fma.c_sign)); // +/-inf -/+ inf
+                /* infinity */
+                fma.class_data[fp_class_pos_inf_c] = (p_inf_v & (~fma.p_sign)) | (c_inf_v & (~fma.c_sign));
+                fma.class_data[fp_class_neg_inf_c] = (p_inf_v & ( fma.p_sign)) | (c_inf_v & ( fma.c_sign));
+                /* zero */
+                fma.class_data[fp_class_pos_zero_c] = p_zero_v & c_zero_v & (~z_neg_v);
+                fma.class_data[fp_class_neg_zero_c] = p_zero_v & c_zero_v & ( z_neg_v);
+                /* normal [sign is irrelevant here] */
+                fma.class_data[fp_class_pos_norm_c] = ~(p_nan_v | p_inf_v | c_nan_v | c_inf_v | (p_zero_v & c_zero_v));
+                fma.class_data[fp_class_neg_norm_c] = ~(p_nan_v | p_inf_v | c_nan_v | c_inf_v | (p_zero_v & c_zero_v));
+                /* subnormal result */
+                fma.class_data[fp_class_pos_denorm_c] = 1'b0; // is evaluated by the normalizer
+                fma.class_data[fp_class_neg_denorm_c] = 1'b0; // is evaluated by the normalizer
+
+                /* exception flags */
+                fma.flags[fp_exc_nv_c] = ((fpu_operands.rs1_class[fp_class_pos_zero_c] | fpu_operands.rs1_class[fp_class_neg_zero_c]) &
+                                          (fpu_operands.rs2_class[fp_class_pos_inf_c ] | fpu_operands.rs2_class[fp_class_neg_inf_c ])) | // mul(+/-zero, +/-inf)
+                                         ((fpu_operands.rs1_class[fp_class_pos_inf_c ] | fpu_operands.rs1_class[fp_class_neg_inf_c ]) &
+                                          (fpu_operands.rs2_class[fp_class_pos_zero_c] | fpu_operands.rs2_class[fp_class_neg_zero_c])) | // mul(+/-inf, +/-zero)
+                                         (p_inf_v & c_inf_v & (fma.p_sign ^ fma.c_sign)); // +/-inf -/+ inf
+                fma.flags[fp_exc_dz_c] = 1'b0; // division by zero: not possible here
+                fma.flags[fp_exc_of_c] = 1'b0; // evaluated in the normalization stage
+                fma.flags[fp_exc_uf_c] = 1'b0; // evaluated in the normalization stage
+                fma.flags[fp_exc_nx_c] = 1'b0; // evaluated by the normalizer
+            end : fma_class_core
+
+        end : fma_enabled
+    endgenerate
+
+    generate
+        if (FP16_SIMD == 0) begin : fma_disabled
+            assign fma         = '0;
+            assign fu_fma.done = 1'b0;
+        end : fma_disabled
+    endgenerate
+
+    /* unused */
+    assign fu_fma.result = '0;
+    assign fu_fma.flags  = '0;
+
 
     // ****************************************************************************************************************************
     // FPU Core - Normalize & Round
@@ -1465,6 +1691,21 @@ module cellrv32_cpu_cp_fpu16 #(
                 normalizer.flags_in         = multiplier.flags;
                 normalizer.start            = multiplier.done;
             end
+            // fused multiply-add
+            op_fma_c : begin
+                normalizer.mode             = 1'b0; // normalization
+                normalizer.sign             = fma.res_sign;
+                normalizer.xexp             = {1'b0, fma.res_exp[4:0]};
+                normalizer.xmantissa[21:19] = {2'b00, fma.res_man[27]};
+                normalizer.xmantissa[18:09] = fma.res_man[26:17];
+                normalizer.xmantissa[08]    = fma.res_man[16];
+                normalizer.xmantissa[07]    = fma.res_man[15];
+                normalizer.xmantissa[06:01] = '0;
+                normalizer.xmantissa[00]    = |fma.res_man[14:00];
+                normalizer.class_data       = fma.res_class;
+                normalizer.flags_in         = fma.res_flags;
+                normalizer.start            = fma.done;
+            end
             // division
             op_div_c : begin
                 normalizer.mode             = 1'b0; // normalization
@@ -13,6 +13,12 @@
 // #   actual FPU core.                                                                             #
 // # * Signaling NaNs (sNaN) will not be generated by the hardware at all. However, if inserted by  #
 // #   the programmer they are handled correctly.                                                   #
+// #                                                                                                #
+// # FPU_PERF = true: performance option                                                            #
+// # * Radix-point alignment (FADD/FSUB) and normalization use barrel shifters (single cycle).      #
+// # * Fused multiply-add (FMADD/FMSUB/FNMSUB/FNMADD.S, R4-type, 3rd operand from rs3): the 48-bit  #
+// #   product is added to the aligned addend in full precision and rounded only once. Pipeline:    #
+// #   multiplier (3 cycles) -> align -> add -> leading-one shift -> normalizer (round).            #
 // # ********************************************************************************************** #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
@@ -20,7 +26,8 @@
 `endif // _INCL_DEFINITIONS
 
 module cellrv32_cpu_cp_fpu32 #(
-    parameter XLEN = 32 // data path width
+    parameter XLEN     = 32, // data path width
+    parameter FPU_PERF = 0   // barrel shifters + fused multiply-add
 ) (
     /* global control */
     input logic             clk_i,     // global clock, rising edge
@@ -49,6 +56,7 @@ module cellrv32_cpu_cp_fpu32 #(
     const logic [3:0] op_mul_c    = 4'b0111;
     const logic [3:0] op_div_c    = 4'b1000;
     const logic [3:0] op_sqrt_c   = 4'b1001;
+    const logic [3:0] op_fma_c    = 4'b1010;
 
     /* commands (one-hot) */
     typedef struct {
@@ -62,6 +70,7 @@ module cellrv32_cpu_cp_fpu32 #(
         logic instr_mul;   
         logic instr_div;
         logic instr_sqrt;
+        logic instr_fma;
         logic [3:0] funct;
     } cmd_t;
     //
@@ -78,6 +87,7 @@ module cellrv32_cpu_cp_fpu32 #(
     } ctrl_engine_t;
     //
     ctrl_engine_t ctrl_engine;
+    logic         fop_start; // start of a non-R4-type operation
 
     /* floating-point operands */
     typedef logic[31:0] op_data_t  [0:2];
@@ -88,6 +98,8 @@ module cellrv32_cpu_cp_fpu32 #(
         logic [09:0] rs1_class; // operand 1 number class
         logic [31:0] rs2;       // operand 2
         logic [09:0] rs2_class; // operand 2 number class
+        logic [31:0] rs3;       // operand 3 (FMA addend)
+        logic [09:0] rs3_class; // operand 3 number class
         logic [02:0] frm;       // rounding mode
     } fpu_operands_t;
     //
@@ -117,6 +129,7 @@ module cellrv32_cpu_cp_fpu32 #(
     fu_interface_t fu_mul;    
     fu_interface_t fu_div;   
     fu_interface_t fu_sqrt;       
+    fu_interface_t fu_fma;
     logic          fu_core_done; // FU operation completed
 
     /* int-to-float */
@@ -207,6 +220,8 @@ module cellrv32_cpu_cp_fpu32 #(
         logic        man_r_ext;
         logic        man_s_ext;
         logic [08:0] exp_cnt;
+        logic [23:0] align_man;  // smaller mantissa (zero if any input is zero)
+        logic [50:0] align_sreg; // smaller mantissa shifted in a single step (FPU_PERF only)
         /* adder/subtractor stage */
         logic        man_comp;
         logic [26:0] man_s; // mantissa + hiden one + GRS
@@ -225,6 +240,50 @@ module cellrv32_cpu_cp_fpu32 #(
     //
     addsub_t addsub;
 
+    /* fused multiply-add unit (FPU_PERF only) */
+    // mantissas use a 52-bit window: 2 integer bits + 46 fraction bits of the product + 4 guard bits
+    typedef struct packed {
+        /* input */
+        logic        p_zero;     // product is zero
+        logic        p_sign;     // product sign (incl. negation)
+        logic [09:0] p_exp;      // product exponent (biased, signed)
+        logic [51:0] p_man;      // product mantissa
+        logic        c_sign;     // addend sign (incl. negation)
+        logic [09:0] c_exp;      // addend exponent (biased, signed)
+        logic [51:0] c_man;      // addend mantissa
+        logic        p_big;      // product has the larger exponent
+        logic [09:0] exp_diff;   // exponent difference
+        logic [51:0] align_man;  // smaller mantissa, aligned
+        logic        align_s;    // smaller mantissa, shifted-out bits
+        /* alignment stage */
+        logic        sub;        // effective subtraction
+        logic        big_sign;   // sign of the operand with the larger exponent
+        logic [09:0] exp;        // larger exponent
+        logic [51:0] man_hi;     // mantissa with the larger exponent
+        logic [51:0] man_lo;     // aligned mantissa with the smaller exponent
+        logic        sticky;     // sticky bit of man_lo
+        /* adder stage */
+        logic [53:0] sum;        // mantissa sum incl. carry (bit 51 = hidden one) and sticky bit
+        logic        sum_sign;
+        logic [09:0] sum_exp;
+        logic [05:0] sum_lzc;    // leading zeros of the sum
+        /* normalization stage */
+        logic [53:0] res_man;    // leading one at bit 53
+        logic [09:0] res_exp;
+        logic        res_sign;
+        logic [09:0] res_class;
+        logic [04:0] res_flags;
+        /* special cases */
+        logic [09:0] class_data;
+        logic [04:0] flags;
+        /* arbitration */
+        logic        start;
+        logic [05:0] latency;    // unit latency
+        logic        done;
+    } fma_t;
+    //
+    fma_t fma;
+
     /* normalizer interface (normalization & rounding and int-to-float) */
     typedef struct {
         logic start;
@@ -258,9 +317,12 @@ module cellrv32_cpu_cp_fpu32 #(
     assign cmd.instr_mul    = (ctrl_i.ir_funct12[11:7] == 5'b00010) ? 1'b1 : 1'b0;
     assign cmd.instr_div    = (ctrl_i.ir_funct12[11:7] == 5'b00011) ? 1'b1 : 1'b0;
     assign cmd.instr_sqrt   = (ctrl_i.ir_funct12[11:7] == 5'b01011) ? 1'b1 : 1'b0;
+    // R4-type (opcode 100xx11): funct12[11:7] is rs3 here
+    assign cmd.instr_fma    = ((FPU_PERF == 1) && (ctrl_i.ir_opcode[6:4] == 3'b100) && (ctrl_i.ir_opcode[1:0] == 2'b11)) ? 1'b1 : 1'b0;
 
     /* binary re-encoding */
-    assign cmd.funct = (cmd.instr_mul      == 1'b1) ? op_mul_c    :
+    assign cmd.funct = (cmd.instr_fma      == 1'b1) ? op_fma_c    :
+                       (cmd.instr_mul      == 1'b1) ? op_mul_c    :
                        (cmd.instr_addsub   == 1'b1) ? op_addsub_c :
                        (cmd.instr_minmax   == 1'b1) ? op_minmax_c :
                        (cmd.instr_sgnj     == 1'b1) ? op_sgnj_c   :
@@ -286,13 +348,19 @@ module cellrv32_cpu_cp_fpu32 #(
     assign op_data[1][22:00] = (rs2_i[30:23] == 8'b00000000) ? 
                                '0 : rs2_i[22:0]; // flush mantissa to zero if subnormal
 
+    /* rs3 */
+    assign op_data[2][31]    = rs3_i[31];
+    assign op_data[2][30:23] = rs3_i[30:23];
+    assign op_data[2][22:00] = (rs3_i[30:23] == 8'b00000000) ? 
+                               '0 : rs3_i[22:0]; // flush mantissa to zero if subnormal
+
     // Number Classifier -------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     logic op_m_all_zero_v, op_e_all_zero_v, op_e_all_one_v;
     logic op_is_zero_v, op_is_inf_v, op_is_denorm_v, op_is_nan_v;
     //
     always_comb begin : number_classifier
-        for (int i = 0; i < 2; ++i) begin
+        for (int i = 0; i < 3; ++i) begin
             /* check for all-zero/all-one */
             op_m_all_zero_v = 1'b0;
             op_e_all_zero_v = 1'b0;
@@ -342,6 +410,8 @@ module cellrv32_cpu_cp_fpu32 #(
             fpu_operands.rs1_class <= '0;
             fpu_operands.rs2       <= '0;
             fpu_operands.rs2_class <= '0;
+            fpu_operands.rs3       <= '0;
+            fpu_operands.rs3_class <= '0;
             funct_ff               <= '0;
             cmp_ff                 <= '0;
         end else begin
@@ -369,6 +439,8 @@ module cellrv32_cpu_cp_fpu32 #(
                         fpu_operands.rs1_class <= op_class[0];
                         fpu_operands.rs2       <= op_data[1];
                         fpu_operands.rs2_class <= op_class[1];
+                        fpu_operands.rs3       <= op_data[2];
+                        fpu_operands.rs3_class <= op_class[2];
                         /* execute! */
                         ctrl_engine.start <= 1'b1;
                         ctrl_engine.state <= S_BUSY;
@@ -395,16 +467,20 @@ module cellrv32_cpu_cp_fpu32 #(
 
     // Functional Unit Interface (operation-start trigger) ---------------------------------------
     // -------------------------------------------------------------------------------------------
-    assign fu_classify.start    = ctrl_engine.start & cmd.instr_class;
-    assign fu_compare.start     = ctrl_engine.start & cmd.instr_comp;
-    assign fu_sign_inject.start = ctrl_engine.start & cmd.instr_sgnj;
-    assign fu_min_max.start     = ctrl_engine.start & cmd.instr_minmax;
-    assign fu_conv_i2f.start    = ctrl_engine.start & cmd.instr_i2f;
-    assign fu_conv_f2i.start    = ctrl_engine.start & cmd.instr_f2i;
-    assign fu_addsub.start      = ctrl_engine.start & cmd.instr_addsub;
-    assign fu_mul.start         = ctrl_engine.start & cmd.instr_mul;
-    assign fu_div.start         = ctrl_engine.start & cmd.instr_div;
-    assign fu_sqrt.start        = ctrl_engine.start & cmd.instr_sqrt;
+    // R4-type instructions use funct12[11:7] as rs3, so all other decodings are invalid then
+    assign fop_start = ctrl_engine.start & (~cmd.instr_fma);
+    //
+    assign fu_classify.start    = fop_start & cmd.instr_class;
+    assign fu_compare.start     = fop_start & cmd.instr_comp;
+    assign fu_sign_inject.start = fop_start & cmd.instr_sgnj;
+    assign fu_min_max.start     = fop_start & cmd.instr_minmax;
+    assign fu_conv_i2f.start    = fop_start & cmd.instr_i2f;
+    assign fu_conv_f2i.start    = fop_start & cmd.instr_f2i;
+    assign fu_addsub.start      = fop_start & cmd.instr_addsub;
+    assign fu_mul.start         = fop_start & cmd.instr_mul;
+    assign fu_div.start         = fop_start & cmd.instr_div;
+    assign fu_sqrt.start        = fop_start & cmd.instr_sqrt;
+    assign fu_fma.start         = ctrl_engine.start & cmd.instr_fma;
 
     // ****************************************************************************************************************************
     // FPU Core - Functional Units
@@ -625,7 +701,7 @@ module cellrv32_cpu_cp_fpu32 #(
     assign multiplier.exp_sum = {1'b0, fpu_operands.rs1[30:23]} + {1'b0, fpu_operands.rs2[30:23]};
 
     /* latency */
-    assign multiplier.start = fu_mul.start;
+    assign multiplier.start = fu_mul.start | fu_fma.start; // FMA uses the multiplier's product
     assign multiplier.done  = multiplier.latency[$bits(multiplier.latency)-1];
     //assign fu_mul.done      = multiplier.done;
 
@@ -1173,16 +1249,21 @@ module cellrv32_cpu_cp_fpu32 #(
         end
         //
         /* shift right small mantissa to align radix point */
-        if (addsub.latency[0] == 1'b1) begin
-            if ((fpu_operands.rs1_class[fp_class_pos_zero_c] ||
-                 fpu_operands.rs2_class[fp_class_pos_zero_c] ||
-                 fpu_operands.rs1_class[fp_class_neg_zero_c] ||
-                 fpu_operands.rs2_class[fp_class_neg_zero_c]) == 1'b0) begin // no input is zero
-                addsub.man_sreg <= addsub.small_man;
-             end else begin
-                addsub.man_sreg <= '0;
-             end
-             //
+        if ((addsub.latency[0] == 1'b1) && (FPU_PERF == 1)) begin // barrel shifter: align in a single step
+            addsub.exp_cnt <= {1'b0, addsub.large_exp};
+            if ((addsub.large_exp[7:0] - addsub.small_exp[7:0]) > 27) begin // see "Trip" below
+                addsub.man_sreg  <= '0;
+                addsub.man_g_ext <= 1'b0;
+                addsub.man_r_ext <= 1'b0;
+                addsub.man_s_ext <= |addsub.align_man;
+            end else begin
+                addsub.man_sreg  <= addsub.align_sreg[50:27];
+                addsub.man_g_ext <= addsub.align_sreg[26];
+                addsub.man_r_ext <= addsub.align_sreg[25];
+                addsub.man_s_ext <= |addsub.align_sreg[24:0]; // sticky bit
+            end
+        end else if (addsub.latency[0] == 1'b1) begin
+            addsub.man_sreg  <= addsub.align_man;
             addsub.exp_cnt   <= {1'b0, addsub.small_exp};
             addsub.man_g_ext <= 1'b0;
             addsub.man_r_ext <= 1'b0;
@@ -1277,6 +1358,13 @@ module cellrv32_cpu_cp_fpu32 #(
     assign addsub.small_man = (addsub.exp_comp[0] == 1'b1) ? {1'b1, fpu_operands.rs1[22:00]} : {1'b1, fpu_operands.rs2[22:00]};
     assign addsub.large_man = (addsub.exp_comp[0] == 1'b1) ? {1'b1, fpu_operands.rs2[22:00]} : {1'b1, fpu_operands.rs1[22:00]};
 
+    /* smaller mantissa alignment */
+    assign addsub.align_man  = (fpu_operands.rs1_class[fp_class_pos_zero_c] |
+                                fpu_operands.rs2_class[fp_class_pos_zero_c] |
+                                fpu_operands.rs1_class[fp_class_neg_zero_c] |
+                                fpu_operands.rs2_class[fp_class_neg_zero_c]) ? '0 : addsub.small_man; // zero if any input is zero
+    assign addsub.align_sreg = {addsub.align_man, 27'b0} >> (addsub.large_exp - addsub.small_exp);
+
     /* mantissa check: find smaller number (magnitude-only) */
     assign addsub.man_s = (addsub.man_comp == 1'b1) ? {addsub.man_sreg, addsub.man_g_ext, addsub.man_r_ext, addsub.man_s_ext} : {addsub.large_man, 3'b000};
     assign addsub.man_l = (addsub.man_comp == 1'b1) ? {addsub.large_man, 3'b000} : {addsub.man_sreg, addsub.man_g_ext, addsub.man_r_ext, addsub.man_s_ext};
@@ -1424,6 +1512,167 @@ module cellrv32_cpu_cp_fpu32 #(
     assign fu_addsub.result = '0;
     assign fu_addsub.flags  = '0;
 
+    // Fused Multiply-Add Core (FMADD, FMSUB, FNMSUB, FNMADD) ------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] The product is taken from the multiplier core (full 48-bit precision). The operand with the
+    // smaller exponent is aligned in a single step; bits shifted out of the 52-bit window only occur if the
+    // exponent difference is large enough that the result cannot cancel by more than one bit, so the
+    // sticky bit is sufficient for correct rounding. Massive cancellation (exponent difference <= 1) is
+    // exact. The sum is then shifted to its leading one and rounded once by the normalizer.
+    generate
+        if (FPU_PERF == 1) begin : fma_enabled
+
+            /* input operands */
+            assign fma.p_zero = fpu_operands.rs1_class[fp_class_pos_zero_c] | fpu_operands.rs1_class[fp_class_neg_zero_c] |
+                                fpu_operands.rs2_class[fp_class_pos_zero_c] | fpu_operands.rs2_class[fp_class_neg_zero_c];
+            assign fma.p_sign = multiplier.sign ^ ctrl_i.ir_opcode[3]; // negate product: FNMSUB, FNMADD
+            assign fma.p_exp  = multiplier.exp_res;
+            assign fma.p_man  = (fma.p_zero == 1'b1) ? '0 : {multiplier.product, 4'b0000};
+            assign fma.c_sign = fpu_operands.rs3[31] ^ ctrl_i.ir_opcode[2]; // negate addend: FMSUB, FNMADD
+            assign fma.c_exp  = {2'b00, fpu_operands.rs3[30:23]};
+            assign fma.c_man  = (fpu_operands.rs3_class[fp_class_pos_zero_c] | fpu_operands.rs3_class[fp_class_neg_zero_c]) ?
+                                '0 : {2'b01, fpu_operands.rs3[22:0], 27'b0};
+
+            /* find operand with larger exponent; a zero operand is always the smaller one */
+            assign fma.p_big    = (fpu_operands.rs3_class[fp_class_pos_zero_c] | fpu_operands.rs3_class[fp_class_neg_zero_c]) |
+                                  ((~fma.p_zero) & ($signed(fma.p_exp) >= $signed(fma.c_exp)));
+            assign fma.exp_diff = (fma.p_big == 1'b1) ? (fma.p_exp - fma.c_exp) : (fma.c_exp - fma.p_exp);
+
+            /* alignment shifter */
+            always_comb begin : fma_align
+                logic [51:0]  man_v;
+                logic [115:0] shift_v;
+                man_v   = (fma.p_big == 1'b1) ? fma.c_man : fma.p_man;
+                shift_v = {man_v, 64'b0} >> fma.exp_diff[5:0];
+                if (fma.exp_diff > 63) begin // everything shifted out (also: zero operand with "negative" difference)
+                    fma.align_man = '0;
+                    fma.align_s   = |man_v;
+                end else begin
+                    fma.align_man = shift_v[115:64];
+                    fma.align_s   = |shift_v[63:0];
+                end
+            end : fma_align
+
+            /* leading zero counter */
+            always_comb begin : fma_lzc
+                fma.sum_lzc = 6'd54;
+                for (int i = 0; i < 54; ++i) begin
+                    if (fma.sum[i] == 1'b1) begin
+                        fma.sum_lzc = 6'(53 - i);
+                    end
+                end
+            end : fma_lzc
+
+            /* pipeline */
+            always_ff @( posedge clk_i ) begin : fma_core
+                /* align stage (product is valid) */
+                fma.sub      <= fma.p_sign ^ fma.c_sign;
+                fma.big_sign <= (fma.p_big == 1'b1) ? fma.p_sign : fma.c_sign;
+                fma.exp      <= (fma.p_big == 1'b1) ? fma.p_exp  : fma.c_exp;
+                fma.man_hi   <= (fma.p_big == 1'b1) ? fma.p_man  : fma.c_man;
+                fma.man_lo   <= fma.align_man;
+                fma.sticky   <= fma.align_s;
+                /* adder stage */
+                if (fma.sub == 1'b0) begin // add magnitudes
+                    fma.sum      <= {1'b0, fma.man_hi, 1'b0} + {1'b0, fma.man_lo, fma.sticky};
+                    fma.sum_sign <= fma.big_sign;
+                end else if ({fma.man_hi, 1'b0} >= {fma.man_lo, fma.sticky}) begin // subtract smaller magnitude
+                    fma.sum      <= {1'b0, fma.man_hi, 1'b0} - {1'b0, fma.man_lo, fma.sticky};
+                    fma.sum_sign <= fma.big_sign;
+                end else begin
+                    fma.sum      <= {1'b0, fma.man_lo, fma.sticky} - {1'b0, fma.man_hi, 1'b0};
+                    fma.sum_sign <= ~fma.big_sign;
+                end
+                fma.sum_exp <= fma.exp;
+                /* normalization stage: move leading one to bit 53 */
+                fma.res_man   <= fma.sum << fma.sum_lzc;
+                fma.res_exp   <= fma.sum_exp + 10'd2 - {4'b0000, fma.sum_lzc};
+                fma.res_class <= fma.class_data;
+                fma.res_flags <= fma.flags;
+                if ((fma.class_data[fp_class_snan_c]     | fma.class_data[fp_class_qnan_c]    |
+                     fma.class_data[fp_class_pos_inf_c]  | fma.class_data[fp_class_neg_inf_c] |
+                     fma.class_data[fp_class_pos_zero_c] | fma.class_data[fp_class_neg_zero_c]) == 1'b0) begin // finite result
+                    if (fma.sum_lzc == 6'd54) begin // exact cancellation: +0 (-0 when rounding down)
+                        fma.res_sign <= (fpu_operands.frm == 3'b010) ? 1'b1 : 1'b0;
+                        fma.res_class[fp_class_pos_zero_c] <= (fpu_operands.frm == 3'b010) ? 1'b0 : 1'b1;
+                        fma.res_class[fp_class_neg_zero_c] <= (fpu_operands.frm == 3'b010) ? 1'b1 : 1'b0;
+                    end else begin
+                        fma.res_sign <= fma.sum_sign;
+                        if ($signed(fma.sum_exp + 10'd2 - {4'b0000, fma.sum_lzc}) >= $signed(10'd255)) begin // overflow
+                            fma.res_flags[fp_exc_of_c] <= 1'b1;
+                        end else if ($signed(fma.sum_exp + 10'd2 - {4'b0000, fma.sum_lzc}) <= $signed(10'd0)) begin // underflow
+                            fma.res_flags[fp_exc_uf_c] <= 1'b1;
+                        end
+                    end
+                end else begin
+                    fma.res_sign <= fma.sum_sign;
+                end
+                /* latency shift register: multiplier (3) + align + add + normalize */
+                fma.latency <= {fma.latency[$bits(fma.latency)-2:0], fma.start};
+            end : fma_core
+
+            /* latency */
+            assign fma.start   = fu_fma.start;
+            assign fma.done    = fma.latency[$bits(fma.latency)-1];
+            assign fu_fma.done = fma.done;
+
+            /* result class */
+            always_comb begin : fma_class_core
+                // declare local variable
+                logic p_nan_v, p_inf_v, p_zero_v, c_nan_v, c_inf_v, c_zero_v, z_neg_v;
+                /* minions */
+                p_nan_v  = multiplier.res_class[fp_class_qnan_c]; // includes any NaN input and +/-inf * +/-zero
+                p_inf_v  = multiplier.res_class[fp_class_pos_inf_c]  | multiplier.res_class[fp_class_neg_inf_c];
+                p_zero_v = multiplier.res_class[fp_class_pos_zero_c] | multiplier.res_class[fp_class_neg_zero_c];
+                c_nan_v  = fpu_operands.rs3_class[fp_class_snan_c]     | fpu_operands.rs3_class[fp_class_qnan_c];
+                c_inf_v  = fpu_operands.rs3_class[fp_class_pos_inf_c]  | fpu_operands.rs3_class[fp_class_neg_inf_c];
+                c_zero_v = fpu_operands.rs3_class[fp_class_pos_zero_c] | fpu_operands.rs3_class[fp_class_neg_zero_c];
+                z_neg_v  = (fma.p_sign & fma.c_sign) | ((fma.p_sign ^ fma.c_sign) & (fpu_operands.frm == 3'b010)); // sign of zero + zero
+
+                /* NaN */
+                fma.class_data[fp_class_snan_c] = fpu_operands.rs1_class[fp_class_snan_c] | fpu_operands.rs2_class[fp_class_snan_c] |
+                                                  fpu_operands.rs3_class[fp_class_snan_c]; // any input is sNaN
+                fma.class_data[fp_class_qnan_c] = p_nan_v | c_nan_v |
+                                                  (p_inf_v & c_inf_v & (fma.p_sign ^ fma.c_sign)); // +/-inf -/+ inf
+                /* infinity */
+                fma.class_data[fp_class_pos_inf_c] = (p_inf_v & (~fma.p_sign)) | (c_inf_v & (~fma.c_sign));
+                fma.class_data[fp_class_neg_inf_c] = (p_inf_v & ( fma.p_sign)) | (c_inf_v & ( fma.c_sign));
+                /* zero */
+                fma.class_data[fp_class_pos_zero_c] = p_zero_v & c_zero_v & (~z_neg_v);
+                fma.class_data[fp_class_neg_zero_c] = p_zero_v & c_zero_v & ( z_neg_v);
+                /* normal [sign is irrelevant here] */
+                fma.class_data[fp_class_pos_norm_c] = ~(p_nan_v | p_inf_v | c_nan_v | c_inf_v | (p_zero_v & c_zero_v));
+                fma.class_data[fp_class_neg_norm_c] = ~(p_nan_v | p_inf_v | c_nan_v | c_inf_v | (p_zero_v & c_zero_v));
+                /* subnormal result */
+                fma.class_data[fp_class_pos_denorm_c] = 1'b0; // is evaluated by the normalizer
+                fma.class_data[fp_class_neg_denorm_c] = 1'b0; // is evaluated by the normalizer
+
+                /* exception flags */
+                fma.flags[fp_exc_nv_c] = ((fpu_operands.rs1_class[fp_class_pos_zero_c] | fpu_operands.rs1_class[fp_class_neg_zero_c]) &
+                                          (fpu_operands.rs2_class[fp_class_pos_inf_c ] | fpu_operands.rs2_class[fp_class_neg_inf_c ])) | // mul(+/-zero, +/-inf)
+                                         ((fpu_operands.rs1_class[fp_class_pos_inf_c ] | fpu_operands.rs1_class[fp_class_neg_inf_c ]) &
+                                          (fpu_operands.rs2_class[fp_class_pos_zero_c] | fpu_operands.rs2_class[fp_class_neg_zero_c])) | // mul(+/-inf, +/-zero)
+                                         (p_inf_v & c_inf_v & (fma.p_sign ^ fma.c_sign)); // +/-inf -/+ inf
+                fma.flags[fp_exc_dz_c] = 1'b0; // division by zero: not possible here
+                fma.flags[fp_exc_of_c] = 1'b0; // evaluated in the normalization stage
+                fma.flags[fp_exc_uf_c] = 1'b0; // evaluated in the normalization stage
+                fma.flags[fp_exc_nx_c] = 1'b0; // evaluated by the normalizer
+            end : fma_class_core
+
+        end : fma_enabled
+    endgenerate
+
+    generate
+        if (FPU_PERF == 0) begin : fma_disabled
+            assign fma         = '0;
+            assign fu_fma.done = 1'b0;
+        end : fma_disabled
+    endgenerate
+
+    /* unused */
+    assign fu_fma.result = '0;
+    assign fu_fma.flags  = '0;
+
 
     // ****************************************************************************************************************************
     // FPU Core - Normalize & Round
@@ -1462,6 +1711,21 @@ module cellrv32_cpu_cp_fpu32 #(
                 normalizer.flags_in         = multiplier.flags;
                 normalizer.start            = multiplier.done;
             end
+            // fused multiply-add (already shifted to the leading one)
+            op_fma_c : begin
+                normalizer.mode             = 1'b0; // normalization
+                normalizer.sign             = fma.res_sign;
+                normalizer.xexp             = {1'b0, fma.res_exp[7:0]};
+                normalizer.xmantissa[47:45] = {2'b00, fma.res_man[53]};
+                normalizer.xmantissa[44:22] = fma.res_man[52:30];
+                normalizer.xmantissa[21]    = fma.res_man[29];
+                normalizer.xmantissa[20]    = fma.res_man[28];
+                normalizer.xmantissa[19:01] = '0;
+                normalizer.xmantissa[00]    = |fma.res_man[27:00];
+                normalizer.class_data       = fma.res_class;
+                normalizer.flags_in         = fma.res_flags;
+                normalizer.start            = fma.done;
+            end
             // division
             op_div_c : begin
                 normalizer.mode             = 1'b0; // normalization
@@ -1512,7 +1776,8 @@ module cellrv32_cpu_cp_fpu32 #(
 
     // Normalizer & Rounding Unit ----------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
-    cellrv32_cpu_cp_fpu32_normalizer
+    cellrv32_cpu_cp_fpu32_normalizer #(
+        .FAST_NORM(FPU_PERF)) // use barrel shifter for normalization
     cellrv32_cpu_cp_fpu32_normalizer_inst (
         /* control */
         .clk_i( clk_i),                    // global clock, rising edge
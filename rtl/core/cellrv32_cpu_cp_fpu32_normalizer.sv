@@ -2,13 +2,18 @@
 // # << CELLRV32 - Single-Precision Floating-Point Unit: Normalizer and Rounding Unit >>            #
 // # ***********************************************************************************************#
 // # This unit also performs int-to-float conversions.                                              #
+// #                                                                                                #
+// # FAST_NORM = false (default) : shift one bit per clock cycle (small but slow)                   #
+// # FAST_NORM = true            : shift to the leading one in a single cycle (barrel shifter)      #
 // # ********************************************************************************************** #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
   import cellrv32_package::*;
 `endif // _INCL_DEFINITIONS
 
-module cellrv32_cpu_cp_fpu32_normalizer (
+module cellrv32_cpu_cp_fpu32_normalizer #(
+    parameter FAST_NORM = 0 // use barrel shifter for normalization
+) (
     /* control */
     input logic       clk_i,      // global clock, rising edge
     input logic       rstn_i,     // global reset, low-active, async
@@ -75,6 +80,18 @@ module cellrv32_cpu_cp_fpu32_normalizer (
     } round_t;
     round_t round;
 
+    /* barrel shifter (FAST_NORM only) */
+    typedef struct {
+        logic        valid;  // leading one found
+        logic [05:0] amount; // shift amount
+        logic [31:0] upper;
+        logic [22:0] lower;
+        logic        ext_g;
+        logic        ext_r;
+        logic        ext_s;
+    } bshift_t;
+    bshift_t bshift;
+
     // Control Engine ----------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     always_ff @( posedge clk_i or negedge rstn_i ) begin : ctrl_engine
@@ -197,6 +214,17 @@ module cellrv32_cpu_cp_fpu32_normalizer (
                         end else begin // second normalization cycle done
                             ctrl.state <= S_CHECK;
                         end
+                    end else if ((FAST_NORM == 1) && (bshift.valid == 1'b1)) begin // move leading one to the hidden bit at once
+                        if (sreg.dir) begin // shift left
+                            ctrl.cnt <= ctrl.cnt - bshift.amount;
+                        end else begin // shift right
+                            ctrl.cnt <= ctrl.cnt + bshift.amount;
+                        end
+                        sreg.upper <= bshift.upper;
+                        sreg.lower <= bshift.lower;
+                        sreg.ext_g <= bshift.ext_g;
+                        sreg.ext_r <= bshift.ext_r;
+                        sreg.ext_s <= bshift.ext_s;
                     end else begin
                         if (sreg.dir) begin // shift left
                             ctrl.cnt   <= ctrl.cnt - 1'b1;
@@ -316,6 +344,45 @@ module cellrv32_cpu_cp_fpu32_normalizer (
     assign flags_o[fp_exc_uf_c] = ctrl.flags[fp_exc_uf_c]; // underflow
     assign flags_o[fp_exc_nx_c] = ctrl.flags[fp_exc_nx_c]; // inexact
 
+    // Barrel Shifter (FAST_NORM only) ------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] The shift amount is limited to 26 (left) / 31 (right) positions, so the exponent counter
+    // crosses the overflow/underflow boundary at most once per step and the cnt_of/cnt_uf detection
+    // above keeps working. An all-zero fraction falls back to the iterative shift (until underflow).
+    always_comb begin : barrel_shifter
+        logic [114:0] shl_v; // {upper, lower, g, r, s} + fill
+        logic [113:0] shr_v; // {upper, lower, g, r} + shifted-out bits
+        logic [025:0] frac_v;
+        frac_v = {sreg.lower, sreg.ext_g, sreg.ext_r, sreg.ext_s};
+        /* defaults */
+        bshift.valid  = 1'b0;
+        bshift.amount = '0;
+        if (sreg.dir) begin // shift left: find leading one below the hidden bit
+            for (int i = 0; i < 26; ++i) begin
+                if (frac_v[i] == 1'b1) begin
+                    bshift.valid  = 1'b1;
+                    bshift.amount = 6'(26 - i);
+                end
+            end
+        end else begin // shift right: find leading one above the hidden bit
+            for (int i = 1; i < 32; ++i) begin
+                if (sreg.upper[i] == 1'b1) begin
+                    bshift.valid  = 1'b1;
+                    bshift.amount = 6'(i);
+                end
+            end
+        end
+        /* shift */
+        shl_v = {sreg.upper, sreg.lower, sreg.ext_g, sreg.ext_r, sreg.ext_s, {57{sreg.ext_s}}} << bshift.amount;
+        shr_v = {sreg.upper, sreg.lower, sreg.ext_g, sreg.ext_r, 57'b0} >> bshift.amount;
+        if (sreg.dir) begin
+            {bshift.upper, bshift.lower, bshift.ext_g, bshift.ext_r, bshift.ext_s} = shl_v[114:57];
+        end else begin
+            {bshift.upper, bshift.lower, bshift.ext_g, bshift.ext_r} = shr_v[113:57];
+            bshift.ext_s = sreg.ext_s | (|shr_v[56:0]); // sticky bit
+        end
+    end : barrel_shifter
+
     // Rounding ----------------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     always_comb begin : rounding_unit_ctrl
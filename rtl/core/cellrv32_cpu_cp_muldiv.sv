@@ -4,6 +4,10 @@
 // # Multiplier core (signed/unsigned) uses serial booth's radix-4 algorithm. Multiplications can be #
 // # mapped to DSP blocks (faster!) when FAST_MUL_EN = true. Divider core (unsigned-only; pre and  #
 // # post sign-compensation logic) uses serial restoring serial algorithm.                         #
+// #                                                                                               #
+// # MULDIV_PERF = true: DSP multiplier (registered inputs and product, a new operation can be     #
+// # started every cycle) and radix-4 divider (two quotient bits per cycle) that skips the leading #
+// # zero bits of the dividend (early termination for small dividends).                            #
 // # ********************************************************************************************* #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
@@ -13,7 +17,8 @@
 module cellrv32_cpu_cp_muldiv #(
     parameter XLEN        = 32, // data path width
     parameter FAST_MUL_EN = 1,  // use DSPs for faster multiplication
-    parameter DIVISION_EN = 1   // implement divider hardware
+    parameter DIVISION_EN = 1,  // implement divider hardware
+    parameter MULDIV_PERF = 0   // DSP multiplier + radix-4 early-out divider
 ) (
     /* global control */
     input  logic            clk_i,   // global clock, rising edge
@@ -38,6 +43,10 @@ module cellrv32_cpu_cp_muldiv #(
     const logic[2:0] cp_op_rem_c    = 3'b110; // rem
     //const logic[2:0] cp_op_remu_c   = 3'b111; // remu
 
+    /* implementation options */
+    localparam logic fast_mul_c = (FAST_MUL_EN == 1) || (MULDIV_PERF == 1); // DSP-based multiplier
+    localparam int   div_rdx_c  = cond_sel_int_f(MULDIV_PERF == 1, 2, 1);  // quotient bits per cycle
+
     /* controller */
     typedef enum logic[1:0] { S_IDLE, S_BUSY, S_DONE } state_t;
     typedef struct {
@@ -59,9 +68,13 @@ module cellrv32_cpu_cp_muldiv #(
         logic sign_mod; // result sign correction  
         logic [XLEN-1:0] remainder; 
         logic [XLEN-1:0] quotient;  
-        logic [XLEN:0]   sub; // try subtraction (and restore if underflow)      
         logic [XLEN-1:0] res_u; // unsigned result   
         logic signed [XLEN-1:0] res;       
+        logic [XLEN-1:0] rs1_abs; // abs(rs1)
+        logic [XLEN-1:0] rs2_abs; // abs(rs2)
+        logic [$clog2(XLEN)-1:0] skip; // leading zero bit pairs of abs(rs1) that do not need to be processed
+        logic [$clog2(XLEN)-1:0] cnt;  // initial iteration counter
+        logic            short; // single iteration only
     } div_t;
     div_t div;
 
@@ -108,15 +121,18 @@ module cellrv32_cpu_cp_muldiv #(
                             else
                                 div.sign_mod <= 1'b0;
                             /* DIV: abs(rs2) */
-                            if ((rs2_i[$bits(rs2_i)-1] & ctrl.rs2_is_signed) == 1'b1) // signed division?
-                                ctrl.rs2_abs <= ~rs2_i + 1; // make positive
-                            else
-                                ctrl.rs2_abs <= rs2_i;
+                            ctrl.rs2_abs <= div.rs2_abs;
                         end
                         /* is fast multiplication? */
-                        if ((ctrl.op == 1'b0) && (FAST_MUL_EN == 1'b1))
+                        if ((ctrl.op == 1'b0) && (fast_mul_c == 1'b1))
                             ctrl.state <= S_DONE;
-                        else 
+                        else if ((ctrl.op == 1'b1) && (MULDIV_PERF == 1)) begin // early-out division
+                            ctrl.cnt <= div.cnt;
+                            if (div.short == 1'b1)
+                                ctrl.state <= S_DONE;
+                            else
+                                ctrl.state <= S_BUSY;
+                        end else 
                             ctrl.state <= S_BUSY;
                     end
                 end
@@ -156,14 +172,14 @@ module cellrv32_cpu_cp_muldiv #(
     // Multiplier Core (signed/unsigned) - Full Parallel -----------------------------------------
     // -------------------------------------------------------------------------------------------
     generate
-        if (FAST_MUL_EN == 1'b1) begin : multiplier_core_parallel
+        if (fast_mul_c == 1'b1) begin : multiplier_core_parallel
             /* direct approach */
             always_ff @( posedge clk_i ) begin : multiplier_core
                 if (mul.start == 1'b1) begin
                     mul.dsp_x <= signed'({(rs1_i[$bits(rs1_i)-1] & ctrl.rs1_is_signed), rs1_i});
                     mul.dsp_y <= signed'({(rs2_i[$bits(rs2_i)-1] & ctrl.rs2_is_signed), rs2_i});
                 end
-                mul.prod <= mul.dsp_z[63:0];
+                mul.prod <= {mul.dsp_z[2*XLEN:0], 1'b0}; // same layout as serial multiplier: product in [2*XLEN:1]
             end : multiplier_core
 
             /* actual multiplication */
@@ -173,7 +189,7 @@ module cellrv32_cpu_cp_muldiv #(
 
     /* no parallel multiplier */
     generate
-        if (FAST_MUL_EN == 1'b0) begin
+        if (fast_mul_c == 1'b0) begin
             assign mul.dsp_x = '0;
             assign mul.dsp_y = '0;
             assign mul.dsp_z = '0;
@@ -183,7 +199,7 @@ module cellrv32_cpu_cp_muldiv #(
     // Multiplier Core (signed/unsigned) - Iterative ---------------------------------------------
     // -------------------------------------------------------------------------------------------
     generate
-        if (FAST_MUL_EN == 1'b0) begin : multiplier_core_serial
+        if (fast_mul_c == 1'b0) begin : multiplier_core_serial
             /* serial booth's radix-4 algorithm */
             always_ff @(posedge clk_i or negedge rstn_i) begin : multiplier_core_serial_booth
                 if (!rstn_i) begin
@@ -225,7 +241,7 @@ module cellrv32_cpu_cp_muldiv #(
 
     /* no serial multiplier */
     generate
-        if (FAST_MUL_EN == 1'b1) begin : multiplier_core_serial_none
+        if (fast_mul_c == 1'b1) begin : multiplier_core_serial_none
              assign mul.base    = '0;
              assign mul.M_ext   = '0;
              assign mul.running = 1'b0;
@@ -238,23 +254,50 @@ module cellrv32_cpu_cp_muldiv #(
         if (DIVISION_EN == 1'b1) begin : divider_core_serial
             /* restoring division algorithm */
             always_ff @( posedge clk_i ) begin : divider_core
+                logic [XLEN-1:0] rem_v, quo_v;
+                logic [XLEN:0]   sub_v;
                 if (div.start == 1'b1) begin // start new division
-                    if ((rs1_i[$bits(rs1_i)-1] & ctrl.rs1_is_signed) == 1'b1) // signed division ?
-                       div.quotient <= ~rs1_i + 1; // make positive
-                    else
-                       div.quotient <= rs1_i;
+                    div.quotient  <= div.rs1_abs << {div.skip, 1'b0}; // skip leading zero bit pairs (perf. mode only)
                     div.remainder <= '0;
                 end else if ((ctrl.state == S_BUSY) || (ctrl.state == S_DONE)) begin // running ?
-                    div.quotient <= {div.quotient[30:0], ~div.sub[32]};
-                    if (div.sub[32] == 1'b0) // implicit shift
-                        div.remainder <= div.sub[31:0];
-                    else // underflow: restore and explicit shift
-                        div.remainder <= {div.remainder[30:0], div.quotient[31]};
+                    rem_v = div.remainder;
+                    quo_v = div.quotient;
+                    for (int i = 0; i < div_rdx_c; ++i) begin // one (radix-2) or two (radix-4) quotient bits per cycle
+                        sub_v = {1'b0, rem_v[30:0], quo_v[31]} - {1'b0, ctrl.rs2_abs}; // try another subtraction (and shift)
+                        if (sub_v[32] == 1'b0) // implicit shift
+                            rem_v = sub_v[31:0];
+                        else // underflow: restore and explicit shift
+                            rem_v = {rem_v[30:0], quo_v[31]};
+                        quo_v = {quo_v[30:0], ~sub_v[32]};
+                    end
+                    div.quotient  <= quo_v;
+                    div.remainder <= rem_v;
                 end
             end : divider_core
 
-            /* try another subtraction (and shift) */
-            assign div.sub = {1'b0, div.remainder[30:0], div.quotient[31]} - {1'b0, ctrl.rs2_abs};
+            /* operand pre-processing */
+            assign div.rs1_abs = ((rs1_i[$bits(rs1_i)-1] & ctrl.rs1_is_signed) == 1'b1) ? (~rs1_i + 1) : rs1_i; // make positive
+            assign div.rs2_abs = ((rs2_i[$bits(rs2_i)-1] & ctrl.rs2_is_signed) == 1'b1) ? (~rs2_i + 1) : rs2_i; // make positive
+
+            /* early termination: the leading zero bits of the dividend only produce zero quotient bits */
+            always_comb begin : divider_early_out
+                int lz;
+                lz = XLEN;
+                for (int i = 0; i < XLEN; ++i) begin
+                    if (div.rs1_abs[i] == 1'b1) begin
+                        lz = XLEN-1-i;
+                    end
+                end
+                if ((MULDIV_PERF == 0) || (rs2_i == '0)) begin // disabled / division by zero: all quotient bits are set
+                    div.skip = '0;
+                end else if (lz >= (XLEN-2)) begin // at least one iteration
+                    div.skip = $clog2(XLEN)'(XLEN/2-1);
+                end else begin
+                    div.skip = $clog2(XLEN)'(lz/2);
+                end
+                div.short = (div.skip == $clog2(XLEN)'(XLEN/2-1)) ? 1'b1 : 1'b0; // single iteration (in S_DONE)
+                div.cnt   = $clog2(XLEN)'(XLEN/2-2) - div.skip; // remaining iterations in S_BUSY (-1)
+            end : divider_early_out
 
             /* result and sign compensation */
             assign div.res_u = ((ctrl.cp_op == cp_op_div_c) || (ctrl.cp_op == cp_op_divu_c)) ? div.quotient : div.remainder;
@@ -267,9 +310,13 @@ module cellrv32_cpu_cp_muldiv #(
         if (DIVISION_EN == 1'b0) begin : divider_core_serial_none
             assign div.remainder = '0;
             assign div.quotient  = '0;
-            assign div.sub       = '0;
             assign div.res_u     = '0;
             assign div.res       = '0;
+            assign div.rs1_abs   = '0;
+            assign div.rs2_abs   = '0;
+            assign div.skip      = '0;
+            assign div.cnt       = '0;
+            assign div.short     = 1'b0;
         end : divider_core_serial_none
     endgenerate
 
@@ -0,0 +1,249 @@
+// ##################################################################################################
+// # << CELLRV32 - CPU Co-Processor: Packed-SIMD DSP Unit (RISC-V "P" Extension Subset, Xpsimd) >>  #
+// # *********************************************************************************************  #
+// # Supported instructions (OP-P major opcode, encodings of the P extension draft):                #
+// # - 2x16 / 4x8 add/sub: [U]RADD/[U]RSUB (halving), [U]KADD/[U]KSUB (saturating), ADD/SUB (wrap)  #
+// # - 16-bit packing: PKBB16, PKBT16, PKTB16, PKTT16                                               #
+// # - 8-bit unpacking: SUNPKD8xy / ZUNPKD8xy (xy = 10, 20, 30, 31, 32)                             #
+// # - 16x16 dual MAC: KMDA, KMADA (accumulates into rd, 32-bit saturation)                         #
+// #                                                                                                #
+// # Saturating instructions do not set the OV flag (no vxsat CSR). KMADA reads rd as third source  #
+// # operand via the register file's rs3 port. All operations take one cycle, except for the dual   #
+// # MAC instructions, which use one additional cycle for the (registered) 16x16 products.          #
+// # ***********************************************************************************************#
+`ifndef  _INCL_DEFINITIONS
+  `define _INCL_DEFINITIONS
+  import cellrv32_package::*;
+`endif // _INCL_DEFINITIONS
+
+module cellrv32_cpu_cp_psimd #(
+    parameter XLEN = 32 // data path width
+) (
+    /* global control */
+    input  logic             clk_i,   // global clock, rising edge
+    input  logic             rstn_i,  // global reset, low-active, async
+    input  ctrl_bus_t        ctrl_i,  // main control bus
+    input  logic             start_i, // trigger operation
+    /* data input */
+    input  logic [XLEN-1:0]  rs1_i,   // rf source 1
+    input  logic [XLEN-1:0]  rs2_i,   // rf source 2
+    input  logic [XLEN-1:0]  rs3_i,   // rf source 3 (= rd, accumulator)
+    /* result and status */
+    output logic [XLEN-1:0]  res_o,   // operation result
+    output logic             valid_o  // data output valid
+);
+    /* operation groups */
+    localparam int op_addsub16_c = 0; // [U][R|K]ADD16 / [U][R|K]SUB16 / ADD16 / SUB16
+    localparam int op_addsub8_c  = 1; // [U][R|K]ADD8  / [U][R|K]SUB8  / ADD8  / SUB8
+    localparam int op_pack_c     = 2; // PKxx16
+    localparam int op_unpack_c   = 3; // [S|Z]UNPKD8xy
+    localparam int op_mac_c      = 4; // KMDA / KMADA
+    //
+    localparam int op_width_c = 5;
+
+  /* controller */
+  typedef enum logic { S_IDLE, S_BUSY_MAC } ctrl_state_t;
+  ctrl_state_t ctrl_state;
+  logic [op_width_c-1:0] cmd, cmd_buf;
+  logic valid;
+
+  /* operand buffers */
+  logic [XLEN-1:0] rs1_reg;
+  logic [XLEN-1:0] rs2_reg;
+  logic [XLEN-1:0] acc_reg;
+  logic [11:0]     funct_reg; // funct7 + rs2 field
+
+  /* add/sub configuration (decoded from funct7) */
+  typedef struct {
+    logic sub; // subtract
+    logic uns; // unsigned operands
+    logic sat; // saturate result
+    logic hlv; // halve result
+  } addsub_t;
+  addsub_t addsub;
+
+  /* dual multiply-accumulate */
+  typedef struct {
+    logic [31:0] prod_hi; // rs1.H1 * rs2.H1
+    logic [31:0] prod_lo; // rs1.H0 * rs2.H0
+    logic [33:0] sum;     // accumulator + both products
+  } mac_t;
+  mac_t mac;
+
+  /* operation results */
+  typedef logic [XLEN-1:0] res_t [op_width_c-1:0];
+  res_t res_int, res_out;
+  logic [XLEN-1:0] addsub16_res, addsub8_res, unpack_res;
+
+  // Instruction Decoding (One-Hot) ------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+  // A minimal decoding logic is used here just to distinguish between the different operation groups.
+  // A more precise decoding as well as a valid-instruction-check is performed by the CPU control unit.
+  assign cmd[op_addsub16_c] = (ctrl_i.ir_funct3 == 3'b000) && (ctrl_i.ir_funct12[11:5] != 7'b1010110) && (ctrl_i.ir_funct12[7] == 1'b0);
+  assign cmd[op_addsub8_c]  = (ctrl_i.ir_funct3 == 3'b000) && (ctrl_i.ir_funct12[11:5] != 7'b1010110) && (ctrl_i.ir_funct12[7] == 1'b1);
+  assign cmd[op_unpack_c]   = (ctrl_i.ir_funct3 == 3'b000) && (ctrl_i.ir_funct12[11:5] == 7'b1010110);
+  assign cmd[op_pack_c]     = (ctrl_i.ir_funct3 == 3'b001) && (ctrl_i.ir_funct12[7:5] == 3'b111);
+  assign cmd[op_mac_c]      = (ctrl_i.ir_funct3 == 3'b001) && (ctrl_i.ir_funct12[7:5] != 3'b111);
+
+  // Co-Processor Controller -------------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+  always_ff @( posedge clk_i or negedge rstn_i ) begin : coprocessor_ctrl
+    if (rstn_i == 1'b0) begin
+        ctrl_state <= S_IDLE;
+        cmd_buf    <= '0;
+        rs1_reg    <= '0;
+        rs2_reg    <= '0;
+        acc_reg    <= '0;
+        funct_reg  <= '0;
+        valid      <= '0;
+    end else begin
+        /* defaults */
+        valid <= '0;
+
+        /* operand registers */
+        if (start_i == 1'b1) begin
+            cmd_buf   <= cmd;
+            rs1_reg   <= rs1_i;
+            rs2_reg   <= rs2_i;
+            acc_reg   <= rs3_i;
+            funct_reg <= ctrl_i.ir_funct12;
+        end
+
+        /* FSM */
+        unique case (ctrl_state)
+            // wait for operation trigger
+            S_IDLE : begin
+                if (start_i == 1'b1) begin
+                    if (cmd[op_mac_c] == 1'b1) begin // multiply products first
+                        ctrl_state <= S_BUSY_MAC;
+                    end else begin
+                        valid <= 1'b1;
+                    end
+                end
+            end
+
+            // products are being registered
+            S_BUSY_MAC : begin
+                valid      <= 1'b1;
+                ctrl_state <= S_IDLE;
+            end
+
+            default: begin
+                ctrl_state <= S_IDLE;
+            end
+        endcase
+    end
+  end : coprocessor_ctrl
+
+  // Packed Add/Sub Core -----------------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+  // funct7[5:3] (= funct_reg[10:8]): 000 = RADD/RSUB, 001 = KADD/KSUB, 010 = URADD/URSUB, 011 = UKADD/UKSUB,
+  // 100 = ADD/SUB (wrap-around); funct7[0] (= funct_reg[5]) selects subtraction
+  assign addsub.sub = funct_reg[5];
+  assign addsub.uns = funct_reg[9];
+  assign addsub.sat = (~funct_reg[10]) &   funct_reg[8];
+  assign addsub.hlv = (~funct_reg[10]) & (~funct_reg[8]);
+
+  always_comb begin : addsub_core
+    logic [16:0] sum16_v;
+    logic [8:0]  sum8_v;
+    /* 2x16-bit lanes */
+    for (int i = 0; i < 2; i++) begin
+        if (addsub.sub == 1'b1) begin
+            sum16_v = {(~addsub.uns) & rs1_reg[16*i+15], rs1_reg[16*i +: 16]} - {(~addsub.uns) & rs2_reg[16*i+15], rs2_reg[16*i +: 16]};
+        end else begin
+            sum16_v = {(~addsub.uns) & rs1_reg[16*i+15], rs1_reg[16*i +: 16]} + {(~addsub.uns) & rs2_reg[16*i+15], rs2_reg[16*i +: 16]};
+        end
+        //
+        if (addsub.hlv == 1'b1) begin // halving: keep carry/sign bit
+            addsub16_res[16*i +: 16] = sum16_v[16:1];
+        end else if ((addsub.sat == 1'b1) && (addsub.uns == 1'b0) && (sum16_v[16] != sum16_v[15])) begin // signed overflow
+            addsub16_res[16*i +: 16] = (sum16_v[16] == 1'b1) ? 16'h8000 : 16'h7fff;
+        end else if ((addsub.sat == 1'b1) && (addsub.uns == 1'b1) && (sum16_v[16] == 1'b1)) begin // unsigned carry/borrow
+            addsub16_res[16*i +: 16] = (addsub.sub == 1'b1) ? 16'h0000 : 16'hffff;
+        end else begin
+            addsub16_res[16*i +: 16] = sum16_v[15:0];
+        end
+    end
+    /* 4x8-bit lanes */
+    for (int i = 0; i < 4; i++) begin
+        if (addsub.sub == 1'b1) begin
+            sum8_v = {(~addsub.uns) & rs1_reg[8*i+7], rs1_reg[8*i +: 8]} - {(~addsub.uns) & rs2_reg[8*i+7], rs2_reg[8*i +: 8]};
+        end else begin
+            sum8_v = {(~addsub.uns) & rs1_reg[8*i+7], rs1_reg[8*i +: 8]} + {(~addsub.uns) & rs2_reg[8*i+7], rs2_reg[8*i +: 8]};
+        end
+        //
+        if (addsub.hlv == 1'b1) begin // halving: keep carry/sign bit
+            addsub8_res[8*i +: 8] = sum8_v[8:1];
+        end else if ((addsub.sat == 1'b1) && (addsub.uns == 1'b0) && (sum8_v[8] != sum8_v[7])) begin // signed overflow
+            addsub8_res[8*i +: 8] = (sum8_v[8] == 1'b1) ? 8'h80 : 8'h7f;
+        end else if ((addsub.sat == 1'b1) && (addsub.uns == 1'b1) && (sum8_v[8] == 1'b1)) begin // unsigned carry/borrow
+            addsub8_res[8*i +: 8] = (addsub.sub == 1'b1) ? 8'h00 : 8'hff;
+        end else begin
+            addsub8_res[8*i +: 8] = sum8_v[7:0];
+        end
+    end
+  end : addsub_core
+
+  assign res_int[op_addsub16_c] = addsub16_res;
+  assign res_int[op_addsub8_c]  = addsub8_res;
+
+  // Pack/Unpack Core --------------------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+  /* PKBB16 / PKBT16 / PKTB16 / PKTT16: funct7[4] = top half of rs1, funct7[3] = top half of rs2 */
+  assign res_int[op_pack_c][31:16] = (funct_reg[9] == 1'b1) ? rs1_reg[31:16] : rs1_reg[15:0];
+  assign res_int[op_pack_c][15:0]  = (funct_reg[8] == 1'b1) ? rs2_reg[31:16] : rs2_reg[15:0];
+
+  /* [S|Z]UNPKD8xy: rs2 field selects the bytes x (upper result half) and y (lower result half), rs2[2] = zero-extension */
+  always_comb begin : unpack_core
+    logic [7:0] byte_x_v, byte_y_v;
+    unique case ({funct_reg[4], funct_reg[1:0]})
+        3'b000  : begin byte_x_v = rs1_reg[15:8];  byte_y_v = rs1_reg[7:0];   end // 810
+        3'b001  : begin byte_x_v = rs1_reg[23:16]; byte_y_v = rs1_reg[7:0];   end // 820
+        3'b010  : begin byte_x_v = rs1_reg[31:24]; byte_y_v = rs1_reg[7:0];   end // 830
+        3'b011  : begin byte_x_v = rs1_reg[31:24]; byte_y_v = rs1_reg[15:8];  end // 831
+        default : begin byte_x_v = rs1_reg[31:24]; byte_y_v = rs1_reg[23:16]; end // 832
+    endcase
+    unpack_res[31:16] = {{8{(~funct_reg[2]) & byte_x_v[7]}}, byte_x_v};
+    unpack_res[15:0]  = {{8{(~funct_reg[2]) & byte_y_v[7]}}, byte_y_v};
+  end : unpack_core
+
+  assign res_int[op_unpack_c] = unpack_res;
+
+  // Dual Multiply-Accumulate Core -------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+  always_ff @( posedge clk_i ) begin : mac_products
+    mac.prod_hi <= $signed(rs1_reg[31:16]) * $signed(rs2_reg[31:16]);
+    mac.prod_lo <= $signed(rs1_reg[15:0])  * $signed(rs2_reg[15:0]);
+  end : mac_products
+
+  /* KMADA (funct7[5] set) accumulates the current rd value, KMDA starts from zero */
+  assign mac.sum = $signed({{2{mac.prod_hi[31]}}, mac.prod_hi}) + $signed({{2{mac.prod_lo[31]}}, mac.prod_lo}) +
+                   ((funct_reg[10] == 1'b1) ? $signed({{2{acc_reg[31]}}, acc_reg}) : 34'sd0);
+
+  /* saturate to signed 32-bit */
+  assign res_int[op_mac_c] = ((mac.sum[33:31] == 3'b000) || (mac.sum[33:31] == 3'b111)) ? mac.sum[31:0] :
+                             (mac.sum[33] == 1'b1) ? 32'h80000000 : 32'h7fffffff;
+
+  // Output Selector ---------------------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+  assign res_out[op_addsub16_c] = (cmd_buf[op_addsub16_c] == 1'b1) ? res_int[op_addsub16_c] : '0;
+  assign res_out[op_addsub8_c]  = (cmd_buf[op_addsub8_c]  == 1'b1) ? res_int[op_addsub8_c]  : '0;
+  assign res_out[op_pack_c]     = (cmd_buf[op_pack_c]     == 1'b1) ? res_int[op_pack_c]     : '0;
+  assign res_out[op_unpack_c]   = (cmd_buf[op_unpack_c]   == 1'b1) ? res_int[op_unpack_c]   : '0;
+  assign res_out[op_mac_c]      = (cmd_buf[op_mac_c]      == 1'b1) ? res_int[op_mac_c]      : '0;
+
+  // Output Gate -------------------------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+  always_ff @( posedge clk_i ) begin : output_gate
+    res_o <= '0; // default
+    if (valid == 1'b1) begin
+        res_o <= res_out[op_addsub16_c] | res_out[op_addsub8_c] |
+                 res_out[op_pack_c]     | res_out[op_unpack_c]  |
+                 res_out[op_mac_c];
+    end
+  end : output_gate
+
+  /* valid output */
+  assign valid_o = valid;
+endmodule
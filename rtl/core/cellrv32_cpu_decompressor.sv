@@ -1,13 +1,19 @@
 // ##################################################################################################
 // # << CELLRV32 - CPU: Compressed Instructions Decoder (RISC-V "C" Extension) >>                   #
 // # ********************************************************************************************** #
+// # Optional Zcmp (push/pop/move) and Zcmt (table jump) instructions are not expanded: they are    #
+// # forwarded as internal "opcode_zcm_c" macro-operations (bits 31:16 = compressed instruction)    #
+// # that are broken down into micro-ops by the execute engine.                                     #
+// # ********************************************************************************************** #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
   import cellrv32_package::*;
 `endif // _INCL_DEFINITIONS
 
 module cellrv32_cpu_decompressor #(
-    parameter FPU_ENABLE = 1  // floating-point instruction enabled
+    parameter FPU_ENABLE = 1, // floating-point instruction enabled
+    parameter ZCMP_EN    = 0, // compressed push/pop/move instructions enabled
+    parameter ZCMT_EN    = 0  // compressed table-jump instructions enabled
 ) (
     /* instruction input */
     input logic [15:0]  ci_instr16_i, // compressed instruction input
@@ -383,6 +389,24 @@ module cellrv32_cpu_decompressor #(
                         end
                     end
                     // ------------------------------------------------------------------------------------------------------------
+                    // C.FSDSP encoding space: Zcmp CM.PUSH, CM.POP, CM.POPRETZ, CM.POPRET, CM.MVSA01, CM.MVA01S and Zcmt CM.JT, CM.JALT
+                    3'b101 : begin
+                        ci_instr32_o[31 : 16]                                 = ci_instr16_i; // original instruction for the micro-sequencer
+                        ci_instr32_o[instr_opcode_msb_c : instr_opcode_lsb_c] = opcode_zcm_c;
+                        //
+                        unique case (ci_instr16_i[12:10])
+                            // CM.PUSH, CM.POP, CM.POPRETZ, CM.POPRET; rlist < 4 is reserved
+                            3'b110, 3'b111 : ci_illegal_o = (~logic'(ZCMP_EN)) | ci_instr16_i[8] | (~(ci_instr16_i[7] | ci_instr16_i[6]));
+                            // CM.MVSA01, CM.MVA01S; CM.MVSA01 with r1s' = r2s' is reserved
+                            3'b011 : ci_illegal_o = (~logic'(ZCMP_EN)) | (~ci_instr16_i[5]) |
+                                                    ((~ci_instr16_i[6]) & (ci_instr16_i[9:7] == ci_instr16_i[4:2]));
+                            // CM.JT (index < 32), CM.JALT (index >= 32)
+                            3'b000 : ci_illegal_o = ~logic'(ZCMT_EN);
+                            // undefined
+                            default: ci_illegal_o = 1'b1;
+                        endcase
+                    end
+                    // ------------------------------------------------------------------------------------------------------------
                     // "100": C.JR, C.JALR, C.MV, C.EBREAK, C.ADD; others: undefined
                     default: begin
                         // C.JR, C.MV
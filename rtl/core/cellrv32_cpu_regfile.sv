@@ -12,6 +12,21 @@
 // # for writing and reading rd/rs1 and a single read-only port for rs2. Therefore, the whole       #
 // # register file can be mapped to a single true-dual-port block RAM. A third and a fourth read    #
 // # port can be optionally enabled.                                                                #
+// #                                                                                                #
+// # Pipelined mode (PIPE_EN): a dedicated write address (rd) is used so the next instruction's     #
+// # operands can be read while the current instruction writes back. Write-back data is forwarded  #
+// # to the read ports if addresses match (write-first bypass).                                     #
+// #                                                                                                #
+// # Dual-issue mode (DUAL_EN): the 3rd and 4th read port provide the operands of the second issue  #
+// # slot, which writes back its result via an additional write port.                               #
+// #                                                                                                #
+// # Non-blocking loads (NBL_EN): the read data of an outstanding load is written back via another  #
+// # write port while the CPU is already executing subsequent (independent) instructions.           #
+// #                                                                                                #
+// # Shadow register bank (SHADOW_EN): the caller-saved registers (ra, t0..t6, a0..a7) exist twice. #
+// # The bank is selected by the CPU control (ctrl_i.rf_bank) and is only switched on trap entry    #
+// # and exit when no write-back is pending. The bank is just an additional address bit so the      #
+// # register file still maps to block RAM (with twice the depth).                                  #
 // # ********************************************************************************************** #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
@@ -22,7 +37,11 @@ module cellrv32_cpu_regfile #(
     parameter int XLEN                  = 32, // data path width
     parameter int CPU_EXTENSION_RISCV_E = 1,  // implement embedded RF extension?
     parameter int RS3_EN                = 1,  // enable 3rd read port
-    parameter int RS4_EN                = 1   // enable 4th read port
+    parameter int RS4_EN                = 1,  // enable 4th read port
+    parameter int PIPE_EN               = 0,  // separate write address + write-back bypass for pipelined mode
+    parameter int DUAL_EN               = 0,  // second write port for dual-issue mode
+    parameter int NBL_EN                = 0,  // late write port for non-blocking loads
+    parameter int SHADOW_EN             = 0   // shadow bank for caller-saved registers
 ) (
     /* global control */
     input logic      clk_i,  // global clock, rising edge
@@ -33,15 +52,20 @@ module cellrv32_cpu_regfile #(
     input logic [XLEN-1:0] mem_i, // memory read data
     input logic [XLEN-1:0] csr_i, // CSR read data
     input logic [XLEN-1:0] pc2_i, // next PC
+    input logic [XLEN-1:0] alu2_i, // second issue slot ALU result
     /* data output */
     output logic [XLEN-1:0] rs1_o, // operand 1
     output logic [XLEN-1:0] rs2_o, // operand 2
     output logic [XLEN-1:0] rs3_o, // operand 4
     output logic [XLEN-1:0] rs4_o  // operand 3
 );
+    /* shadow register bank: caller-saved registers x1, x5..x7, x10..x17, x28..x31 */
+    localparam logic [31:0] shadow_regs_c = 32'hf003fce2;
+    localparam int rf_banks_c = (SHADOW_EN == 1) ? 2 : 1;
+
     /* register file */
-    typedef logic [XLEN-1:0] reg_file_t     [31:0];
-    typedef logic [XLEN-1:0] reg_file_emb_t [15:0];
+    typedef logic [XLEN-1:0] reg_file_t     [(32*rf_banks_c)-1:0];
+    typedef logic [XLEN-1:0] reg_file_emb_t [(16*rf_banks_c)-1:0];
     reg_file_t reg_file;
     reg_file_emb_t reg_file_emb;
 
@@ -50,9 +74,16 @@ module cellrv32_cpu_regfile #(
     logic  rf_we;   // write enable
     logic  rd_zero; // writing to x0?
     logic  [4:0] opa_addr; // rs1/dst address
+    logic  [4:0] opw_addr; // write address
+    logic  [3:0] byp;      // write-back bypass for rs1..rs4
+    logic  rf_we2;         // second issue slot write enable
+    logic  [3:0] byp2;     // second issue slot write-back bypass for rs1..rs4
+    logic  rf_wel;         // non-blocking load write enable
     logic  [4:0] opb_addr; // rs2 address
     logic  [4:0] opc_addr; // rs3 address
     logic  [4:0] opd_addr; // rs4 address
+    logic  [5:0] pa_addr, pb_addr, pc_addr, pd_addr; // physical read addresses: {bank, rsx}
+    logic  [5:0] pw_addr, pw2_addr, pwl_addr;        // physical write addresses: {bank, rd}
 
     // Data Write-Back Select --------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -71,17 +102,49 @@ module cellrv32_cpu_regfile #(
     // Register File Access ----------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     /* access addresses */
-    assign opa_addr = (ctrl_i.rf_zero_we == 1'b1) ? 5'b00000 :   // force rd = zero
-                      (ctrl_i.rf_wb_en == 1'b1) ? ctrl_i.rf_rd : // rd
+    assign opw_addr = (ctrl_i.rf_zero_we == 1'b1) ? 5'b00000 :   // force rd = zero
+                       ctrl_i.rf_rd; // rd
+    assign opa_addr = ((PIPE_EN == 0) && ((ctrl_i.rf_wb_en == 1'b1) || (ctrl_i.rf_zero_we == 1'b1))) ? opw_addr : // rd (shared port)
                        ctrl_i.rf_rs1; // rs1
     assign opb_addr = ctrl_i.rf_rs2;  // rs2
     assign opc_addr = ctrl_i.rf_rs3;  // rs3
-    assign opd_addr = {ctrl_i.ir_funct12[6:5], ctrl_i.ir_funct3}; // rs4: [26:25] & [14:12]; not RISC-V-standard!
+    assign opd_addr = ctrl_i.rf_rs4;  // rs4
+
+    /* physical addresses - bank select only applies to shadowed registers */
+    function automatic logic [5:0] rf_phys_f(input logic bank, input logic [4:0] addr);
+        return {bank & shadow_regs_c[addr] & logic'(SHADOW_EN), addr};
+    endfunction
+
+    assign pa_addr  = rf_phys_f(ctrl_i.rf_bank, opa_addr);
+    assign pb_addr  = rf_phys_f(ctrl_i.rf_bank, opb_addr);
+    assign pc_addr  = rf_phys_f(ctrl_i.rf_bank, opc_addr);
+    assign pd_addr  = rf_phys_f(ctrl_i.rf_bank, opd_addr);
+    assign pw_addr  = rf_phys_f(ctrl_i.rf_bank, opw_addr);
+    assign pw2_addr = rf_phys_f(ctrl_i.rf_bank, ctrl_i.rf_rd2);
+    assign pwl_addr = rf_phys_f(ctrl_i.rf_bank, ctrl_i.rf_rdl);
 
     /* write enable */
     assign rd_zero = (ctrl_i.rf_rd == 5'b00000) ? 1'b1 : 1'b0;
     assign rf_we   = (ctrl_i.rf_wb_en & (~rd_zero)) | ctrl_i.rf_zero_we; // do not write to x0 unless explicitly forced
 
+    /* write-back bypass (pipelined mode only) */
+    assign byp[0] = (PIPE_EN == 1) && (rf_we == 1'b1) && (opw_addr[3:0] == opa_addr[3:0]) && ((opw_addr[4] == opa_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+    assign byp[1] = (PIPE_EN == 1) && (rf_we == 1'b1) && (opw_addr[3:0] == opb_addr[3:0]) && ((opw_addr[4] == opb_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+    assign byp[2] = (PIPE_EN == 1) && (rf_we == 1'b1) && (opw_addr[3:0] == opc_addr[3:0]) && ((opw_addr[4] == opc_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+    assign byp[3] = (PIPE_EN == 1) && (rf_we == 1'b1) && (opw_addr[3:0] == opd_addr[3:0]) && ((opw_addr[4] == opd_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+
+    /* second issue slot write enable (x0 is never written) */
+    assign rf_we2 = ((DUAL_EN == 1) && (ctrl_i.rf_wb2_en == 1'b1) && (ctrl_i.rf_rd2 != 5'b00000)) ? 1'b1 : 1'b0;
+
+    /* second issue slot write-back bypass (pipelined mode only) */
+    assign byp2[0] = (PIPE_EN == 1) && (rf_we2 == 1'b1) && (ctrl_i.rf_rd2[3:0] == opa_addr[3:0]) && ((ctrl_i.rf_rd2[4] == opa_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+    assign byp2[1] = (PIPE_EN == 1) && (rf_we2 == 1'b1) && (ctrl_i.rf_rd2[3:0] == opb_addr[3:0]) && ((ctrl_i.rf_rd2[4] == opb_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+    assign byp2[2] = (PIPE_EN == 1) && (rf_we2 == 1'b1) && (ctrl_i.rf_rd2[3:0] == opc_addr[3:0]) && ((ctrl_i.rf_rd2[4] == opc_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+    assign byp2[3] = (PIPE_EN == 1) && (rf_we2 == 1'b1) && (ctrl_i.rf_rd2[3:0] == opd_addr[3:0]) && ((ctrl_i.rf_rd2[4] == opd_addr[4]) || (CPU_EXTENSION_RISCV_E == 1));
+
+    /* non-blocking load write enable (x0 is never written) */
+    assign rf_wel = ((NBL_EN == 1) && (ctrl_i.rf_wbl_en == 1'b1) && (ctrl_i.rf_rdl != 5'b00000)) ? 1'b1 : 1'b0;
+
     // RV32I Register File with 32 Entries -------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     generate
@@ -89,22 +152,28 @@ module cellrv32_cpu_regfile #(
             // sync read and write
             always_ff @( posedge clk_i ) begin : rf_access
                 if (rf_we == 1'b1) begin
-                    reg_file[opa_addr[4:0]] <= rf_wdata;
+                    reg_file[pw_addr[5:0]] <= rf_wdata;
+                end
+                if (rf_we2 == 1'b1) begin
+                    reg_file[pw2_addr[5:0]] <= alu2_i;
+                end
+                if (rf_wel == 1'b1) begin
+                    reg_file[pwl_addr[5:0]] <= mem_i;
                 end
                 //
-                rs1_o <= reg_file[opa_addr[4:0]];
-                rs2_o <= reg_file[opb_addr[4:0]];
+                rs1_o <= (byp2[0] == 1'b1) ? alu2_i : (byp[0] == 1'b1) ? rf_wdata : reg_file[pa_addr[5:0]];
+                rs2_o <= (byp2[1] == 1'b1) ? alu2_i : (byp[1] == 1'b1) ? rf_wdata : reg_file[pb_addr[5:0]];
                 //
                 /* optional 3rd read port */
                 if (RS3_EN == 1) begin
-                    rs3_o <= reg_file[opc_addr[4:0]];
+                    rs3_o <= (byp2[2] == 1'b1) ? alu2_i : (byp[2] == 1'b1) ? rf_wdata : reg_file[pc_addr[5:0]];
                 end else begin
                     rs3_o <= '0;
                 end
                 //
                 /* optional 4th read port */
                 if (RS4_EN == 1) begin
-                    rs4_o <= reg_file[opd_addr[4:0]];
+                    rs4_o <= (byp2[3] == 1'b1) ? alu2_i : (byp[3] == 1'b1) ? rf_wdata : reg_file[pd_addr[5:0]];
                 end else begin
                     rs4_o <= '0;
                 end
@@ -119,22 +188,28 @@ module cellrv32_cpu_regfile #(
             // sync read and write
             always_ff @( posedge clk_i ) begin : rf_access
                 if (rf_we) begin
-                    reg_file_emb[opa_addr[3:0]] <= rf_wdata;
+                    reg_file_emb[{pw_addr[5], pw_addr[3:0]}] <= rf_wdata;
+                end
+                if (rf_we2 == 1'b1) begin
+                    reg_file_emb[{pw2_addr[5], pw2_addr[3:0]}] <= alu2_i;
+                end
+                if (rf_wel == 1'b1) begin
+                    reg_file_emb[{pwl_addr[5], pwl_addr[3:0]}] <= mem_i;
                 end
                 //
-                rs1_o <= reg_file_emb[opa_addr[3:0]];
-                rs2_o <= reg_file_emb[opb_addr[3:0]];
+                rs1_o <= (byp2[0] == 1'b1) ? alu2_i : (byp[0] == 1'b1) ? rf_wdata : reg_file_emb[{pa_addr[5], pa_addr[3:0]}];
+                rs2_o <= (byp2[1] == 1'b1) ? alu2_i : (byp[1] == 1'b1) ? rf_wdata : reg_file_emb[{pb_addr[5], pb_addr[3:0]}];
                 //
                 /* optional 3rd read port */
                 if (RS3_EN) begin
-                    rs3_o <= reg_file_emb[opc_addr[3:0]];
+                    rs3_o <= (byp2[2] == 1'b1) ? alu2_i : (byp[2] == 1'b1) ? rf_wdata : reg_file_emb[{pc_addr[5], pc_addr[3:0]}];
                 end else begin
                     rs3_o <= '0;
                 end
                 //
                 /* optional 4th read port */
                 if (RS4_EN) begin // implement fourth read port?
-                    rs4_o <= reg_file_emb[opd_addr[3:0]];
+                    rs4_o <= (byp2[3] == 1'b1) ? alu2_i : (byp[3] == 1'b1) ? rf_wdata : reg_file_emb[{pd_addr[5], pd_addr[3:0]}];
                 end else begin
                     rs4_o <= '0;
                 end
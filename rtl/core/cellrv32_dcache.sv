@@ -0,0 +1,539 @@
+// ##################################################################################################
+// # << CELLRV32 - Processor-Internal Data Cache >>                                                 #
+// # ********************************************************************************************** #
+// # Direct mapped (DCACHE_NUM_SETS = 1) or 2-way set-associative (DCACHE_NUM_SETS = 2).            #
+// # Least recently used replacement policy (if DCACHE_NUM_SETS > 1).                               #
+// #                                                                                                #
+// # Write-back + write-allocate: stores that hit only update the cache block (it becomes dirty),   #
+// # a miss writes back the dirty victim block (if any) and downloads the new block before the      #
+// # access is re-checked. A FENCE/FENCE.I (clear_i) writes back all dirty blocks and invalidates   #
+// # the whole cache. Port B of the bus switch (instruction fetch) is locked (lock_o) while this    #
+// # flush is in progress so the i-cache cannot fetch stale data from main memory.                  #
+// #                                                                                                #
+// # Accesses flagged as uncached (host_uc_i) bypass the cache.                                     #
+// #                                                                                                #
+// # Multi-cycle (vector) accesses go directly to the bus and are NOT coherent with the cache: they #
+// # neither look up nor update cached blocks. The CPU therefore writes back and invalidates the    #
+// # whole cache (clear_i) when it starts a vector load/store and stays in that instruction until   #
+// # it is done, so no block can be cached in between. Multi-cycle requests are only granted        #
+// # (host_multi_rsp_o) in cycles where the controller stays idle; requests that were not granted   #
+// # are dropped and re-issued by the vector unit. A pending flush has priority over them.          #
+// #                                                                                                #
+// # Cache-block zero writes (host_zero_i, Zicboz cbo.zero) that miss do not download the block: it #
+// # is filled with zeros (after writing back a dirty victim) and becomes dirty by the host write.  #
+// # The remaining words of the block are written by the same cbo.zero, so nothing is lost. This is #
+// # only possible if DCACHE_BLOCK_SIZE <= cbo_block_size_c (a normal write-allocate is done else). #
+// #                                                                                                #
+// # Prefetch hints (pref_i, Zicbop prefetch.r/prefetch.w) are served if there is no host request:  #
+// # the addressed block is allocated like a read miss, without any host response. A hint is        #
+// # dropped while another hint is pending. pref_addr_i has to be a cacheable address.              #
+// # ********************************************************************************************** #
+`ifndef  _INCL_DEFINITIONS
+  `define _INCL_DEFINITIONS
+  import cellrv32_package::*;
+`endif // _INCL_DEFINITIONS
+
+module cellrv32_dcache #(
+    parameter int DCACHE_NUM_BLOCKS = 4,  // number of blocks (min 2), has to be a power of 2
+    parameter int DCACHE_BLOCK_SIZE = 64, // block size in bytes (min 8), has to be a power of 2
+    parameter int DCACHE_NUM_SETS   = 1   // associativity / number of sets (1=direct_mapped), has to be a power of 2
+) (
+    /* global control */
+    input  logic        clk_i,   // global clock, rising edge
+    input  logic        rstn_i,  // global reset, low-active, async
+    input  logic        clear_i, // write back dirty blocks and invalidate cache
+    output logic        lock_o,  // exclusive bus access required (cache flush in progress)
+    /* prefetch hint */
+    input  logic        pref_i,      // prefetch hint
+    input  logic [31:0] pref_addr_i, // hint address
+    /* host controller interface */
+    input  logic        host_uc_i,        // uncached access
+    input  logic        host_zero_i,      // write is part of a cache-block zero operation
+    input  logic [31:0] host_addr_i,      // bus access address
+    output logic [31:0] host_rdata_o,     // bus read data
+    input  logic [31:0] host_wdata_i,     // bus write data
+    input  logic [03:0] host_ben_i,       // byte enable
+    input  logic        host_we_i,        // write enable
+    input  logic        host_re_i,        // read enable
+    output logic        host_ack_o,       // bus transfer acknowledge
+    output logic        host_err_o,       // bus transfer error
+    input  logic        host_multi_en_i,  // multi-cycle access in progress
+    output logic        host_multi_rsp_o, // multi-cycle access response valid
+    /* peripheral bus interface */
+    output logic        bus_cached_o,     // set if cached (!) access in progress
+    output logic [31:0] bus_addr_o,       // bus access address
+    input  logic [31:0] bus_rdata_i,      // bus read data
+    output logic [31:0] bus_wdata_o,      // bus write data
+    output logic [03:0] bus_ben_o,        // byte enable
+    output logic        bus_we_o,         // write enable
+    output logic        bus_re_o,         // read enable
+    input  logic        bus_ack_i,        // bus transfer acknowledge
+    input  logic        bus_err_i,        // bus transfer error
+    output logic        bus_multi_en_o,   // multi-cycle access in progress
+    input  logic        bus_multi_rsp_i   // multi-cycle access response valid
+);
+    /* cache-block zero writes cover whole blocks: allocate without download */
+    localparam logic zero_alloc_en_c = (DCACHE_BLOCK_SIZE <= cbo_block_size_c) ? 1'b1 : 1'b0;
+
+    /* cache layout */
+    localparam int cache_offset_size_c = $clog2(DCACHE_BLOCK_SIZE/4); // offset addresses full 32-bit words
+    localparam int cache_index_size_c  = $clog2(DCACHE_NUM_BLOCKS);
+    localparam int cache_tag_size_c    = 32 - (cache_offset_size_c + cache_index_size_c + 2); // 2 additonal bits for byte offset
+
+    /* cache interface */
+    typedef struct {
+        logic clear;             // cache clear
+        logic [31:0] host_addr;  // host lookup address
+        logic host_re;           // host lookup
+        logic host_we;           // host write
+        logic [31:0] host_rdata; // cpu read data
+        logic hit;               // hit access
+        logic lru;               // set to be replaced
+        logic ctrl_en;           // control access enable
+        logic ctrl_set;          // control access set
+        logic ctrl_we;           // control write enable
+        logic [31:0] ctrl_rdata; // control read data
+        logic ctrl_tag_we;       // control tag write enabled
+        logic ctrl_valid_we;     // control valid flag set
+        logic ctrl_invalid_we;   // control valid flag clear
+        logic ctrl_valid;        // selected block is valid
+        logic ctrl_dirty;        // selected block is dirty
+        logic [31:0] ctrl_base;  // selected block base address
+    } cache_if_t;
+    //
+    cache_if_t cache;
+
+    /* control engine */
+    typedef enum  { S_IDLE, S_CACHE_CLEAR, S_CACHE_CHECK, S_CACHE_MISS,
+                    S_BUS_UPLOAD_RD, S_BUS_UPLOAD_REQ, S_BUS_UPLOAD_GET,
+                    S_BUS_DOWNLOAD_REQ, S_BUS_DOWNLOAD_GET, S_CACHE_RESYNC,
+                    S_CACHE_ZERO, S_DIRECT_ACC, S_FLUSH_READ, S_FLUSH_CHECK, S_FLUSH_NEXT } ctrl_engine_state_t;
+
+    typedef struct {
+        ctrl_engine_state_t state;     // current state
+        ctrl_engine_state_t state_nxt; // next state
+        logic [31:0] addr_reg;         // address register for block upload/download
+        logic [31:0] addr_reg_nxt;
+        logic        set;              // selected set for block upload/download
+        logic        set_nxt;
+        logic [cache_index_size_c:0] fidx; // flush: block index (+ done flag)
+        logic [cache_index_size_c:0] fidx_nxt;
+        logic        re_buf;           // read request buffer
+        logic        re_buf_nxt;
+        logic        we_buf;           // write request buffer
+        logic        we_buf_nxt;
+        logic        wr;               // current host access is a write
+        logic        wr_nxt;
+        logic        zero;             // current host access is a cache-block zero write
+        logic        zero_nxt;
+        logic        clear_buf;        // clear request buffer
+        logic        clear_buf_nxt;
+        logic        flush;            // flush in progress
+        logic        flush_nxt;
+        logic        err;              // bus error during block upload/download
+        logic        err_nxt;
+        logic        pref;             // current operation is a prefetch hint
+        logic        pref_nxt;
+        logic        pref_buf;         // prefetch hint buffer
+        logic        pref_buf_nxt;
+        logic [31:0] pref_addr;        // prefetch hint address
+        logic [31:0] pref_addr_nxt;
+    } ctrl_t;
+    //
+    ctrl_t ctrl;
+
+    /* bus access source */
+    logic direct; // host directly drives the bus
+
+    /* address of current host access or prefetch hint */
+    logic [31:0] acc_addr;
+
+    /* prefetch hint accepted (no other hint pending or in progress) */
+    logic pref_req;
+
+    // Sanity Checks -----------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    /* configuration */
+    initial begin
+      assert (!(is_power_of_two_f(DCACHE_NUM_BLOCKS) == 1'b0)) else
+      $error("CELLRV32 PROCESSOR CONFIG ERROR! d-cache number of blocks <DCACHE_NUM_BLOCKS> has to be a power of 2.");
+      assert (!(is_power_of_two_f(DCACHE_BLOCK_SIZE) == 1'b0)) else
+      $error("CELLRV32 PROCESSOR CONFIG ERROR! d-cache block size <DCACHE_BLOCK_SIZE> has to be a power of 2.");
+      assert (!(is_power_of_two_f(DCACHE_NUM_SETS) == 1'b0)) else
+      $error("CELLRV32 PROCESSOR CONFIG ERROR! d-cache associativity <DCACHE_NUM_SETS> has to be a power of 2.");
+      assert (!(DCACHE_NUM_BLOCKS < 2)) else
+      $error("CELLRV32 PROCESSOR CONFIG ERROR! d-cache number of blocks <DCACHE_NUM_BLOCKS> has to be >= 2.");
+      assert (!(DCACHE_BLOCK_SIZE < 8)) else
+      $error("CELLRV32 PROCESSOR CONFIG ERROR! d-cache block size <DCACHE_BLOCK_SIZE> has to be >= 8.");
+      assert (!((DCACHE_NUM_SETS == 0) || (DCACHE_NUM_SETS > 2))) else
+      $error("CELLRV32 PROCESSOR CONFIG ERROR! d-cache associativity <DCACHE_NUM_SETS> has to be 1 (direct-mapped) or 2 (2-way set-associative).");
+    end
+
+    // Control Engine FSM Sync -------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    always_ff @( posedge clk_i or negedge rstn_i) begin : ctrl_engine_fsm_sync
+        if (rstn_i == 1'b0) begin
+            ctrl.state     <= S_CACHE_CLEAR; // to reset cache information memory, which does not have an explicit reset
+            ctrl.addr_reg  <= '0;
+            ctrl.set       <= 1'b0;
+            ctrl.fidx      <= '0;
+            ctrl.re_buf    <= 1'b0;
+            ctrl.we_buf    <= 1'b0;
+            ctrl.wr        <= 1'b0;
+            ctrl.zero      <= 1'b0;
+            ctrl.clear_buf <= 1'b0;
+            ctrl.flush     <= 1'b0;
+            ctrl.err       <= 1'b0;
+            ctrl.pref      <= 1'b0;
+            ctrl.pref_buf  <= 1'b0;
+            ctrl.pref_addr <= '0;
+        end else begin
+            ctrl.state     <= ctrl.state_nxt;
+            ctrl.addr_reg  <= ctrl.addr_reg_nxt;
+            ctrl.set       <= ctrl.set_nxt;
+            ctrl.fidx      <= ctrl.fidx_nxt;
+            ctrl.re_buf    <= ctrl.re_buf_nxt;
+            ctrl.we_buf    <= ctrl.we_buf_nxt;
+            ctrl.wr        <= ctrl.wr_nxt;
+            ctrl.zero      <= ctrl.zero_nxt;
+            ctrl.clear_buf <= ctrl.clear_buf_nxt;
+            ctrl.flush     <= ctrl.flush_nxt;
+            ctrl.err       <= ctrl.err_nxt;
+            ctrl.pref      <= ctrl.pref_nxt;
+            ctrl.pref_buf  <= ctrl.pref_buf_nxt;
+            ctrl.pref_addr <= ctrl.pref_addr_nxt;
+        end
+    end : ctrl_engine_fsm_sync
+
+    // Control Engine FSM Comb -------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    always_comb begin : ctrl_engine_fsm_comb
+        /* control defaults */
+        ctrl.state_nxt        = ctrl.state;
+        ctrl.addr_reg_nxt     = ctrl.addr_reg;
+        ctrl.set_nxt          = ctrl.set;
+        ctrl.fidx_nxt         = ctrl.fidx;
+        ctrl.re_buf_nxt       = ctrl.re_buf | (host_re_i & (~host_multi_en_i)); // buffer single-access requests only
+        ctrl.we_buf_nxt       = ctrl.we_buf | (host_we_i & (~host_multi_en_i));
+        ctrl.wr_nxt           = ctrl.wr;
+        ctrl.zero_nxt         = ctrl.zero;
+        ctrl.clear_buf_nxt    = ctrl.clear_buf | clear_i; // buffer clear request from CPU
+        ctrl.flush_nxt        = ctrl.flush;
+        ctrl.err_nxt          = ctrl.err;
+        ctrl.pref_nxt         = ctrl.pref;
+        ctrl.pref_buf_nxt     = ctrl.pref_buf | pref_req; // buffer hint from CPU
+        ctrl.pref_addr_nxt    = (pref_req == 1'b1) ? pref_addr_i : ctrl.pref_addr;
+
+        /* cache defaults */
+        cache.clear           = 1'b0;
+        cache.host_addr       = acc_addr;
+        cache.host_re         = 1'b0;
+        cache.host_we         = 1'b0;
+        cache.ctrl_en         = 1'b0;
+        cache.ctrl_set        = ctrl.set;
+        cache.ctrl_we         = 1'b0;
+        cache.ctrl_tag_we     = 1'b0;
+        cache.ctrl_valid_we   = 1'b0;
+        cache.ctrl_invalid_we = 1'b0;
+
+        /* host interface defaults */
+        host_ack_o            = 1'b0;
+        host_err_o            = 1'b0;
+        host_rdata_o          = cache.host_rdata;
+
+        /* peripheral bus interface defaults */
+        bus_re_o              = 1'b0;
+        bus_we_o              = 1'b0;
+        direct                = 1'b0;
+
+        /* fsm */
+        unique case (ctrl.state)
+            // --------------------------------------------------------------
+            // wait for host access request or cache control operation
+            S_IDLE : begin
+                direct        = 1'b1; // pass-through of multi-cycle accesses
+                host_ack_o    = bus_ack_i;
+                host_err_o    = bus_err_i;
+                host_rdata_o  = bus_rdata_i;
+                ctrl.pref_nxt = 1'b0;
+                //
+                if (ctrl.clear_buf == 1'b1) begin // cache control operation? (a multi-cycle request in this cycle has not been granted)
+                    ctrl.clear_buf_nxt = 1'b0;
+                    ctrl.pref_buf_nxt  = 1'b0; // drop pending hint: do not allocate blocks behind the flush
+                    ctrl.flush_nxt     = 1'b1;
+                    ctrl.fidx_nxt      = '0;
+                    ctrl.set_nxt       = 1'b0;
+                    ctrl.addr_reg_nxt  = '0;
+                    ctrl.state_nxt     = S_FLUSH_READ;
+                end else if (host_multi_en_i == 1'b1) begin // multi-cycle access in progress: bypass
+                    bus_re_o = host_re_i;
+                    bus_we_o = host_we_i;
+                end else if ((host_re_i == 1'b1) || (ctrl.re_buf == 1'b1) || (host_we_i == 1'b1) || (ctrl.we_buf == 1'b1)) begin
+                    ctrl.re_buf_nxt = 1'b0;
+                    ctrl.we_buf_nxt = 1'b0;
+                    ctrl.wr_nxt     = host_we_i | ctrl.we_buf;
+                    ctrl.zero_nxt   = (host_we_i | ctrl.we_buf) & host_zero_i & zero_alloc_en_c;
+                    if (host_uc_i == 1'b1) begin // uncached access
+                        bus_re_o       = host_re_i | ctrl.re_buf;
+                        bus_we_o       = host_we_i | ctrl.we_buf;
+                        ctrl.state_nxt = S_DIRECT_ACC;
+                    end else begin // cached access
+                        ctrl.state_nxt = S_CACHE_CHECK;
+                    end
+                end else if (ctrl.pref_buf == 1'b1) begin // prefetch hint: allocate block like a read miss
+                    cache.host_addr   = ctrl.pref_addr;
+                    ctrl.pref_buf_nxt = 1'b0;
+                    ctrl.pref_nxt     = 1'b1;
+                    ctrl.wr_nxt       = 1'b0;
+                    ctrl.zero_nxt     = 1'b0;
+                    ctrl.state_nxt    = S_CACHE_CHECK;
+                end
+            end
+            // --------------------------------------------------------------
+            // invalidate all cache entries
+            S_CACHE_CLEAR : begin
+                cache.clear    = 1'b1;
+                ctrl.flush_nxt = 1'b0;
+                ctrl.state_nxt = S_IDLE;
+            end
+            // --------------------------------------------------------------
+            // finalize host access if cache hit
+            S_CACHE_CHECK : begin
+                cache.host_re = 1'b1; // update access history
+                if (cache.hit == 1'b1) begin
+                    cache.host_we  = ctrl.wr; // write to hit set, block becomes dirty
+                    host_ack_o     = ~ctrl.pref; // no host access to finalize for a prefetch hint
+                    ctrl.state_nxt = S_IDLE;
+                end else begin
+                    // cache MISS
+                    ctrl.state_nxt = S_CACHE_MISS;
+                end
+            end
+            // --------------------------------------------------------------
+            // select victim block, write back if dirty
+            S_CACHE_MISS : begin
+                cache.ctrl_set = cache.lru; // status of the block to be replaced
+                ctrl.set_nxt   = cache.lru;
+                ctrl.err_nxt   = 1'b0;
+                if ((cache.ctrl_valid == 1'b1) && (cache.ctrl_dirty == 1'b1)) begin
+                    ctrl.addr_reg_nxt = cache.ctrl_base;
+                    ctrl.state_nxt    = S_BUS_UPLOAD_RD;
+                end else begin
+                    ctrl.addr_reg_nxt = acc_addr;
+                    ctrl.addr_reg_nxt[(2+cache_offset_size_c)-1 : 0] = '0; // block-aligned
+                    if (ctrl.zero == 1'b1) begin // cache-block zero: no need to download the block
+                        ctrl.state_nxt = S_CACHE_ZERO;
+                    end else begin
+                        ctrl.state_nxt = S_BUS_DOWNLOAD_REQ;
+                    end
+                end
+            end
+            // --------------------------------------------------------------
+            // write back dirty block: read word from cache
+            S_BUS_UPLOAD_RD : begin
+                cache.ctrl_en  = 1'b1; // we are in cache control mode
+                ctrl.state_nxt = S_BUS_UPLOAD_REQ;
+            end
+            // --------------------------------------------------------------
+            // write back dirty block: request bus write
+            S_BUS_UPLOAD_REQ : begin
+                cache.ctrl_en  = 1'b1; // we are in cache control mode
+                bus_we_o       = 1'b1; // request new write transfer
+                ctrl.state_nxt = S_BUS_UPLOAD_GET;
+            end
+            // --------------------------------------------------------------
+            // write back dirty block: wait for bus response
+            S_BUS_UPLOAD_GET : begin
+                cache.ctrl_en = 1'b1; // we are in cache control mode
+                //
+                if ((bus_ack_i == 1'b1) || (bus_err_i == 1'b1)) begin
+                    ctrl.err_nxt = ctrl.err | bus_err_i;
+                    // block complete?
+                    if ((&ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2]) == 1'b1) begin
+                        if (ctrl.flush == 1'b1) begin // continue flushing
+                            ctrl.state_nxt = S_FLUSH_NEXT;
+                        end else begin // download (or zero-fill) the requested block
+                            ctrl.addr_reg_nxt = acc_addr;
+                            ctrl.addr_reg_nxt[(2+cache_offset_size_c)-1 : 0] = '0; // block-aligned
+                            if (ctrl.zero == 1'b1) begin
+                                ctrl.state_nxt = S_CACHE_ZERO;
+                            end else begin
+                                ctrl.state_nxt = S_BUS_DOWNLOAD_REQ;
+                            end
+                        end
+                    end else begin // write back next word
+                        ctrl.addr_reg_nxt = ctrl.addr_reg + 4;
+                        ctrl.state_nxt    = S_BUS_UPLOAD_RD;
+                    end
+                end
+            end
+            // --------------------------------------------------------------
+            // download new cache block: request new word
+            S_BUS_DOWNLOAD_REQ : begin
+                cache.ctrl_en  = 1'b1; // we are in cache control mode
+                bus_re_o       = 1'b1; // request new read transfer
+                ctrl.state_nxt = S_BUS_DOWNLOAD_GET;
+            end
+            // --------------------------------------------------------------
+            // download new cache block: wait for bus response
+            S_BUS_DOWNLOAD_GET : begin
+                cache.ctrl_en = 1'b1; // we are in cache control mode
+                //
+                if ((bus_ack_i == 1'b1) || (bus_err_i == 1'b1)) begin // ACK or ERROR = write to cache and get next word
+                    cache.ctrl_we = 1'b1; // write to cache
+                    ctrl.err_nxt  = ctrl.err | bus_err_i;
+                    // block complete?
+                    if ((&ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2]) == 1'b1) begin
+                      if ((ctrl.err == 1'b1) || (bus_err_i == 1'b1)) begin // do not keep a faulty block
+                        cache.ctrl_invalid_we = 1'b1;
+                      end else begin
+                        cache.ctrl_tag_we   = 1'b1; // write tag of current address
+                        cache.ctrl_valid_we = 1'b1; // current block is valid now
+                      end
+                      ctrl.state_nxt = S_CACHE_RESYNC;
+                    end else begin // get next word
+                      ctrl.addr_reg_nxt = ctrl.addr_reg + 4;
+                      ctrl.state_nxt    = S_BUS_DOWNLOAD_REQ;
+                    end
+                end
+            end
+            // --------------------------------------------------------------
+            // cache-block zero: fill new block with zeros instead of downloading it
+            S_CACHE_ZERO : begin
+                cache.ctrl_en = 1'b1; // we are in cache control mode
+                cache.ctrl_we = 1'b1; // write zero to cache
+                // block complete?
+                if ((&ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2]) == 1'b1) begin
+                    if (ctrl.err == 1'b1) begin // victim write-back failed: do not allocate
+                        cache.ctrl_invalid_we = 1'b1;
+                    end else begin
+                        cache.ctrl_tag_we   = 1'b1; // write tag of current address
+                        cache.ctrl_valid_we = 1'b1; // current block is valid now
+                    end
+                    ctrl.state_nxt = S_CACHE_RESYNC;
+                end else begin // next word
+                    ctrl.addr_reg_nxt = ctrl.addr_reg + 4;
+                end
+            end
+            // --------------------------------------------------------------
+            // re-sync host/cache access: cache read-latency, check again
+            S_CACHE_RESYNC : begin
+                if (ctrl.pref == 1'b1) begin // prefetch hint done (a faulty block has not been allocated)
+                    ctrl.state_nxt = S_IDLE;
+                end else if (ctrl.err == 1'b1) begin // bus error during write-back or download
+                    host_err_o     = 1'b1;
+                    ctrl.state_nxt = S_IDLE;
+                end else begin
+                    ctrl.state_nxt = S_CACHE_CHECK;
+                end
+            end
+            // --------------------------------------------------------------
+            // uncached access: wait for bus response
+            S_DIRECT_ACC : begin
+                direct       = 1'b1;
+                host_ack_o   = bus_ack_i;
+                host_err_o   = bus_err_i;
+                host_rdata_o = bus_rdata_i;
+                if ((bus_ack_i == 1'b1) || (bus_err_i == 1'b1)) begin
+                    ctrl.state_nxt = S_IDLE;
+                end
+            end
+            // --------------------------------------------------------------
+            // flush: read status of current block
+            S_FLUSH_READ : begin
+                cache.ctrl_en  = 1'b1;
+                ctrl.state_nxt = S_FLUSH_CHECK;
+            end
+            // --------------------------------------------------------------
+            // flush: write back current block if dirty
+            S_FLUSH_CHECK : begin
+                cache.ctrl_en = 1'b1;
+                if ((cache.ctrl_valid == 1'b1) && (cache.ctrl_dirty == 1'b1)) begin
+                    ctrl.addr_reg_nxt = cache.ctrl_base;
+                    ctrl.state_nxt    = S_BUS_UPLOAD_RD;
+                end else begin
+                    ctrl.state_nxt = S_FLUSH_NEXT;
+                end
+            end
+            // --------------------------------------------------------------
+            // flush: go to next block/set; invalidate all when done
+            S_FLUSH_NEXT : begin
+                if ((DCACHE_NUM_SETS > 1) && (ctrl.set == 1'b0)) begin
+                    ctrl.set_nxt = 1'b1;
+                end else begin
+                    ctrl.set_nxt  = 1'b0;
+                    ctrl.fidx_nxt = ctrl.fidx + 1;
+                end
+                ctrl.addr_reg_nxt = '0;
+                ctrl.addr_reg_nxt[(2+cache_offset_size_c+cache_index_size_c)-1 : 2+cache_offset_size_c] = ctrl.fidx_nxt[cache_index_size_c-1:0];
+                //
+                if (ctrl.fidx_nxt[cache_index_size_c] == 1'b1) begin // all blocks checked
+                    ctrl.state_nxt = S_CACHE_CLEAR;
+                end else begin
+                    ctrl.state_nxt = S_FLUSH_READ;
+                end
+            end
+            // --------------------------------------------------------------
+            // undefined
+            default: begin
+                ctrl.state_nxt = S_IDLE;
+            end
+        endcase
+    end : ctrl_engine_fsm_comb
+
+    /* address of current host access or prefetch hint */
+    assign acc_addr = ((ctrl.pref == 1'b1) && (ctrl.state != S_IDLE)) ? ctrl.pref_addr : host_addr_i;
+    assign pref_req = ((pref_i == 1'b1) && (ctrl.pref_buf == 1'b0) && ((ctrl.pref == 1'b0) || (ctrl.state == S_IDLE))) ? 1'b1 : 1'b0;
+
+    /* peripheral bus: host access (uncached/multi-cycle) or block transfer */
+    assign bus_addr_o  = (direct == 1'b1) ? host_addr_i  : ctrl.addr_reg;
+    assign bus_wdata_o = (direct == 1'b1) ? host_wdata_i : cache.ctrl_rdata;
+    assign bus_ben_o   = (direct == 1'b1) ? host_ben_i   : 4'b1111;
+
+    /* multi-cycle accesses are only forwarded while idle; grant new requests only if the controller stays idle */
+    assign bus_multi_en_o   = ((ctrl.state == S_IDLE) && (ctrl.clear_buf == 1'b0)) ? host_multi_en_i : 1'b0;
+    assign host_multi_rsp_o = ((ctrl.state == S_IDLE) && (ctrl.state_nxt == S_IDLE) && (clear_i == 1'b0)) ? bus_multi_rsp_i : 1'b0;
+
+    /* keep instruction fetch off the bus until all dirty blocks have been written back */
+    assign lock_o = clear_i | ctrl.clear_buf | ctrl.flush;
+
+    /* cache access in progress */
+    assign bus_cached_o = ((ctrl.state == S_BUS_UPLOAD_REQ) || (ctrl.state == S_BUS_UPLOAD_GET) ||
+                           (ctrl.state == S_BUS_DOWNLOAD_REQ) || (ctrl.state == S_BUS_DOWNLOAD_GET)) ? 1'b1 : 1'b0;
+
+    // Cache Memory ------------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    cellrv32_dcache_memory #(
+        .DCACHE_NUM_BLOCKS(DCACHE_NUM_BLOCKS), // number of blocks (min 2), has to be a power of 2
+        .DCACHE_BLOCK_SIZE(DCACHE_BLOCK_SIZE), // block size in bytes (min 8), has to be a power of 2
+        .DCACHE_NUM_SETS(DCACHE_NUM_SETS)      // associativity; 1=direct-mapped, 2=2-way set-associative
+    ) cellrv32_dcache_memory_inst (
+        /* global control */
+        .clk_i(clk_i),                          // global clock, rising edge
+        .invalidate_i(cache.clear),             // invalidate whole cache
+        /* host cache access */
+        .host_addr_i(cache.host_addr),          // access address
+        .host_re_i(cache.host_re),              // lookup
+        .host_we_i(cache.host_we),              // write enable (byte-wise)
+        .host_ben_i(host_ben_i),                // byte enable
+        .host_wdata_i(host_wdata_i),            // write data
+        .host_rdata_o(cache.host_rdata),        // read data
+        /* access status (1 cycle delay to access) */
+        .hit_o(cache.hit),                      // hit access
+        .lru_o(cache.lru),                      // set to be replaced
+        /* ctrl cache access */
+        .ctrl_en_i(cache.ctrl_en),              // control interface enable
+        .ctrl_addr_i(ctrl.addr_reg),            // access address
+        .ctrl_set_i(cache.ctrl_set),            // selected set
+        .ctrl_we_i(cache.ctrl_we),              // write enable (full-word)
+        .ctrl_wdata_i((ctrl.state == S_CACHE_ZERO) ? '0 : bus_rdata_i), // write data (zero-fill or block download)
+        .ctrl_rdata_o(cache.ctrl_rdata),        // read data
+        .ctrl_tag_we_i(cache.ctrl_tag_we),      // write tag to selected block
+        .ctrl_valid_i(cache.ctrl_valid_we),     // make selected block valid
+        .ctrl_invalid_i(cache.ctrl_invalid_we), // make selected block invalid
+        .ctrl_valid_o(cache.ctrl_valid),        // selected block is valid
+        .ctrl_dirty_o(cache.ctrl_dirty),        // selected block is dirty
+        .ctrl_base_o(cache.ctrl_base)           // base address of selected block
+    );
+
+endmodule
@@ -11,7 +11,9 @@ module cellrv32_fifo #(
     parameter int FIFO_WIDTH = 18,   // size of data elements in fifo
     parameter logic   FIFO_RSYNC = 1'b0, // false = async read; true = sync read
     parameter logic   FIFO_SAFE  = 1'b0, // true = allow read/write only if entry available
-    parameter logic   FIFO_GATE  = 1'b0  // true = use output gate (set to zero if no valid data available)
+    parameter logic   FIFO_GATE  = 1'b0, // true = use output gate (set to zero if no valid data available)
+    parameter logic   FIFO_PEEK  = 1'b0, // true = second read port for the next entry (async read, depth > 1 only)
+    parameter logic   FIFO_WR2   = 1'b0  // true = second write port to write two entries at once (depth > 1 only)
 ) (
     /* control */
     input  logic clk_i,   // clock, rising edge
@@ -22,10 +24,18 @@ module cellrv32_fifo #(
     input  logic [FIFO_WIDTH-1:0] wdata_i,  // write data
     input  logic                  we_i,     // write enable
     output logic                  free_o,   // at least one entry is free when set
+    /* second write port (FIFO_WR2 only) */
+    input  logic [FIFO_WIDTH-1:0] wdata2_i, // write data of next entry
+    input  logic                  we2_i,    // write two entries at once (requires we_i)
+    output logic                  free2_o,  // at least two entries are free when set
     /* read port */
     input  logic                  re_i,     // read enable
     output logic [FIFO_WIDTH-1:0] rdata_o,  // read data
-    output logic                  avail_o   // data available when set
+    output logic                  avail_o,  // data available when set
+    /* peek port (FIFO_PEEK only) */
+    input  logic                  re2_i,    // read two entries at once (requires re_i)
+    output logic [FIFO_WIDTH-1:0] rdata2_o, // read data of next entry
+    output logic                  avail2_o  // at least two entries available when set
 );
     /* FIFO */
     typedef logic [FIFO_DEPTH-1:0][FIFO_WIDTH-1:0] fifo_data_t;
@@ -33,6 +43,8 @@ module cellrv32_fifo #(
     typedef struct packed {
         logic we; // write enable
         logic re; // read enable
+        logic re2; // read second entry
+        logic we2; // write second entry
         logic [$clog2(FIFO_DEPTH):0] w_pnt; // write pointer
         logic [$clog2(FIFO_DEPTH):0] r_pnt; // read pointer
         fifo_data_t data; // fifo memory
@@ -64,6 +76,8 @@ module cellrv32_fifo #(
     // -------------------------------------------------------------------------------------------
     assign fifo.re = (FIFO_SAFE == 0) ? re_i : (re_i & fifo.avail); // SAFE = read only if data available
     assign fifo.we = (FIFO_SAFE == 0) ? we_i : (we_i & fifo.free); // SAFE = write only if space left
+    assign fifo.re2 = ((FIFO_PEEK == 1'b1) && (FIFO_DEPTH > 1)) ? (fifo.re & re2_i) : 1'b0; // read two entries at once
+    assign fifo.we2 = ((FIFO_WR2  == 1'b1) && (FIFO_DEPTH > 1)) ? (fifo.we & we2_i) : 1'b0; // write two entries at once
 
     // FIFO Pointers -----------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
@@ -76,13 +90,13 @@ module cellrv32_fifo #(
             if (clear_i == 1'b1) begin
                 fifo.w_pnt <= '0;
             end else if (fifo.we == 1'b1) begin
-                fifo.w_pnt <= fifo.w_pnt + 1'b1;
+                fifo.w_pnt <= fifo.w_pnt + 1'b1 + fifo.we2;
             end
             /* read port */
             if (clear_i == 1'b1) begin
                 fifo.r_pnt <= '0;
             end else if (fifo.re == 1'b1) begin
-                fifo.r_pnt <= fifo.r_pnt + 1'b1;
+                fifo.r_pnt <= fifo.r_pnt + 1'b1 + fifo.re2;
             end
         end
     end : fifo_pointers
@@ -134,11 +148,17 @@ module cellrv32_fifo #(
     /* "real" FIFO memory (several entries) */
     generate
         if (FIFO_DEPTH > 1) begin : fifo_memory
+            logic [$clog2(FIFO_DEPTH):0] w_pnt2;
+            assign w_pnt2 = fifo.w_pnt + 1'b1;
+            //
             always_ff @(posedge clk_i or negedge rstn_i) begin : fifo_write
                 if (rstn_i == 1'b0) begin
                     fifo.data <= '0;
                 end else if (fifo.we == 1'b1) begin
                     fifo.data[fifo.w_pnt[$bits(fifo.w_pnt)-2 : 0]] <= wdata_i;
+                    if (fifo.we2 == 1'b1) begin
+                        fifo.data[w_pnt2[$bits(w_pnt2)-2 : 0]] <= wdata2_i;
+                    end
                 end
             end : fifo_write
             // unused
@@ -195,5 +215,29 @@ module cellrv32_fifo #(
     // ensure the output data is always *defined* (by setting the output to all-zero if
     // not valid data is available).
     assign rdata_o = ((FIFO_GATE == 0) || (fifo.avail == 1'b1)) ? rdata : '0;
+
+    // Peek Port ---------------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    generate
+        if ((FIFO_PEEK == 1'b1) && (FIFO_DEPTH > 1)) begin : fifo_peek_enabled
+            logic [$clog2(FIFO_DEPTH):0] r_pnt2;
+            assign r_pnt2   = fifo.r_pnt + 1'b1;
+            assign rdata2_o = fifo.data[r_pnt2[$bits(r_pnt2)-2 : 0]];
+            assign avail2_o = (level_diff >= 2) ? 1'b1 : 1'b0;
+        end else begin : fifo_peek_disabled
+            assign rdata2_o = '0;
+            assign avail2_o = 1'b0;
+        end : fifo_peek_disabled
+    endgenerate
+
+    // Second Write Port -------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    generate
+        if ((FIFO_WR2 == 1'b1) && (FIFO_DEPTH > 1)) begin : fifo_wr2_enabled
+            assign free2_o = (level_diff <= (FIFO_DEPTH-2)) ? 1'b1 : 1'b0;
+        end else begin : fifo_wr2_disabled
+            assign free2_o = 1'b0;
+        end : fifo_wr2_disabled
+    endgenerate
     
 endmodule
\ No newline at end of file
@@ -1,8 +1,28 @@
 // ##################################################################################################
 // # << CELLRV32 - Processor-Internal Instruction Cache >>                                          #
 // # ********************************************************************************************** #
-// # Direct mapped (ICACHE_NUM_SETS = 1) or 2-way set-associative (ICACHE_NUM_SETS = 2).            #
-// # Least recently used replacement policy (if ICACHE_NUM_SETS > 1).                               #
+// # Direct mapped (ICACHE_NUM_SETS = 1) or 2/4/8-way set-associative (ICACHE_NUM_SETS = 2/4/8).    #
+// # Tree pseudo-LRU replacement policy (if ICACHE_NUM_SETS > 1), which is true LRU for 2 sets.     #
+// #                                                                                                #
+// # 64-bit host read: an access to an even word also returns the following (odd) word of the same  #
+// # block (host_wide_o set) if the block size is at least 8 bytes and the odd word is not faulty.  #
+// #                                                                                                #
+// # Block refill is critical-word-first: the download starts at the requested word and wraps       #
+// # around at the end of the block. The requested word is handed to the host as soon as it arrives #
+// # (early restart) while the rest of the block is still being downloaded.                         #
+// #                                                                                                #
+// # Optional next-line prefetcher (ICACHE_PREFETCH): after block N has been allocated, block N+1   #
+// # is downloaded into a one-block stream buffer while the host keeps hitting in the cache. A miss  #
+// # to the buffered block copies it into the cache without any bus access.                        #
+// #                                                                                                #
+// # Way locking: locked ways (lock_i) are never replaced by host misses. A block preload request   #
+// # (fill_i) always downloads the addressed block into way fill_way_i, even if that way is locked. #
+// # Host misses are served without allocation if all ways are locked. clear_i also invalidates     #
+// # locked ways.                                                                                   #
+// #                                                                                                #
+// # Prefetch hints (fill_i + hint_i, Zicbop prefetch.i) share the preload request buffer: the      #
+// # block is only downloaded if it misses, using the regular (lock-aware) victim selection. A hint #
+// # is dropped if another request is already buffered or if all ways are locked.                   #
 // # ********************************************************************************************** #
 `ifndef  _INCL_DEFINITIONS
   `define _INCL_DEFINITIONS
@@ -12,19 +32,32 @@
 module cellrv32_icache #(
     parameter int ICACHE_NUM_BLOCKS = 4,  // number of blocks (min 1), has to be a power of 2
     parameter int ICACHE_BLOCK_SIZE = 64, // block size in bytes (min 4), has to be a power of 2
-    parameter int ICACHE_NUM_SETS   = 1   // associativity / number of sets (1=direct_mapped), has to be a power of 2
+    parameter int ICACHE_NUM_SETS   = 1,  // associativity / number of sets (1=direct_mapped), has to be a power of 2
+    parameter logic ICACHE_PREFETCH = 1'b0 // implement next-line prefetcher (stream buffer)
 ) (
     /* global control */
     input  logic        clk_i,   // global clock, rising edge
     input  logic        rstn_i,  // global reset, low-active, async
     input  logic        clear_i, // cache clear
     output logic        miss_o,  // cache miss
+    output logic        hit_o,   // cache hit
+    output logic        evict_o, // valid block replaced
+    output logic        wait_o,  // host waiting for miss handling
+    /* way locking / block preload */
+    input  logic [7:0]  lock_i,      // locked ways (excluded from replacement)
+    input  logic [2:0]  fill_way_i,  // target way of block preload
+    input  logic        fill_i,      // request block preload
+    input  logic [31:0] fill_addr_i, // preload address
+    input  logic        hint_i,      // preload request is a prefetch hint
+    output logic        fill_busy_o, // block preload pending
     /* host controller interface */
     input  logic [31:0] host_addr_i,  // bus access address
     output logic [31:0] host_rdata_o, // bus read data
     input  logic        host_re_i,    // read enable
     output logic        host_ack_o,   // bus transfer acknowledge
     output logic        host_err_o,   // bus transfer error
+    output logic [31:0] host_rdata2_o,// bus read data of next sequential word
+    output logic        host_wide_o,  // next sequential word is valid
     /* peripheral bus interface */
     output logic        bus_cached_o, // set if cached (!) access in progress
     output logic [31:0] bus_addr_o,   // bus access address
@@ -37,6 +70,7 @@ module cellrv32_icache #(
     localparam int cache_offset_size_c = $clog2(ICACHE_BLOCK_SIZE/4); // offset addresses full 32-bit words
     localparam int cache_index_size_c  = $clog2(ICACHE_NUM_BLOCKS);
     localparam int cache_tag_size_c    = 32 - (cache_offset_size_c + cache_index_size_c + 2); // 2 additonal bits for byte offset
+    localparam int cache_words_c       = ICACHE_BLOCK_SIZE/4; // 32-bit words per block
     
     /* cache interface */
     typedef struct {
@@ -44,6 +78,8 @@ module cellrv32_icache #(
         logic [31:0] host_addr;  // cpu access address
         logic [31:0] host_rdata; // cpu read data
         logic host_rstat;        // cpu read status
+        logic [31:0] host_rdata2;// cpu read data of odd word
+        logic host_rstat2;       // cpu read status of odd word
         logic hit;               // hit access
         logic ctrl_en;           // control access enable
         logic [31:0] ctrl_addr;  // control access address
@@ -53,6 +89,11 @@ module cellrv32_icache #(
         logic ctrl_tag_we;       // control tag write enabled
         logic ctrl_valid_we;     // control valid flag set
         logic ctrl_invalid_we;   // control valid flag clear
+        logic host_ack;          // host access finalized from cache (64-bit read possible)
+        logic host_lookup;       // host lookup (update access history on hit)
+        logic evict;             // valid block replaced
+        logic [ICACHE_NUM_SETS-1:0] lock; // locked sets
+        logic lock_all;          // no set available for allocation
     } cache_if_t;
     //
     cache_if_t cache;
@@ -60,7 +101,7 @@ module cellrv32_icache #(
     /* control engine */
     typedef enum  { S_IDLE, S_CACHE_CLEAR, S_CACHE_CHECK, 
                     S_CACHE_MISS, S_BUS_DOWNLOAD_REQ,
-                    S_BUS_DOWNLOAD_GET, S_CACHE_RESYNC_0,
+                    S_BUS_DOWNLOAD_GET, S_SBUF_COPY, S_CACHE_RESYNC_0,
                     S_CACHE_RESYNC_1 } ctrl_engine_state_t;
     
     typedef struct {
@@ -72,10 +113,55 @@ module cellrv32_icache #(
         logic        re_buf_nxt;
         logic        clear_buf;        // clear request buffer
         logic        clear_buf_nxt;
+        logic [cache_offset_size_c:0] cnt; // number of words downloaded
+        logic [cache_offset_size_c:0] cnt_nxt;
+        logic        acked;            // host access already finalized (early restart)
+        logic        acked_nxt;
+        logic        bypass;           // single-word host access without allocation (all ways locked)
+        logic        bypass_nxt;
+        logic        fill;             // current operation is a block preload
+        logic        fill_nxt;
+        logic        fill_buf;         // preload request buffer
+        logic        fill_buf_nxt;
+        logic [31:0] fill_addr;        // preload address
+        logic [31:0] fill_addr_nxt;
+        logic        hint;             // current preload is a prefetch hint
+        logic        hint_nxt;
+        logic        hint_buf;         // buffered preload request is a prefetch hint
+        logic        hint_buf_nxt;
     } ctrl_t;
     // 
     ctrl_t ctrl;
 
+    /* next-line prefetcher */
+    typedef enum  { PF_IDLE, PF_REQ, PF_GET } pf_state_t;
+
+    typedef struct {
+        pf_state_t   state;  // current state
+        logic [31:0] addr;   // address of current word
+        logic [31:0] base;   // base address of buffered block
+        logic        valid;  // buffer holds the complete block
+        logic        kill;   // discard block (cache cleared while downloading)
+        logic        start;  // start prefetch (from control engine)
+        logic [31:0] next;   // base address of block to be prefetched
+        logic        abort;  // abort prefetch (from control engine)
+        logic        hit;    // missed block is (being) buffered
+        logic        re;     // bus read request
+    } pf_t;
+    //
+    pf_t pf;
+
+    /* stream buffer */
+    logic [31:0]              sbuf_data [0:cache_words_c-1];
+    logic [cache_words_c-1:0] sbuf_err;
+
+    /* address and block base address of current host access or preload */
+    logic [31:0] acc_addr;
+    logic [31:0] host_base;
+
+    /* preload request accepted (explicit preloads always, hints only if no other request is buffered) */
+    logic fill_req;
+
     // Sanity Checks -----------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     /* configuration */
@@ -90,8 +176,8 @@ module cellrv32_icache #(
       $error("CELLRV32 PROCESSOR CONFIG ERROR! i-cache number of blocks <ICACHE_NUM_BLOCKS> has to be >= 1.");
       assert (!(ICACHE_BLOCK_SIZE < 4)) else
       $error("CELLRV32 PROCESSOR CONFIG ERROR! i-cache block size <ICACHE_BLOCK_SIZE> has to be >= 4.");
-      assert (!((ICACHE_NUM_SETS == 0) || (ICACHE_NUM_SETS > 2))) else
-      $error("CELLRV32 PROCESSOR CONFIG ERROR! i-cache associativity <ICACHE_NUM_SETS> has to be 1 (direct-mapped) or 2 (2-way set-associative).");
+      assert (!((ICACHE_NUM_SETS == 0) || (ICACHE_NUM_SETS > 8))) else
+      $error("CELLRV32 PROCESSOR CONFIG ERROR! i-cache associativity <ICACHE_NUM_SETS> has to be 1 (direct-mapped) or 2/4/8 (n-way set-associative).");
     end
 
     // Control Engine FSM Sync -------------------------------------------------------------------
@@ -102,11 +188,27 @@ module cellrv32_icache #(
             ctrl.re_buf    <= 1'b0;
             ctrl.clear_buf <= 1'b0;
             ctrl.addr_reg  <= '0;
+            ctrl.cnt       <= '0;
+            ctrl.acked     <= 1'b0;
+            ctrl.bypass    <= 1'b0;
+            ctrl.fill      <= 1'b0;
+            ctrl.fill_buf  <= 1'b0;
+            ctrl.fill_addr <= '0;
+            ctrl.hint      <= 1'b0;
+            ctrl.hint_buf  <= 1'b0;
         end else begin
             ctrl.state     <= ctrl.state_nxt;
             ctrl.re_buf    <= ctrl.re_buf_nxt;
             ctrl.clear_buf <= ctrl.clear_buf_nxt;
             ctrl.addr_reg  <= ctrl.addr_reg_nxt;
+            ctrl.cnt       <= ctrl.cnt_nxt;
+            ctrl.acked     <= ctrl.acked_nxt;
+            ctrl.bypass    <= ctrl.bypass_nxt;
+            ctrl.fill      <= ctrl.fill_nxt;
+            ctrl.fill_buf  <= ctrl.fill_buf_nxt;
+            ctrl.fill_addr <= ctrl.fill_addr_nxt;
+            ctrl.hint      <= ctrl.hint_nxt;
+            ctrl.hint_buf  <= ctrl.hint_buf_nxt;
         end
     end : ctrl_engine_fsm_sync
 
@@ -118,10 +220,18 @@ module cellrv32_icache #(
         ctrl.addr_reg_nxt     = ctrl.addr_reg;
         ctrl.re_buf_nxt       = ctrl.re_buf | host_re_i;
         ctrl.clear_buf_nxt    = ctrl.clear_buf | clear_i; // buffer clear request from CPU
+        ctrl.cnt_nxt          = ctrl.cnt;
+        ctrl.acked_nxt        = ctrl.acked;
+        ctrl.bypass_nxt       = ctrl.bypass;
+        ctrl.fill_nxt         = ctrl.fill;
+        ctrl.fill_buf_nxt     = ctrl.fill_buf | fill_req; // buffer preload request from CPU
+        ctrl.fill_addr_nxt    = (fill_req == 1'b1) ? fill_addr_i : ctrl.fill_addr;
+        ctrl.hint_nxt         = ctrl.hint;
+        ctrl.hint_buf_nxt     = (fill_req == 1'b1) ? hint_i : ctrl.hint_buf;
 
         /* cache defaults */
         cache.clear           = 1'b0;
-        cache.host_addr       = host_addr_i;
+        cache.host_addr       = acc_addr;
         cache.ctrl_en         = 1'b0;
         cache.ctrl_addr       = ctrl.addr_reg;
         cache.ctrl_we         = 1'b0;
@@ -130,6 +240,13 @@ module cellrv32_icache #(
         cache.ctrl_tag_we     = 1'b0;
         cache.ctrl_valid_we   = 1'b0;
         cache.ctrl_invalid_we = 1'b0;
+        cache.host_ack        = 1'b0;
+        cache.host_lookup     = 1'b0;
+
+        /* prefetcher control defaults */
+        pf.start              = 1'b0;
+        pf.next               = {ctrl.addr_reg[31 : 2+cache_offset_size_c], {(2+cache_offset_size_c){1'b0}}} + ICACHE_BLOCK_SIZE; // block N+1
+        pf.abort              = 1'b0;
 
         /* host interface defaults */
         host_ack_o            = 1'b0;
@@ -137,17 +254,31 @@ module cellrv32_icache #(
         host_rdata_o          = cache.host_rdata;
 
         /* peripheral bus interface defaults */
-        bus_addr_o            = ctrl.addr_reg;
-        bus_re_o              = 1'b0;
+        bus_addr_o            = (pf.state != PF_IDLE) ? pf.addr : ctrl.addr_reg;
+        bus_re_o              = pf.re;
 
         /* fsm */
         unique case (ctrl.state)
             // --------------------------------------------------------------
             // wait for host access request or cache control operation
             S_IDLE : begin
+                cache.host_addr = host_addr_i;
+                ctrl.fill_nxt   = 1'b0;
                 if (ctrl.clear_buf == 1'b1) // cache control operation?
                   ctrl.state_nxt = S_CACHE_CLEAR;
-                else if ((host_re_i == 1'b1) || (ctrl.re_buf == 1'b1)) begin // cache access
+                else if (ctrl.fill_buf == 1'b1) begin // block preload (always allocated, no hit check) or prefetch hint
+                  cache.host_addr   = ctrl.fill_addr;
+                  ctrl.addr_reg_nxt = ctrl.fill_addr; // keep address, the buffer can already take the next request
+                  ctrl.fill_buf_nxt = fill_req;
+                  ctrl.hint_nxt     = ctrl.hint_buf;
+                  if (ctrl.hint_buf == 1'b0) begin
+                    ctrl.fill_nxt  = 1'b1;
+                    ctrl.state_nxt = S_CACHE_MISS;
+                  end else if (cache.lock_all == 1'b0) begin // hint: no allocation if all ways are locked
+                    ctrl.fill_nxt  = 1'b1;
+                    ctrl.state_nxt = S_CACHE_CHECK;
+                  end
+                end else if ((host_re_i == 1'b1) || (ctrl.re_buf == 1'b1)) begin // cache access
                   ctrl.re_buf_nxt = 1'b0;
                   ctrl.state_nxt  = S_CACHE_CHECK;
                 end
@@ -162,11 +293,15 @@ module cellrv32_icache #(
             // --------------------------------------------------------------
             // finalize host access if cache hit
             S_CACHE_CHECK : begin
+                cache.host_lookup = 1'b1;
                 if (cache.hit == 1'b1) begin
-                    if (cache.host_rstat == 1'b1) begin
-                        host_err_o = 1'b1;
-                    end else begin
-                        host_ack_o = 1'b1;
+                    if (ctrl.fill == 1'b0) begin // no host access to finalize for a prefetch hint
+                        if (cache.host_rstat == 1'b1) begin
+                            host_err_o = 1'b1;
+                        end else begin
+                            host_ack_o = 1'b1;
+                        end
+                        cache.host_ack = 1'b1;
                     end
                     ctrl.state_nxt = S_IDLE;
                 end else begin
@@ -175,13 +310,23 @@ module cellrv32_icache #(
                 end
             end
             // --------------------------------------------------------------
-            // compute block base address
+            // get block from stream buffer or start download at the requested word
             S_CACHE_MISS : begin
-                 ctrl.addr_reg_nxt = host_addr_i;
-                 ctrl.addr_reg_nxt[(2+cache_offset_size_c)-1 : 2] = '0; // block-aligned
-                 ctrl.addr_reg_nxt[1:0] = 2'b00; // word-aligned
-                 //
-                 ctrl.state_nxt = S_BUS_DOWNLOAD_REQ;
+                if ((pf.hit == 1'b1) && ((cache.lock_all == 1'b0) || (ctrl.fill == 1'b1))) begin // block is (being) prefetched
+                    if (pf.valid == 1'b1) begin
+                        ctrl.addr_reg_nxt = host_base;
+                        ctrl.state_nxt    = S_SBUF_COPY;
+                    end
+                end else if (pf.state != PF_IDLE) begin // wrong block: abort prefetch, wait for the bus
+                    pf.abort = 1'b1;
+                end else begin
+                    ctrl.addr_reg_nxt      = acc_addr;
+                    ctrl.addr_reg_nxt[1:0] = 2'b00; // word-aligned, critical word first
+                    ctrl.cnt_nxt           = '0;
+                    ctrl.acked_nxt         = ctrl.fill; // no host access to finalize for a preload
+                    ctrl.bypass_nxt        = cache.lock_all & (~ctrl.fill); // preloads ignore the lock
+                    ctrl.state_nxt         = S_BUS_DOWNLOAD_REQ;
+                end
             end
             // --------------------------------------------------------------
             // download new cache block: request new word
@@ -196,19 +341,47 @@ module cellrv32_icache #(
                 cache.ctrl_en = 1'b1; // we are in cache control mode
                 //
                 if ((bus_ack_i == 1'b1) || (bus_err_i == 1'b1)) begin // ACK or ERROR = write to cache and get next word
-                    cache.ctrl_we = 1'b1; // write to cache
+                    cache.ctrl_we = ~ctrl.bypass; // write to cache
+                    ctrl.cnt_nxt  = ctrl.cnt + 1;
+                    // early restart: critical word goes directly to the host
+                    if (ctrl.acked == 1'b0) begin
+                      host_rdata_o   = bus_rdata_i;
+                      host_ack_o     = ~bus_err_i;
+                      host_err_o     = bus_err_i;
+                      ctrl.acked_nxt = 1'b1;
+                    end
                     // block complete?
-                    if ((&ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2]) == 1'b1) begin
+                    if (ctrl.bypass == 1'b1) begin // no allocation: done after the critical word
+                      ctrl.state_nxt      = S_IDLE;
+                    end else if (ctrl.cnt == (cache_words_c-1)) begin
                       cache.ctrl_tag_we   = 1'b1; // current block is valid now
                       cache.ctrl_valid_we = 1'b1; // write tag of current address
-                      ctrl.state_nxt      = S_CACHE_RESYNC_0;
-                    end else begin // get next word
-                      ctrl.addr_reg_nxt = ctrl.addr_reg + 4;
-                      ctrl.state_nxt    = S_BUS_DOWNLOAD_REQ;
+                      pf.start            = ICACHE_PREFETCH; // prefetch next block
+                      ctrl.state_nxt      = S_IDLE; // host has already been served
+                    end else begin // get next word (wrap around within block)
+                      ctrl.addr_reg_nxt[(2+cache_offset_size_c)-1 : 2] = ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2] + 1'b1;
+                      ctrl.state_nxt = S_BUS_DOWNLOAD_REQ;
                     end
                 end 
             end
             // --------------------------------------------------------------
+            // copy prefetched block from stream buffer
+            S_SBUF_COPY : begin
+                cache.ctrl_en    = 1'b1; // we are in cache control mode
+                cache.ctrl_we    = 1'b1; // write to cache
+                cache.ctrl_wdata = sbuf_data[ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2]];
+                cache.ctrl_wstat = sbuf_err[ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2]];
+                // block complete?
+                if ((&ctrl.addr_reg[(2+cache_offset_size_c)-1 : 2]) == 1'b1) begin
+                  cache.ctrl_tag_we   = 1'b1; // current block is valid now
+                  cache.ctrl_valid_we = 1'b1; // write tag of current address
+                  pf.start            = ICACHE_PREFETCH; // prefetch next block
+                  ctrl.state_nxt      = S_CACHE_RESYNC_0;
+                end else begin
+                  ctrl.addr_reg_nxt = ctrl.addr_reg + 4;
+                end
+            end
+            // --------------------------------------------------------------
             // re-sync host/cache access: cache read-latency
             S_CACHE_RESYNC_0 : begin
                 ctrl.state_nxt = S_CACHE_RESYNC_1;
@@ -216,10 +389,13 @@ module cellrv32_icache #(
             // --------------------------------------------------------------
             // re-sync host/cache access: finalize CPU request
             S_CACHE_RESYNC_1 : begin
-                if (cache.host_rstat == 1'b1) begin // data word from cache marked as faulty?
-                    host_err_o = 1'b1;
-                end else begin
-                    host_ack_o = 1'b1;
+                if (ctrl.fill == 1'b0) begin // no host access to finalize for a preload
+                    if (cache.host_rstat == 1'b1) begin // data word from cache marked as faulty?
+                        host_err_o = 1'b1;
+                    end else begin
+                        host_ack_o = 1'b1;
+                    end
+                    cache.host_ack = 1'b1;
                 end
                 //
                 ctrl.state_nxt = S_IDLE;
@@ -232,31 +408,147 @@ module cellrv32_icache #(
         endcase
     end : ctrl_engine_fsm_comb
 
+    /* 64-bit host read: second word of 64-bit-aligned double word (not for an early-restart response) */
+    assign host_rdata2_o = cache.host_rdata2;
+    assign host_wide_o   = ((cache_offset_size_c > 0) && (host_addr_i[2] == 1'b0) && (cache.host_rstat2 == 1'b0) && (cache.host_ack == 1'b1)) ? 1'b1 : 1'b0;
+
     /* signal cache miss to CPU */
-    assign miss_o = (ctrl.state == S_CACHE_MISS) ? 1'b1 : 1'b0;
+    assign miss_o = ((ctrl.state == S_CACHE_CHECK) && (cache.hit == 1'b0) && (ctrl.fill == 1'b0)) ? 1'b1 : 1'b0;
+    assign hit_o  = ((ctrl.state == S_CACHE_CHECK) && (cache.hit == 1'b1) && (ctrl.fill == 1'b0)) ? 1'b1 : 1'b0;
+
+    /* miss statistics: block replacement and host stall cycles (early restart ends the stall unless another request is pending) */
+    assign evict_o = cache.evict;
+    assign wait_o  = (ctrl.fill == 1'b1) ? ((ctrl.state != S_IDLE) && (ctrl.re_buf == 1'b1)) : // host request stalled by preload
+                     ((ctrl.state == S_CACHE_MISS) || (ctrl.state == S_SBUF_COPY) ||
+                      (ctrl.state == S_CACHE_RESYNC_0) || (ctrl.state == S_CACHE_RESYNC_1) ||
+                      (((ctrl.state == S_BUS_DOWNLOAD_REQ) || (ctrl.state == S_BUS_DOWNLOAD_GET)) && ((ctrl.acked == 1'b0) || (ctrl.re_buf == 1'b1)))) ? 1'b1 : 1'b0;
+
+    /* way locking / block preload */
+    assign cache.lock     = lock_i[ICACHE_NUM_SETS-1:0];
+    assign cache.lock_all = &cache.lock;
+    assign fill_busy_o    = ((ctrl.fill_buf == 1'b1) || ((ctrl.fill == 1'b1) && (ctrl.state != S_IDLE))) ? 1'b1 : 1'b0;
+    assign fill_req       = fill_i & ((~hint_i) | (~ctrl.fill_buf));
 
     /* cache access in progress */
-    assign bus_cached_o = ((ctrl.state == S_BUS_DOWNLOAD_REQ) || (ctrl.state == S_BUS_DOWNLOAD_GET)) ? 1'b1 : 1'b0;
+    assign bus_cached_o = ((((ctrl.state == S_BUS_DOWNLOAD_REQ) || (ctrl.state == S_BUS_DOWNLOAD_GET)) && (ctrl.bypass == 1'b0)) || (pf.state != PF_IDLE)) ? 1'b1 : 1'b0;
+
+    /* address and block base address of current host access or preload */
+    assign acc_addr  = ((ctrl.fill == 1'b1) && (ctrl.state != S_IDLE)) ? ctrl.addr_reg : host_addr_i;
+    assign host_base = {acc_addr[31 : 2+cache_offset_size_c], {(2+cache_offset_size_c){1'b0}}};
+
+    // Next-Line Prefetcher ----------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    // [NOTE] the prefetcher only uses the bus while the control engine does not: a miss to another block
+    // aborts the prefetch after the current word, a miss to the buffered block waits until it is complete.
+    generate
+     if (ICACHE_PREFETCH == 1'b1) begin : prefetch_enabled
+         always_ff @( posedge clk_i or negedge rstn_i ) begin : prefetch_engine
+             if (rstn_i == 1'b0) begin
+                 pf.state <= PF_IDLE;
+                 pf.addr  <= '0;
+                 pf.base  <= '0;
+                 pf.valid <= 1'b0;
+                 pf.kill  <= 1'b0;
+             end else begin
+                 unique case (pf.state)
+                     // wait for new block to prefetch
+                     PF_IDLE : begin
+                         if ((pf.start == 1'b1) && (pf.next != '0)) begin // do not wrap around the address space
+                             pf.addr  <= pf.next;
+                             pf.base  <= pf.next;
+                             pf.valid <= 1'b0;
+                             pf.kill  <= 1'b0;
+                             pf.state <= PF_REQ;
+                         end
+                     end
+                     // request next word (bus_re_o)
+                     PF_REQ : begin
+                         if ((pf.abort == 1'b1) || (pf.kill == 1'b1)) begin
+                             pf.state <= PF_IDLE;
+                         end else begin
+                             pf.state <= PF_GET;
+                         end
+                     end
+                     // wait for bus response
+                     PF_GET : begin
+                         if ((bus_ack_i == 1'b1) || (bus_err_i == 1'b1)) begin
+                             if ((&pf.addr[(2+cache_offset_size_c)-1 : 2]) == 1'b1) begin // block complete
+                                 pf.valid <= ~pf.kill;
+                                 pf.state <= PF_IDLE;
+                             end else if (pf.abort == 1'b1) begin
+                                 pf.state <= PF_IDLE;
+                             end else begin
+                                 pf.addr  <= pf.addr + 4;
+                                 pf.state <= PF_REQ;
+                             end
+                         end
+                     end
+                     default : begin
+                         pf.state <= PF_IDLE;
+                     end
+                 endcase
+                 /* cache clear: stream buffer content is outdated */
+                 if ((clear_i == 1'b1) || (cache.clear == 1'b1)) begin
+                     pf.valid <= 1'b0;
+                     pf.kill  <= (pf.state != PF_IDLE) ? 1'b1 : 1'b0;
+                 end
+             end
+         end : prefetch_engine
+
+         /* stream buffer (no reset required) */
+         always_ff @( posedge clk_i ) begin : stream_buffer
+             if ((pf.state == PF_GET) && ((bus_ack_i == 1'b1) || (bus_err_i == 1'b1))) begin
+                 sbuf_data[pf.addr[(2+cache_offset_size_c)-1 : 2]] <= bus_rdata_i;
+                 sbuf_err[pf.addr[(2+cache_offset_size_c)-1 : 2]]  <= bus_err_i;
+             end
+         end : stream_buffer
+
+         /* request and buffer hit */
+         assign pf.re  = ((pf.state == PF_REQ) && (pf.abort == 1'b0) && (pf.kill == 1'b0)) ? 1'b1 : 1'b0;
+         assign pf.hit = ((pf.base == host_base) && (pf.kill == 1'b0) && ((pf.valid == 1'b1) || (pf.state != PF_IDLE))) ? 1'b1 : 1'b0;
+     end : prefetch_enabled
+    endgenerate
+
+    generate
+     if (ICACHE_PREFETCH == 1'b0) begin : prefetch_disabled
+         assign pf.state = PF_IDLE;
+         assign pf.addr  = '0;
+         assign pf.base  = '0;
+         assign pf.valid = 1'b0;
+         assign pf.kill  = 1'b0;
+         assign pf.re    = 1'b0;
+         assign pf.hit   = 1'b0;
+         assign sbuf_data = '{default: '0};
+         assign sbuf_err  = '0;
+     end : prefetch_disabled
+    endgenerate
 
     // Cache Memory ------------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     cellrv32_icache_memory #(
         .ICACHE_NUM_BLOCKS(ICACHE_NUM_BLOCKS), // number of blocks (min 1), has to be a power of 2
         .ICACHE_BLOCK_SIZE(ICACHE_BLOCK_SIZE), // block size in bytes (min 4), has to be a power of 2
-        .ICACHE_NUM_SETS(ICACHE_NUM_SETS)      // associativity; 0=direct-mapped, 1=2-way set-associative
+        .ICACHE_NUM_SETS(ICACHE_NUM_SETS)      // associativity; 1=direct-mapped, 2/4/8-way set-associative
     ) cellrv32_icache_memory_inst (
         /* global control */
         .clk_i(clk_i),                       // global clock, rising edge
         .invalidate_i(cache.clear),          // invalidate whole cache
+        .lock_i(cache.lock),                 // locked sets
         /* host cache access (read-only) */
         .host_addr_i(cache.host_addr),       // access address
-        .host_re_i(host_re_i),               // read enable
+        .host_re_i(cache.host_lookup),       // lookup (update access history on hit)
         .host_rdata_o(cache.host_rdata),     // read data
         .host_rstat_o(cache.host_rstat),     // read status
+        .host_rdata2_o(cache.host_rdata2),   // read data of odd word
+        .host_rstat2_o(cache.host_rstat2),   // read status of odd word
         /* access status (1 cycle delay to access) */
         .hit_o(cache.hit),            // hit access
+        .evict_o(cache.evict),        // valid block replaced
         /* ctrl cache access (write-only) */
         .ctrl_en_i(cache.ctrl_en),             // control interface enable
+        .ctrl_alloc_i(logic'(ctrl.state == S_CACHE_MISS)), // select victim set for the new block
+        .ctrl_force_i(ctrl.fill & (~ctrl.hint)), // preload: use selected way (not for hints)
+        .ctrl_set_i(fill_way_i),               // preload target way
         .ctrl_addr_i(cache.ctrl_addr),         // access address
         .ctrl_we_i(cache.ctrl_we),             // write enable (full-word)
         .ctrl_wdata_i(cache.ctrl_wdata),       // write data
@@ -1,9 +1,13 @@
 // ##################################################################################################
 // # << CELLRV32 - Cache Memory >>                                                                  #
 // # ********************************************************************************************** #
-// # Direct mapped (ICACHE_NUM_SETS = 1) or 2-way set-associative (ICACHE_NUM_SETS = 2).            #
-// # Least recently used replacement policy (if ICACHE_NUM_SETS > 1).                               #
+// # Direct mapped (ICACHE_NUM_SETS = 1) or 2/4/8-way set-associative (ICACHE_NUM_SETS = 2/4/8).    #
+// # Tree pseudo-LRU replacement policy (if ICACHE_NUM_SETS > 1), which is true LRU for 2 sets.     #
+// # Locked sets are never selected for replacement; the control port can force a specific set.     #
+// # The set to be replaced is sampled at the start of a block allocation (ctrl_alloc_i) and held   #
+// # until the block's tag and valid flag are written, so a block is never split across sets.       #
 // # Read-only for host, write-only for control. All output signals have one cycle latency.         #
+// # A second host read port provides the odd word of the addressed 64-bit-aligned double word.     #
 // #                                                                                                #
 // # Cache sets are mapped to individual memory components - no multi-dimensional memory arrays     #
 // # are used as some synthesis tools have problems to map these to actual BRAM primitives.         #
@@ -16,20 +20,27 @@
 module cellrv32_icache_memory #(
     parameter int ICACHE_NUM_BLOCKS = 4,  // number of blocks (min 1), has to be a power of 2
     parameter int ICACHE_BLOCK_SIZE = 16, // block size in bytes (min 4), has to be a power of 2
-    parameter int ICACHE_NUM_SETS   = 1   // associativity; 1=direct-mapped, 2=2-way set-associative
+    parameter int ICACHE_NUM_SETS   = 1   // associativity; 1=direct-mapped, 2/4/8-way set-associative
 ) (
     /* global control */
     input  logic        clk_i,         // global clock, rising edge
     input  logic        invalidate_i,  // invalidate whole cache
+    input  logic [ICACHE_NUM_SETS-1:0] lock_i, // set is locked (excluded from replacement)
     /* host cache access (read-only) */
     input  logic [31:0] host_addr_i,   // access address
-    input  logic        host_re_i,     // read enable
+    input  logic        host_re_i,     // lookup (update access history on hit)
     output logic [31:0] host_rdata_o,  // read data
     output logic        host_rstat_o,  // read status
+    output logic [31:0] host_rdata2_o, // read data of odd word (64-bit-aligned double word)
+    output logic        host_rstat2_o, // read status of odd word
     /* access status (1 cycle delay to access) */
     output logic        hit_o,         // hit access
+    output logic        evict_o,       // valid block is replaced (ctrl_valid_i)
     /* ctrl cache access (write-only) */
     input  logic        ctrl_en_i,     // control interface enable
+    input  logic        ctrl_alloc_i,  // start of block allocation: select set to be replaced
+    input  logic        ctrl_force_i,  // use ctrl_set_i instead of replacement policy
+    input  logic [2:0]  ctrl_set_i,    // forced set
     input  logic [31:0] ctrl_addr_i,   // access address
     input  logic        ctrl_we_i,     // write enable (full-word)
     input  logic [31:0] ctrl_wdata_i,  // write data
@@ -43,21 +54,19 @@ module cellrv32_icache_memory #(
     localparam int cache_index_size_c  = $clog2(ICACHE_NUM_BLOCKS);
     localparam int cache_tag_size_c    = 32 - (cache_offset_size_c + cache_index_size_c + 2); // 2 additional bits for byte offset
     localparam int cache_entries_c     = ICACHE_NUM_BLOCKS * (ICACHE_BLOCK_SIZE/4); // number of 32-bit entries (per set)
+    localparam int cache_set_bits_c    = (ICACHE_NUM_SETS > 1) ? $clog2(ICACHE_NUM_SETS) : 1; // set select width
 
-    /* status flag memory */
-    logic [ICACHE_NUM_BLOCKS-1:0] valid_flag_s0;
-    logic [ICACHE_NUM_BLOCKS-1:0] valid_flag_s1;
-    logic [1:0]                   valid; // valid flag read data
+    /* status flag memory read data */
+    logic [ICACHE_NUM_SETS-1:0] valid; // valid flag read data
+    logic [ICACHE_NUM_SETS-1:0] valid_cur; // valid flag of current block (async, eviction check)
 
-    /* tag memory */
-    typedef logic [cache_tag_size_c-1:0] tag_mem_t [0:ICACHE_NUM_BLOCKS-1];
-    tag_mem_t tag_mem_s0;
-    tag_mem_t tag_mem_s1;
-    typedef logic [cache_tag_size_c-1:0] tag_rd_t [0:1];
-    tag_rd_t tag; // tag read data
+    /* tag memory read data */
+    typedef logic [cache_tag_size_c-1:0] tag_rd_t [0:ICACHE_NUM_SETS-1];
+    tag_rd_t tag;
 
     /* access status */
-    logic [1:0] hit;
+    logic [ICACHE_NUM_SETS-1:0]  hit;
+    logic [cache_set_bits_c-1:0] hit_set; // encoded hit set
 
     /* access address decomposition */
     typedef struct {
@@ -68,30 +77,61 @@ module cellrv32_icache_memory #(
     //
     acc_addr_t host_acc_addr, ctrl_acc_addr;
 
-    /* cache data memory (32-bit data + 1-bit status) */
-    typedef logic[31+1:0] cache_mem_t [0:cache_entries_c-1];
-    //
-    cache_mem_t cache_data_memory_s0; // set 0
-    cache_mem_t cache_data_memory_s1; // set 1
-
-    /* cache data memory access */
-    typedef logic[31+1:0] cache_rdata_t [0:1];
+    /* cache data memory access (32-bit data + 1-bit status) */
+    typedef logic[31+1:0] cache_rdata_t [0:ICACHE_NUM_SETS-1];
     //
     cache_rdata_t cache_rd;
+    cache_rdata_t cache_rd2; // second read port
     logic [cache_index_size_c-1:0] cache_index;
     logic [cache_offset_size_c-1:0] cache_offset;
     logic [cache_index_size_c+cache_offset_size_c-1:0] cache_addr; // index & offset
+    logic [cache_index_size_c+cache_offset_size_c-1:0] cache_addr2; // index & offset of odd word
     logic cache_we; // write enable (full-word)
-    logic set_select;
+    logic [cache_set_bits_c-1:0] set_select;
 
-    /* access history */
+    /* access history: one pseudo-LRU tree per block index, node n at bit n (bit 0 unused) */
     typedef struct {
-        logic [ICACHE_NUM_BLOCKS-1:0] last_used_set;
-        logic to_be_replaced;
+        logic [ICACHE_NUM_SETS-1:0]  plru [0:ICACHE_NUM_BLOCKS-1];
+        logic [cache_set_bits_c-1:0] to_be_replaced;
     } history_t;
     //
     history_t history;
 
+    // Pseudo-LRU Helpers ------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    /* follow the tree bits from the root to the least recently used set; skip locked sets */
+    function automatic logic [cache_set_bits_c-1:0] plru_victim_f(input logic [ICACHE_NUM_SETS-1:0] tree,
+                                                                  input logic [ICACHE_NUM_SETS-1:0] lock);
+        int node;
+        logic [cache_set_bits_c-1:0] victim;
+        node = 1;
+        for (int l = 0; l < $clog2(ICACHE_NUM_SETS); ++l) begin
+            node = 2*node + int'(tree[node]);
+        end
+        victim = cache_set_bits_c'(node - ICACHE_NUM_SETS);
+        // locked: use lowest unlocked set instead
+        if (lock[victim] == 1'b1) begin
+            for (int i = ICACHE_NUM_SETS-1; i >= 0; --i) begin
+                if (lock[i] == 1'b0) begin
+                    victim = cache_set_bits_c'(i);
+                end
+            end
+        end
+        return victim;
+    endfunction
+
+    /* let all nodes on the path to the accessed set point away from it */
+    function automatic logic [ICACHE_NUM_SETS-1:0] plru_update_f(input logic [ICACHE_NUM_SETS-1:0] tree,
+                                                                 input logic [cache_set_bits_c-1:0] set);
+        int node;
+        node = 1;
+        for (int l = $clog2(ICACHE_NUM_SETS)-1; l >= 0; --l) begin
+            tree[node] = ~set[l];
+            node = 2*node + int'(set[l]);
+        end
+        return tree;
+    endfunction
+
     // Access Address Decomposition --------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
     assign host_acc_addr.tag    = host_addr_i[31 : 31-(cache_tag_size_c-1)];
@@ -107,63 +147,88 @@ module cellrv32_icache_memory #(
     always_ff @( posedge clk_i ) begin : access_history
         // invalidate whole cache
         if (invalidate_i == 1'b1) begin
-            history.last_used_set <= '1;
+            for (int i = 0; i < ICACHE_NUM_BLOCKS; ++i) begin
+                history.plru[i] <= '0;
+            end
+        end else if ((ctrl_en_i == 1'b1) && (ctrl_valid_i == 1'b1)) begin // new block counts as access
+            history.plru[cache_index] <= plru_update_f(history.plru[cache_index], set_select);
         end else if ((host_re_i == 1'b1) && ((|hit) == 1'b1)) begin
-            history.last_used_set[cache_index] <= hit[0];
+            history.plru[cache_index] <= plru_update_f(history.plru[cache_index], hit_set);
         end
         //
-        history.to_be_replaced <= history.last_used_set[cache_index];
-    end : access_history
-
-    /* which set is going to be replaced? -> opposite of last used set = least recently used set */
-    assign set_select = (ICACHE_NUM_SETS == 1) ? 1'b0 : history.to_be_replaced;
-    
-    // Status flag memory ------------------------------------------------------------------------
-    // -------------------------------------------------------------------------------------------
-    always_ff @( posedge clk_i ) begin : status_memory
-        /* write access */
-        if (invalidate_i == 1'b1) begin // invalidate whole cache
-            valid_flag_s0 <= '0;
-            valid_flag_s1 <= '0;
-        end else if (ctrl_en_i == 1'b1) begin
-            if (ctrl_invalid_i == 1'b1) begin // make current block invalid
-                if (set_select == 1'b0)
-                  valid_flag_s0[cache_index] <= 1'b0;
-                else
-                  valid_flag_s1[cache_index] <= 1'b0;
-            end else if (ctrl_valid_i == 1'b1) begin // make current block valid
-                if (set_select == 1'b0) 
-                  valid_flag_s0[cache_index] <= 1'b1;
-                else
-                  valid_flag_s1[cache_index] <= 1'b1;
+        /* victim is held during the whole block allocation (lock_i and the history might change meanwhile) */
+        if (ctrl_alloc_i == 1'b1) begin
+            if (ctrl_force_i == 1'b1) begin
+                history.to_be_replaced <= ctrl_set_i[cache_set_bits_c-1:0];
+            end else begin
+                history.to_be_replaced <= plru_victim_f(history.plru[cache_index], lock_i);
             end
         end
-        /* read access (sync) */
-        valid[0] <= valid_flag_s0[cache_index];
-        valid[1] <= valid_flag_s1[cache_index];
-    end : status_memory
+    end : access_history
+
+    /* which set is going to be replaced? -> pseudo least recently used (unlocked) set or forced set */
+    assign set_select = (ICACHE_NUM_SETS == 1) ? '0 : history.to_be_replaced;
 
-    // Tag memory --------------------------------------------------------------------------------
+    // Cache Sets --------------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
-    always_ff @( posedge clk_i ) begin : tag_memory
-        if ((ctrl_en_i == 1'b1) && (ctrl_tag_we_i == 1'b1)) begin // write access
-           if (set_select == 1'b0)
-             tag_mem_s0[cache_index] <= ctrl_acc_addr.tag;
-           else
-             tag_mem_s1[cache_index] <= ctrl_acc_addr.tag;
-        end
-        /* read access (sync) */
-        tag[0] <= tag_mem_s0[cache_index];
-        tag[1] <= tag_mem_s1[cache_index];
-    end : tag_memory
+    generate
+      for (genvar s = 0; s < ICACHE_NUM_SETS; ++s) begin : cache_set
+          /* status flag memory */
+          logic [ICACHE_NUM_BLOCKS-1:0] valid_flag;
+          /* tag memory */
+          logic [cache_tag_size_c-1:0] tag_mem [0:ICACHE_NUM_BLOCKS-1];
+          /* cache data memory (32-bit data + 1-bit status) */
+          logic [31+1:0] cache_data_memory [0:cache_entries_c-1];
+
+          /* status flag memory */
+          always_ff @( posedge clk_i ) begin : status_memory
+              /* write access */
+              if (invalidate_i == 1'b1) begin // invalidate whole cache
+                  valid_flag <= '0;
+              end else if ((ctrl_en_i == 1'b1) && (set_select == s)) begin
+                  if (ctrl_invalid_i == 1'b1) begin // make current block invalid
+                      valid_flag[cache_index] <= 1'b0;
+                  end else if (ctrl_valid_i == 1'b1) begin // make current block valid
+                      valid_flag[cache_index] <= 1'b1;
+                  end
+              end
+              /* read access (sync) */
+              valid[s] <= valid_flag[cache_index];
+          end : status_memory
+
+          assign valid_cur[s] = valid_flag[cache_index];
+
+          /* tag memory */
+          always_ff @( posedge clk_i ) begin : tag_memory
+              if ((ctrl_en_i == 1'b1) && (ctrl_tag_we_i == 1'b1) && (set_select == s)) begin // write access
+                  tag_mem[cache_index] <= ctrl_acc_addr.tag;
+              end
+              /* read access (sync) */
+              tag[s] <= tag_mem[cache_index];
+          end : tag_memory
+
+          /* cache data memory */
+          always_ff @( posedge clk_i ) begin : cache_mem_access
+              if ((cache_we == 1'b1) && (set_select == s)) begin // write access from control (full-word)
+                  cache_data_memory[cache_addr] <= {ctrl_wstat_i, ctrl_wdata_i};
+              end
+              /* read access from host (full-word) */
+              cache_rd[s]  <= cache_data_memory[cache_addr];
+              /* read access from host (odd word) */
+              cache_rd2[s] <= cache_data_memory[cache_addr2];
+          end : cache_mem_access
+      end : cache_set
+    endgenerate
 
     /* comparator */
     always_comb begin : comparator
-        hit = '0;
+        hit     = '0;
+        hit_set = '0;
         // loop i
         for (int i = 0; i < ICACHE_NUM_SETS; ++i) begin
             if ((host_acc_addr.tag == tag[i]) && (valid[i] == 1'b1)) begin
-                hit[i] = 1'b1;
+                hit[i]  = 1'b1;
+                hit_set = cache_set_bits_c'(i);
             end
         end
     end : comparator
@@ -171,30 +236,23 @@ module cellrv32_icache_memory #(
     /* global hit */
     assign hit_o = (|hit == 1'b1) ? 1'b1 : 1'b0;
 
-    // Cache Data Memory -------------------------------------------------------------------------
-    // -------------------------------------------------------------------------------------------
-    always_ff @( posedge clk_i ) begin : cache_mem_access
-        if (cache_we == 1'b1) begin // write access from control (full-word)
-          if ((set_select == 1'b0) || (ICACHE_NUM_SETS == 1))
-            cache_data_memory_s0[cache_addr] <= {ctrl_wstat_i, ctrl_wdata_i};
-          else
-            cache_data_memory_s1[cache_addr] <= {ctrl_wstat_i, ctrl_wdata_i};
-        end
-        /* read access from host (full-word) */
-        cache_rd[0] <= cache_data_memory_s0[cache_addr];
-        cache_rd[1] <= cache_data_memory_s1[cache_addr];
-    end : cache_mem_access
+    /* replacement of a valid block */
+    assign evict_o = ((ctrl_en_i == 1'b1) && (ctrl_valid_i == 1'b1) && (valid_cur[set_select] == 1'b1)) ? 1'b1 : 1'b0;
 
     /* data output */
-    assign host_rdata_o = ((hit[0] == 1'b1) || (ICACHE_NUM_SETS == 1)) ? cache_rd[0][31:0] : cache_rd[1][31:0];
-    assign host_rstat_o = ((hit[0] == 1'b1) || (ICACHE_NUM_SETS == 1)) ? cache_rd[0][32]   : cache_rd[1][32];
+    assign host_rdata_o  = cache_rd[hit_set][31:0];
+    assign host_rstat_o  = cache_rd[hit_set][32];
+
+    assign host_rdata2_o = cache_rd2[hit_set][31:0];
+    assign host_rstat2_o = cache_rd2[hit_set][32];
 
     /* cache block ram access address */
-    assign cache_addr = {cache_index, cache_offset};
+    assign cache_addr  = {cache_index, cache_offset};
+    assign cache_addr2 = {cache_addr[$bits(cache_addr)-1:1], 1'b1}; // odd word of double word
 
     /* cache access select */
     assign cache_index  = (ctrl_en_i == 1'b0) ? host_acc_addr.index  : ctrl_acc_addr.index;
     assign cache_offset = (ctrl_en_i == 1'b0) ? host_acc_addr.offset : ctrl_acc_addr.offset;
     assign cache_we     = (ctrl_en_i == 1'b0) ? 1'b0                 : ctrl_we_i;
 
-endmodule
\ No newline at end of file
+endmodule
@@ -14,6 +14,9 @@ module cellrv32_sysinfo #(
     parameter int     CLOCK_FREQUENCY    = 0, // clock frequency of clk_i in Hz
     parameter logic[31:0] CUSTOM_ID          = 32'h00000000, // custom user-defined ID
     parameter logic[00:0] INT_BOOTLOADER_EN  = 1'b0, // boot configuration: true = boot explicit bootloader; false = boot from int/ext (I)MEM
+    /* Cache-block operations */
+    parameter logic   CPU_ZICBOP_EN      = 1'b0, // cache-block prefetch hints (Zicbop) implemented?
+    parameter logic   CPU_ZICBOZ_EN      = 1'b0, // cache-block zero operation (Zicboz) implemented?
     /* Physical memory protection (PMP) */
     parameter int PMP_NUM_REGIONS = 0, // number of regions (0..64)
     /* Internal Instruction memory */
@@ -26,7 +29,11 @@ module cellrv32_sysinfo #(
     parameter logic   ICACHE_EN            = 1'b0, // implement instruction cache
     parameter int ICACHE_NUM_BLOCKS    = 0, // i-cache: number of blocks (min 2), has to be a power of 2
     parameter int ICACHE_BLOCK_SIZE    = 0, // i-cache: block size in bytes (min 4), has to be a power of 2
-    parameter int ICACHE_ASSOCIATIVITY = 0, // i-cache: associativity (min 1), has to be a power 2
+    parameter int ICACHE_ASSOCIATIVITY = 0, // i-cache: associativity (1/2/4/8), has to be a power 2
+    parameter logic   DCACHE_EN            = 1'b0, // implement data cache
+    parameter int DCACHE_NUM_BLOCKS    = 0, // d-cache: number of blocks (min 2), has to be a power of 2
+    parameter int DCACHE_BLOCK_SIZE    = 0, // d-cache: block size in bytes (min 8), has to be a power of 2
+    parameter int DCACHE_ASSOCIATIVITY = 0, // d-cache: associativity (min 1), has to be a power 2
     /* External memory interface */
     parameter logic MEM_EXT_EN           = 1'b0, // implement external memory bus interface?
     parameter logic MEM_EXT_BIG_ENDIAN   = 1'b0, // byte order: true=big-endian, false=little-endian
@@ -48,7 +55,8 @@ module cellrv32_sysinfo #(
     parameter int IO_XIRQ_NUM_CH       = 0, // number of external interrupt (XIRQ) channels to implement
     parameter logic   IO_GPTMR_EN          = 1'b0, // implement general purpose timer (GPTMR)?
     parameter logic   IO_XIP_EN            = 1'b0, // implement execute in place module (XIP)?
-    parameter logic   IO_ONEWIRE_EN        = 1'b0  // implement 1-wire interface (ONEWIRE)?
+    parameter logic   IO_ONEWIRE_EN        = 1'b0, // implement 1-wire interface (ONEWIRE)?
+    parameter logic   IO_TRACE_EN          = 1'b0  // implement instruction trace buffer (TRACE)?
 ) (
     /* host access */
     input  logic        clk_i,  // global clock line
@@ -96,13 +104,15 @@ module cellrv32_sysinfo #(
     assign sysinfo[2][03] = (MEM_INT_DMEM_EN && (MEM_INT_DMEM_SIZE > 0)); // processor-internal data memory implemented?
     assign sysinfo[2][04] = MEM_EXT_BIG_ENDIAN;  // is external memory bus interface using BIG-endian byte-order?
     assign sysinfo[2][05] = ICACHE_EN;           // processor-internal instruction cache implemented?
+    assign sysinfo[2][06] = DCACHE_EN;           // processor-internal data cache implemented?
+    assign sysinfo[2][07] = CPU_ZICBOP_EN;       // cache-block prefetch hints (Zicbop) implemented?
+    assign sysinfo[2][08] = CPU_ZICBOZ_EN;       // cache-block zero operation (Zicboz) implemented?
     //
-    assign sysinfo[2][12:06] = '0; // reserved
+    assign sysinfo[2][12:09] = '0; // reserved
     /* Misc */
     assign sysinfo[2][13] = is_simulation_c;     // is this a simulation?
     assign sysinfo[2][14] = ON_CHIP_DEBUGGER_EN; // on-chip debugger implemented?
-    //
-    assign sysinfo[2][15] = 1'b0; // reserved
+    assign sysinfo[2][15] = IO_TRACE_EN;         // instruction trace buffer (TRACE) implemented?
     /* IO */
     assign sysinfo[2][16] = (IO_GPIO_NUM > 0);     // general purpose input/output port unit (GPIO) implemented?
     assign sysinfo[2][17] = IO_MTIME_EN;         // machine system timer (MTIME) implemented?
@@ -125,12 +135,13 @@ module cellrv32_sysinfo #(
     assign sysinfo[3][03 : 00] = (ICACHE_EN == 1'b1) ? 4'($clog2(ICACHE_BLOCK_SIZE))    : '0; // i-cache: log2(block_size_in_bytes)
     assign sysinfo[3][07 : 04] = (ICACHE_EN == 1'b1) ? 4'($clog2(ICACHE_NUM_BLOCKS))    : '0; // i-cache: log2(number_of_block)
     assign sysinfo[3][11 : 08] = (ICACHE_EN == 1'b1) ? 4'($clog2(ICACHE_ASSOCIATIVITY)) : '0; // i-cache: log2(associativity)
-    assign sysinfo[3][15 : 12] =  ((ICACHE_ASSOCIATIVITY > 1) && (ICACHE_EN == 1'b1)) ? 4'b0001 : '0; // i-cache: replacement strategy (LRU only (yet))
+    assign sysinfo[3][15 : 12] =  ((ICACHE_ASSOCIATIVITY > 2) && (ICACHE_EN == 1'b1)) ? 4'b0010 : // i-cache: replacement strategy (tree pseudo-LRU)
+                                  ((ICACHE_ASSOCIATIVITY > 1) && (ICACHE_EN == 1'b1)) ? 4'b0001 : '0; // i-cache: replacement strategy (LRU)
     //
-    assign sysinfo[3][19 : 16] = '0; // reserved - d-cache: log2(block_size)
-    assign sysinfo[3][23 : 20] = '0; // reserved - d-cache: log2(num_blocks)
-    assign sysinfo[3][27 : 24] = '0; // reserved - d-cache: log2(associativity)
-    assign sysinfo[3][31 : 28] = '0; // reserved - d-cache: replacement strategy
+    assign sysinfo[3][19 : 16] = (DCACHE_EN == 1'b1) ? 4'($clog2(DCACHE_BLOCK_SIZE))    : '0; // d-cache: log2(block_size_in_bytes)
+    assign sysinfo[3][23 : 20] = (DCACHE_EN == 1'b1) ? 4'($clog2(DCACHE_NUM_BLOCKS))    : '0; // d-cache: log2(number_of_block)
+    assign sysinfo[3][27 : 24] = (DCACHE_EN == 1'b1) ? 4'($clog2(DCACHE_ASSOCIATIVITY)) : '0; // d-cache: log2(associativity)
+    assign sysinfo[3][31 : 28] =  ((DCACHE_ASSOCIATIVITY > 1) && (DCACHE_EN == 1'b1)) ? 4'b0001 : '0; // d-cache: replacement strategy (LRU only (yet))
 
     /* SYSINFO(4): Base address of instruction memory space */
     assign sysinfo[4] = ispace_base_c; // defined in cellrv32_package.sv file
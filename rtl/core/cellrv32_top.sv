@@ -39,20 +39,44 @@ module cellrv32_top #(
     parameter logic CPU_EXTENSION_RISCV_M        = 1'b0,  // implement mul/div extension?
     parameter logic CPU_EXTENSION_RISCV_U        = 1'b0,  // implement user mode extension?
     parameter logic CPU_EXTENSION_RISCV_V        = 1'b0,  // implement vector extension?
+    parameter logic CPU_EXTENSION_RISCV_Zcmp     = 1'b0,  // implement compressed push/pop/move extension (requires C)?
+    parameter logic CPU_EXTENSION_RISCV_Zcmt     = 1'b0,  // implement compressed table-jump extension (requires C)?
     parameter logic CPU_EXTENSION_RISCV_Zfinx    = 1'b0,  // implement 32-bit floating-point extension (using INT regs!)
     parameter logic CPU_EXTENSION_RISCV_Zhinx    = 1'b0,  // implement 16-bit floating-point extension (using INT regs!)
     parameter logic CPU_EXTENSION_RISCV_Zicsr    = 1'b1,   // implement CSR system?
     parameter logic CPU_EXTENSION_RISCV_Zicntr   = 1'b1,   // implement base counters?
     parameter logic CPU_EXTENSION_RISCV_Zicond   = 1'b0,  // implement conditional operations extension?
+    parameter logic CPU_EXTENSION_RISCV_Zicbop   = 1'b0,  // implement cache-block prefetch hints?
+    parameter logic CPU_EXTENSION_RISCV_Zicboz   = 1'b0,  // implement cache-block zero operation?
     parameter logic CPU_EXTENSION_RISCV_Zihpm    = 1'b0,  // implement hardware performance monitors?
     parameter logic CPU_EXTENSION_RISCV_Zifencei = 1'b0,  // implement instruction stream sync.?
+    parameter logic CPU_EXTENSION_RISCV_Zkn      = 1'b0,  // implement scalar cryptography (NIST suite) extension?
     parameter logic CPU_EXTENSION_RISCV_Zmmul    = 1'b0,  // implement multiply-only M sub-extension?
     parameter logic CPU_EXTENSION_RISCV_Zxcfu    = 1'b0,  // implement custom (instr.) functions unit?
+    parameter logic CPU_EXTENSION_RISCV_Sscofpmf = 1'b0,  // implement HPM counter-overflow interrupt extension (requires Zihpm)?
 
     /* Tuning Options */
     parameter logic   FAST_MUL_EN     = 1'b0,  // use DSPs for M extension's multiplier
     parameter logic   FAST_SHIFT_EN   = 1'b0,  // use barrel shifter for shift operations
+    parameter logic   MULDIV_PERF     = 1'b0,  // pipelined DSP multiplier + radix-4 early-out divider (M extension)
+    parameter logic   FPU_PERF        = 1'b0,  // barrel-shift FPU normalizer/aligner + fused multiply-add (Zfinx)
     parameter int     CPU_IPB_ENTRIES = 1,     // entries in instruction prefetch buffer, has to be a power of 2, min 1
+    parameter logic   CPU_BP_EN          = 1'b0, // implement dynamic branch prediction (BHT + BTB)?
+    parameter int     CPU_BP_BHT_ENTRIES = 64,   // branch history table entries, has to be a power of 2, min 2
+    parameter int     CPU_BP_BTB_ENTRIES = 16,   // branch target buffer entries, has to be a power of 2, min 2
+    parameter int     CPU_BP_RAS_DEPTH   = 4,    // return address stack entries, has to be zero or a power of 2, min 2
+    parameter logic   CPU_PIPELINE_MODE  = 1'b0, // overlap dispatch and write-back of single-cycle ALU operations?
+    parameter logic   CPU_DUAL_ISSUE     = 1'b0, // issue two independent simple ALU operations at once?
+    parameter logic   CPU_FETCH_64BIT    = 1'b0, // fetch two instruction words per i-cache access (requires ICACHE_EN)?
+    parameter logic [4:0] CPU_FUSION     = 5'b00000, // macro-op fusion enable per pattern: [0] lui+addi, [1] auipc+jalr, [2] slli+srli, [3] add+load, [4] slli+add
+    parameter logic   CPU_HWLOOP         = 1'b0, // implement zero-overhead hardware loops (two nested loop contexts)?
+    parameter logic   CPU_FP16_SIMD      = 1'b0, // implement packed-SIMD 2x FP16 operations + half-precision FMA (Zhinx)?
+    parameter logic   CPU_PSIMD          = 1'b0, // implement packed-SIMD integer DSP operations (P extension subset)?
+    parameter logic   CPU_NB_LOAD        = 1'b0, // continue execution of independent instructions while a load is pending?
+    parameter int     CPU_SB_DEPTH       = 0,    // store buffer entries (posted writes), has to be zero or a power of 2
+    parameter logic   CPU_MISALIGNED     = 1'b0, // misaligned loads/stores in hardware instead of an exception?
+    parameter logic   CPU_IRQ_VECTORED   = 1'b0, // vectored interrupts with priority/preemption levels and tail-chaining?
+    parameter logic   CPU_RF_SHADOW      = 1'b0, // shadow register bank for caller-saved registers (fast interrupt entry)?
 
     /* Physical Memory Protection (PMP) */
     parameter int PMP_NUM_REGIONS     = 0,      // number of regions (0..16)
@@ -74,7 +98,14 @@ module cellrv32_top #(
     parameter logic   ICACHE_EN            = 1'b0,   // implement instruction cache
     parameter int     ICACHE_NUM_BLOCKS    = 4,      // i-cache: number of blocks (min 1), has to be a power of 2
     parameter int     ICACHE_BLOCK_SIZE    = 64,     // i-cache: block size in bytes (min 4), has to be a power of 2
-    parameter int     ICACHE_ASSOCIATIVITY = 1,      // i-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
+    parameter int     ICACHE_ASSOCIATIVITY = 1,      // i-cache: associativity / number of sets (1=direct_mapped, 2/4/8-way), has to be a power of 2
+    parameter logic   ICACHE_PREFETCH_EN   = 1'b0,   // i-cache: implement next-line prefetcher (one-block stream buffer)
+
+    /* Internal Data Cache (dCACHE) */
+    parameter logic   DCACHE_EN            = 1'b0,   // implement data cache
+    parameter int     DCACHE_NUM_BLOCKS    = 4,      // d-cache: number of blocks (min 2), has to be a power of 2
+    parameter int     DCACHE_BLOCK_SIZE    = 64,     // d-cache: block size in bytes (min 8), has to be a power of 2
+    parameter int     DCACHE_ASSOCIATIVITY = 1,      // d-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
 
     /* External memory interface (WISHBONE) */
     parameter logic   MEM_EXT_EN         = 1'b0,  // implement external memory bus interface?
@@ -115,7 +146,9 @@ module cellrv32_top #(
     parameter int     IO_NEOLED_TX_FIFO = 1,      // NEOLED FIFO depth, has to be a power of two, min 1
     parameter logic   IO_GPTMR_EN       = 1'b0,   // implement general purpose timer (GPTMR)?
     parameter logic   IO_XIP_EN         = 1'b0,   // implement execute in place module (XIP)?
-    parameter logic   IO_ONEWIRE_EN     = 1'b0    // implement 1-wire interface (ONEWIRE)?
+    parameter logic   IO_ONEWIRE_EN     = 1'b0,   // implement 1-wire interface (ONEWIRE)?
+    parameter logic   IO_TRACE_EN       = 1'b0,   // implement instruction trace encoder and trace buffer (TRACE)?
+    parameter int     IO_TRACE_DEPTH    = 1024    // trace buffer size in 32-bit words, has to be a power of two, min 16
 ) (
     /* Global control */
     input logic clk_i,  // global clock, rising edge
@@ -262,6 +295,8 @@ module cellrv32_top #(
     } bus_i_interface_t;
     //
     bus_i_interface_t cpu_i, i_cache;
+    logic [31:0]      cpu_i_rdata2; // 64-bit fetch: read data of next sequential word
+    logic             cpu_i_wide;   // 64-bit fetch: next sequential word is valid
 
     /* bus interface - data access */
     typedef struct {
@@ -274,6 +309,8 @@ module cellrv32_top #(
         logic ack;    // bus transfer acknowledge
         logic err;    // bus transfer error
         logic fence;  // fence instruction executed
+        logic flush;  // write back and invalidate data cache (vector memory access)
+        logic zero;   // write is part of a cache-block zero operation
         logic src;    // access source (1=instruction fetch, 0=data access)
         logic cached; // cached transfer
         logic priv;   // set when in privileged machine mode
@@ -281,7 +318,10 @@ module cellrv32_top #(
         logic multi_rsp;   // set when multi-cycle access response is valid
     } bus_d_interface_t;
     //
-    bus_d_interface_t cpu_d, p_bus;
+    bus_d_interface_t cpu_d, d_cache, p_bus;
+    logic             dcache_uc;   // uncached data access
+    logic             dcache_lock; // d-cache flush in progress, keep instruction fetch off the bus
+    logic             dcache_pref_uc; // prefetch hint to uncached address
     //
     logic [3:0] d_bus_req_ticket;
     logic [3:0] d_bus_resp_ticket;
@@ -327,12 +367,13 @@ module cellrv32_top #(
     enum { RESP_BUSKEEPER, RESP_IMEM, RESP_DMEM, RESP_BOOTROM, RESP_WISHBONE, RESP_GPIO,
            RESP_MTIME, RESP_UART0, RESP_UART1, RESP_SPI, RESP_TWI, RESP_PWM, RESP_WDT,
            RESP_TRNG, RESP_CFS, RESP_NEOLED, RESP_SYSINFO, RESP_OCD, RESP_XIRQ, RESP_GPTMR,
-           RESP_XIP_CT, RESP_XIP_ACC, RESP_ONEWIRE, RESP_SDI } resp_bus_id;
+           RESP_XIP_CT, RESP_XIP_ACC, RESP_ONEWIRE, RESP_SDI, RESP_TRACE } resp_bus_id;
 
     /* module response bus */
-    resp_bus_entry_t resp_bus [24]; // number of device ID is 24
+    localparam int resp_bus_num_c = RESP_TRACE + 1; // number of device IDs (last enum entry + 1)
+    resp_bus_entry_t resp_bus [resp_bus_num_c];
     // initiate default value of all element in resp_bus array
-    // for (genvar i = 0; i < 24; ++i) begin
+    // for (genvar i = 0; i < resp_bus_num_c; ++i) begin
     //     assign resp_bus[i] = resp_bus_entry_terminate_c;
     // end
 
@@ -360,6 +401,24 @@ module cellrv32_top #(
     logic       xip_enable;
     logic [3:0] xip_page;
 
+    /* SoC-level HPM events */
+    logic [hpm_ext_width_c-1:0] hpm_ext;
+    logic       icache_hit, icache_miss, icache_evict, icache_wait;
+    logic       bus_arb_wait;
+
+    /* instruction trace */
+    trace_port_t cpu_trace;
+
+    /* i-cache control (way locking, block preload) */
+    logic [7:0]  icache_lock;
+    logic [2:0]  icache_way;
+    logic        icache_fill, icache_busy, icache_hint;
+    logic [31:0] icache_fill_addr;
+
+    /* d-cache prefetch hint */
+    logic        dcache_pref;
+    logic [31:0] dcache_pref_addr;
+
     // Processor IO/Peripherals Configuration ----------------------------------------------------
     // -------------------------------------------------------------------------------------------
     initial begin
@@ -367,7 +426,7 @@ module cellrv32_top #(
         assert (1'b0) else $info("Tip: Compile application with USER_FLAGS+=-DUART[0/1]_SIM_MODE to auto-enable UART[0/1]'s simulation mode (redirect UART output to simulator console).\n");
        
         assert (1'b0) else $info(
-        "CELLRV32 PROCESSOR CONFIG NOTE: Peripherals = %S%S%S%S%S%S%S%S%S%S%S%S%S%S%S%S",
+        "CELLRV32 PROCESSOR CONFIG NOTE: Peripherals = %S%S%S%S%S%S%S%S%S%S%S%S%S%S%S%S%S",
         cond_sel_string_f((IO_GPIO_NUM > 0), "GPIO ", ""),
         cond_sel_string_f(IO_MTIME_EN, "MTIME ", ""),
         cond_sel_string_f(IO_UART0_EN, "UART0 ", ""),
@@ -383,7 +442,8 @@ module cellrv32_top #(
         cond_sel_string_f((XIRQ_NUM_CH > 0), "XIRQ ", ""),
         cond_sel_string_f(IO_GPTMR_EN, "GPTMR ", ""),
         cond_sel_string_f(IO_XIP_EN, "XIP ", ""),
-        cond_sel_string_f(IO_ONEWIRE_EN, "ONEWIRE ", ""));
+        cond_sel_string_f(IO_ONEWIRE_EN, "ONEWIRE ", ""),
+        cond_sel_string_f(IO_TRACE_EN, "TRACE ", ""));
     end
 
     // Sanity Checks -----------------------------------------------------------------------------
@@ -430,6 +490,14 @@ module cellrv32_top #(
         /* instruction cache */
         assert ((ICACHE_EN != 1'b1) || (CPU_EXTENSION_RISCV_Zifencei != 1'b0)) else
         $warning("CELLRV32 CPU CONFIG WARNING! The <CPU_EXTENSION_RISCV_Zifencei> is required to perform i-cache memory sync operations.");
+        assert ((CPU_FETCH_64BIT != 1'b1) || ((ICACHE_EN == 1'b1) && (ICACHE_BLOCK_SIZE >= 8))) else
+        $warning("CELLRV32 PROCESSOR CONFIG WARNING! <CPU_FETCH_64BIT> requires the i-cache (<ICACHE_EN>) with a block size of at least 8 bytes.");
+        assert ((ICACHE_PREFETCH_EN != 1'b1) || (ICACHE_EN == 1'b1)) else
+        $warning("CELLRV32 PROCESSOR CONFIG WARNING! <ICACHE_PREFETCH_EN> requires the i-cache (<ICACHE_EN>).");
+
+        /* data cache */
+        assert (DCACHE_EN != 1'b1) else
+        $info("CELLRV32 PROCESSOR CONFIG NOTE: Implementing write-back d-cache: processor-internal memories and the upper address page are not cached, vector memory accesses bypass the cache.");
     end
 
     // ****************************************************************************************************************************
@@ -550,21 +618,46 @@ module cellrv32_top #(
         .CPU_EXTENSION_RISCV_M       (CPU_EXTENSION_RISCV_M),        // implement mul/div extension?
         .CPU_EXTENSION_RISCV_U       (CPU_EXTENSION_RISCV_U),        // implement user mode extension?
         .CPU_EXTENSION_RISCV_V       (CPU_EXTENSION_RISCV_V),        // implement vector extension?
+        .CPU_EXTENSION_RISCV_Zcmp    (CPU_EXTENSION_RISCV_Zcmp),     // implement compressed push/pop/move extension?
+        .CPU_EXTENSION_RISCV_Zcmt    (CPU_EXTENSION_RISCV_Zcmt),     // implement compressed table-jump extension?
         .CPU_EXTENSION_RISCV_Zfinx   (CPU_EXTENSION_RISCV_Zfinx),    // implement 32-bit floating-point extension (using INT reg!)
         .CPU_EXTENSION_RISCV_Zhinx   (CPU_EXTENSION_RISCV_Zhinx),    // implement 16-bit floating-point extension (using INT reg!)
         .CPU_EXTENSION_RISCV_Zicsr   (CPU_EXTENSION_RISCV_Zicsr),    // implement CSR system?
         .CPU_EXTENSION_RISCV_Zicntr  (CPU_EXTENSION_RISCV_Zicntr),   // implement base counters?
         .CPU_EXTENSION_RISCV_Zicond  (CPU_EXTENSION_RISCV_Zicond),   // implement conditional operations extension?
+        .CPU_EXTENSION_RISCV_Zicbop  (CPU_EXTENSION_RISCV_Zicbop),   // implement cache-block prefetch hints?
+        .CPU_EXTENSION_RISCV_Zicboz  (CPU_EXTENSION_RISCV_Zicboz),   // implement cache-block zero operation?
         .CPU_EXTENSION_RISCV_Zihpm   (CPU_EXTENSION_RISCV_Zihpm),    // implement hardware performance monitors?
         .CPU_EXTENSION_RISCV_Zifencei(CPU_EXTENSION_RISCV_Zifencei), // implement instruction stream sync.?
+        .CPU_EXTENSION_RISCV_Zkn     (CPU_EXTENSION_RISCV_Zkn),      // implement scalar cryptography (NIST suite) extension?
         .CPU_EXTENSION_RISCV_Zmmul   (CPU_EXTENSION_RISCV_Zmmul),    // implement multiply-only M sub-extension?
         .CPU_EXTENSION_RISCV_Zxcfu   (CPU_EXTENSION_RISCV_Zxcfu),    // implement custom (instr.) functions unit?
         .CPU_EXTENSION_RISCV_Sdext   (ON_CHIP_DEBUGGER_EN),          // implement external debug mode extension?
         .CPU_EXTENSION_RISCV_Sdtrig  (ON_CHIP_DEBUGGER_EN),          // implement debug mode trigger module extension?
+        .CPU_EXTENSION_RISCV_Sscofpmf(CPU_EXTENSION_RISCV_Sscofpmf), // implement HPM counter-overflow interrupt extension?
         /* Extension Options */
         .FAST_MUL_EN                 (FAST_MUL_EN),                  // use DSPs for M extension's multiplier
         .FAST_SHIFT_EN               (FAST_SHIFT_EN),                // use barrel shifter for shift operations
+        .MULDIV_PERF                 (MULDIV_PERF),                  // pipelined DSP multiplier + radix-4 early-out divider
+        .FPU_PERF                    (FPU_PERF),                     // barrel-shift FPU normalizer/aligner + fused multiply-add (Zfinx)
         .CPU_IPB_ENTRIES             (CPU_IPB_ENTRIES),              // entries is instruction prefetch buffer, has to be a power of 1
+        .CPU_BP_EN                   (CPU_BP_EN),                    // implement dynamic branch prediction (BHT + BTB)?
+        .CPU_BP_BHT_ENTRIES          (CPU_BP_BHT_ENTRIES),           // branch history table entries, has to be a power of 2
+        .CPU_BP_BTB_ENTRIES          (CPU_BP_BTB_ENTRIES),           // branch target buffer entries, has to be a power of 2
+        .CPU_BP_RAS_DEPTH            (CPU_BP_RAS_DEPTH),             // return address stack entries, has to be zero or a power of 2
+        .CPU_PIPELINE_MODE           (CPU_PIPELINE_MODE),            // overlap dispatch and write-back of single-cycle ALU operations?
+        .CPU_DUAL_ISSUE              (CPU_DUAL_ISSUE),               // issue two independent simple ALU operations at once?
+        .CPU_FETCH_64BIT             (CPU_FETCH_64BIT),              // accept two instruction words per fetch (64-bit fetch path)?
+        .CPU_FUSION                  (CPU_FUSION),                   // macro-op fusion: per-pattern enable
+        .CPU_HWLOOP                  (CPU_HWLOOP),                   // implement zero-overhead hardware loops?
+        .CPU_FP16_SIMD               (CPU_FP16_SIMD),                // implement packed-SIMD 2x FP16 operations?
+        .CPU_PSIMD                   (CPU_PSIMD),                    // implement packed-SIMD integer DSP operations?
+        .CPU_NB_LOAD                 (CPU_NB_LOAD),                  // implement non-blocking loads?
+        .CPU_SB_DEPTH                (CPU_SB_DEPTH),                 // store buffer entries
+        .CPU_MISALIGNED              (CPU_MISALIGNED),               // implement hardware support for misaligned accesses?
+        .CPU_IRQ_VECTORED            (CPU_IRQ_VECTORED),             // implement vectored interrupt controller?
+        .CPU_RF_SHADOW               (CPU_RF_SHADOW),                // implement shadow register bank?
+        .CPU_ICACHE_CTRL             (ICACHE_EN),                    // implement i-cache control CSRs?
         /* Physical Memory Protection (PMP) */
         .PMP_NUM_REGIONS             (PMP_NUM_REGIONS),              // number of regions (0..16)
         .PMP_MIN_GRANULARITY         (PMP_MIN_GRANULARITY),          // minimal region granularity in bytes, has to be a power of 2, min 4 bytes
@@ -583,8 +676,20 @@ module cellrv32_top #(
         .i_bus_re_o    (cpu_i.re),    // read request
         .i_bus_ack_i   (cpu_i.ack),   // bus transfer acknowledge
         .i_bus_err_i   (cpu_i.err),   // bus transfer error
+        .i_bus_rdata2_i(cpu_i_rdata2),// bus read data of next sequential word
+        .i_bus_wide_i  (cpu_i_wide),  // next sequential word is valid
         .i_bus_fence_o (cpu_i.fence), // executed FENCEI operation
         .i_bus_priv_o  (cpu_i.priv),  // current effective privilege level
+        /* i-cache control */
+        .ic_lock_o     (icache_lock),      // locked ways
+        .ic_way_o      (icache_way),       // preload target way
+        .ic_fill_o     (icache_fill),      // block preload request
+        .ic_fill_addr_o(icache_fill_addr), // preload address
+        .ic_busy_i     (icache_busy),      // block preload pending
+        .ic_hint_o     (icache_hint),      // preload is a prefetch hint
+        /* d-cache prefetch hint */
+        .dc_pref_o     (dcache_pref),      // prefetch.r/prefetch.w hint
+        .dc_pref_addr_o(dcache_pref_addr), // hint address
         /* data bus interface */
         .d_bus_addr_o  (cpu_d.addr),  // bus access address
         .d_bus_rdata_i (cpu_d.rdata), // bus read data
@@ -595,6 +700,8 @@ module cellrv32_top #(
         .d_bus_ack_i   (cpu_d.ack),   // bus transfer acknowledge
         .d_bus_err_i   (cpu_d.err),   // bus transfer error
         .d_bus_fence_o (cpu_d.fence), // executed FENCE operation
+        .d_bus_flush_o (cpu_d.flush), // write back and invalidate d-cache
+        .d_bus_zero_o  (cpu_d.zero),  // cache-block zero write
         .d_bus_priv_o  (cpu_d.priv),  // current effective privilege level
         .d_bus_multi_en_o (cpu_d.multi_en), // multi-cycle access in progress
         .d_bus_multi_rsp_i   (cpu_d.multi_rsp),   // multi-cycle access response valid
@@ -606,15 +713,27 @@ module cellrv32_top #(
         .mtime_irq_i   (mtime_irq),   // machine timer interrupt
         /* fast interrupts (custom) */
         .firq_i        (fast_irq),    // fast interrupt trigger
+        /* SoC-level HPM events */
+        .hpm_ext_i     (hpm_ext),     // cache/bus switch/XIP events
+        /* instruction trace */
+        .trace_o       (cpu_trace),   // retired branches, jumps and traps
         /* debug mode (halt) request */
         .db_halt_req_i (dci_halt_req)
     );
 
+    /* SoC-level HPM events */
+    assign hpm_ext[hpm_ext_ic_hit_c]  = icache_hit;
+    assign hpm_ext[hpm_ext_ic_miss_c] = icache_miss;
+    assign hpm_ext[hpm_ext_arb_c]     = bus_arb_wait;
+    assign hpm_ext[hpm_ext_xip_c]     = xip_access;
+    assign hpm_ext[hpm_ext_ic_evict_c] = icache_evict;
+    assign hpm_ext[hpm_ext_ic_wait_c]  = icache_wait;
+
     /* misc */
     assign cpu_i.src    = 1'b1; // initialized but unused
     assign cpu_d.src    = 1'b0; // initialized but unused
     assign cpu_i.cached = 1'b0; // initialized but unused
-    assign cpu_d.cached = 1'b0; // no data cache available yet
+    assign cpu_d.cached = 1'b0; // initialized but unused
 
     /* advanced memory control */
     assign fence_o  = cpu_d.fence; // indicates an executed FENCE operation
@@ -656,19 +775,32 @@ module cellrv32_top #(
             cellrv32_icache #(
                 .ICACHE_NUM_BLOCKS (ICACHE_NUM_BLOCKS),   // number of blocks (min 2), has to be a power of 2
                 .ICACHE_BLOCK_SIZE (ICACHE_BLOCK_SIZE),   // block size in bytes (min 4), has to be a power of 2
-                .ICACHE_NUM_SETS   (ICACHE_ASSOCIATIVITY) // associativity / number of sets (1=direct_mapped), has to be a power of 2
+                .ICACHE_NUM_SETS   (ICACHE_ASSOCIATIVITY), // associativity / number of sets (1=direct_mapped), has to be a power of 2
+                .ICACHE_PREFETCH   (ICACHE_PREFETCH_EN)    // implement next-line prefetcher
             ) cellrv32_icache_inst (
                 /* global control */
                 .clk_i        (clk_i),          // global clock, rising edge
                 .rstn_i       (rstn_int),       // global reset, low-active, async
                 .clear_i      (cpu_i.fence),    // cache clear
-                .miss_o       (    ),           // cache miss
+                .miss_o       (icache_miss),    // cache miss
+                .hit_o        (icache_hit),     // cache hit
+                .evict_o      (icache_evict),   // valid block replaced
+                .wait_o       (icache_wait),    // host waiting for miss handling
+                /* way locking / block preload */
+                .lock_i       (icache_lock),      // locked ways
+                .fill_way_i   (icache_way),       // target way of block preload
+                .fill_i       (icache_fill),      // request block preload
+                .fill_addr_i  (icache_fill_addr), // preload address
+                .hint_i       (icache_hint),      // preload is a prefetch hint
+                .fill_busy_o  (icache_busy),      // block preload pending
                 /* host controller interface */
                 .host_addr_i  (cpu_i.addr),     // bus access address
                 .host_rdata_o (cpu_i.rdata),    // bus read data
                 .host_re_i    (cpu_i.re),       // read enable
                 .host_ack_o   (cpu_i.ack),      // bus transfer acknowledge
                 .host_err_o   (cpu_i.err),      // bus transfer error
+                .host_rdata2_o(cpu_i_rdata2),   // bus read data of next sequential word
+                .host_wide_o  (cpu_i_wide),     // next sequential word is valid
                 /* peripheral bus interface */
                 .bus_cached_o (i_cache.cached), // set if cached (!) access in progress
                 .bus_addr_o   (i_cache.addr),   // bus access address
@@ -692,6 +824,13 @@ module cellrv32_top #(
             assign cpu_i.err      = i_cache.err;
             assign i_cache.cached = 1'b0; // single transfer (uncached)
             assign i_cache.priv   = cpu_i.priv;
+            assign cpu_i_rdata2   = '0;   // no 64-bit fetch without i-cache
+            assign cpu_i_wide     = 1'b0;
+            assign icache_hit     = 1'b0;
+            assign icache_miss    = 1'b0;
+            assign icache_evict   = 1'b0;
+            assign icache_wait    = 1'b0;
+            assign icache_busy    = 1'b0;
         end : cellrv32_icache_inst_OFF
     endgenerate
 
@@ -701,7 +840,83 @@ module cellrv32_top #(
 
     // CPU Data Cache ----------------------------------------------------------------------------
     // -------------------------------------------------------------------------------------------
-    // <to be define>
+    generate
+        if (DCACHE_EN == 1'b1) begin : cellrv32_dcache_inst_ON
+            cellrv32_dcache #(
+                .DCACHE_NUM_BLOCKS (DCACHE_NUM_BLOCKS),   // number of blocks (min 2), has to be a power of 2
+                .DCACHE_BLOCK_SIZE (DCACHE_BLOCK_SIZE),   // block size in bytes (min 8), has to be a power of 2
+                .DCACHE_NUM_SETS   (DCACHE_ASSOCIATIVITY) // associativity / number of sets (1=direct_mapped), has to be a power of 2
+            ) cellrv32_dcache_inst (
+                /* global control */
+                .clk_i            (clk_i),                      // global clock, rising edge
+                .rstn_i           (rstn_int),                   // global reset, low-active, async
+                .clear_i          (cpu_d.fence | cpu_i.fence | cpu_d.flush), // write back and invalidate
+                .lock_o           (dcache_lock),                // flush in progress
+                /* prefetch hint */
+                .pref_i           (dcache_pref & (~dcache_pref_uc)), // prefetch hint (cacheable addresses only)
+                .pref_addr_i      (dcache_pref_addr),           // hint address
+                /* host controller interface */
+                .host_uc_i        (dcache_uc),                  // uncached access
+                .host_zero_i      (cpu_d.zero),                 // cache-block zero write: allocate without refill
+                .host_addr_i      (cpu_d.addr),                 // bus access address
+                .host_rdata_o     (cpu_d.rdata),                // bus read data
+                .host_wdata_i     (cpu_d.wdata),                // bus write data
+                .host_ben_i       (cpu_d.ben),                  // byte enable
+                .host_we_i        (cpu_d.we),                   // write enable
+                .host_re_i        (cpu_d.re),                   // read enable
+                .host_ack_o       (cpu_d.ack),                  // bus transfer acknowledge
+                .host_err_o       (cpu_d.err),                  // bus transfer error
+                .host_multi_en_i  (cpu_d.multi_en),             // multi-cycle access in progress
+                .host_multi_rsp_o (cpu_d.multi_rsp),            // multi-cycle access response valid
+                /* peripheral bus interface */
+                .bus_cached_o     (d_cache.cached),             // set if cached (!) access in progress
+                .bus_addr_o       (d_cache.addr),               // bus access address
+                .bus_rdata_i      (d_cache.rdata),              // bus read data
+                .bus_wdata_o      (d_cache.wdata),              // bus write data
+                .bus_ben_o        (d_cache.ben),                // byte enable
+                .bus_we_o         (d_cache.we),                 // write enable
+                .bus_re_o         (d_cache.re),                 // read enable
+                .bus_ack_i        (d_cache.ack),                // bus transfer acknowledge
+                .bus_err_i        (d_cache.err),                // bus transfer error
+                .bus_multi_en_o   (d_cache.multi_en),           // multi-cycle access in progress
+                .bus_multi_rsp_i  (d_cache.multi_rsp)           // multi-cycle access response valid
+            );
+
+            /* uncached: processor-internal memories and the upper address page (bootloader ROM, OCD, IO devices) */
+            assign dcache_uc = (cpu_d.addr[31:28] == dcache_uc_page_c) ||
+                               ((MEM_INT_IMEM_EN == 1'b1) && (cpu_d.addr[31:$clog2(MEM_INT_IMEM_SIZE)] == imem_base_c[31:$clog2(MEM_INT_IMEM_SIZE)])) ||
+                               ((MEM_INT_DMEM_EN == 1'b1) && (cpu_d.addr[31:$clog2(MEM_INT_DMEM_SIZE)] == dmem_base_c[31:$clog2(MEM_INT_DMEM_SIZE)]));
+
+            /* prefetch hints are only forwarded for cacheable addresses */
+            assign dcache_pref_uc = (dcache_pref_addr[31:28] == dcache_uc_page_c) ||
+                                    ((MEM_INT_IMEM_EN == 1'b1) && (dcache_pref_addr[31:$clog2(MEM_INT_IMEM_SIZE)] == imem_base_c[31:$clog2(MEM_INT_IMEM_SIZE)])) ||
+                                    ((MEM_INT_DMEM_EN == 1'b1) && (dcache_pref_addr[31:$clog2(MEM_INT_DMEM_SIZE)] == dmem_base_c[31:$clog2(MEM_INT_DMEM_SIZE)]));
+        end : cellrv32_dcache_inst_ON
+    endgenerate
+
+    generate
+        if (DCACHE_EN == 1'b0) begin : cellrv32_dcache_inst_OFF
+            assign d_cache.addr     = cpu_d.addr;
+            assign cpu_d.rdata      = d_cache.rdata;
+            assign d_cache.wdata    = cpu_d.wdata;
+            assign d_cache.ben      = cpu_d.ben;
+            assign d_cache.we       = cpu_d.we;
+            assign d_cache.re       = cpu_d.re;
+            assign cpu_d.ack        = d_cache.ack;
+            assign cpu_d.err        = d_cache.err;
+            assign d_cache.multi_en = cpu_d.multi_en;
+            assign cpu_d.multi_rsp  = d_cache.multi_rsp;
+            assign d_cache.cached   = 1'b0; // single transfer (uncached)
+            assign dcache_uc        = 1'b1;
+            assign dcache_lock      = 1'b0;
+            assign dcache_pref_uc   = 1'b1; // prefetch.r/prefetch.w are no-ops
+        end : cellrv32_dcache_inst_OFF
+    endgenerate
+
+    /* yet unused */
+    assign d_cache.priv  = cpu_d.priv;
+    assign d_cache.fence = cpu_d.fence;
+    assign d_cache.src   = 1'b0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     //                                                                                                                         //
@@ -724,18 +939,19 @@ module cellrv32_top #(
         .clk_i           (clk_i),          // global clock, rising edge
         .rstn_i          (rstn_int),       // global reset, low-active, async
         /* controller interface a */
-        .ca_bus_priv_i   (cpu_d.priv),     // current privilege level
-        .ca_bus_cached_i (cpu_d.cached),   // set if cached transfer
-        .ca_bus_addr_i   (cpu_d.addr),     // bus access address
-        .ca_bus_rdata_o  (cpu_d.rdata),    // bus read data
-        .ca_bus_wdata_i  (cpu_d.wdata),    // bus write data
-        .ca_bus_ben_i    (cpu_d.ben),      // byte enable
-        .ca_bus_we_i     (cpu_d.we),       // write enable
-        .ca_bus_re_i     (cpu_d.re),       // read enable
-        .ca_bus_ack_o    (cpu_d.ack),      // bus transfer acknowledge
-        .ca_bus_err_o    (cpu_d.err),      // bus transfer error
-        .ca_bus_multi_en_i (cpu_d.multi_en),       // multi-cycle transfer indicator
-        .ca_bus_multi_rsp_o (cpu_d.multi_rsp),       // multi-cycle transfer response
+        .ca_bus_priv_i   (d_cache.priv),     // current privilege level
+        .ca_bus_cached_i (d_cache.cached),   // set if cached transfer
+        .ca_bus_addr_i   (d_cache.addr),     // bus access address
+        .ca_bus_rdata_o  (d_cache.rdata),    // bus read data
+        .ca_bus_wdata_i  (d_cache.wdata),    // bus write data
+        .ca_bus_ben_i    (d_cache.ben),      // byte enable
+        .ca_bus_we_i     (d_cache.we),       // write enable
+        .ca_bus_re_i     (d_cache.re),       // read enable
+        .ca_bus_ack_o    (d_cache.ack),      // bus transfer acknowledge
+        .ca_bus_err_o    (d_cache.err),      // bus transfer error
+        .ca_bus_multi_en_i (d_cache.multi_en),       // multi-cycle transfer indicator
+        .ca_bus_multi_rsp_o (d_cache.multi_rsp),       // multi-cycle transfer response
+        .ca_bus_lock_i   (dcache_lock),      // port B must not be granted
         /* controller interface b */
         .cb_bus_priv_i   (i_cache.priv),   // current privilege level
         .cb_bus_cached_i (i_cache.cached), // set if cached transfer
@@ -758,7 +974,9 @@ module cellrv32_top #(
         .p_bus_we_o      (p_bus.we),       // write enable
         .p_bus_re_o      (p_bus.re),       // read enable
         .p_bus_ack_i     (p_bus.ack),      // bus transfer acknowledge
-        .p_bus_err_i     (bus_error)       // bus transfer error
+        .p_bus_err_i     (bus_error),      // bus transfer error
+        /* status */
+        .arb_wait_o      (bus_arb_wait)    // controller port waiting for the other port (HPM)
     );
 
     /* any fence operation? */
@@ -1601,6 +1819,36 @@ module cellrv32_top #(
         end : cellrv32_onewire_inst_OFF
     endgenerate
 
+    // Instruction Trace Encoder and Trace Buffer (TRACE) ----------------------------------------
+    // -------------------------------------------------------------------------------------------
+    generate
+        if (IO_TRACE_EN == 1'b1) begin : cellrv32_trace_inst_ON
+            cellrv32_trace #(
+                .TRACE_DEPTH (IO_TRACE_DEPTH)              // trace RAM size in 32-bit words
+            ) cellrv32_trace_inst (
+                /* host access */
+                .clk_i       (clk_i),                      // global clock line
+                .rstn_i      (rstn_int),                   // global reset line, low-active, async
+                .addr_i      (p_bus.addr),                 // address
+                .rden_i      (io_rden),                    // read enable
+                .wren_i      (io_wren),                    // write enable
+                .data_i      (p_bus.wdata),                // data in
+                .data_o      (resp_bus[RESP_TRACE].rdata), // data out
+                .ack_o       (resp_bus[RESP_TRACE].ack),   // transfer acknowledge
+                /* trace port */
+                .trace_i     (cpu_trace)                   // CPU instruction trace port
+            );
+            // no access error possible
+            assign resp_bus[RESP_TRACE].err = 1'b0; 
+        end : cellrv32_trace_inst_ON
+    endgenerate
+
+    generate
+        if (IO_TRACE_EN == 1'b0) begin : cellrv32_trace_inst_OFF
+            assign resp_bus[RESP_TRACE] = resp_bus_entry_terminate_c;
+        end : cellrv32_trace_inst_OFF
+    endgenerate
+
     // System Configuration Information Memory (SYSINFO) -----------------------------------------
     // -------------------------------------------------------------------------------------------
     cellrv32_sysinfo #(
@@ -1608,6 +1856,9 @@ module cellrv32_top #(
         .CLOCK_FREQUENCY      (CLOCK_FREQUENCY),      // clock frequency of clk_i in Hz
         .CUSTOM_ID            (CUSTOM_ID),            // custom user-defined ID
         .INT_BOOTLOADER_EN    (INT_BOOTLOADER_EN),    // implement processor-internal bootloader?
+        /* Cache-block operations */
+        .CPU_ZICBOP_EN        (CPU_EXTENSION_RISCV_Zicbop), // cache-block prefetch hints implemented?
+        .CPU_ZICBOZ_EN        (CPU_EXTENSION_RISCV_Zicboz), // cache-block zero operation implemented?
         /* Physical memory protection (PMP) */
         .PMP_NUM_REGIONS      (PMP_NUM_REGIONS),      // number of regions (0..16)
         /* internal Instruction memory */
@@ -1621,6 +1872,10 @@ module cellrv32_top #(
         .ICACHE_NUM_BLOCKS    (ICACHE_NUM_BLOCKS),    // i-cache: number of blocks (min 2), has to be a power of 2
         .ICACHE_BLOCK_SIZE    (ICACHE_BLOCK_SIZE),    // i-cache: block size in bytes (min 4), has to be a power of 2
         .ICACHE_ASSOCIATIVITY (ICACHE_ASSOCIATIVITY), // i-cache: associativity (min 1), has to be a power 2
+        .DCACHE_EN            (DCACHE_EN),            // implement data cache
+        .DCACHE_NUM_BLOCKS    (DCACHE_NUM_BLOCKS),    // d-cache: number of blocks (min 2), has to be a power of 2
+        .DCACHE_BLOCK_SIZE    (DCACHE_BLOCK_SIZE),    // d-cache: block size in bytes (min 8), has to be a power of 2
+        .DCACHE_ASSOCIATIVITY (DCACHE_ASSOCIATIVITY), // d-cache: associativity (min 1), has to be a power 2
         /* External memory interface */
         .MEM_EXT_EN           (MEM_EXT_EN),           // implement external memory bus interface?
         .MEM_EXT_BIG_ENDIAN   (MEM_EXT_BIG_ENDIAN),   // byte order: true=big-endian, false=little-endian
@@ -1642,7 +1897,8 @@ module cellrv32_top #(
         .IO_XIRQ_NUM_CH       (XIRQ_NUM_CH),          // number of external interrupt (XIRQ) channels to implement
         .IO_GPTMR_EN          (IO_GPTMR_EN),          // implement general purpose timer (GPTMR)?
         .IO_XIP_EN            (IO_XIP_EN),            // implement execute in place module (XIP)?
-        .IO_ONEWIRE_EN        (IO_ONEWIRE_EN)         // implement 1-wire interface (ONEWIRE)?
+        .IO_ONEWIRE_EN        (IO_ONEWIRE_EN),        // implement 1-wire interface (ONEWIRE)?
+        .IO_TRACE_EN          (IO_TRACE_EN)           // implement instruction trace buffer (TRACE)?
     ) cellrv32_sysinfo_inst (
         /* host access */
         .clk_i  (clk_i),                        // global clock line
@@ -0,0 +1,390 @@
+// ##################################################################################################
+// # << CELLRV32 - Instruction Trace Encoder and Trace Buffer (TRACE) >>                            #
+// # ********************************************************************************************** #
+// # Non-intrusive branch trace (E-Trace-like): only control-flow information that cannot be        #
+// # inferred from the program image is recorded. Outcomes of conditional branches are collected in #
+// # compressed branch-map packets (one bit per branch). Uninferable discontinuities (indirect       #
+// # jumps, hardware loop wraps, trap entry and trap return) emit address packets carrying source   #
+// # and target address plus the number of clock cycles since the previous timed packet.            #
+// # Packets are stored in an on-chip trace RAM that operates as circular buffer or stops when it   #
+// # is full. The buffer is read through a memory-mapped pointer/data window (also accessible by    #
+// # the on-chip debugger via system bus accesses). See sw/trace_dec for the host-side decoder.     #
+// # In circular mode the start pointer (WPTR register, upper half) always points to the header of  #
+// # the oldest complete packet, so a wrapped buffer can be read from a packet boundary.            #
+// # ********************************************************************************************** #
+`ifndef  _INCL_DEFINITIONS
+  `define _INCL_DEFINITIONS
+  import cellrv32_package::*;
+`endif // _INCL_DEFINITIONS
+
+module cellrv32_trace #(
+    parameter int TRACE_DEPTH = 1024 // trace RAM size in 32-bit words, has to be a power of two, min 16
+) (
+    /* host access */
+    input  logic        clk_i,   // global clock line
+    input  logic        rstn_i,  // global reset line, low-active, async
+    input  logic [31:0] addr_i,  // address
+    input  logic        rden_i,  // read enable
+    input  logic        wren_i,  // write enable
+    input  logic [31:0] data_i,  // data in
+    output logic [31:0] data_o,  // data out
+    output logic        ack_o,   // transfer acknowledge
+    /* trace port */
+    input  trace_port_t trace_i  // CPU instruction trace port
+);
+    /* IO space: module base address */
+    localparam int hi_abb_c = $clog2(io_size_c)-1; // high address boundary bit
+    localparam int lo_abb_c = $clog2(trace_size_c); // low address boundary bit
+
+    /* trace RAM */
+    localparam int ram_abits_c = $clog2(TRACE_DEPTH);
+
+    /* control register */
+    localparam int ctrl_en_c     =  0; // r/w: trace enable
+    localparam int ctrl_mode_c   =  1; // r/w: buffer mode (0=circular, 1=stop when full)
+    localparam int ctrl_clr_c    =  2; // -/w: clear trace buffer, auto-clears
+    //
+    localparam int ctrl_wrap_c   =  8; // r/-: circular buffer has wrapped around
+    localparam int ctrl_full_c   =  9; // r/-: buffer is full, recording stopped
+    localparam int ctrl_lost_c   = 10; // r/-: packets were lost (encoder FIFO overflow)
+    localparam int ctrl_busy_c   = 11; // r/-: packets pending in encoder FIFO
+    //
+    localparam int ctrl_depth0_c = 16; // r/-: log2(trace RAM size in words), LSB
+    localparam int ctrl_depth4_c = 20; // r/-: log2(trace RAM size in words), MSB
+
+    /* branch map packet capacity */
+    localparam int bmap_size_c = 25;
+
+    /* access control */
+    logic        acc_en; // module access enable
+    logic [31:0] addr;   // access address
+    logic        wren;   // word write enable
+    logic        rden;   // read enable
+
+    /* control */
+    typedef struct {
+        logic en;     // trace enable
+        logic mode;   // buffer mode
+        logic clr;    // clear buffer (one cycle)
+        logic en_ff;  // enable edge detector
+        logic wrap;   // buffer has wrapped around
+        logic full;   // buffer full
+        logic lost;   // packets dropped
+        logic resync; // next address packet has to be a sync point
+    } ctrl_t;
+    //
+    ctrl_t ctrl;
+
+    /* encoder */
+    typedef struct {
+        logic [4:0]             cnt;        // number of recorded branches
+        logic [bmap_size_c-1:0] bits;       // taken flags
+        logic [4:0]             cnt_nxt;
+        logic [bmap_size_c-1:0] bits_nxt;
+        logic [19:0]            delta;      // clock cycles since last timed packet
+        logic                   ev_addr;    // address packet required
+        logic                   ev_br;      // branch map update
+        logic                   ev_time;    // time packet required
+        logic                   flush;      // branch map packet required
+        logic [1:0]             atype;      // address packet type
+        logic                   push;       // push single entry
+        logic                   push2;      // push two entries
+        logic                   drop;       // no space left in FIFO
+    } enc_t;
+    //
+    enc_t enc;
+
+    /* encoder FIFO: {number of words - 1, word 0, word 1, word 2} */
+    typedef struct {
+        logic [97:0] wdata, wdata2, rdata;
+        logic        we, we2, re, clear;
+        logic        free, free2, avail;
+    } fifo_t;
+    //
+    fifo_t fifo;
+    logic [97:0] pkt_bmap, pkt_addr, pkt_time;
+
+    /* trace RAM */
+    typedef struct {
+        logic [1:0]             idx;   // word index within current packet
+        logic [31:0]            wdata; // write data
+        logic                   we;    // write enable
+        logic [ram_abits_c-1:0] wptr;  // write pointer
+        logic [ram_abits_c-1:0] rptr;  // read pointer
+        logic [ram_abits_c-1:0] sptr;  // start pointer: header of oldest complete packet
+        logic [1:0]             slen;  // number of words - 1 of oldest packet
+        logic [31:0]            rdata; // read data
+    } buf_t;
+    //
+    buf_t trc_buf;
+    logic [31:0] trace_ram [0:TRACE_DEPTH-1];
+    logic [1:0]  trace_len [0:TRACE_DEPTH-1]; // packet size, only valid for header words
+
+    // Sanity Checks -----------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    initial begin
+        assert (((1 << ram_abits_c) == TRACE_DEPTH) && (TRACE_DEPTH >= 16) && (TRACE_DEPTH <= 32768)) else
+        $error("CELLRV32 PROCESSOR CONFIG ERROR: TRACE buffer depth has to be a power of two (16..32768).");
+    end
+
+    // Host Access -------------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    /* write access */
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : write_access
+        if (rstn_i == 1'b0) begin
+            ctrl.en   <= 1'b0;
+            ctrl.mode <= 1'b0;
+            ctrl.clr  <= 1'b0;
+        end else begin
+            ctrl.clr <= 1'b0; // default
+            //
+            if ((wren == 1'b1) && (addr == trace_ctrl_addr_c)) begin
+                ctrl.en   <= data_i[ctrl_en_c];
+                ctrl.mode <= data_i[ctrl_mode_c];
+                ctrl.clr  <= data_i[ctrl_clr_c];
+            end
+        end
+    end : write_access
+
+    /* read access */
+    always_ff @( posedge clk_i ) begin : read_access
+        ack_o  <= rden | wren; // bus access acknowledge
+        data_o <= '0;
+        //
+        if (rden == 1'b1) begin
+            unique case (addr[3:2])
+                // control register
+                2'b00 : begin
+                    data_o[ctrl_en_c]   <= ctrl.en;
+                    data_o[ctrl_mode_c] <= ctrl.mode;
+                    data_o[ctrl_wrap_c] <= ctrl.wrap;
+                    data_o[ctrl_full_c] <= ctrl.full;
+                    data_o[ctrl_lost_c] <= ctrl.lost;
+                    data_o[ctrl_busy_c] <= fifo.avail;
+                    data_o[ctrl_depth4_c : ctrl_depth0_c] <= 5'(ram_abits_c);
+                end
+                // write pointer and start pointer
+                2'b01 : begin
+                    data_o[ram_abits_c-1:0]  <= trc_buf.wptr;
+                    data_o[16 +: ram_abits_c] <= trc_buf.sptr;
+                end
+                // read pointer
+                2'b10 : begin
+                    data_o[ram_abits_c-1:0] <= trc_buf.rptr;
+                end
+                // trace data
+                default: begin
+                    data_o <= trc_buf.rdata;
+                end
+            endcase
+        end
+    end : read_access
+
+    /* access control */
+    assign acc_en = (addr_i[hi_abb_c : lo_abb_c] == trace_base_c[hi_abb_c : lo_abb_c]) ? 1'b1 : 1'b0;
+    assign addr   = {trace_base_c[31 : lo_abb_c], addr_i[lo_abb_c-1 : 2], 2'b00}; // word aligned
+    assign wren   = acc_en & wren_i;
+    assign rden   = acc_en & rden_i;
+
+    // Trace Encoder -----------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    always_comb begin : encoder_comb
+        /* address packet type */
+        if (trace_i.trap == 1'b1) begin
+            enc.atype = trace_addr_trap_c;
+        end else if (trace_i.tret == 1'b1) begin
+            enc.atype = trace_addr_tret_c;
+        end else if (trace_i.jmp == 1'b1) begin
+            enc.atype = trace_addr_jmp_c;
+        end else begin
+            enc.atype = trace_addr_br_c;
+        end
+        /* events */
+        enc.ev_addr = ctrl.en & (trace_i.trap | trace_i.tret | trace_i.jmp | (trace_i.br & ctrl.resync));
+        enc.ev_br   = ctrl.en & trace_i.br & (~ctrl.resync);
+        enc.ev_time = ctrl.en & (&enc.delta) & (~enc.ev_addr);
+        /* branch map update */
+        enc.cnt_nxt  = enc.cnt;
+        enc.bits_nxt = enc.bits;
+        if (enc.ev_br == 1'b1) begin
+            enc.bits_nxt[enc.cnt] = trace_i.taken;
+            enc.cnt_nxt           = enc.cnt + 1'b1;
+        end
+        /* branch map has to be written before an address packet, when full or when tracing stops */
+        enc.flush = ((enc.ev_addr == 1'b1) && (enc.cnt != '0)) ||
+                    ((enc.ev_br == 1'b1) && (enc.cnt_nxt == 5'(bmap_size_c))) ||
+                    ((ctrl.en == 1'b0) && (ctrl.en_ff == 1'b1) && (enc.cnt != '0));
+        /* FIFO push */
+        enc.push2 = enc.flush & (enc.ev_addr | enc.ev_time);
+        enc.push  = enc.flush | enc.ev_addr | enc.ev_time;
+        enc.drop  = (enc.push2 == 1'b1) ? (~fifo.free2) : (enc.push & (~fifo.free));
+    end : encoder_comb
+
+    /* packets */
+    assign pkt_bmap = {2'd0, trace_pkt_bmap_c, enc.cnt_nxt, enc.bits_nxt, 64'h0};
+    assign pkt_addr = {2'd2, trace_pkt_addr_c, ctrl.resync, enc.atype, trace_i.cause, enc.delta, trace_i.src, trace_i.tgt};
+    assign pkt_time = {2'd0, trace_pkt_time_c, 10'h0, enc.delta, 64'h0};
+
+    /* FIFO write */
+    assign fifo.clear  = ctrl.clr;
+    assign fifo.wdata  = (enc.flush == 1'b1) ? pkt_bmap : ((enc.ev_addr == 1'b1) ? pkt_addr : pkt_time);
+    assign fifo.wdata2 = (enc.ev_addr == 1'b1) ? pkt_addr : pkt_time;
+    assign fifo.we     = enc.push & (~enc.drop);
+    assign fifo.we2    = enc.push2 & (~enc.drop);
+
+    /* encoder state */
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : encoder_sync
+        if (rstn_i == 1'b0) begin
+            ctrl.en_ff  <= 1'b0;
+            ctrl.resync <= 1'b1;
+            ctrl.lost   <= 1'b0;
+            enc.cnt     <= '0;
+            enc.bits    <= '0;
+            enc.delta   <= '0;
+        end else begin
+            ctrl.en_ff <= ctrl.en;
+            //
+            if (ctrl.clr == 1'b1) begin
+                ctrl.resync <= 1'b1;
+                ctrl.lost   <= 1'b0;
+                enc.cnt     <= '0;
+                enc.bits    <= '0;
+                enc.delta   <= '0;
+            end else if (enc.drop == 1'b1) begin // FIFO overflow: discard branch history and re-sync
+                ctrl.resync <= 1'b1;
+                ctrl.lost   <= 1'b1;
+                enc.cnt     <= '0;
+                enc.bits    <= '0;
+                enc.delta   <= (&enc.delta) ? enc.delta : (enc.delta + 1'b1); // saturate
+            end else begin
+                /* (re-)start tracing with a sync point */
+                if ((ctrl.en == 1'b1) && (ctrl.en_ff == 1'b0)) begin
+                    ctrl.resync <= 1'b1;
+                    enc.delta   <= '0;
+                end else if (enc.ev_addr == 1'b1) begin
+                    ctrl.resync <= 1'b0;
+                end
+                /* branch map */
+                if (enc.flush == 1'b1) begin
+                    enc.cnt  <= '0;
+                    enc.bits <= '0;
+                end else begin
+                    enc.cnt  <= enc.cnt_nxt;
+                    enc.bits <= enc.bits_nxt;
+                end
+                /* cycle counter */
+                if ((enc.ev_addr == 1'b1) || (enc.ev_time == 1'b1)) begin
+                    enc.delta <= 20'd1;
+                end else if (ctrl.en == 1'b1) begin
+                    enc.delta <= enc.delta + 1'b1;
+                end
+            end
+        end
+    end : encoder_sync
+
+    /* encoder FIFO */
+    cellrv32_fifo #(
+        .FIFO_DEPTH(4),     // number of fifo entries; has to be a power of two; min 1
+        .FIFO_WIDTH(98),    // size of data elements in fifo
+        .FIFO_RSYNC(1'b0),  // async read
+        .FIFO_SAFE(1'b1),   // safe access
+        .FIFO_GATE(1'b0),   // no output gate required
+        .FIFO_WR2(1'b1)     // branch map and address packet at once
+    ) encoder_fifo_inst (
+        /* control */
+        .clk_i(clk_i),          // clock, rising edge
+        .rstn_i(rstn_i),        // async reset, low-active
+        .clear_i(fifo.clear),   // sync reset, high-active
+        .half_o(),              // FIFO at least half-full
+        /* write port */
+        .wdata_i(fifo.wdata),   // write data
+        .we_i(fifo.we),         // write enable
+        .free_o(fifo.free),     // at least one entry is free when set
+        .wdata2_i(fifo.wdata2), // write data of next entry
+        .we2_i(fifo.we2),       // write two entries at once
+        .free2_o(fifo.free2),   // at least two entries are free when set
+        /* read port */
+        .re_i(fifo.re),         // read enable
+        .rdata_o(fifo.rdata),   // read data
+        .avail_o(fifo.avail),   // data available when set
+        .re2_i(1'b0),           // read two entries at once
+        .rdata2_o(),            // read data of next entry
+        .avail2_o()             // at least two entries available when set
+    );
+
+    // Trace Buffer ------------------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------
+    /* packet serializer: one word per cycle */
+    always_comb begin : serializer
+        unique case (trc_buf.idx)
+            2'b00  : trc_buf.wdata = fifo.rdata[95:64];
+            2'b01  : trc_buf.wdata = fifo.rdata[63:32];
+            default: trc_buf.wdata = fifo.rdata[31:00];
+        endcase
+        trc_buf.we = fifo.avail & (~ctrl.full);
+        fifo.re    = fifo.avail & ((trc_buf.idx == fifo.rdata[97:96]) | ctrl.full); // packet done or buffer full (discard)
+    end : serializer
+
+    /* buffer pointers and status */
+    always_ff @( posedge clk_i or negedge rstn_i ) begin : buffer_ctrl
+        if (rstn_i == 1'b0) begin
+            trc_buf.idx  <= '0;
+            trc_buf.wptr <= '0;
+            trc_buf.rptr <= '0;
+            trc_buf.sptr <= '0;
+            ctrl.wrap    <= 1'b0;
+            ctrl.full    <= 1'b0;
+        end else begin
+            if (ctrl.clr == 1'b1) begin
+                trc_buf.idx  <= '0;
+                trc_buf.wptr <= '0;
+                trc_buf.rptr <= '0;
+                trc_buf.sptr <= '0;
+                ctrl.wrap    <= 1'b0;
+                ctrl.full    <= 1'b0;
+            end else begin
+                /* write */
+                if (fifo.re == 1'b1) begin
+                    trc_buf.idx <= '0;
+                end else if (fifo.avail == 1'b1) begin
+                    trc_buf.idx <= trc_buf.idx + 1'b1;
+                end
+                if (trc_buf.we == 1'b1) begin
+                    trc_buf.wptr <= trc_buf.wptr + 1'b1;
+                    if (&trc_buf.wptr) begin // last entry
+                        ctrl.wrap <= ~ctrl.mode;
+                        ctrl.full <=  ctrl.mode;
+                    end
+                    /* oldest packet gets overwritten: next packet becomes the oldest one */
+                    if ((ctrl.wrap == 1'b1) && (trc_buf.wptr == trc_buf.sptr)) begin
+                        trc_buf.sptr <= trc_buf.sptr + ram_abits_c'(trc_buf.slen) + 1'b1;
+                    end
+                end
+                /* read: set pointer or auto-increment on data read */
+                if ((wren == 1'b1) && (addr == trace_rptr_addr_c)) begin
+                    trc_buf.rptr <= data_i[ram_abits_c-1:0];
+                end else if ((rden == 1'b1) && (addr == trace_data_addr_c)) begin
+                    trc_buf.rptr <= trc_buf.rptr + 1'b1;
+                end
+            end
+        end
+    end : buffer_ctrl
+
+    /* trace RAM */
+    always_ff @( posedge clk_i ) begin : trace_ram_access
+        if (trc_buf.we == 1'b1) begin
+            trace_ram[trc_buf.wptr] <= trc_buf.wdata;
+        end
+        trc_buf.rdata <= trace_ram[trc_buf.rptr]; // [NOTE] pointer is stable for at least one cycle before a data read
+    end : trace_ram_access
+
+    /* packet size of each header word (for start pointer update) */
+    always_ff @( posedge clk_i ) begin : trace_len_access
+        if ((trc_buf.we == 1'b1) && (trc_buf.idx == 2'b00)) begin
+            trace_len[trc_buf.wptr] <= fifo.rdata[97:96];
+        end
+    end : trace_len_access
+
+    assign trc_buf.slen = trace_len[trc_buf.sptr]; // async read
+
+endmodule
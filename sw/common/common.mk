@@ -43,6 +43,8 @@ CELLRV32_INC_PATH = $(CELLRV32_HOME)/sw/lib/include
 CELLRV32_SRC_PATH = $(CELLRV32_HOME)/sw/lib/source
 # Path to CELLRV32 executable generator
 CELLRV32_EXG_PATH = $(CELLRV32_HOME)/sw/image_gen
+# Path to CELLRV32 instruction trace decoder
+CELLRV32_TRD_PATH = $(CELLRV32_HOME)/sw/trace_dec
 # Path to CELLRV32 core rtl folder
 CELLRV32_RTL_PATH = $(CELLRV32_LOCAL_RTL)/core
 # Path to CELLRV32 sim folder
@@ -89,11 +91,16 @@ OBJCOPY = $(RISCV_PREFIX)objcopy
 SIZE    = $(RISCV_PREFIX)size
 
 # Host native compiler
-CC_X86 = gcc -Wall -O -g
+CC_X86  = gcc -Wall -O -g
+CXX_X86 = g++ -Wall -O -g -std=c++17
 
 # CELLRV32 executable image generator
 IMAGE_GEN = $(CELLRV32_EXG_PATH)/image_gen
 
+# CELLRV32 instruction trace decoder
+TRACE_DEC = $(CELLRV32_TRD_PATH)/trace_dec
+TRACE_LOG ?= trace.log
+
 # Compiler & linker flags
 CC_OPTS  = -march=$(MARCH) -mabi=$(MABI) $(EFFORT) -Wall -ffunction-sections -fdata-sections -nostartfiles -mno-fdiv
 CC_OPTS += -Wl,--gc-sections -lm -lc -lgcc -lc -g
@@ -115,7 +122,7 @@ intro:
 # -----------------------------------------------------------------------------
 # Application output definitions
 # -----------------------------------------------------------------------------
-.PHONY: intro check info help elf_info clean clean_all bootloader
+.PHONY: intro check info help elf_info trace clean clean_all bootloader
 .DEFAULT_GOAL := help
 
 # 'compile' is still here for compatibility
@@ -144,6 +151,10 @@ $(IMAGE_GEN): $(CELLRV32_EXG_PATH)/image_gen.c
 	@echo Compiling $(IMAGE_GEN)
 	@$(CC_X86) $< -o $(IMAGE_GEN)
 
+$(TRACE_DEC): $(CELLRV32_TRD_PATH)/trace_dec.cpp
+	@echo Compiling $(TRACE_DEC)
+	@$(CXX_X86) $< -o $(TRACE_DEC)
+
 
 # -----------------------------------------------------------------------------
 # General targets: Assemble, compile, link, dump
@@ -271,6 +282,13 @@ sim: $(APP_IMG) install
 	@cp $(CELLRV32_SIM_PATH)/simple/*.sh $(CELLRV32_SIM_PATH)/simple/build
 	@sh $(CELLRV32_SIM_PATH)/simple/build/questa.sh
 
+# -----------------------------------------------------------------------------
+# Decode instruction trace dump (TRACE module, see cellrv32_trace_dump())
+# -----------------------------------------------------------------------------
+trace: $(APP_ELF) $(TRACE_DEC)
+	@$(TRACE_DEC) $(APP_ELF) $(TRACE_LOG)
+
+
 # -----------------------------------------------------------------------------
 # Show final ELF details (just for debugging)
 # -----------------------------------------------------------------------------
@@ -285,7 +303,7 @@ clean:
 	@rm -f *.elf *.o *.bin *.out *.asm *.hex *.svh *.sv
 
 clean_all: clean
-	@rm -f $(OBJ) $(IMAGE_GEN)
+	@rm -f $(OBJ) $(IMAGE_GEN) $(TRACE_DEC)
 
 
 # -----------------------------------------------------------------------------
@@ -351,6 +369,7 @@ help: intro
 	@echo " sim        - in-console simulation using default/simple testbench and QuestaSim"
 	@echo " all        - exe + install + hex + bin + asm"
 	@echo " elf_info   - show ELF layout info"
+	@echo " trace      - decode instruction trace dump <TRACE_LOG> using <$(APP_ELF)>"
 	@echo " clean      - clean up project home folder"
 	@echo " clean_all  - clean up whole project, core libraries and image generator"
 	@echo " bl_image   - compile and generate SystemVerilog BOOTROM boot image (for bootloader only, no header) in local folder"
@@ -363,6 +382,7 @@ help: intro
 	@echo " MABI         - Machine binary interface: \"$(MABI)\""
 	@echo " APP_INC      - C include folder(s) [append only]: \"$(APP_INC)\""
 	@echo " ASM_INC      - ASM include folder(s) [append only]: \"$(ASM_INC)\""
+	@echo " TRACE_LOG    - Instruction trace dump file: \"$(TRACE_LOG)\""
 	@echo " RISCV_PREFIX - Toolchain prefix: \"$(RISCV_PREFIX)\""
 	@echo " CELLRV32_HOME - CELLRV32 home folder: \"$(CELLRV32_HOME)\""
 	@echo ""
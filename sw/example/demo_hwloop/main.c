@@ -0,0 +1,348 @@
+// #################################################################################################
+// # << CELLRV32 - Zero-Overhead Hardware Loops Demo Program >>                                    #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file demo_hwloop/main.c
+ * @author Dat Nguyen
+ * @brief Example program comparing plain software loops against the CELLRV32
+ * zero-overhead hardware loops ('Xhwloop' ISA extension, CPU_HWLOOP).
+ **************************************************************************/
+#include <cellrv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Number of array elements (1D kernel) */
+#define ARRAY_SIZE 256
+/** Number of rows/columns (2D kernel) */
+#define MATRIX_SIZE 16
+/** Number of searches (search kernel) */
+#define SEARCH_NUM 8
+/**@}*/
+
+
+// Global variables
+uint32_t data_a[ARRAY_SIZE], data_b[ARRAY_SIZE];
+uint32_t matrix[MATRIX_SIZE][MATRIX_SIZE];
+
+// Prototypes
+uint32_t xorshift32(void);
+uint32_t kernel_1d_sw(const uint32_t *a, const uint32_t *b, uint32_t n);
+uint32_t kernel_1d_hw(const uint32_t *a, const uint32_t *b, uint32_t n);
+uint32_t kernel_2d_sw(const uint32_t *m, uint32_t rows, uint32_t cols);
+uint32_t kernel_2d_hw(const uint32_t *m, uint32_t rows, uint32_t cols);
+uint32_t kernel_find_sw(const uint32_t *a, uint32_t key, uint32_t n);
+uint32_t kernel_find_hw(const uint32_t *a, uint32_t key, uint32_t n);
+void print_report(const char *name, uint32_t res_sw, uint32_t res_hw, uint32_t cycles_sw, uint32_t cycles_hw);
+
+
+/**********************************************************************//**
+ * Main function
+ *
+ * @note This program requires the hardware loop extension (CPU_HWLOOP) and UART0.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  uint32_t i, j, res_sw, res_hw, t_start, cycles_sw, cycles_hw;
+
+  // initialize CELLRV32 run-time environment
+  cellrv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  cellrv32_uart0_setup(BAUD_RATE, 0);
+
+  // check if UART0 is implemented
+  if (cellrv32_uart0_available() == 0) {
+    return 1; // UART0 not available, exit
+  }
+
+  // intro
+  cellrv32_uart0_printf("\n<<< CELLRV32 Zero-Overhead Hardware Loops Demo Program >>>\n\n");
+
+  // check if hardware loops are implemented at all
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_XHWLOOP)) == 0) {
+    cellrv32_uart0_printf("ERROR! Hardware loops ('Xhwloop' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+  // check if the cycle counter is implemented
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZICNTR)) == 0) {
+    cellrv32_uart0_printf("ERROR! Base counters ('Zicntr' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+  // initialize test data
+  for (i=0; i<ARRAY_SIZE; i++) {
+    data_a[i] = xorshift32();
+    data_b[i] = xorshift32();
+  }
+  for (i=0; i<MATRIX_SIZE; i++) {
+    for (j=0; j<MATRIX_SIZE; j++) {
+      matrix[i][j] = xorshift32();
+    }
+  }
+
+  cellrv32_uart0_printf("1D kernel: %u elements, 2D kernel: %ux%u elements\n\n", ARRAY_SIZE, MATRIX_SIZE, MATRIX_SIZE);
+
+
+  // 1D kernel: single (inner) hardware loop
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  res_sw    = kernel_1d_sw(data_a, data_b, ARRAY_SIZE);
+  cycles_sw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  res_hw    = kernel_1d_hw(data_a, data_b, ARRAY_SIZE);
+  cycles_hw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  print_report("1D (a[i] ^ b[i])", res_sw, res_hw, cycles_sw, cycles_hw);
+
+
+  // 2D kernel: nested hardware loops
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  res_sw    = kernel_2d_sw(&matrix[0][0], MATRIX_SIZE, MATRIX_SIZE);
+  cycles_sw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  res_hw    = kernel_2d_hw(&matrix[0][0], MATRIX_SIZE, MATRIX_SIZE);
+  cycles_hw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  print_report("2D (sum of m[i][j])", res_sw, res_hw, cycles_sw, cycles_hw);
+
+
+  // search kernel: conditional branch as last instruction of the loop body
+  // alternate hits and misses so the branch predictor learns "taken" for the loop-end instruction
+  res_sw    = 0;
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<SEARCH_NUM; i++) {
+    j      = (i & 1) ? (i * 29) % ARRAY_SIZE : 0;
+    res_sw = (res_sw << 4) ^ kernel_find_sw(data_a, (i & 1) ? data_a[j] : data_b[i], ARRAY_SIZE);
+  }
+  cycles_sw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  res_hw    = 0;
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<SEARCH_NUM; i++) {
+    j      = (i & 1) ? (i * 29) % ARRAY_SIZE : 0;
+    res_hw = (res_hw << 4) ^ kernel_find_hw(data_a, (i & 1) ? data_a[j] : data_b[i], ARRAY_SIZE);
+  }
+  cycles_hw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  print_report("search (first a[i] == key)", res_sw, res_hw, cycles_sw, cycles_hw);
+
+
+  cellrv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * 1D kernel using a plain software loop.
+ *
+ * @param[in] a Pointer to first input array.
+ * @param[in] b Pointer to second input array.
+ * @param[in] n Number of elements (>0).
+ * @return Sum of a[i] XOR b[i].
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) kernel_1d_sw(const uint32_t *a, const uint32_t *b, uint32_t n) {
+
+  uint32_t i, sum = 0;
+
+  for (i=0; i<n; i++) {
+    sum += a[i] ^ b[i];
+  }
+
+  return sum;
+}
+
+
+/**********************************************************************//**
+ * 1D kernel using the inner hardware loop (context 0).
+ *
+ * @param[in] a Pointer to first input array.
+ * @param[in] b Pointer to second input array.
+ * @param[in] n Number of elements (>0).
+ * @return Sum of a[i] XOR b[i].
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) kernel_1d_hw(const uint32_t *a, const uint32_t *b, uint32_t n) {
+
+  uint32_t sum = 0;
+
+  asm volatile (
+    HWLOOP_BEGIN(0, "%[n]")
+    "lw   t0, 0(%[a])          \n"
+    "lw   t1, 0(%[b])          \n"
+    "addi %[a], %[a], 4        \n"
+    "addi %[b], %[b], 4        \n"
+    "xor  t0, t0, t1           \n"
+    "add  %[sum], %[sum], t0   \n"
+    HWLOOP_END(0)
+    : [sum] "+r" (sum), [a] "+r" (a), [b] "+r" (b)
+    : [n] "r" (n)
+    : "t0", "t1", "t6", "memory"
+  );
+
+  return sum;
+}
+
+
+/**********************************************************************//**
+ * 2D kernel using plain nested software loops.
+ *
+ * @param[in] m Pointer to matrix (row-major).
+ * @param[in] rows Number of rows (>0).
+ * @param[in] cols Number of columns (>0).
+ * @return Sum of all elements, each row rotated by its index.
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) kernel_2d_sw(const uint32_t *m, uint32_t rows, uint32_t cols) {
+
+  uint32_t i, j, row, sum = 0;
+
+  for (i=0; i<rows; i++) {
+    row = 0;
+    for (j=0; j<cols; j++) {
+      row += *m++;
+    }
+    sum = ((sum << 1) | (sum >> 31)) + row;
+  }
+
+  return sum;
+}
+
+
+/**********************************************************************//**
+ * 2D kernel using nested hardware loops (context 1 = rows, context 0 = columns).
+ *
+ * @param[in] m Pointer to matrix (row-major).
+ * @param[in] rows Number of rows (>0).
+ * @param[in] cols Number of columns (>0).
+ * @return Sum of all elements, each row rotated by its index.
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) kernel_2d_hw(const uint32_t *m, uint32_t rows, uint32_t cols) {
+
+  uint32_t row, tmp, sum = 0;
+
+  asm volatile (
+    HWLOOP_BEGIN(1, "%[rows]")
+    "li   %[row], 0            \n"
+    HWLOOP_BEGIN(0, "%[cols]")
+    "lw   t0, 0(%[m])          \n"
+    "addi %[m], %[m], 4        \n"
+    "add  %[row], %[row], t0   \n"
+    HWLOOP_END(0)
+    "srli %[tmp], %[sum], 31   \n"
+    "slli %[sum], %[sum], 1    \n"
+    "or   %[sum], %[sum], %[tmp] \n"
+    "add  %[sum], %[sum], %[row] \n"
+    HWLOOP_END(1)
+    : [sum] "+r" (sum), [m] "+r" (m), [row] "=&r" (row), [tmp] "=&r" (tmp)
+    : [rows] "r" (rows), [cols] "r" (cols)
+    : "t0", "t6", "memory"
+  );
+
+  return sum;
+}
+
+
+/**********************************************************************//**
+ * Search kernel using a plain software loop.
+ *
+ * @param[in] a Pointer to input array.
+ * @param[in] key Value to search for.
+ * @param[in] n Number of elements (>0).
+ * @return Index + 1 of the first element that equals key, 0 if not found.
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) kernel_find_sw(const uint32_t *a, uint32_t key, uint32_t n) {
+
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (a[i] == key) {
+      return i + 1;
+    }
+  }
+
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Search kernel using the inner hardware loop (context 0). The conditional early-exit branch is the
+ * last instruction of the loop body, so it shares its fetch word with the loop end.
+ *
+ * @param[in] a Pointer to input array.
+ * @param[in] key Value to search for.
+ * @param[in] n Number of elements (>0).
+ * @return Index + 1 of the first element that equals key, 0 if not found.
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) kernel_find_hw(const uint32_t *a, uint32_t key, uint32_t n) {
+
+  uint32_t idx = 0;
+
+  asm volatile (
+    HWLOOP_BEGIN(0, "%[n]")
+    "lw   t0, 0(%[a])          \n"
+    "addi %[a], %[a], 4        \n"
+    "addi %[idx], %[idx], 1    \n"
+    "beq  t0, %[key], 2f       \n"
+    HWLOOP_END(0)
+    "li   %[idx], 0            \n" // not found
+    "j    3f                   \n"
+    "2:                        \n"
+    "csrw 0x802, zero          \n" // left loop body early: terminate loop
+    "3:                        \n"
+    : [idx] "+r" (idx), [a] "+r" (a)
+    : [key] "r" (key), [n] "r" (n)
+    : "t0", "t6", "memory"
+  );
+
+  return idx;
+}
+
+
+/**********************************************************************//**
+ * Print results and cycle counts of a kernel.
+ *
+ * @param[in] name Kernel name.
+ * @param[in] res_sw Result of the software loop version.
+ * @param[in] res_hw Result of the hardware loop version.
+ * @param[in] cycles_sw Cycles of the software loop version.
+ * @param[in] cycles_hw Cycles of the hardware loop version.
+ **************************************************************************/
+void print_report(const char *name, uint32_t res_sw, uint32_t res_hw, uint32_t cycles_sw, uint32_t cycles_hw) {
+
+  cellrv32_uart0_printf("%s:\n", name);
+  cellrv32_uart0_printf("  plain loop:    result = 0x%x, %u cycles\n", res_sw, cycles_sw);
+  cellrv32_uart0_printf("  hardware loop: result = 0x%x, %u cycles ", res_hw, cycles_hw);
+
+  if (res_sw != res_hw) {
+    cellrv32_uart0_printf("%c[1m[FAILED]%c[0m\n", 27, 27);
+  }
+  else {
+    cellrv32_uart0_printf("%c[1m[ok]%c[0m\n", 27, 27);
+  }
+}
+
+
+/**********************************************************************//**
+ * Pseudo-random number generator (to generate deterministic test data).
+ *
+ * @return Random data (32-bit).
+ **************************************************************************/
+uint32_t xorshift32(void) {
+
+  static uint32_t x32 = 314159265;
+
+  x32 ^= x32 << 13;
+  x32 ^= x32 >> 17;
+  x32 ^= x32 << 5;
+
+  return x32;
+}
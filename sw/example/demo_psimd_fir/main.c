@@ -0,0 +1,293 @@
+// #################################################################################################
+// # << CELLRV32 - Packed-SIMD DSP Unit ('Xpsimd') FIR Benchmark and Test Program >>               #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file demo_psimd_fir/main.c
+ * @author Dat Nguyen
+ * @brief Test program for the CELLRV32 packed-SIMD DSP unit ('Xpsimd' ISA extension, CPU_PSIMD).
+ * Checks all instructions against pure-software reference functions using pseudo-random data and
+ * compares a plain C Q15 FIR filter against a packed-SIMD (dual 16x16 MAC) implementation.
+ **************************************************************************/
+
+#include <cellrv32.h>
+#include "psimd_intrinsics.h"
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE      (19200)
+/** Number of test cases for each instruction */
+#define NUM_TEST_CASES (1000)
+/** Number of FIR filter taps (has to be even) */
+#define FIR_TAPS       (32)
+/** Number of FIR output samples (has to be even) */
+#define FIR_SAMPLES    (256)
+/**@}*/
+
+
+// Global variables
+int16_t fir_coeff[FIR_TAPS] __attribute__ ((aligned (4)));
+int16_t fir_input[FIR_SAMPLES+FIR_TAPS] __attribute__ ((aligned (4)));
+int16_t fir_output_sw[FIR_SAMPLES], fir_output_hw[FIR_SAMPLES];
+
+// Prototypes
+uint32_t xorshift32(void);
+uint32_t check_instr(const char *name, uint32_t (*hw)(uint32_t, uint32_t), uint32_t (*sw)(uint32_t, uint32_t));
+void fir_sw(const int16_t *h, const int16_t *x, int16_t *y);
+void fir_hw(const int16_t *h, const int16_t *x, int16_t *y);
+
+// Wrappers for the single-operand / accumulating intrinsics
+uint32_t hw_sunpkd810(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_sunpkd810(a); }
+uint32_t sw_sunpkd810(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_sunpkd810(a); }
+uint32_t hw_sunpkd832(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_sunpkd832(a); }
+uint32_t sw_sunpkd832(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_sunpkd832(a); }
+uint32_t hw_zunpkd831(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_zunpkd831(a); }
+uint32_t sw_zunpkd831(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_zunpkd831(a); }
+uint32_t hw_kmada(uint32_t a, uint32_t b) { return riscv_intrinsic_kmada(a ^ b, a, b); }
+uint32_t sw_kmada(uint32_t a, uint32_t b) { return riscv_emulate_kmada(a ^ b, a, b); }
+
+// Intrinsics have to be wrapped to be callable via function pointers
+#define PSIMD_WRAP(name) \
+  uint32_t hw_##name(uint32_t a, uint32_t b) { return riscv_intrinsic_##name(a, b); }
+
+PSIMD_WRAP(radd16)
+PSIMD_WRAP(uradd16)
+PSIMD_WRAP(kadd16)
+PSIMD_WRAP(ukadd16)
+PSIMD_WRAP(add16)
+PSIMD_WRAP(ksub16)
+PSIMD_WRAP(uksub16)
+PSIMD_WRAP(sub16)
+PSIMD_WRAP(kadd8)
+PSIMD_WRAP(ukadd8)
+PSIMD_WRAP(add8)
+PSIMD_WRAP(rsub8)
+PSIMD_WRAP(uksub8)
+PSIMD_WRAP(sub8)
+PSIMD_WRAP(pkbb16)
+PSIMD_WRAP(pkbt16)
+PSIMD_WRAP(pktb16)
+PSIMD_WRAP(pktt16)
+PSIMD_WRAP(kmda)
+
+
+/**********************************************************************//**
+ * Main function
+ *
+ * @note This program requires the packed-SIMD DSP unit (CPU_PSIMD) and UART0.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  uint32_t i, err_cnt = 0, t_start, cycles_sw, cycles_hw;
+
+  // capture all exceptions and give debug info via UART
+  cellrv32_rte_setup();
+
+  // setup UART0 at default baud rate, no interrupts
+  cellrv32_uart0_setup(BAUD_RATE, 0);
+
+  // check if UART0 is implemented
+  if (cellrv32_uart0_available() == 0) {
+    return 1; // UART0 not available, exit
+  }
+
+  // intro
+  cellrv32_uart0_printf("\n<<< CELLRV32 Packed-SIMD DSP Unit ('Xpsimd') FIR Benchmark >>>\n\n");
+
+  // check if the packed-SIMD unit is implemented at all
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_XPSIMD)) == 0) {
+    cellrv32_uart0_printf("ERROR! Packed-SIMD DSP unit ('Xpsimd' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+  // check if the cycle counter is implemented
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZICNTR)) == 0) {
+    cellrv32_uart0_printf("ERROR! Base counters ('Zicntr' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+
+  // instruction tests
+  cellrv32_uart0_printf("Instruction tests (%u test cases per instruction):\n", (uint32_t)NUM_TEST_CASES);
+  err_cnt += check_instr("radd16",    hw_radd16,    riscv_emulate_radd16);
+  err_cnt += check_instr("uradd16",   hw_uradd16,   riscv_emulate_uradd16);
+  err_cnt += check_instr("kadd16",    hw_kadd16,    riscv_emulate_kadd16);
+  err_cnt += check_instr("ukadd16",   hw_ukadd16,   riscv_emulate_ukadd16);
+  err_cnt += check_instr("add16",     hw_add16,     riscv_emulate_add16);
+  err_cnt += check_instr("ksub16",    hw_ksub16,    riscv_emulate_ksub16);
+  err_cnt += check_instr("uksub16",   hw_uksub16,   riscv_emulate_uksub16);
+  err_cnt += check_instr("sub16",     hw_sub16,     riscv_emulate_sub16);
+  err_cnt += check_instr("kadd8",     hw_kadd8,     riscv_emulate_kadd8);
+  err_cnt += check_instr("ukadd8",    hw_ukadd8,    riscv_emulate_ukadd8);
+  err_cnt += check_instr("add8",      hw_add8,      riscv_emulate_add8);
+  err_cnt += check_instr("rsub8",     hw_rsub8,     riscv_emulate_rsub8);
+  err_cnt += check_instr("uksub8",    hw_uksub8,    riscv_emulate_uksub8);
+  err_cnt += check_instr("sub8",      hw_sub8,      riscv_emulate_sub8);
+  err_cnt += check_instr("pkbb16",    hw_pkbb16,    riscv_emulate_pkbb16);
+  err_cnt += check_instr("pkbt16",    hw_pkbt16,    riscv_emulate_pkbt16);
+  err_cnt += check_instr("pktb16",    hw_pktb16,    riscv_emulate_pktb16);
+  err_cnt += check_instr("pktt16",    hw_pktt16,    riscv_emulate_pktt16);
+  err_cnt += check_instr("sunpkd810", hw_sunpkd810, sw_sunpkd810);
+  err_cnt += check_instr("sunpkd832", hw_sunpkd832, sw_sunpkd832);
+  err_cnt += check_instr("zunpkd831", hw_zunpkd831, sw_zunpkd831);
+  err_cnt += check_instr("kmda",      hw_kmda,      riscv_emulate_kmda);
+  err_cnt += check_instr("kmada",     hw_kmada,     sw_kmada);
+
+
+  // FIR benchmark: Q15 coefficients with sum(|h|) <= 1.0 (no accumulator saturation)
+  for (i=0; i<FIR_TAPS; i++) {
+    fir_coeff[i] = (int16_t)(xorshift32() % 2048) - 1024;
+  }
+  for (i=0; i<(FIR_SAMPLES+FIR_TAPS); i++) {
+    fir_input[i] = (int16_t)xorshift32();
+  }
+
+  cellrv32_uart0_printf("\nQ15 FIR filter: %u taps, %u samples\n", (uint32_t)FIR_TAPS, (uint32_t)FIR_SAMPLES);
+
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  fir_sw(fir_coeff, fir_input, fir_output_sw);
+  cycles_sw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  fir_hw(fir_coeff, fir_input, fir_output_hw);
+  cycles_hw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  cellrv32_uart0_printf("  plain C:     %u cycles\n", cycles_sw);
+  cellrv32_uart0_printf("  packed-SIMD: %u cycles ", cycles_hw);
+
+  for (i=0; i<FIR_SAMPLES; i++) {
+    if (fir_output_sw[i] != fir_output_hw[i]) {
+      err_cnt++;
+      break;
+    }
+  }
+  if (i != FIR_SAMPLES) {
+    cellrv32_uart0_printf("%c[1m[FAILED]%c[0m (first mismatch at sample %u)\n", 27, 27, i);
+  }
+  else {
+    cellrv32_uart0_printf("%c[1m[ok]%c[0m\n", 27, 27);
+  }
+  if (cycles_hw != 0) {
+    cellrv32_uart0_printf("  speedup:     %u.%u%u\n", cycles_sw / cycles_hw,
+                          ((cycles_sw * 10) / cycles_hw) % 10, ((cycles_sw * 100) / cycles_hw) % 10);
+  }
+
+
+  if (err_cnt) {
+    cellrv32_uart0_printf("\n%c[1m[%u errors]%c[0m\n", 27, err_cnt, 27);
+    return 1;
+  }
+
+  cellrv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Check an instruction against its emulation function using pseudo-random operands.
+ *
+ * @param[in] name Instruction name.
+ * @param[in] hw Intrinsic wrapper (hardware).
+ * @param[in] sw Emulation function (software reference).
+ * @return Number of errors.
+ **************************************************************************/
+uint32_t check_instr(const char *name, uint32_t (*hw)(uint32_t, uint32_t), uint32_t (*sw)(uint32_t, uint32_t)) {
+
+  uint32_t i, opa, opb, res_hw, res_sw;
+
+  cellrv32_uart0_printf("  %s: ", name);
+
+  for (i=0; i<(uint32_t)NUM_TEST_CASES; i++) {
+    opa = xorshift32();
+    opb = xorshift32();
+    res_hw = hw(opa, opb);
+    res_sw = sw(opa, opb);
+    if (res_hw != res_sw) {
+      cellrv32_uart0_printf("%c[1m[FAILED]%c[0m opa=0x%x, opb=0x%x: ref=0x%x, res=0x%x\n", 27, 27, opa, opb, res_sw, res_hw);
+      return 1;
+    }
+  }
+
+  cellrv32_uart0_printf("%c[1m[ok]%c[0m\n", 27, 27);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Q15 FIR filter, plain C (one 16x16 MAC per tap).
+ *
+ * @param[in] h Pointer to FIR_TAPS coefficients.
+ * @param[in] x Pointer to FIR_SAMPLES+FIR_TAPS input samples.
+ * @param[in,out] y Pointer to FIR_SAMPLES output samples.
+ **************************************************************************/
+void __attribute__ ((noinline)) fir_sw(const int16_t *h, const int16_t *x, int16_t *y) {
+
+  int n, k;
+  int32_t acc;
+
+  for (n=0; n<FIR_SAMPLES; n++) {
+    acc = 0;
+    for (k=0; k<FIR_TAPS; k++) {
+      acc += (int32_t)h[k] * (int32_t)x[n+k];
+    }
+    y[n] = (int16_t)(acc >> 15);
+  }
+}
+
+
+/**********************************************************************//**
+ * Q15 FIR filter, packed-SIMD: two output samples per pass, two taps per KMADA.
+ * The odd output sample needs the sample pairs shifted by one element, which are
+ * re-packed from two aligned words using PKBT16.
+ *
+ * @param[in] h Pointer to FIR_TAPS coefficients (32-bit aligned).
+ * @param[in] x Pointer to FIR_SAMPLES+FIR_TAPS input samples (32-bit aligned).
+ * @param[in,out] y Pointer to FIR_SAMPLES output samples.
+ **************************************************************************/
+void __attribute__ ((noinline)) fir_hw(const int16_t *h, const int16_t *x, int16_t *y) {
+
+  const uint32_t *h32 = (const uint32_t*)h;
+  const uint32_t *x32;
+  uint32_t acc0, acc1, w_lo, w_hi, hk;
+  int n, k;
+
+  for (n=0; n<FIR_SAMPLES; n+=2) {
+    acc0 = 0;
+    acc1 = 0;
+    x32  = (const uint32_t*)&x[n];
+    w_lo = x32[0];
+    for (k=0; k<FIR_TAPS/2; k++) {
+      hk   = h32[k];
+      w_hi = x32[k+1];
+      acc0 = riscv_intrinsic_kmada(acc0, w_lo, hk); // {x[n+2k+1], x[n+2k]}
+      acc1 = riscv_intrinsic_kmada(acc1, riscv_intrinsic_pkbt16(w_hi, w_lo), hk); // {x[n+2k+2], x[n+2k+1]}
+      w_lo = w_hi;
+    }
+    y[n]   = (int16_t)((int32_t)acc0 >> 15);
+    y[n+1] = (int16_t)((int32_t)acc1 >> 15);
+  }
+}
+
+
+/**********************************************************************//**
+ * Pseudo-random number generator (to generate deterministic test data).
+ *
+ * @return Random data (32-bit).
+ **************************************************************************/
+uint32_t xorshift32(void) {
+
+  static uint32_t x32 = 314159265;
+
+  x32 ^= x32 << 13;
+  x32 ^= x32 >> 17;
+  x32 ^= x32 << 5;
+
+  return x32;
+}
@@ -0,0 +1,1132 @@
+// #################################################################################################
+// # << CELLRV32 - Intrinsics + Emulation Functions for the Packed-SIMD DSP Unit ('Xpsimd') >>     #
+// # ********************************************************************************************* #
+// # The intrinsics provided by this library allow to use the packed-SIMD DSP instructions (subset #
+// # of the RISC-V 'P' extension draft, OP-P major opcode) without the need for compiler support.  #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file demo_psimd_fir/psimd_intrinsics.h
+ * @author Dat Nguyen
+ * @brief "Intrinsic" library for the CELLRV32 packed-SIMD DSP unit (CPU_PSIMD).
+ * Also provides emulation functions for all intrinsics (functionality re-built in pure software).
+ *
+ * @note Saturating instructions do not report overflows (the P extension's OV flag is not implemented).
+ **************************************************************************/
+ 
+#ifndef psimd_intrinsics_h
+#define psimd_intrinsics_h
+
+
+/**********************************************************************//**
+ * @name R2-type instruction format; the rs2 field is used as (constant) function select
+ **************************************************************************/
+#define PSIMD_INSTR_R2_TYPE(funct7, sel, rs1, funct3, opcode) \
+({                                                           \
+    uint32_t __return;                                       \
+    asm volatile (                                           \
+      ""                                                     \
+      : [output] "=r" (__return)                             \
+      : [input_i] "r" (rs1)                                  \
+    );                                                       \
+    asm volatile (                                           \
+      ".word (                                               \
+        (((" #funct7 ") & 0x7f) << 25) |                     \
+        (((" #sel    ") & 0x1f) << 20) |                     \
+        ((( regnum_%1 ) & 0x1f) << 15) |                     \
+        (((" #funct3 ") & 0x07) << 12) |                     \
+        ((( regnum_%0 ) & 0x1f) <<  7) |                     \
+        (((" #opcode ") & 0x7f) <<  0)                       \
+      );"                                                    \
+      : [rd] "=r" (__return)                                 \
+      : "r" (rs1)                                            \
+    );                                                       \
+    __return;                                                \
+})
+
+
+/**********************************************************************//**
+ * @name R3-type instruction format; rd is also a source operand (accumulator)
+ **************************************************************************/
+#define PSIMD_INSTR_R3_ACC_TYPE(funct7, acc, rs2, rs1, funct3, opcode) \
+({                                                                    \
+    uint32_t __return = (acc);                                        \
+    asm volatile (                                                    \
+      ""                                                              \
+      : [output] "+r" (__return)                                      \
+      : [input_i] "r" (rs1),                                          \
+        [input_j] "r" (rs2)                                           \
+    );                                                                \
+    asm volatile (                                                    \
+      ".word (                                                        \
+        (((" #funct7 ") & 0x7f) << 25) |                              \
+        ((( regnum_%2 ) & 0x1f) << 20) |                              \
+        ((( regnum_%1 ) & 0x1f) << 15) |                              \
+        (((" #funct3 ") & 0x07) << 12) |                              \
+        ((( regnum_%0 ) & 0x1f) <<  7) |                              \
+        (((" #opcode ") & 0x7f) <<  0)                                \
+      );"                                                             \
+      : [rd] "+r" (__return)                                          \
+      : "r" (rs1),                                                    \
+        "r" (rs2)                                                     \
+    );                                                                \
+    __return;                                                         \
+})
+
+
+// ################################################################################################
+// Intrinsics
+// ################################################################################################
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed addition, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_radd16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000000, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned addition, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_uradd16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010000, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed addition, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_kadd16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0001000, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned addition, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_ukadd16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0011000, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around addition, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_add16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0100000, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed subtraction, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_rsub16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000001, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned subtraction, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_ursub16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010001, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed subtraction, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_ksub16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0001001, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned subtraction, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_uksub16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0011001, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around subtraction, 2x16-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sub16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0100001, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed addition, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_radd8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000100, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned addition, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_uradd8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010100, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed addition, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_kadd8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0001100, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned addition, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_ukadd8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0011100, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around addition, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_add8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0100100, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed subtraction, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_rsub8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000101, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned subtraction, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_ursub8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010101, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed subtraction, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_ksub8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0001101, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned subtraction, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_uksub8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0011101, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around subtraction, 4x8-bit lanes [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sub8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0100101, rs2, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack bottom half of rs1 (upper result) and bottom half of rs2 (lower result) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_pkbb16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000111, rs2, rs1, 0b001, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack bottom half of rs1 (upper result) and top half of rs2 (lower result) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_pkbt16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0001111, rs2, rs1, 0b001, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack top half of rs1 (upper result) and bottom half of rs2 (lower result) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_pktb16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010111, rs2, rs1, 0b001, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack top half of rs1 (upper result) and top half of rs2 (lower result) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_pktt16(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0011111, rs2, rs1, 0b001, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 1 (upper result) and byte 0 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sunpkd810(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01000, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 2 (upper result) and byte 0 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sunpkd820(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01001, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 3 (upper result) and byte 0 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sunpkd830(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01010, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 3 (upper result) and byte 1 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sunpkd831(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01011, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 3 (upper result) and byte 2 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sunpkd832(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b10011, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 1 (upper result) and byte 0 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_zunpkd810(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01100, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 2 (upper result) and byte 0 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_zunpkd820(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01101, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 3 (upper result) and byte 0 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_zunpkd830(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01110, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 3 (upper result) and byte 1 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_zunpkd831(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b01111, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 3 (upper result) and byte 2 (lower result) to 16 bit [intrinsic].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_zunpkd832(uint32_t rs1) {
+
+  return PSIMD_INSTR_R2_TYPE(0b1010110, 0b10111, rs1, 0b000, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Signed 16x16 dual multiply and add, 32-bit saturation [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1 (two signed 16-bit values).
+ * @param[in] rs2 Source operand 2 (two signed 16-bit values).
+ * @return rs1.H1*rs2.H1 + rs1.H0*rs2.H0.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_kmda(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0011100, rs2, rs1, 0b001, 0b1110111);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Signed 16x16 dual multiply and accumulate, 32-bit saturation [intrinsic].
+ *
+ * @param[in] acc Accumulator (signed 32-bit).
+ * @param[in] rs1 Source operand 1 (two signed 16-bit values).
+ * @param[in] rs2 Source operand 2 (two signed 16-bit values).
+ * @return acc + rs1.H1*rs2.H1 + rs1.H0*rs2.H0.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_kmada(uint32_t acc, uint32_t rs1, uint32_t rs2) {
+
+  return PSIMD_INSTR_R3_ACC_TYPE(0b0100100, acc, rs2, rs1, 0b001, 0b1110111);
+}
+
+
+// ################################################################################################
+// Emulation functions
+// ################################################################################################
+
+
+/**********************************************************************//**
+ * Packed add/sub of a single lane [emulation helper].
+ *
+ * @param[in] a Operand A (zero-extended lane value).
+ * @param[in] b Operand B (zero-extended lane value).
+ * @param[in] width Lane width in bits (8 or 16).
+ * @param[in] mode Operation mode (funct7[6:3]).
+ * @param[in] sub Subtract when set.
+ * @return Lane result (zero-extended).
+ **************************************************************************/
+uint32_t riscv_emulate_addsub_lane(uint32_t a, uint32_t b, int width, int mode, int sub) {
+
+  int32_t opa, opb, res;
+  int32_t max_s = (1 << (width-1)) - 1;
+  int32_t min_s = -(1 << (width-1));
+  int32_t max_u = (1 << width) - 1;
+  int uns = (mode >> 1) & 1;
+
+  if (uns) {
+    opa = (int32_t)a;
+    opb = (int32_t)b;
+  }
+  else { // sign-extend
+    opa = (int32_t)(a << (32-width)) >> (32-width);
+    opb = (int32_t)(b << (32-width)) >> (32-width);
+  }
+
+  if (sub) {
+    res = opa - opb;
+  }
+  else {
+    res = opa + opb;
+  }
+
+  if (mode == 0b0100) { // wrap-around
+    return (uint32_t)res & max_u;
+  }
+  else if ((mode & 1) == 0) { // halving
+    return (uint32_t)(res >> 1) & max_u;
+  }
+  else if (uns) { // unsigned saturation
+    if (res > max_u) {
+      res = max_u;
+    }
+    if (res < 0) {
+      res = 0;
+    }
+    return (uint32_t)res;
+  }
+  else { // signed saturation
+    if (res > max_s) {
+      res = max_s;
+    }
+    if (res < min_s) {
+      res = min_s;
+    }
+    return (uint32_t)res & max_u;
+  }
+}
+
+
+/**********************************************************************//**
+ * Packed add/sub of all lanes [emulation helper].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @param[in] width Lane width in bits (8 or 16).
+ * @param[in] mode Operation mode (funct7[6:3]).
+ * @param[in] sub Subtract when set.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_addsub(uint32_t rs1, uint32_t rs2, int width, int mode, int sub) {
+
+  uint32_t res = 0, mask = (1 << width) - 1;
+  int i;
+
+  for (i=0; i<32; i+=width) {
+    res |= riscv_emulate_addsub_lane((rs1 >> i) & mask, (rs2 >> i) & mask, width, mode, sub) << i;
+  }
+
+  return res;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed addition, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_radd16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0000, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned addition, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_uradd16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0010, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed addition, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_kadd16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0001, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned addition, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_ukadd16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0011, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around addition, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_add16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0100, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed subtraction, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_rsub16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0000, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned subtraction, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_ursub16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0010, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed subtraction, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_ksub16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0001, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned subtraction, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_uksub16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0011, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around subtraction, 2x16-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sub16(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 16, 0b0100, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed addition, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_radd8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0000, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned addition, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_uradd8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0010, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed addition, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_kadd8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0001, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned addition, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_ukadd8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0011, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around addition, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_add8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0100, 0);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving signed subtraction, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_rsub8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0000, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Halving unsigned subtraction, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_ursub8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0010, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating signed subtraction, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_ksub8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0001, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Saturating unsigned subtraction, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_uksub8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0011, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Wrap-around subtraction, 4x8-bit lanes [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sub8(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_addsub(rs1, rs2, 8, 0b0100, 1);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack bottom half of rs1 (upper result) and bottom half of rs2 (lower result) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_pkbb16(uint32_t rs1, uint32_t rs2) {
+
+  return ((rs1 & 0xffff) << 16) | (rs2 & 0xffff);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack bottom half of rs1 (upper result) and top half of rs2 (lower result) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_pkbt16(uint32_t rs1, uint32_t rs2) {
+
+  return ((rs1 & 0xffff) << 16) | (rs2 >> 16);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack top half of rs1 (upper result) and bottom half of rs2 (lower result) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_pktb16(uint32_t rs1, uint32_t rs2) {
+
+  return ((rs1 >> 16) << 16) | (rs2 & 0xffff);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Pack top half of rs1 (upper result) and top half of rs2 (lower result) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_pktt16(uint32_t rs1, uint32_t rs2) {
+
+  return ((rs1 >> 16) << 16) | (rs2 >> 16);
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 1 (upper result) and byte 0 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sunpkd810(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(int8_t)(rs1 >> 8);
+  uint16_t lo = (uint16_t)(int16_t)(int8_t)(rs1 >> 0);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 2 (upper result) and byte 0 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sunpkd820(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(int8_t)(rs1 >> 16);
+  uint16_t lo = (uint16_t)(int16_t)(int8_t)(rs1 >> 0);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 3 (upper result) and byte 0 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sunpkd830(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(int8_t)(rs1 >> 24);
+  uint16_t lo = (uint16_t)(int16_t)(int8_t)(rs1 >> 0);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 3 (upper result) and byte 1 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sunpkd831(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(int8_t)(rs1 >> 24);
+  uint16_t lo = (uint16_t)(int16_t)(int8_t)(rs1 >> 8);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Sign-extend byte 3 (upper result) and byte 2 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sunpkd832(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(int8_t)(rs1 >> 24);
+  uint16_t lo = (uint16_t)(int16_t)(int8_t)(rs1 >> 16);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 1 (upper result) and byte 0 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_zunpkd810(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(uint8_t)(rs1 >> 8);
+  uint16_t lo = (uint16_t)(int16_t)(uint8_t)(rs1 >> 0);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 2 (upper result) and byte 0 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_zunpkd820(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(uint8_t)(rs1 >> 16);
+  uint16_t lo = (uint16_t)(int16_t)(uint8_t)(rs1 >> 0);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 3 (upper result) and byte 0 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_zunpkd830(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(uint8_t)(rs1 >> 24);
+  uint16_t lo = (uint16_t)(int16_t)(uint8_t)(rs1 >> 0);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 3 (upper result) and byte 1 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_zunpkd831(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(uint8_t)(rs1 >> 24);
+  uint16_t lo = (uint16_t)(int16_t)(uint8_t)(rs1 >> 8);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Zero-extend byte 3 (upper result) and byte 2 (lower result) to 16 bit [emulation].
+ *
+ * @param[in] rs1 Source operand.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_zunpkd832(uint32_t rs1) {
+
+  uint16_t hi = (uint16_t)(int16_t)(uint8_t)(rs1 >> 24);
+  uint16_t lo = (uint16_t)(int16_t)(uint8_t)(rs1 >> 16);
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Signed 16x16 dual multiply and accumulate, 32-bit saturation [emulation helper].
+ *
+ * @param[in] acc Accumulator (signed 32-bit).
+ * @param[in] rs1 Source operand 1 (two signed 16-bit values).
+ * @param[in] rs2 Source operand 2 (two signed 16-bit values).
+ * @return acc + rs1.H1*rs2.H1 + rs1.H0*rs2.H0.
+ **************************************************************************/
+uint32_t riscv_emulate_kmada(uint32_t acc, uint32_t rs1, uint32_t rs2) {
+
+  int64_t res = (int64_t)(int32_t)acc;
+
+  res += (int64_t)((int32_t)(int16_t)(rs1 >> 16) * (int32_t)(int16_t)(rs2 >> 16));
+  res += (int64_t)((int32_t)(int16_t)(rs1 & 0xffff) * (int32_t)(int16_t)(rs2 & 0xffff));
+
+  if (res > (int64_t)INT32_MAX) {
+    res = (int64_t)INT32_MAX;
+  }
+  if (res < (int64_t)INT32_MIN) {
+    res = (int64_t)INT32_MIN;
+  }
+
+  return (uint32_t)(int32_t)res;
+}
+
+
+/**********************************************************************//**
+ * Intrinsic: Signed 16x16 dual multiply and add, 32-bit saturation [emulation].
+ *
+ * @param[in] rs1 Source operand 1 (two signed 16-bit values).
+ * @param[in] rs2 Source operand 2 (two signed 16-bit values).
+ * @return rs1.H1*rs2.H1 + rs1.H0*rs2.H0.
+ **************************************************************************/
+uint32_t riscv_emulate_kmda(uint32_t rs1, uint32_t rs2) {
+
+  return riscv_emulate_kmada(0, rs1, rs2);
+}
+
+
+#endif // psimd_intrinsics_h
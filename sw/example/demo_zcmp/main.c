@@ -0,0 +1,235 @@
+// #################################################################################################
+// # << CELLRV32 - Zcmp Push/Pop and Zcmt Table Jump Demo Program >>                               #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file demo_zcmp/main.c
+ * @author Dat Nguyen
+ * @brief Example program comparing plain function prologues/epilogues against the
+ * Zcmp push/pop instructions and showing a Zcmt table jump (CPU_EXTENSION_RISCV_Zcmp/Zcmt).
+ *
+ * @note The Zcmp/Zcmt instructions are emitted as raw ".half" encodings so this program
+ * also builds with toolchains that do not know these extensions. Compile with
+ * the "C" extension enabled (e.g. MARCH=rv32imc_zicsr).
+ **************************************************************************/
+#include <cellrv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Number of function calls per benchmark */
+#define NUM_CALLS 256
+/** Jump table index used by the cm.jalt test (>= 32) */
+#define JT_INDEX 32
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Test functions (see assembly below)
+ **************************************************************************/
+/**@{*/
+/** Call the callee with known s0..s2 and return its result; returns 0xffffffff if s0..s2/sp got corrupted */
+uint32_t call_check_sw(uint32_t a, uint32_t b);
+uint32_t call_check_zcmp(uint32_t a, uint32_t b);
+/** Call the table jump target (via cm.jalt) */
+uint32_t call_zcmt(uint32_t a);
+/** Callees / jump target and their code boundaries */
+extern const char callee_sw[], callee_sw_end[];
+extern const char callee_zcmp[], callee_zcmp_end[];
+extern const char zcmt_target[];
+/**@}*/
+
+
+/**********************************************************************//**
+ * Test functions. Both callees compute (a + b) using callee-saved registers;
+ * "callee_sw" uses a plain prologue/epilogue, "callee_zcmp" uses:
+ * cm.push {ra, s0-s2}, -16 (0xb872)
+ * cm.mvsa01 s0, s1 (0xac26)
+ * cm.popret {ra, s0-s2}, 16 (0xbe72)
+ * "call_zcmt" uses cm.jalt 32 (0xa082).
+ **************************************************************************/
+asm (
+  ".text                           \n"
+  ".balign 4                       \n"
+  ".macro CALL_CHECK name, callee  \n"
+  ".globl \\name                   \n"
+  "\\name:                         \n"
+  "  addi sp, sp, -16              \n"
+  "  sw   ra, 12(sp)               \n"
+  "  sw   s0,  8(sp)               \n"
+  "  sw   s1,  4(sp)               \n"
+  "  sw   s2,  0(sp)               \n"
+  "  li   s0, 0x01234567           \n"
+  "  li   s1, 0x89abcdef           \n"
+  "  li   s2, 0x55aa55aa           \n"
+  "  mv   t0, sp                   \n"
+  "  call \\callee                 \n"
+  "  xor  t1, sp, t0               \n"
+  "  li   t2, 0x01234567           \n"
+  "  xor  t2, t2, s0               \n"
+  "  or   t1, t1, t2               \n"
+  "  li   t2, 0x89abcdef           \n"
+  "  xor  t2, t2, s1               \n"
+  "  or   t1, t1, t2               \n"
+  "  li   t2, 0x55aa55aa           \n"
+  "  xor  t2, t2, s2               \n"
+  "  or   t1, t1, t2               \n"
+  "  beqz t1, 1f                   \n"
+  "  li   a0, -1                   \n"
+  "1:                              \n"
+  "  lw   ra, 12(sp)               \n"
+  "  lw   s0,  8(sp)               \n"
+  "  lw   s1,  4(sp)               \n"
+  "  lw   s2,  0(sp)               \n"
+  "  addi sp, sp, 16               \n"
+  "  ret                           \n"
+  ".endm                           \n"
+  "CALL_CHECK call_check_sw,   callee_sw   \n"
+  "CALL_CHECK call_check_zcmp, callee_zcmp \n"
+  ".globl callee_sw, callee_sw_end \n"
+  "callee_sw:                      \n"
+  "  addi sp, sp, -16              \n"
+  "  sw   ra, 12(sp)               \n"
+  "  sw   s0,  8(sp)               \n"
+  "  sw   s1,  4(sp)               \n"
+  "  sw   s2,  0(sp)               \n"
+  "  mv   s0, a0                   \n"
+  "  mv   s1, a1                   \n"
+  "  add  s2, s0, s1               \n"
+  "  mv   a0, s2                   \n"
+  "  lw   ra, 12(sp)               \n"
+  "  lw   s0,  8(sp)               \n"
+  "  lw   s1,  4(sp)               \n"
+  "  lw   s2,  0(sp)               \n"
+  "  addi sp, sp, 16               \n"
+  "  ret                           \n"
+  "callee_sw_end:                  \n"
+  ".balign 4                       \n"
+  ".globl callee_zcmp, callee_zcmp_end \n"
+  "callee_zcmp:                    \n"
+  "  .half 0xb872                  \n"
+  "  .half 0xac26                  \n"
+  "  add  s2, s0, s1               \n"
+  "  mv   a0, s2                   \n"
+  "  .half 0xbe72                  \n"
+  "callee_zcmp_end:                \n"
+  ".balign 4                       \n"
+  ".globl call_zcmt                \n"
+  "call_zcmt:                      \n"
+  "  addi sp, sp, -16              \n"
+  "  sw   ra, 12(sp)               \n"
+  "  .half 0xa082                  \n"
+  "  lw   ra, 12(sp)               \n"
+  "  addi sp, sp, 16               \n"
+  "  ret                           \n"
+  ".balign 4                       \n"
+  ".globl zcmt_target              \n"
+  "zcmt_target:                    \n"
+  "  addi a0, a0, 1                \n"
+  "  ret                           \n"
+);
+
+
+// Global variables
+/** Zcmt jump table (base address has to be 64-byte aligned) */
+uint32_t jump_table[64] __attribute__ ((aligned(64)));
+
+
+/**********************************************************************//**
+ * Main function
+ *
+ * @note This program requires the Zcmp/Zcmt ISA extensions, Zicntr and UART0.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  uint32_t i, res, err, t_start, cycles_sw, cycles_zcmp;
+
+  // initialize CELLRV32 run-time environment
+  cellrv32_rte_setup();
+
+  // setup UART at default baud rate, no interrupts
+  cellrv32_uart0_setup(BAUD_RATE, 0);
+
+  // check if UART0 is implemented
+  if (cellrv32_uart0_available() == 0) {
+    return 1; // UART0 not available, exit
+  }
+
+  // intro
+  cellrv32_uart0_printf("\n<<< CELLRV32 Zcmp/Zcmt Demo Program >>>\n\n");
+
+  // check if Zcmp is implemented at all
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZCMP)) == 0) {
+    cellrv32_uart0_printf("ERROR! Push/pop instructions ('Zcmp' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+  // check if the cycle counter is implemented
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZICNTR)) == 0) {
+    cellrv32_uart0_printf("ERROR! Base counters ('Zicntr' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+
+  // functional check
+  err = 0;
+  for (i=0; i<NUM_CALLS; i++) {
+    res = (i * 0x9e3779b9) & 0x7fffffff;
+    if ((call_check_sw(res, i) != (res + i)) || (call_check_zcmp(res, i) != (res + i))) {
+      err++;
+    }
+  }
+
+  // benchmark
+  t_start   = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<NUM_CALLS; i++) {
+    call_check_sw(i, i);
+  }
+  cycles_sw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  t_start     = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<NUM_CALLS; i++) {
+    call_check_zcmp(i, i);
+  }
+  cycles_zcmp = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  cellrv32_uart0_printf("Function call (%u calls):\n", NUM_CALLS);
+  cellrv32_uart0_printf("  plain prologue/epilogue: %u bytes, %u cycles\n", (uint32_t)(callee_sw_end - callee_sw), cycles_sw);
+  cellrv32_uart0_printf("  cm.push/cm.popret:       %u bytes, %u cycles ", (uint32_t)(callee_zcmp_end - callee_zcmp), cycles_zcmp);
+  if (err) {
+    cellrv32_uart0_printf("%c[1m[FAILED]%c[0m\n", 27, 27);
+  }
+  else {
+    cellrv32_uart0_printf("%c[1m[ok]%c[0m\n", 27, 27);
+  }
+
+
+  // table jump
+  if (cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZCMT)) {
+    jump_table[JT_INDEX] = (uint32_t)zcmt_target;
+    asm volatile ("fence"); // make sure the table entry has been written before it is fetched
+    cellrv32_cpu_csr_write(CSR_JVT, (uint32_t)jump_table);
+
+    cellrv32_uart0_printf("\nTable jump (cm.jalt %u): ", JT_INDEX);
+    if (call_zcmt(41) != 42) {
+      cellrv32_uart0_printf("%c[1m[FAILED]%c[0m\n", 27, 27);
+    }
+    else {
+      cellrv32_uart0_printf("%c[1m[ok]%c[0m\n", 27, 27);
+    }
+  }
+  else {
+    cellrv32_uart0_printf("\nTable jumps ('Zcmt' ISA extension) not implemented, skipping.\n");
+  }
+
+
+  cellrv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
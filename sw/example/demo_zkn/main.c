@@ -0,0 +1,637 @@
+// #################################################################################################
+// # << CELLRV32 - Scalar Cryptography Extension ('Zkn') Test and Throughput Benchmark Program >>  #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file demo_zkn/main.c
+ * @author Dat Nguyen
+ * @brief Test program for the CELLRV32 scalar cryptography instructions ('Zkn' ISA extension,
+ * CPU_EXTENSION_RISCV_Zkn). Checks all instructions against pure-software reference functions using
+ * pseudo-random data, checks AES-128 (FIPS-197) and SHA-256 (FIPS-180) test vectors and compares the
+ * throughput (cycles per byte) of table-based software implementations against the instructions.
+ **************************************************************************/
+
+#include <cellrv32.h>
+#include "zkn_intrinsics.h"
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE      (19200)
+/** Number of test cases for each instruction */
+#define NUM_TEST_CASES (1000)
+/** Size of the benchmark data buffer in bytes (has to be a multiple of 64) */
+#define BENCH_BYTES    (1024)
+/**@}*/
+
+
+// Global variables
+uint32_t aes_te0[256]; // software AES: combined SubBytes + MixColumns table (row 0)
+uint32_t aes_enc_rk[44], aes_dec_rk[44];
+uint32_t bench_data[BENCH_BYTES/4], bench_res_sw[BENCH_BYTES/4], bench_res_hw[BENCH_BYTES/4];
+
+// SHA-256 round constants
+const uint32_t sha256_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+// SHA-256 initial hash value
+const uint32_t sha256_h0[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// Prototypes
+uint32_t xorshift32(void);
+uint32_t check_instr(const char *name, uint32_t (*hw)(uint32_t, uint32_t), uint32_t (*sw)(uint32_t, uint32_t));
+uint32_t check_block(const char *name, const uint32_t *res, const uint32_t *ref, uint32_t num);
+void print_cpb(const char *name, uint32_t cycles, uint32_t bytes);
+void aes_setup(const uint32_t *key);
+void aes_enc_sw(const uint32_t *in, uint32_t *out);
+void aes_enc_hw(const uint32_t *in, uint32_t *out);
+void aes_dec_hw(const uint32_t *in, uint32_t *out);
+void sha256_block_sw(uint32_t *state, const uint32_t *block);
+void sha256_block_hw(uint32_t *state, const uint32_t *block);
+
+// Wrappers for the single-operand intrinsics
+uint32_t hw_brev8(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_brev8(a); }
+uint32_t sw_brev8(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_brev8(a); }
+uint32_t hw_zip(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_zip(a); }
+uint32_t sw_zip(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_zip(a); }
+uint32_t hw_unzip(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_unzip(a); }
+uint32_t sw_unzip(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_unzip(a); }
+uint32_t hw_sha256sum0(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_sha256sum0(a); }
+uint32_t sw_sha256sum0(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_sha256sum0(a); }
+uint32_t hw_sha256sum1(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_sha256sum1(a); }
+uint32_t sw_sha256sum1(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_sha256sum1(a); }
+uint32_t hw_sha256sig0(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_sha256sig0(a); }
+uint32_t sw_sha256sig0(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_sha256sig0(a); }
+uint32_t hw_sha256sig1(uint32_t a, uint32_t b) { (void)b; return riscv_intrinsic_sha256sig1(a); }
+uint32_t sw_sha256sig1(uint32_t a, uint32_t b) { (void)b; return riscv_emulate_sha256sig1(a); }
+
+// Intrinsics have to be wrapped to be callable via function pointers
+#define ZKN_WRAP(name) \
+  uint32_t hw_##name(uint32_t a, uint32_t b) { return riscv_intrinsic_##name(a, b); }
+#define ZKN_WRAP_AES(name, bs) \
+  uint32_t hw_##name##_##bs(uint32_t a, uint32_t b) { return riscv_intrinsic_##name(a, b, bs); } \
+  uint32_t sw_##name##_##bs(uint32_t a, uint32_t b) { return riscv_emulate_##name(a, b, bs); }
+
+ZKN_WRAP(pack)
+ZKN_WRAP(packh)
+ZKN_WRAP(xperm8)
+ZKN_WRAP(xperm4)
+ZKN_WRAP(sha512sum0r)
+ZKN_WRAP(sha512sum1r)
+ZKN_WRAP(sha512sig0l)
+ZKN_WRAP(sha512sig0h)
+ZKN_WRAP(sha512sig1l)
+ZKN_WRAP(sha512sig1h)
+ZKN_WRAP_AES(aes32esi, 0)
+ZKN_WRAP_AES(aes32esi, 3)
+ZKN_WRAP_AES(aes32esmi, 0)
+ZKN_WRAP_AES(aes32esmi, 1)
+ZKN_WRAP_AES(aes32esmi, 2)
+ZKN_WRAP_AES(aes32esmi, 3)
+ZKN_WRAP_AES(aes32dsi, 1)
+ZKN_WRAP_AES(aes32dsi, 2)
+ZKN_WRAP_AES(aes32dsmi, 0)
+ZKN_WRAP_AES(aes32dsmi, 1)
+ZKN_WRAP_AES(aes32dsmi, 2)
+ZKN_WRAP_AES(aes32dsmi, 3)
+
+
+/**********************************************************************//**
+ * Main function
+ *
+ * @note This program requires the scalar cryptography extension (CPU_EXTENSION_RISCV_Zkn) and UART0.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  // FIPS-197 appendix C.1 AES-128 test vector (little-endian column words)
+  const uint32_t aes_key[4] = {0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c};
+  const uint32_t aes_pt[4]  = {0x33221100, 0x77665544, 0xbbaa9988, 0xffeeddcc};
+  const uint32_t aes_ct[4]  = {0xd8e0c469, 0x30047b6a, 0x80b7cdd8, 0x5ac5b470};
+  // FIPS-180 SHA-256 test vector: "abc" (single padded block)
+  const uint32_t sha_ref[8] = {0xba7816bf, 0x8f01cfea, 0x414140de, 0x5dae2223,
+                               0xb00361a3, 0x96177a9c, 0xb410ff61, 0xf20015ad};
+  uint32_t sha_block[16], state_sw[8], state_hw[8], tmp[4];
+  uint32_t i, err_cnt = 0, t_start, cycles_sw, cycles_hw;
+
+  // capture all exceptions and give debug info via UART
+  cellrv32_rte_setup();
+
+  // setup UART0 at default baud rate, no interrupts
+  cellrv32_uart0_setup(BAUD_RATE, 0);
+
+  // check if UART0 is implemented
+  if (cellrv32_uart0_available() == 0) {
+    return 1; // UART0 not available, exit
+  }
+
+  // intro
+  cellrv32_uart0_printf("\n<<< CELLRV32 Scalar Cryptography ('Zkn') Test and Benchmark >>>\n\n");
+
+  // check if the scalar cryptography extension is implemented at all
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZKN)) == 0) {
+    cellrv32_uart0_printf("ERROR! Scalar cryptography ('Zkn' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+  // check if the cycle counter is implemented
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1 << CSR_MXISA_ZICNTR)) == 0) {
+    cellrv32_uart0_printf("ERROR! Base counters ('Zicntr' ISA extension) not implemented!\n");
+    return 1;
+  }
+
+
+  // instruction tests
+  cellrv32_uart0_printf("Instruction tests (%u test cases per instruction):\n", (uint32_t)NUM_TEST_CASES);
+  err_cnt += check_instr("pack",         hw_pack,         riscv_emulate_pack);
+  err_cnt += check_instr("packh",        hw_packh,        riscv_emulate_packh);
+  err_cnt += check_instr("brev8",        hw_brev8,        sw_brev8);
+  err_cnt += check_instr("zip",          hw_zip,          sw_zip);
+  err_cnt += check_instr("unzip",        hw_unzip,        sw_unzip);
+  err_cnt += check_instr("xperm8",       hw_xperm8,       riscv_emulate_xperm8);
+  err_cnt += check_instr("xperm4",       hw_xperm4,       riscv_emulate_xperm4);
+  err_cnt += check_instr("aes32esi(0)",  hw_aes32esi_0,   sw_aes32esi_0);
+  err_cnt += check_instr("aes32esi(3)",  hw_aes32esi_3,   sw_aes32esi_3);
+  err_cnt += check_instr("aes32esmi(0)", hw_aes32esmi_0,  sw_aes32esmi_0);
+  err_cnt += check_instr("aes32esmi(1)", hw_aes32esmi_1,  sw_aes32esmi_1);
+  err_cnt += check_instr("aes32esmi(2)", hw_aes32esmi_2,  sw_aes32esmi_2);
+  err_cnt += check_instr("aes32esmi(3)", hw_aes32esmi_3,  sw_aes32esmi_3);
+  err_cnt += check_instr("aes32dsi(1)",  hw_aes32dsi_1,   sw_aes32dsi_1);
+  err_cnt += check_instr("aes32dsi(2)",  hw_aes32dsi_2,   sw_aes32dsi_2);
+  err_cnt += check_instr("aes32dsmi(0)", hw_aes32dsmi_0,  sw_aes32dsmi_0);
+  err_cnt += check_instr("aes32dsmi(1)", hw_aes32dsmi_1,  sw_aes32dsmi_1);
+  err_cnt += check_instr("aes32dsmi(2)", hw_aes32dsmi_2,  sw_aes32dsmi_2);
+  err_cnt += check_instr("aes32dsmi(3)", hw_aes32dsmi_3,  sw_aes32dsmi_3);
+  err_cnt += check_instr("sha256sum0",   hw_sha256sum0,   sw_sha256sum0);
+  err_cnt += check_instr("sha256sum1",   hw_sha256sum1,   sw_sha256sum1);
+  err_cnt += check_instr("sha256sig0",   hw_sha256sig0,   sw_sha256sig0);
+  err_cnt += check_instr("sha256sig1",   hw_sha256sig1,   sw_sha256sig1);
+  err_cnt += check_instr("sha512sum0r",  hw_sha512sum0r,  riscv_emulate_sha512sum0r);
+  err_cnt += check_instr("sha512sum1r",  hw_sha512sum1r,  riscv_emulate_sha512sum1r);
+  err_cnt += check_instr("sha512sig0l",  hw_sha512sig0l,  riscv_emulate_sha512sig0l);
+  err_cnt += check_instr("sha512sig0h",  hw_sha512sig0h,  riscv_emulate_sha512sig0h);
+  err_cnt += check_instr("sha512sig1l",  hw_sha512sig1l,  riscv_emulate_sha512sig1l);
+  err_cnt += check_instr("sha512sig1h",  hw_sha512sig1h,  riscv_emulate_sha512sig1h);
+
+
+  // test vectors
+  cellrv32_uart0_printf("\nTest vectors:\n");
+  aes_setup(aes_key);
+
+  aes_enc_sw(aes_pt, tmp);
+  err_cnt += check_block("AES-128 encrypt (software)", tmp, aes_ct, 4);
+  aes_enc_hw(aes_pt, tmp);
+  err_cnt += check_block("AES-128 encrypt (Zkne)", tmp, aes_ct, 4);
+  aes_dec_hw(aes_ct, tmp);
+  err_cnt += check_block("AES-128 decrypt (Zknd)", tmp, aes_pt, 4);
+
+  for (i=0; i<16; i++) {
+    sha_block[i] = 0;
+  }
+  sha_block[0]  = 0x61626380; // "abc" + padding bit
+  sha_block[15] = 24; // message length in bits
+  for (i=0; i<8; i++) {
+    state_sw[i] = sha256_h0[i];
+    state_hw[i] = sha256_h0[i];
+  }
+  sha256_block_sw(state_sw, sha_block);
+  err_cnt += check_block("SHA-256 (software)", state_sw, sha_ref, 8);
+  sha256_block_hw(state_hw, sha_block);
+  err_cnt += check_block("SHA-256 (Zknh)", state_hw, sha_ref, 8);
+
+
+  // throughput benchmark
+  for (i=0; i<(BENCH_BYTES/4); i++) {
+    bench_data[i] = xorshift32();
+  }
+
+  cellrv32_uart0_printf("\nThroughput (%u bytes):\n", (uint32_t)BENCH_BYTES);
+
+  // AES-128 ECB encryption
+  t_start = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<(BENCH_BYTES/4); i+=4) {
+    aes_enc_sw(&bench_data[i], &bench_res_sw[i]);
+  }
+  cycles_sw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  t_start = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<(BENCH_BYTES/4); i+=4) {
+    aes_enc_hw(&bench_data[i], &bench_res_hw[i]);
+  }
+  cycles_hw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  print_cpb("AES-128 encrypt, T-table software", cycles_sw, BENCH_BYTES);
+  print_cpb("AES-128 encrypt, Zkne            ", cycles_hw, BENCH_BYTES);
+  err_cnt += check_block("AES-128 results", bench_res_hw, bench_res_sw, BENCH_BYTES/4);
+
+  // SHA-256 compression
+  for (i=0; i<8; i++) {
+    state_sw[i] = sha256_h0[i];
+    state_hw[i] = sha256_h0[i];
+  }
+
+  t_start = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<(BENCH_BYTES/4); i+=16) {
+    sha256_block_sw(state_sw, &bench_data[i]);
+  }
+  cycles_sw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  t_start = cellrv32_cpu_csr_read(CSR_MCYCLE);
+  for (i=0; i<(BENCH_BYTES/4); i+=16) {
+    sha256_block_hw(state_hw, &bench_data[i]);
+  }
+  cycles_hw = cellrv32_cpu_csr_read(CSR_MCYCLE) - t_start;
+
+  print_cpb("SHA-256, software                ", cycles_sw, BENCH_BYTES);
+  print_cpb("SHA-256, Zknh                    ", cycles_hw, BENCH_BYTES);
+  err_cnt += check_block("SHA-256 results", state_hw, state_sw, 8);
+
+
+  if (err_cnt) {
+    cellrv32_uart0_printf("\n%c[1m[%u errors]%c[0m\n", 27, err_cnt, 27);
+    return 1;
+  }
+
+  cellrv32_uart0_printf("\nProgram completed.\n");
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Check an instruction against its emulation function using pseudo-random operands.
+ *
+ * @param[in] name Instruction name.
+ * @param[in] hw Intrinsic wrapper (hardware).
+ * @param[in] sw Emulation function (software reference).
+ * @return Number of errors.
+ **************************************************************************/
+uint32_t check_instr(const char *name, uint32_t (*hw)(uint32_t, uint32_t), uint32_t (*sw)(uint32_t, uint32_t)) {
+
+  uint32_t i, opa, opb, res_hw, res_sw;
+
+  cellrv32_uart0_printf("  %s: ", name);
+
+  for (i=0; i<(uint32_t)NUM_TEST_CASES; i++) {
+    opa = xorshift32();
+    opb = xorshift32();
+    if (i & 1) { // small indices to exercise the valid crossbar range
+      opb &= 0x03030303;
+    }
+    res_hw = hw(opa, opb);
+    res_sw = sw(opa, opb);
+    if (res_hw != res_sw) {
+      cellrv32_uart0_printf("%c[1m[FAILED]%c[0m opa=0x%x, opb=0x%x: ref=0x%x, res=0x%x\n", 27, 27, opa, opb, res_sw, res_hw);
+      return 1;
+    }
+  }
+
+  cellrv32_uart0_printf("%c[1m[ok]%c[0m\n", 27, 27);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Compare a block of words against a reference.
+ *
+ * @param[in] name Test name.
+ * @param[in] res Pointer to result words.
+ * @param[in] ref Pointer to reference words.
+ * @param[in] num Number of words.
+ * @return Number of errors.
+ **************************************************************************/
+uint32_t check_block(const char *name, const uint32_t *res, const uint32_t *ref, uint32_t num) {
+
+  uint32_t i;
+
+  cellrv32_uart0_printf("  %s: ", name);
+
+  for (i=0; i<num; i++) {
+    if (res[i] != ref[i]) {
+      cellrv32_uart0_printf("%c[1m[FAILED]%c[0m word %u: ref=0x%x, res=0x%x\n", 27, 27, i, ref[i], res[i]);
+      return 1;
+    }
+  }
+
+  cellrv32_uart0_printf("%c[1m[ok]%c[0m\n", 27, 27);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Print cycles and cycles per byte (two fractional digits).
+ *
+ * @param[in] name Benchmark name.
+ * @param[in] cycles Number of cycles.
+ * @param[in] bytes Number of processed bytes.
+ **************************************************************************/
+void print_cpb(const char *name, uint32_t cycles, uint32_t bytes) {
+
+  cellrv32_uart0_printf("  %s: %u cycles = %u.%u%u cycles/byte\n", name, cycles, cycles / bytes,
+                        ((cycles * 10) / bytes) % 10, ((cycles * 100) / bytes) % 10);
+}
+
+
+/**********************************************************************//**
+ * AES-128 setup: build the software T-table and the encryption/decryption key schedules.
+ * The decryption key schedule (equivalent inverse cipher) applies InvMixColumns to the middle
+ * round keys by chaining aes32esi (SubBytes) and aes32dsmi (InvSubBytes + InvMixColumns).
+ *
+ * @param[in] key Pointer to 128-bit key (little-endian column words).
+ **************************************************************************/
+void aes_setup(const uint32_t *key) {
+
+  uint32_t i, t, u, rcon = 0x01;
+  uint8_t s;
+
+  // T-table: {03*S(x), S(x), S(x), 02*S(x)}
+  for (i=0; i<256; i++) {
+    s = zkn_aes_sbox[i];
+    aes_te0[i] = ((uint32_t)zkn_gfmul(s, 3) << 24) | ((uint32_t)s << 16) | ((uint32_t)s << 8) | (uint32_t)zkn_gfmul(s, 2);
+  }
+
+  // encryption key expansion
+  for (i=0; i<4; i++) {
+    aes_enc_rk[i] = key[i];
+  }
+  for (i=4; i<44; i++) {
+    t = aes_enc_rk[i-1];
+    if ((i & 3) == 0) {
+      t = zkn_ror32(t, 8); // RotWord
+      t = ((uint32_t)zkn_aes_sbox[(t >> 24) & 0xff] << 24) | ((uint32_t)zkn_aes_sbox[(t >> 16) & 0xff] << 16) |
+          ((uint32_t)zkn_aes_sbox[(t >>  8) & 0xff] <<  8) |  (uint32_t)zkn_aes_sbox[t & 0xff]; // SubWord
+      t ^= rcon;
+      rcon = zkn_gfmul((uint8_t)rcon, 2);
+    }
+    aes_enc_rk[i] = aes_enc_rk[i-4] ^ t;
+  }
+
+  // decryption key schedule (reversed round order, InvMixColumns on middle round keys)
+  for (i=0; i<44; i+=4) {
+    aes_dec_rk[i+0] = aes_enc_rk[40-i+0];
+    aes_dec_rk[i+1] = aes_enc_rk[40-i+1];
+    aes_dec_rk[i+2] = aes_enc_rk[40-i+2];
+    aes_dec_rk[i+3] = aes_enc_rk[40-i+3];
+  }
+  for (i=4; i<40; i++) {
+    t = aes_dec_rk[i];
+    u = 0;
+    u = riscv_intrinsic_aes32esi(u, t, 0);
+    u = riscv_intrinsic_aes32esi(u, t, 1);
+    u = riscv_intrinsic_aes32esi(u, t, 2);
+    u = riscv_intrinsic_aes32esi(u, t, 3);
+    t = 0;
+    t = riscv_intrinsic_aes32dsmi(t, u, 0);
+    t = riscv_intrinsic_aes32dsmi(t, u, 1);
+    t = riscv_intrinsic_aes32dsmi(t, u, 2);
+    t = riscv_intrinsic_aes32dsmi(t, u, 3);
+    aes_dec_rk[i] = t;
+  }
+}
+
+
+/**********************************************************************//**
+ * AES-128 block encryption, software (single T-table + rotations).
+ *
+ * @param[in] in Pointer to plaintext block (4 words).
+ * @param[in,out] out Pointer to ciphertext block (4 words).
+ **************************************************************************/
+void __attribute__ ((noinline)) aes_enc_sw(const uint32_t *in, uint32_t *out) {
+
+  const uint32_t *rk = aes_enc_rk;
+  uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+  int r;
+
+  s0 = in[0] ^ rk[0];
+  s1 = in[1] ^ rk[1];
+  s2 = in[2] ^ rk[2];
+  s3 = in[3] ^ rk[3];
+
+  for (r=1; r<10; r++) {
+    rk += 4;
+    t0 = rk[0] ^ aes_te0[s0 & 0xff] ^ zkn_ror32(aes_te0[(s1 >> 8) & 0xff], 24) ^ zkn_ror32(aes_te0[(s2 >> 16) & 0xff], 16) ^ zkn_ror32(aes_te0[s3 >> 24], 8);
+    t1 = rk[1] ^ aes_te0[s1 & 0xff] ^ zkn_ror32(aes_te0[(s2 >> 8) & 0xff], 24) ^ zkn_ror32(aes_te0[(s3 >> 16) & 0xff], 16) ^ zkn_ror32(aes_te0[s0 >> 24], 8);
+    t2 = rk[2] ^ aes_te0[s2 & 0xff] ^ zkn_ror32(aes_te0[(s3 >> 8) & 0xff], 24) ^ zkn_ror32(aes_te0[(s0 >> 16) & 0xff], 16) ^ zkn_ror32(aes_te0[s1 >> 24], 8);
+    t3 = rk[3] ^ aes_te0[s3 & 0xff] ^ zkn_ror32(aes_te0[(s0 >> 8) & 0xff], 24) ^ zkn_ror32(aes_te0[(s1 >> 16) & 0xff], 16) ^ zkn_ror32(aes_te0[s2 >> 24], 8);
+    s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+  }
+
+  // final round: no MixColumns (S-box byte of the T-table entry)
+  rk += 4;
+  out[0] = rk[0] ^ ((aes_te0[s0 & 0xff] >> 8) & 0xff) ^ (aes_te0[(s1 >> 8) & 0xff] & 0xff00) ^
+                   ((aes_te0[(s2 >> 16) & 0xff] << 8) & 0xff0000) ^ ((aes_te0[s3 >> 24] << 16) & 0xff000000);
+  out[1] = rk[1] ^ ((aes_te0[s1 & 0xff] >> 8) & 0xff) ^ (aes_te0[(s2 >> 8) & 0xff] & 0xff00) ^
+                   ((aes_te0[(s3 >> 16) & 0xff] << 8) & 0xff0000) ^ ((aes_te0[s0 >> 24] << 16) & 0xff000000);
+  out[2] = rk[2] ^ ((aes_te0[s2 & 0xff] >> 8) & 0xff) ^ (aes_te0[(s3 >> 8) & 0xff] & 0xff00) ^
+                   ((aes_te0[(s0 >> 16) & 0xff] << 8) & 0xff0000) ^ ((aes_te0[s1 >> 24] << 16) & 0xff000000);
+  out[3] = rk[3] ^ ((aes_te0[s3 & 0xff] >> 8) & 0xff) ^ (aes_te0[(s0 >> 8) & 0xff] & 0xff00) ^
+                   ((aes_te0[(s1 >> 16) & 0xff] << 8) & 0xff0000) ^ ((aes_te0[s2 >> 24] << 16) & 0xff000000);
+}
+
+
+/**********************************************************************//**
+ * AES-128 block encryption using the Zkne instructions (no tables).
+ *
+ * @param[in] in Pointer to plaintext block (4 words).
+ * @param[in,out] out Pointer to ciphertext block (4 words).
+ **************************************************************************/
+void __attribute__ ((noinline)) aes_enc_hw(const uint32_t *in, uint32_t *out) {
+
+  const uint32_t *rk = aes_enc_rk;
+  uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+  int r;
+
+  s0 = in[0] ^ rk[0];
+  s1 = in[1] ^ rk[1];
+  s2 = in[2] ^ rk[2];
+  s3 = in[3] ^ rk[3];
+
+  for (r=1; r<10; r++) {
+    rk += 4;
+    t0 = riscv_intrinsic_aes32esmi(rk[0], s0, 0);
+    t1 = riscv_intrinsic_aes32esmi(rk[1], s1, 0);
+    t2 = riscv_intrinsic_aes32esmi(rk[2], s2, 0);
+    t3 = riscv_intrinsic_aes32esmi(rk[3], s3, 0);
+    t0 = riscv_intrinsic_aes32esmi(t0, s1, 1);
+    t1 = riscv_intrinsic_aes32esmi(t1, s2, 1);
+    t2 = riscv_intrinsic_aes32esmi(t2, s3, 1);
+    t3 = riscv_intrinsic_aes32esmi(t3, s0, 1);
+    t0 = riscv_intrinsic_aes32esmi(t0, s2, 2);
+    t1 = riscv_intrinsic_aes32esmi(t1, s3, 2);
+    t2 = riscv_intrinsic_aes32esmi(t2, s0, 2);
+    t3 = riscv_intrinsic_aes32esmi(t3, s1, 2);
+    t0 = riscv_intrinsic_aes32esmi(t0, s3, 3);
+    t1 = riscv_intrinsic_aes32esmi(t1, s0, 3);
+    t2 = riscv_intrinsic_aes32esmi(t2, s1, 3);
+    t3 = riscv_intrinsic_aes32esmi(t3, s2, 3);
+    s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+  }
+
+  // final round: no MixColumns
+  rk += 4;
+  t0 = riscv_intrinsic_aes32esi(rk[0], s0, 0);
+  t1 = riscv_intrinsic_aes32esi(rk[1], s1, 0);
+  t2 = riscv_intrinsic_aes32esi(rk[2], s2, 0);
+  t3 = riscv_intrinsic_aes32esi(rk[3], s3, 0);
+  t0 = riscv_intrinsic_aes32esi(t0, s1, 1);
+  t1 = riscv_intrinsic_aes32esi(t1, s2, 1);
+  t2 = riscv_intrinsic_aes32esi(t2, s3, 1);
+  t3 = riscv_intrinsic_aes32esi(t3, s0, 1);
+  t0 = riscv_intrinsic_aes32esi(t0, s2, 2);
+  t1 = riscv_intrinsic_aes32esi(t1, s3, 2);
+  t2 = riscv_intrinsic_aes32esi(t2, s0, 2);
+  t3 = riscv_intrinsic_aes32esi(t3, s1, 2);
+  out[0] = riscv_intrinsic_aes32esi(t0, s3, 3);
+  out[1] = riscv_intrinsic_aes32esi(t1, s0, 3);
+  out[2] = riscv_intrinsic_aes32esi(t2, s1, 3);
+  out[3] = riscv_intrinsic_aes32esi(t3, s2, 3);
+}
+
+
+/**********************************************************************//**
+ * AES-128 block decryption using the Zknd instructions (equivalent inverse cipher).
+ *
+ * @param[in] in Pointer to ciphertext block (4 words).
+ * @param[in,out] out Pointer to plaintext block (4 words).
+ **************************************************************************/
+void __attribute__ ((noinline)) aes_dec_hw(const uint32_t *in, uint32_t *out) {
+
+  const uint32_t *rk = aes_dec_rk;
+  uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+  int r;
+
+  s0 = in[0] ^ rk[0];
+  s1 = in[1] ^ rk[1];
+  s2 = in[2] ^ rk[2];
+  s3 = in[3] ^ rk[3];
+
+  for (r=1; r<10; r++) {
+    rk += 4;
+    t0 = riscv_intrinsic_aes32dsmi(rk[0], s0, 0);
+    t1 = riscv_intrinsic_aes32dsmi(rk[1], s1, 0);
+    t2 = riscv_intrinsic_aes32dsmi(rk[2], s2, 0);
+    t3 = riscv_intrinsic_aes32dsmi(rk[3], s3, 0);
+    t0 = riscv_intrinsic_aes32dsmi(t0, s3, 1);
+    t1 = riscv_intrinsic_aes32dsmi(t1, s0, 1);
+    t2 = riscv_intrinsic_aes32dsmi(t2, s1, 1);
+    t3 = riscv_intrinsic_aes32dsmi(t3, s2, 1);
+    t0 = riscv_intrinsic_aes32dsmi(t0, s2, 2);
+    t1 = riscv_intrinsic_aes32dsmi(t1, s3, 2);
+    t2 = riscv_intrinsic_aes32dsmi(t2, s0, 2);
+    t3 = riscv_intrinsic_aes32dsmi(t3, s1, 2);
+    t0 = riscv_intrinsic_aes32dsmi(t0, s1, 3);
+    t1 = riscv_intrinsic_aes32dsmi(t1, s2, 3);
+    t2 = riscv_intrinsic_aes32dsmi(t2, s3, 3);
+    t3 = riscv_intrinsic_aes32dsmi(t3, s0, 3);
+    s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+  }
+
+  // final round: no InvMixColumns
+  rk += 4;
+  t0 = riscv_intrinsic_aes32dsi(rk[0], s0, 0);
+  t1 = riscv_intrinsic_aes32dsi(rk[1], s1, 0);
+  t2 = riscv_intrinsic_aes32dsi(rk[2], s2, 0);
+  t3 = riscv_intrinsic_aes32dsi(rk[3], s3, 0);
+  t0 = riscv_intrinsic_aes32dsi(t0, s3, 1);
+  t1 = riscv_intrinsic_aes32dsi(t1, s0, 1);
+  t2 = riscv_intrinsic_aes32dsi(t2, s1, 1);
+  t3 = riscv_intrinsic_aes32dsi(t3, s2, 1);
+  t0 = riscv_intrinsic_aes32dsi(t0, s2, 2);
+  t1 = riscv_intrinsic_aes32dsi(t1, s3, 2);
+  t2 = riscv_intrinsic_aes32dsi(t2, s0, 2);
+  t3 = riscv_intrinsic_aes32dsi(t3, s1, 2);
+  out[0] = riscv_intrinsic_aes32dsi(t0, s1, 3);
+  out[1] = riscv_intrinsic_aes32dsi(t1, s2, 3);
+  out[2] = riscv_intrinsic_aes32dsi(t2, s3, 3);
+  out[3] = riscv_intrinsic_aes32dsi(t3, s0, 3);
+}
+
+
+/**********************************************************************//**
+ * SHA-256 compression function template; the four sigma functions are passed as macros.
+ **************************************************************************/
+#define SHA256_BLOCK(STATE, BLOCK, SUM0, SUM1, SIG0, SIG1)                     \
+{                                                                              \
+  uint32_t w[64], a, b, c, d, e, f, g, h, t1, t2;                              \
+  int i;                                                                       \
+                                                                               \
+  for (i=0; i<16; i++) {                                                       \
+    w[i] = BLOCK[i];                                                           \
+  }                                                                            \
+  for (i=16; i<64; i++) {                                                      \
+    w[i] = SIG1(w[i-2]) + w[i-7] + SIG0(w[i-15]) + w[i-16];                    \
+  }                                                                            \
+                                                                               \
+  a = STATE[0]; b = STATE[1]; c = STATE[2]; d = STATE[3];                      \
+  e = STATE[4]; f = STATE[5]; g = STATE[6]; h = STATE[7];                      \
+                                                                               \
+  for (i=0; i<64; i++) {                                                       \
+    t1 = h + SUM1(e) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];              \
+    t2 = SUM0(a) + ((a & b) ^ (a & c) ^ (b & c));                              \
+    h = g; g = f; f = e; e = d + t1;                                           \
+    d = c; c = b; b = a; a = t1 + t2;                                          \
+  }                                                                            \
+                                                                               \
+  STATE[0] += a; STATE[1] += b; STATE[2] += c; STATE[3] += d;                  \
+  STATE[4] += e; STATE[5] += f; STATE[6] += g; STATE[7] += h;                  \
+}
+
+#define SHA256_SW_SUM0(x) (zkn_ror32(x, 2) ^ zkn_ror32(x, 13) ^ zkn_ror32(x, 22))
+#define SHA256_SW_SUM1(x) (zkn_ror32(x, 6) ^ zkn_ror32(x, 11) ^ zkn_ror32(x, 25))
+#define SHA256_SW_SIG0(x) (zkn_ror32(x, 7) ^ zkn_ror32(x, 18) ^ ((x) >> 3))
+#define SHA256_SW_SIG1(x) (zkn_ror32(x, 17) ^ zkn_ror32(x, 19) ^ ((x) >> 10))
+
+
+/**********************************************************************//**
+ * SHA-256 compression of one 512-bit block, software.
+ *
+ * @param[in,out] state Pointer to hash state (8 words).
+ * @param[in] block Pointer to message block (16 big-endian words).
+ **************************************************************************/
+void __attribute__ ((noinline)) sha256_block_sw(uint32_t *state, const uint32_t *block) {
+
+  SHA256_BLOCK(state, block, SHA256_SW_SUM0, SHA256_SW_SUM1, SHA256_SW_SIG0, SHA256_SW_SIG1)
+}
+
+
+/**********************************************************************//**
+ * SHA-256 compression of one 512-bit block using the Zknh instructions.
+ *
+ * @param[in,out] state Pointer to hash state (8 words).
+ * @param[in] block Pointer to message block (16 big-endian words).
+ **************************************************************************/
+void __attribute__ ((noinline)) sha256_block_hw(uint32_t *state, const uint32_t *block) {
+
+  SHA256_BLOCK(state, block, riscv_intrinsic_sha256sum0, riscv_intrinsic_sha256sum1, riscv_intrinsic_sha256sig0, riscv_intrinsic_sha256sig1)
+}
+
+
+/**********************************************************************//**
+ * Pseudo-random number generator (to generate deterministic test data).
+ *
+ * @return Random data (32-bit).
+ **************************************************************************/
+uint32_t xorshift32(void) {
+
+  static uint32_t x32 = 314159265;
+
+  x32 ^= x32 << 13;
+  x32 ^= x32 >> 17;
+  x32 ^= x32 << 5;
+
+  return x32;
+}
@@ -0,0 +1,709 @@
+// #################################################################################################
+// # << CELLRV32 - Intrinsics + Emulation Functions for the Scalar Cryptography Extension (Zkn) >> #
+// # ********************************************************************************************* #
+// # The intrinsics provided by this library allow to use the scalar cryptography instructions     #
+// # (Zbkb, Zbkx, Zkne, Zknd, Zknh) without the need for compiler support.                         #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file demo_zkn/zkn_intrinsics.h
+ * @author Dat Nguyen
+ * @brief "Intrinsic" library for the CELLRV32 scalar cryptography instructions (CPU_EXTENSION_RISCV_Zkn).
+ * Also provides emulation functions for all intrinsics (functionality re-built in pure software).
+ *
+ * @note The AES byte select "bs" has to be a constant (0..3) as it is encoded in the instruction word.
+ **************************************************************************/
+ 
+#ifndef zkn_intrinsics_h
+#define zkn_intrinsics_h
+
+
+// ################################################################################################
+// Intrinsics
+// ################################################################################################
+
+
+/**********************************************************************//**
+ * Zbkb: Pack low halves of rs1 and rs2 [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_pack(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000100, rs2, rs1, 0b100, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Pack low bytes of rs1 and rs2 [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_packh(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000100, rs2, rs1, 0b111, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Reverse bits in each byte [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_brev8(uint32_t rs1) {
+
+  return CUSTOM_INSTR_R2_TYPE(0b0110100, 0b00111, rs1, 0b101, 0b0010011);
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Bit-interleave lower and upper half [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_zip(uint32_t rs1) {
+
+  return CUSTOM_INSTR_R2_TYPE(0b0000100, 0b01111, rs1, 0b001, 0b0010011);
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Bit-deinterleave into lower and upper half [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_unzip(uint32_t rs1) {
+
+  return CUSTOM_INSTR_R2_TYPE(0b0000100, 0b01111, rs1, 0b101, 0b0010011);
+}
+
+
+/**********************************************************************//**
+ * Zbkx: Byte-wise crossbar permutation (rs1 = table, rs2 = indices) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_xperm8(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010100, rs2, rs1, 0b100, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zbkx: Nibble-wise crossbar permutation (rs1 = table, rs2 = indices) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_xperm4(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010100, rs2, rs1, 0b010, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sum0 function [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha256sum0(uint32_t rs1) {
+
+  return CUSTOM_INSTR_R2_TYPE(0b0001000, 0b00000, rs1, 0b001, 0b0010011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sum1 function [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha256sum1(uint32_t rs1) {
+
+  return CUSTOM_INSTR_R2_TYPE(0b0001000, 0b00001, rs1, 0b001, 0b0010011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sigma0 function [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha256sig0(uint32_t rs1) {
+
+  return CUSTOM_INSTR_R2_TYPE(0b0001000, 0b00010, rs1, 0b001, 0b0010011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sigma1 function [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha256sig1(uint32_t rs1) {
+
+  return CUSTOM_INSTR_R2_TYPE(0b0001000, 0b00011, rs1, 0b001, 0b0010011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sum0, one half (rs1/rs2 = low/high or high/low word) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha512sum0r(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0101000, rs2, rs1, 0b000, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sum1, one half (rs1/rs2 = low/high or high/low word) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha512sum1r(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0101001, rs2, rs1, 0b000, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma0, low word (rs1 = low, rs2 = high) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha512sig0l(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0101010, rs2, rs1, 0b000, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma0, high word (rs1 = high, rs2 = low) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha512sig0h(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0101110, rs2, rs1, 0b000, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma1, low word (rs1 = low, rs2 = high) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha512sig1l(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0101011, rs2, rs1, 0b000, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma1, high word (rs1 = high, rs2 = low) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_sha512sig1h(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0101111, rs2, rs1, 0b000, 0b0110011);
+}
+
+
+/**********************************************************************//**
+ * Zkne: AES final round encryption (SubBytes of byte bs of rs2, rotated into place and XORed to rs1) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1 (accumulator).
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (constant, 0..3).
+ * @return Result.
+ **************************************************************************/
+#define riscv_intrinsic_aes32esi(rs1, rs2, bs) CUSTOM_INSTR_R3_TYPE((((bs) << 5) | 0b0010001), rs2, rs1, 0b000, 0b0110011)
+
+
+/**********************************************************************//**
+ * Zkne: AES middle round encryption (SubBytes + MixColumns of byte bs of rs2, rotated into place and XORed to rs1) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1 (accumulator).
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (constant, 0..3).
+ * @return Result.
+ **************************************************************************/
+#define riscv_intrinsic_aes32esmi(rs1, rs2, bs) CUSTOM_INSTR_R3_TYPE((((bs) << 5) | 0b0010011), rs2, rs1, 0b000, 0b0110011)
+
+
+/**********************************************************************//**
+ * Zknd: AES final round decryption (InvSubBytes of byte bs of rs2, rotated into place and XORed to rs1) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1 (accumulator).
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (constant, 0..3).
+ * @return Result.
+ **************************************************************************/
+#define riscv_intrinsic_aes32dsi(rs1, rs2, bs) CUSTOM_INSTR_R3_TYPE((((bs) << 5) | 0b0010101), rs2, rs1, 0b000, 0b0110011)
+
+
+/**********************************************************************//**
+ * Zknd: AES middle round decryption (InvSubBytes + InvMixColumns of byte bs of rs2, rotated into place and XORed to rs1) [intrinsic].
+ *
+ * @param[in] rs1 Source operand 1 (accumulator).
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (constant, 0..3).
+ * @return Result.
+ **************************************************************************/
+#define riscv_intrinsic_aes32dsmi(rs1, rs2, bs) CUSTOM_INSTR_R3_TYPE((((bs) << 5) | 0b0010111), rs2, rs1, 0b000, 0b0110011)
+
+
+// ################################################################################################
+// Emulation functions
+// ################################################################################################
+
+
+/**********************************************************************//**
+ * AES forward S-box (emulation only).
+ **************************************************************************/
+static const uint8_t zkn_aes_sbox[256] = {
+  0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+  0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+  0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+  0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+  0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+  0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+  0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+  0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+  0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+  0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+  0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+  0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+  0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+  0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+  0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+  0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+
+/**********************************************************************//**
+ * AES inverse S-box (emulation only).
+ **************************************************************************/
+static const uint8_t zkn_aes_inv_sbox[256] = {
+  0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
+  0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
+  0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+  0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
+  0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
+  0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+  0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
+  0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02, 0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
+  0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+  0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
+  0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89, 0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
+  0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+  0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
+  0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d, 0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
+  0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+  0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
+};
+
+
+/**********************************************************************//**
+ * Rotate right (emulation helper).
+ *
+ * @param[in] x Input word.
+ * @param[in] n Rotation amount (1..31).
+ * @return Rotated word.
+ **************************************************************************/
+uint32_t zkn_ror32(uint32_t x, uint32_t n) {
+
+  return (x >> n) | (x << (32 - n));
+}
+
+
+/**********************************************************************//**
+ * GF(2^8) multiplication with AES polynomial (emulation helper).
+ *
+ * @param[in] a Factor 1.
+ * @param[in] b Factor 2.
+ * @return Product.
+ **************************************************************************/
+uint8_t zkn_gfmul(uint8_t a, uint8_t b) {
+
+  uint8_t p = 0;
+
+  while (b) {
+    if (b & 1) {
+      p ^= a;
+    }
+    a = (uint8_t)((a << 1) ^ ((a & 0x80) ? 0x1b : 0x00));
+    b >>= 1;
+  }
+  return p;
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Pack low halves of rs1 and rs2 [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_pack(uint32_t rs1, uint32_t rs2) {
+
+  return (rs2 << 16) | (rs1 & 0xffff);
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Pack low bytes of rs1 and rs2 [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_packh(uint32_t rs1, uint32_t rs2) {
+
+  return ((rs2 & 0xff) << 8) | (rs1 & 0xff);
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Reverse bits in each byte [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_brev8(uint32_t rs1) {
+
+  uint32_t i, res = 0;
+
+  for (i=0; i<32; i++) {
+    if (rs1 & (1 << i)) {
+      res |= 1 << ((i & ~7) + (7 - (i & 7)));
+    }
+  }
+  return res;
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Bit-interleave lower and upper half [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_zip(uint32_t rs1) {
+
+  uint32_t i, res = 0;
+
+  for (i=0; i<16; i++) {
+    res |= ((rs1 >> i) & 1) << (2*i);
+    res |= ((rs1 >> (i+16)) & 1) << (2*i+1);
+  }
+  return res;
+}
+
+
+/**********************************************************************//**
+ * Zbkb: Bit-deinterleave into lower and upper half [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_unzip(uint32_t rs1) {
+
+  uint32_t i, res = 0;
+
+  for (i=0; i<16; i++) {
+    res |= ((rs1 >> (2*i)) & 1) << i;
+    res |= ((rs1 >> (2*i+1)) & 1) << (i+16);
+  }
+  return res;
+}
+
+
+/**********************************************************************//**
+ * Zbkx: Byte-wise crossbar permutation (rs1 = table, rs2 = indices) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_xperm8(uint32_t rs1, uint32_t rs2) {
+
+  uint32_t i, idx, res = 0;
+
+  for (i=0; i<32; i+=8) {
+    idx = (rs2 >> i) & 0xff;
+    if (idx < 4) {
+      res |= ((rs1 >> (8*idx)) & 0xff) << i;
+    }
+  }
+  return res;
+}
+
+
+/**********************************************************************//**
+ * Zbkx: Nibble-wise crossbar permutation (rs1 = table, rs2 = indices) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_xperm4(uint32_t rs1, uint32_t rs2) {
+
+  uint32_t i, idx, res = 0;
+
+  for (i=0; i<32; i+=4) {
+    idx = (rs2 >> i) & 0xf;
+    if (idx < 8) {
+      res |= ((rs1 >> (4*idx)) & 0xf) << i;
+    }
+  }
+  return res;
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sum0 function [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha256sum0(uint32_t rs1) {
+
+  return zkn_ror32(rs1, 2) ^ zkn_ror32(rs1, 13) ^ zkn_ror32(rs1, 22);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sum1 function [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha256sum1(uint32_t rs1) {
+
+  return zkn_ror32(rs1, 6) ^ zkn_ror32(rs1, 11) ^ zkn_ror32(rs1, 25);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sigma0 function [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha256sig0(uint32_t rs1) {
+
+  return zkn_ror32(rs1, 7) ^ zkn_ror32(rs1, 18) ^ (rs1 >> 3);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-256 Sigma1 function [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha256sig1(uint32_t rs1) {
+
+  return zkn_ror32(rs1, 17) ^ zkn_ror32(rs1, 19) ^ (rs1 >> 10);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sum0, one half (rs1/rs2 = low/high or high/low word) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha512sum0r(uint32_t rs1, uint32_t rs2) {
+
+  return (rs1 << 25) ^ (rs1 << 30) ^ (rs1 >> 28) ^ (rs2 >> 7) ^ (rs2 >> 2) ^ (rs2 << 4);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sum1, one half (rs1/rs2 = low/high or high/low word) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha512sum1r(uint32_t rs1, uint32_t rs2) {
+
+  return (rs1 << 23) ^ (rs1 >> 14) ^ (rs1 >> 18) ^ (rs2 >> 9) ^ (rs2 << 18) ^ (rs2 << 14);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma0, low word (rs1 = low, rs2 = high) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha512sig0l(uint32_t rs1, uint32_t rs2) {
+
+  return (rs1 >> 1) ^ (rs1 >> 7) ^ (rs1 >> 8) ^ (rs2 << 31) ^ (rs2 << 25) ^ (rs2 << 24);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma0, high word (rs1 = high, rs2 = low) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha512sig0h(uint32_t rs1, uint32_t rs2) {
+
+  return (rs1 >> 1) ^ (rs1 >> 7) ^ (rs1 >> 8) ^ (rs2 << 31) ^ (rs2 << 24);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma1, low word (rs1 = low, rs2 = high) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha512sig1l(uint32_t rs1, uint32_t rs2) {
+
+  return (rs1 << 3) ^ (rs1 >> 6) ^ (rs1 >> 19) ^ (rs2 >> 29) ^ (rs2 << 26) ^ (rs2 << 13);
+}
+
+
+/**********************************************************************//**
+ * Zknh: SHA-512 Sigma1, high word (rs1 = high, rs2 = low) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_sha512sig1h(uint32_t rs1, uint32_t rs2) {
+
+  return (rs1 << 3) ^ (rs1 >> 6) ^ (rs1 >> 19) ^ (rs2 >> 29) ^ (rs2 << 13);
+}
+
+
+/**********************************************************************//**
+ * Zkne: AES final round encryption (SubBytes of byte bs of rs2, rotated into place and XORed to rs1) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (0..3).
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_aes32esi(uint32_t rs1, uint32_t rs2, uint32_t bs) {
+
+  uint8_t so = zkn_aes_sbox[(rs2 >> (8*(bs & 3))) & 0xff];
+  uint32_t mix;
+
+  mix = so;
+
+  if ((bs & 3) == 0) {
+    return rs1 ^ mix;
+  }
+  return rs1 ^ ((mix << (8*(bs & 3))) | (mix >> (32 - 8*(bs & 3))));
+}
+
+
+/**********************************************************************//**
+ * Zkne: AES middle round encryption (SubBytes + MixColumns of byte bs of rs2, rotated into place and XORed to rs1) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (0..3).
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_aes32esmi(uint32_t rs1, uint32_t rs2, uint32_t bs) {
+
+  uint8_t so = zkn_aes_sbox[(rs2 >> (8*(bs & 3))) & 0xff];
+  uint32_t mix;
+
+  mix = ((uint32_t)zkn_gfmul(so, 3) << 24) | ((uint32_t)so << 16) | ((uint32_t)so << 8) | (uint32_t)zkn_gfmul(so, 2);
+
+  if ((bs & 3) == 0) {
+    return rs1 ^ mix;
+  }
+  return rs1 ^ ((mix << (8*(bs & 3))) | (mix >> (32 - 8*(bs & 3))));
+}
+
+
+/**********************************************************************//**
+ * Zknd: AES final round decryption (InvSubBytes of byte bs of rs2, rotated into place and XORed to rs1) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (0..3).
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_aes32dsi(uint32_t rs1, uint32_t rs2, uint32_t bs) {
+
+  uint8_t so = zkn_aes_inv_sbox[(rs2 >> (8*(bs & 3))) & 0xff];
+  uint32_t mix;
+
+  mix = so;
+
+  if ((bs & 3) == 0) {
+    return rs1 ^ mix;
+  }
+  return rs1 ^ ((mix << (8*(bs & 3))) | (mix >> (32 - 8*(bs & 3))));
+}
+
+
+/**********************************************************************//**
+ * Zknd: AES middle round decryption (InvSubBytes + InvMixColumns of byte bs of rs2, rotated into place and XORed to rs1) [emulation].
+ *
+ * @param[in] rs1 Source operand 1.
+ * @param[in] rs2 Source operand 2.
+ * @param[in] bs Byte select (0..3).
+ * @return Result.
+ **************************************************************************/
+uint32_t riscv_emulate_aes32dsmi(uint32_t rs1, uint32_t rs2, uint32_t bs) {
+
+  uint8_t so = zkn_aes_inv_sbox[(rs2 >> (8*(bs & 3))) & 0xff];
+  uint32_t mix;
+
+  mix = ((uint32_t)zkn_gfmul(so, 0x0b) << 24) | ((uint32_t)zkn_gfmul(so, 0x0d) << 16) |
+        ((uint32_t)zkn_gfmul(so, 0x09) <<  8) |  (uint32_t)zkn_gfmul(so, 0x0e);
+
+  if ((bs & 3) == 0) {
+    return rs1 ^ mix;
+  }
+  return rs1 ^ ((mix << (8*(bs & 3))) | (mix >> (32 - 8*(bs & 3))));
+}
+
+
+#endif // zkn_intrinsics_h
@@ -470,13 +470,13 @@ inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fclasss(float rs
 
 
 // ################################################################################################
-// !!! UNSUPPORTED instructions !!!
+// !!! UNSUPPORTED instructions (available only if FPU_PERF is enabled) !!!
 // ################################################################################################
 
 /**********************************************************************//**
  * Single-precision floating-point fused multiply-add
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction is only supported if FPU_PERF is enabled; it raises an illegal instruction exception otherwise.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -498,7 +498,7 @@ inline float __attribute__ ((always_inline)) riscv_intrinsic_fmadds(float rs1, f
 /**********************************************************************//**
  * Single-precision floating-point fused multiply-sub
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction is only supported if FPU_PERF is enabled; it raises an illegal instruction exception otherwise.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -520,7 +520,7 @@ inline float __attribute__ ((always_inline)) riscv_intrinsic_fmsubs(float rs1, f
 /**********************************************************************//**
  * Single-precision floating-point fused negated multiply-sub
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction is only supported if FPU_PERF is enabled; it raises an illegal instruction exception otherwise.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -542,7 +542,7 @@ inline float __attribute__ ((always_inline)) riscv_intrinsic_fnmsubs(float rs1,
 /**********************************************************************//**
  * Single-precision floating-point fused negated multiply-add
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction is only supported if FPU_PERF is enabled; it raises an illegal instruction exception otherwise.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -1058,7 +1058,7 @@ float __attribute__ ((noinline)) riscv_emulate_fsqrts(float rs1) {
 /**********************************************************************//**
  * Single-precision floating-point fused multiply-add
  *
- * @warning This instruction is not supported!
+ * @note The result is rounded only once (fused operation).
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -1071,7 +1071,7 @@ float __attribute__ ((noinline)) riscv_emulate_fmadds(float rs1, float rs2, floa
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = (opa * opb) + opc;
+  float res = fmaf(opa, opb, opc);
   return subnormal_flush(res);
 }
 
@@ -1090,7 +1090,7 @@ float __attribute__ ((noinline)) riscv_emulate_fmsubs(float rs1, float rs2, floa
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = (opa * opb) - opc;
+  float res = fmaf(opa, opb, -opc);
   return subnormal_flush(res);
 }
 
@@ -1109,7 +1109,7 @@ float __attribute__ ((noinline)) riscv_emulate_fnmsubs(float rs1, float rs2, flo
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = -(opa * opb) + opc;
+  float res = fmaf(-opa, opb, opc);
   return subnormal_flush(res);
 }
 
@@ -1128,7 +1128,7 @@ float __attribute__ ((noinline)) riscv_emulate_fnmadds(float rs1, float rs2, flo
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = -(opa * opb) - opc;
+  float res = fmaf(-opa, opb, -opc);
   return subnormal_flush(res);
 }
 
@@ -54,8 +54,8 @@
 #define RUN_SGNINJ_TESTS   (1)
 //** Run classify tests when != 0 */
 #define RUN_CLASSIFY_TESTS (1)
-//** Run unsupported instructions tests when != 0 */
-#define RUN_UNAVAIL_TESTS  (0)
+//** Run fused multiply-add tests when != 0 (requires FPU_PERF) */
+#define RUN_FMA_TESTS      (0)
 //** Run average instruction execution time test when != 0 */
 #define RUN_TIMING_TESTS   (0)
 /**@}*/
@@ -450,10 +450,10 @@ int main() {
 
  
 // ----------------------------------------------------------------------------
-// Unsupported Instructions Tests
+// Fused Multiply-Add Tests (FPU_PERF only)
 // ----------------------------------------------------------------------------
 
-#if (RUN_UNAVAIL_TESTS != 0)
+#if (RUN_FMA_TESTS != 0)
 // ----------------------------------------------------------------------------
 // Fused-Multiply Add/Sub Tests
 // ----------------------------------------------------------------------------
@@ -449,13 +449,13 @@ inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fclasss(int16_t
 
 
 // ################################################################################################
-// !!! UNSUPPORTED instructions !!!
+// Fused multiply-add instructions (require CPU_FP16_SIMD)
 // ################################################################################################
 
 /**********************************************************************//**
  * Half-precision floating-point fused multiply-add
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction raises an illegal instruction exception if CPU_FP16_SIMD is not implemented.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -471,7 +471,7 @@ inline int32_t __attribute__ ((always_inline)) riscv_intrinsic_fmadds(int16_t rs
 /**********************************************************************//**
  * Half-precision floating-point fused multiply-sub
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction raises an illegal instruction exception if CPU_FP16_SIMD is not implemented.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -487,7 +487,7 @@ inline int32_t __attribute__ ((always_inline)) riscv_intrinsic_fmsubs(int16_t rs
 /**********************************************************************//**
  * Half-precision floating-point fused negated multiply-sub
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction raises an illegal instruction exception if CPU_FP16_SIMD is not implemented.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -503,7 +503,7 @@ inline int32_t __attribute__ ((always_inline)) riscv_intrinsic_fnmsubs(int16_t r
 /**********************************************************************//**
  * Half-precision floating-point fused negated multiply-add
  *
- * @warning This instruction is not supported and should raise an illegal instruction exception when executed.
+ * @warning This instruction raises an illegal instruction exception if CPU_FP16_SIMD is not implemented.
  *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
@@ -516,6 +516,162 @@ inline int32_t __attribute__ ((always_inline)) riscv_intrinsic_fnmadds(int16_t r
 }
 
 
+// ################################################################################################
+// Packed-SIMD instructions (2x FP16 in one x register, custom "Xhsimd", require CPU_FP16_SIMD)
+// ################################################################################################
+
+/**********************************************************************//**
+ * Pack two half-precision floating-point values into one register
+ *
+ * @param[in] lo Lane 0 (bits 15:0).
+ * @param[in] hi Lane 1 (bits 31:16).
+ * @return Packed value.
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_pack_ph(uint16_t lo, uint16_t hi) {
+
+  return ((uint32_t)hi << 16) | (uint32_t)lo;
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point addition
+ *
+ * @note Custom encoding: FADD with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fadd_ph(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000011, rs2, rs1, 0b000, 0b1010011);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point subtraction
+ *
+ * @note Custom encoding: FSUB with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fsub_ph(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0000111, rs2, rs1, 0b000, 0b1010011);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point multiplication
+ *
+ * @note Custom encoding: FMUL with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fmul_ph(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0001011, rs2, rs1, 0b000, 0b1010011);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point minimum
+ *
+ * @note Custom encoding: FMIN with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fmin_ph(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010111, rs2, rs1, 0b000, 0b1010011);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point maximum
+ *
+ * @note Custom encoding: FMAX with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fmax_ph(uint32_t rs1, uint32_t rs2) {
+
+  return CUSTOM_INSTR_R3_TYPE(0b0010111, rs2, rs1, 0b001, 0b1010011);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point fused multiply-add
+ *
+ * @note Custom encoding: FMADD with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @param[in] rs3 Source operand 3 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fmadd_ph(uint32_t rs1, uint32_t rs2, uint32_t rs3) {
+
+  return CUSTOM_INSTR_R4_TYPE(rs3, rs2, rs1, 0b000, 0b11, 0b1000011);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point fused multiply-sub
+ *
+ * @note Custom encoding: FMSUB with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @param[in] rs3 Source operand 3 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fmsub_ph(uint32_t rs1, uint32_t rs2, uint32_t rs3) {
+
+  return CUSTOM_INSTR_R4_TYPE(rs3, rs2, rs1, 0b000, 0b11, 0b1000111);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point fused negated multiply-sub
+ *
+ * @note Custom encoding: FNMSUB with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @param[in] rs3 Source operand 3 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fnmsub_ph(uint32_t rs1, uint32_t rs2, uint32_t rs3) {
+
+  return CUSTOM_INSTR_R4_TYPE(rs3, rs2, rs1, 0b000, 0b11, 0b1001011);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point fused negated multiply-add
+ *
+ * @note Custom encoding: FNMADD with fmt = 11.
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @param[in] rs3 Source operand 3 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+inline uint32_t __attribute__ ((always_inline)) riscv_intrinsic_fnmadd_ph(uint32_t rs1, uint32_t rs2, uint32_t rs3) {
+
+  return CUSTOM_INSTR_R4_TYPE(rs3, rs2, rs1, 0b000, 0b11, 0b1001111);
+}
+
+
 // ################################################################################################
 // Emulation functions
 // ################################################################################################
@@ -983,8 +1139,6 @@ float __attribute__ ((noinline)) riscv_emulate_fsqrts(float rs1) {
 /**********************************************************************//**
  * Single-precision floating-point fused multiply-add
  *
- * @warning This instruction is not supported!
- *
  * @param[in] rs1 Source operand 1
  * @param[in] rs2 Source operand 2
  * @param[in] rs3 Source operand 3
@@ -996,7 +1150,7 @@ float __attribute__ ((noinline)) riscv_emulate_fmadds(float rs1, float rs2, floa
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = (opa * opb) + opc;
+  float res = fmaf(opa, opb, opc);
   return subnormal_flush(res);
 }
 
@@ -1015,7 +1169,7 @@ float __attribute__ ((noinline)) riscv_emulate_fmsubs(float rs1, float rs2, floa
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = (opa * opb) - opc;
+  float res = fmaf(opa, opb, -opc);
   return subnormal_flush(res);
 }
 
@@ -1034,7 +1188,7 @@ float __attribute__ ((noinline)) riscv_emulate_fnmsubs(float rs1, float rs2, flo
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = -(opa * opb) + opc;
+  float res = fmaf(-opa, opb, opc);
   return subnormal_flush(res);
 }
 
@@ -1053,8 +1207,104 @@ float __attribute__ ((noinline)) riscv_emulate_fnmadds(float rs1, float rs2, flo
   float opb = subnormal_flush(rs2);
   float opc = subnormal_flush(rs3);
 
-  float res = -(opa * opb) - opc;
+  float res = fmaf(-opa, opb, -opc);
   return subnormal_flush(res);
 }
 
+
+// ################################################################################################
+// Packed-SIMD emulation functions (lane-wise)
+// ################################################################################################
+
+/**********************************************************************//**
+ * Packed half-precision floating-point addition
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) riscv_emulate_fadd_ph(uint32_t rs1, uint32_t rs2) {
+
+  uint16_t lo = float2half(riscv_emulate_fadds(half2float(rs1 & 0xffff), half2float(rs2 & 0xffff)));
+  uint16_t hi = float2half(riscv_emulate_fadds(half2float(rs1 >> 16),    half2float(rs2 >> 16)));
+  return riscv_pack_ph(lo, hi);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point subtraction
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) riscv_emulate_fsub_ph(uint32_t rs1, uint32_t rs2) {
+
+  uint16_t lo = float2half(riscv_emulate_fsubs(half2float(rs1 & 0xffff), half2float(rs2 & 0xffff)));
+  uint16_t hi = float2half(riscv_emulate_fsubs(half2float(rs1 >> 16),    half2float(rs2 >> 16)));
+  return riscv_pack_ph(lo, hi);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point multiplication
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) riscv_emulate_fmul_ph(uint32_t rs1, uint32_t rs2) {
+
+  uint16_t lo = float2half(riscv_emulate_fmuls(half2float(rs1 & 0xffff), half2float(rs2 & 0xffff)));
+  uint16_t hi = float2half(riscv_emulate_fmuls(half2float(rs1 >> 16),    half2float(rs2 >> 16)));
+  return riscv_pack_ph(lo, hi);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point minimum
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) riscv_emulate_fmin_ph(uint32_t rs1, uint32_t rs2) {
+
+  uint16_t lo = float2half(riscv_emulate_fmins(half2float(rs1 & 0xffff), half2float(rs2 & 0xffff)));
+  uint16_t hi = float2half(riscv_emulate_fmins(half2float(rs1 >> 16),    half2float(rs2 >> 16)));
+  return riscv_pack_ph(lo, hi);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point maximum
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) riscv_emulate_fmax_ph(uint32_t rs1, uint32_t rs2) {
+
+  uint16_t lo = float2half(riscv_emulate_fmaxs(half2float(rs1 & 0xffff), half2float(rs2 & 0xffff)));
+  uint16_t hi = float2half(riscv_emulate_fmaxs(half2float(rs1 >> 16),    half2float(rs2 >> 16)));
+  return riscv_pack_ph(lo, hi);
+}
+
+
+/**********************************************************************//**
+ * Packed half-precision floating-point fused multiply-add
+ *
+ * @param[in] rs1 Source operand 1 (2x FP16).
+ * @param[in] rs2 Source operand 2 (2x FP16).
+ * @param[in] rs3 Source operand 3 (2x FP16).
+ * @return Result (2x FP16).
+ **************************************************************************/
+uint32_t __attribute__ ((noinline)) riscv_emulate_fmadd_ph(uint32_t rs1, uint32_t rs2, uint32_t rs3) {
+
+  uint16_t lo = float2half(riscv_emulate_fmadds(half2float(rs1 & 0xffff), half2float(rs2 & 0xffff), half2float(rs3 & 0xffff)));
+  uint16_t hi = float2half(riscv_emulate_fmadds(half2float(rs1 >> 16),    half2float(rs2 >> 16),    half2float(rs3 >> 16)));
+  return riscv_pack_ph(lo, hi);
+}
+
+
 #endif // cellrv32_zhinx_extension_intrinsics_h
\ No newline at end of file
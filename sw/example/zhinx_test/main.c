@@ -54,8 +54,10 @@
 #define RUN_SGNINJ_TESTS   (1)
 //** Run classify tests when != 0 */
 #define RUN_CLASSIFY_TESTS (1)
-//** Run unsupported instructions tests when != 0 */
-#define RUN_UNAVAIL_TESTS  (0)
+//** Run fused multiply-add tests when != 0 (requires CPU_FP16_SIMD) */
+#define RUN_FMA_TESTS      (0)
+//** Run packed-SIMD (2x FP16) tests when != 0 (requires CPU_FP16_SIMD) */
+#define RUN_SIMD_TESTS     (0)
 
 
 // Prototypes
@@ -82,9 +84,11 @@ void print_report(uint32_t num_err);
   uint32_t i = 0;
   float16_conv_t vector_a;
   float16_conv_t vector_b;
+  float16_conv_t vector_c;
   
   float_conv_t opa;
   float_conv_t opb;
+  float_conv_t opc;
   
   float_conv_t res_hw;
   float_conv_t res_sw;
@@ -138,7 +142,7 @@ void print_report(uint32_t num_err);
 #endif
   cellrv32_uart0_printf("Test cases per instruction: %u\n", (uint32_t)NUM_TEST_CASES);
   cellrv32_uart0_printf("NOTE: The CELLRV32 FPU does not support subnormal numbers yet. Subnormal numbers are flushed to zero.\n");
-  cellrv32_uart0_printf("WARNING: The F[N]MADD/SUB reference software is non-fused (it performs multiplication, then rounding, then addition and rounding), so some test cases may fail.\n\n");
+  cellrv32_uart0_printf("WARNING: The F[N]MADD/SUB reference software rounds twice (to single, then to half precision), so some test cases may fail.\n\n");
 
   // clear exception status word
   cellrv32_cpu_csr_write(CSR_FFLAGS, 0); // real hardware
@@ -530,10 +534,10 @@ void print_report(uint32_t num_err);
 
 
 // ----------------------------------------------------------------------------
-// Unsupported Instructions Tests
+// Fused Multiply-Add Tests (CPU_FP16_SIMD only)
 // ----------------------------------------------------------------------------
 
-#if (RUN_UNAVAIL_TESTS != 0)
+#if (RUN_FMA_TESTS != 0)
 // ----------------------------------------------------------------------------
 // Fused-Multiply Add/Sub Tests
 // ----------------------------------------------------------------------------
@@ -631,6 +635,120 @@ void print_report(uint32_t num_err);
 #endif
 
 
+// ----------------------------------------------------------------------------
+// Packed-SIMD Tests (CPU_FP16_SIMD only)
+// ----------------------------------------------------------------------------
+
+#if (RUN_SIMD_TESTS != 0)
+  if ((cellrv32_cpu_csr_read(CSR_MXISA) & (1<<CSR_MXISA_XHSIMD)) == 0) {
+    cellrv32_uart0_puts("\nWarning! <CPU_FP16_SIMD> not synthesized, packed instructions will raise exceptions.\n");
+  }
+
+  cellrv32_uart0_printf("\n#%u: FADD.PH (packed addition)...\n", test_cnt);
+  err_cnt = 0;
+  for (i=0;i<(uint32_t)NUM_TEST_CASES; i++) {
+    // generate vector (two lanes)
+    opa.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    opb.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    // software emulation (lane-wise)
+    res_sw.binary_value = riscv_emulate_fadd_ph(opa.binary_value, opb.binary_value);
+    // hardware
+    res_hw.binary_value = riscv_intrinsic_fadd_ph(opa.binary_value, opb.binary_value);
+    // verification
+    err_cnt += verify_result(i, opa.binary_value, opb.binary_value, res_sw.binary_value, res_hw.binary_value);
+  }
+  print_report(err_cnt);
+  err_cnt_total += err_cnt;
+  test_cnt++;
+
+  cellrv32_uart0_printf("\n#%u: FSUB.PH (packed subtraction)...\n", test_cnt);
+  err_cnt = 0;
+  for (i=0;i<(uint32_t)NUM_TEST_CASES; i++) {
+    // generate vector (two lanes)
+    opa.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    opb.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    // software emulation (lane-wise)
+    res_sw.binary_value = riscv_emulate_fsub_ph(opa.binary_value, opb.binary_value);
+    // hardware
+    res_hw.binary_value = riscv_intrinsic_fsub_ph(opa.binary_value, opb.binary_value);
+    // verification
+    err_cnt += verify_result(i, opa.binary_value, opb.binary_value, res_sw.binary_value, res_hw.binary_value);
+  }
+  print_report(err_cnt);
+  err_cnt_total += err_cnt;
+  test_cnt++;
+
+  cellrv32_uart0_printf("\n#%u: FMUL.PH (packed multiplication)...\n", test_cnt);
+  err_cnt = 0;
+  for (i=0;i<(uint32_t)NUM_TEST_CASES; i++) {
+    // generate vector (two lanes)
+    opa.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    opb.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    // software emulation (lane-wise)
+    res_sw.binary_value = riscv_emulate_fmul_ph(opa.binary_value, opb.binary_value);
+    // hardware
+    res_hw.binary_value = riscv_intrinsic_fmul_ph(opa.binary_value, opb.binary_value);
+    // verification
+    err_cnt += verify_result(i, opa.binary_value, opb.binary_value, res_sw.binary_value, res_hw.binary_value);
+  }
+  print_report(err_cnt);
+  err_cnt_total += err_cnt;
+  test_cnt++;
+
+  cellrv32_uart0_printf("\n#%u: FMIN.PH (packed select minimum)...\n", test_cnt);
+  err_cnt = 0;
+  for (i=0;i<(uint32_t)NUM_TEST_CASES; i++) {
+    // generate vector (two lanes)
+    opa.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    opb.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    // software emulation (lane-wise)
+    res_sw.binary_value = riscv_emulate_fmin_ph(opa.binary_value, opb.binary_value);
+    // hardware
+    res_hw.binary_value = riscv_intrinsic_fmin_ph(opa.binary_value, opb.binary_value);
+    // verification
+    err_cnt += verify_result(i, opa.binary_value, opb.binary_value, res_sw.binary_value, res_hw.binary_value);
+  }
+  print_report(err_cnt);
+  err_cnt_total += err_cnt;
+  test_cnt++;
+
+  cellrv32_uart0_printf("\n#%u: FMAX.PH (packed select maximum)...\n", test_cnt);
+  err_cnt = 0;
+  for (i=0;i<(uint32_t)NUM_TEST_CASES; i++) {
+    // generate vector (two lanes)
+    opa.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    opb.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    // software emulation (lane-wise)
+    res_sw.binary_value = riscv_emulate_fmax_ph(opa.binary_value, opb.binary_value);
+    // hardware
+    res_hw.binary_value = riscv_intrinsic_fmax_ph(opa.binary_value, opb.binary_value);
+    // verification
+    err_cnt += verify_result(i, opa.binary_value, opb.binary_value, res_sw.binary_value, res_hw.binary_value);
+  }
+  print_report(err_cnt);
+  err_cnt_total += err_cnt;
+  test_cnt++;
+
+  cellrv32_uart0_printf("\n#%u: FMADD.PH (packed fused-multiply addition)...\n", test_cnt);
+  err_cnt = 0;
+  for (i=0;i<(uint32_t)NUM_TEST_CASES; i++) {
+    // generate vector (two lanes)
+    opa.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    opb.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    opc.binary_value = riscv_pack_ph(get_test_vector16(), get_test_vector16());
+    // software emulation (lane-wise)
+    res_sw.binary_value = riscv_emulate_fmadd_ph(opa.binary_value, opb.binary_value, opc.binary_value);
+    // hardware
+    res_hw.binary_value = riscv_intrinsic_fmadd_ph(opa.binary_value, opb.binary_value, opc.binary_value);
+    // verification
+    err_cnt += verify_result(i, opa.binary_value, opb.binary_value, res_sw.binary_value, res_hw.binary_value);
+  }
+  print_report(err_cnt);
+  err_cnt_total += err_cnt;
+  test_cnt++;
+#endif
+
+
 // ----------------------------------------------------------------------------
 // Final report
 // ----------------------------------------------------------------------------
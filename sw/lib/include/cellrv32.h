@@ -48,6 +48,9 @@ enum CELLRV32_CSR_enum {
   CSR_VTYPE          = 0xc21, /**< 0x00d - vtype  (r/-): Vector type register (read-only) */
   CSR_VLENB          = 0xc22, /**< 0x00e - vlenb  (r/-): Vector length in bytes (read-only) */
 
+  /* compressed table jumps */
+  CSR_JVT            = 0x017, /**< 0x017 - jvt    (r/w): Zcmt jump vector table base address (bits 5:0 = mode, always 0) */
+
   /* machine control and status */
   CSR_MSTATUS        = 0x300, /**< 0x300 - mstatus    (r/w): Machine status register */
   CSR_MISA           = 0x301, /**< 0x301 - misa       (r/-): CPU ISA and extensions (read-only in CELLRV32) */
@@ -94,6 +97,37 @@ enum CELLRV32_CSR_enum {
   CSR_MHPMEVENT30    = 0x33e, /**< 0x33e - mhpmevent30 (r/w): Machine hardware performance monitor event selector 30 */
   CSR_MHPMEVENT31    = 0x33f, /**< 0x33f - mhpmevent31 (r/w): Machine hardware performance monitor event selector 31 */
 
+  /* machine counter setup, high word */
+  CSR_MHPMEVENT3H    = 0x723, /**< 0x723 - mhpmevent3h  (r/w): Machine hardware performance monitor event selector 3  high word (Sscofpmf) */
+  CSR_MHPMEVENT4H    = 0x724, /**< 0x724 - mhpmevent4h  (r/w): Machine hardware performance monitor event selector 4  high word (Sscofpmf) */
+  CSR_MHPMEVENT5H    = 0x725, /**< 0x725 - mhpmevent5h  (r/w): Machine hardware performance monitor event selector 5  high word (Sscofpmf) */
+  CSR_MHPMEVENT6H    = 0x726, /**< 0x726 - mhpmevent6h  (r/w): Machine hardware performance monitor event selector 6  high word (Sscofpmf) */
+  CSR_MHPMEVENT7H    = 0x727, /**< 0x727 - mhpmevent7h  (r/w): Machine hardware performance monitor event selector 7  high word (Sscofpmf) */
+  CSR_MHPMEVENT8H    = 0x728, /**< 0x728 - mhpmevent8h  (r/w): Machine hardware performance monitor event selector 8  high word (Sscofpmf) */
+  CSR_MHPMEVENT9H    = 0x729, /**< 0x729 - mhpmevent9h  (r/w): Machine hardware performance monitor event selector 9  high word (Sscofpmf) */
+  CSR_MHPMEVENT10H   = 0x72a, /**< 0x72a - mhpmevent10h (r/w): Machine hardware performance monitor event selector 10 high word (Sscofpmf) */
+  CSR_MHPMEVENT11H   = 0x72b, /**< 0x72b - mhpmevent11h (r/w): Machine hardware performance monitor event selector 11 high word (Sscofpmf) */
+  CSR_MHPMEVENT12H   = 0x72c, /**< 0x72c - mhpmevent12h (r/w): Machine hardware performance monitor event selector 12 high word (Sscofpmf) */
+  CSR_MHPMEVENT13H   = 0x72d, /**< 0x72d - mhpmevent13h (r/w): Machine hardware performance monitor event selector 13 high word (Sscofpmf) */
+  CSR_MHPMEVENT14H   = 0x72e, /**< 0x72e - mhpmevent14h (r/w): Machine hardware performance monitor event selector 14 high word (Sscofpmf) */
+  CSR_MHPMEVENT15H   = 0x72f, /**< 0x72f - mhpmevent15h (r/w): Machine hardware performance monitor event selector 15 high word (Sscofpmf) */
+  CSR_MHPMEVENT16H   = 0x730, /**< 0x730 - mhpmevent16h (r/w): Machine hardware performance monitor event selector 16 high word (Sscofpmf) */
+  CSR_MHPMEVENT17H   = 0x731, /**< 0x731 - mhpmevent17h (r/w): Machine hardware performance monitor event selector 17 high word (Sscofpmf) */
+  CSR_MHPMEVENT18H   = 0x732, /**< 0x732 - mhpmevent18h (r/w): Machine hardware performance monitor event selector 18 high word (Sscofpmf) */
+  CSR_MHPMEVENT19H   = 0x733, /**< 0x733 - mhpmevent19h (r/w): Machine hardware performance monitor event selector 19 high word (Sscofpmf) */
+  CSR_MHPMEVENT20H   = 0x734, /**< 0x734 - mhpmevent20h (r/w): Machine hardware performance monitor event selector 20 high word (Sscofpmf) */
+  CSR_MHPMEVENT21H   = 0x735, /**< 0x735 - mhpmevent21h (r/w): Machine hardware performance monitor event selector 21 high word (Sscofpmf) */
+  CSR_MHPMEVENT22H   = 0x736, /**< 0x736 - mhpmevent22h (r/w): Machine hardware performance monitor event selector 22 high word (Sscofpmf) */
+  CSR_MHPMEVENT23H   = 0x737, /**< 0x737 - mhpmevent23h (r/w): Machine hardware performance monitor event selector 23 high word (Sscofpmf) */
+  CSR_MHPMEVENT24H   = 0x738, /**< 0x738 - mhpmevent24h (r/w): Machine hardware performance monitor event selector 24 high word (Sscofpmf) */
+  CSR_MHPMEVENT25H   = 0x739, /**< 0x739 - mhpmevent25h (r/w): Machine hardware performance monitor event selector 25 high word (Sscofpmf) */
+  CSR_MHPMEVENT26H   = 0x73a, /**< 0x73a - mhpmevent26h (r/w): Machine hardware performance monitor event selector 26 high word (Sscofpmf) */
+  CSR_MHPMEVENT27H   = 0x73b, /**< 0x73b - mhpmevent27h (r/w): Machine hardware performance monitor event selector 27 high word (Sscofpmf) */
+  CSR_MHPMEVENT28H   = 0x73c, /**< 0x73c - mhpmevent28h (r/w): Machine hardware performance monitor event selector 28 high word (Sscofpmf) */
+  CSR_MHPMEVENT29H   = 0x73d, /**< 0x73d - mhpmevent29h (r/w): Machine hardware performance monitor event selector 29 high word (Sscofpmf) */
+  CSR_MHPMEVENT30H   = 0x73e, /**< 0x73e - mhpmevent30h (r/w): Machine hardware performance monitor event selector 30 high word (Sscofpmf) */
+  CSR_MHPMEVENT31H   = 0x73f, /**< 0x73f - mhpmevent31h (r/w): Machine hardware performance monitor event selector 31 high word (Sscofpmf) */
+
   /* machine trap control */
   CSR_MSCRATCH       = 0x340, /**< 0x340 - mscratch (r/w): Machine scratch register */
   CSR_MEPC           = 0x341, /**< 0x341 - mepc     (r/w): Machine exception program counter */
@@ -139,6 +173,29 @@ enum CELLRV32_CSR_enum {
   CSR_DPC            = 0x7b1, /**< 0x7b1 - dpc       (-/-): Debug program counter */
   CSR_DSCRATCH0      = 0x7b2, /**< 0x7b2 - dscratch0 (-/-): Debug scratch register */
 
+  /* CELLRV32-specific (custom) vectored interrupt controller CSRs */
+  CSR_MIRQCTL0       = 0x7c0, /**< 0x7c0 - mirqctl0 (r/w): Interrupt priority/level, mcause IDs 0..7 (one nibble per ID) */
+  CSR_MIRQCTL1       = 0x7c1, /**< 0x7c1 - mirqctl1 (r/w): Interrupt priority/level, mcause IDs 8..15 */
+  CSR_MIRQCTL2       = 0x7c2, /**< 0x7c2 - mirqctl2 (r/w): Interrupt priority/level, mcause IDs 16..23 (FIRQ 0..7) */
+  CSR_MIRQCTL3       = 0x7c3, /**< 0x7c3 - mirqctl3 (r/w): Interrupt priority/level, mcause IDs 24..31 (FIRQ 8..15) */
+  CSR_MIRQCFG        = 0x7c4, /**< 0x7c4 - mirqcfg  (r/w): Interrupt level configuration and status */
+
+  /* CELLRV32-specific (custom) shadow register bank CSRs */
+  CSR_MSHADOWEN      = 0x7c8, /**< 0x7c8 - mshadowen  (r/w): Use shadow register bank for interrupt (one bit per mcause ID) */
+  CSR_MSHADOWCTL     = 0x7c9, /**< 0x7c9 - mshadowctl (r/w): Shadow register bank status */
+
+  /* CELLRV32-specific (custom) i-cache control CSRs */
+  CSR_MICACHECTL     = 0x7ca, /**< 0x7ca - micachectl  (r/w): i-cache way locking and preload status */
+  CSR_MICACHEFILL    = 0x7cb, /**< 0x7cb - micachefill (r/w): i-cache block preload address, write triggers preload */
+
+  /* CELLRV32-specific (custom) hardware loop CSRs */
+  CSR_LPSTART0       = 0x800, /**< 0x800 - lpstart0 (r/w): Hardware loop 0 (inner) body start address */
+  CSR_LPEND0         = 0x801, /**< 0x801 - lpend0   (r/w): Hardware loop 0 (inner) address right after the loop body */
+  CSR_LPCOUNT0       = 0x802, /**< 0x802 - lpcount0 (r/w): Hardware loop 0 (inner) remaining iterations */
+  CSR_LPSTART1       = 0x810, /**< 0x810 - lpstart1 (r/w): Hardware loop 1 (outer) body start address */
+  CSR_LPEND1         = 0x811, /**< 0x811 - lpend1   (r/w): Hardware loop 1 (outer) address right after the loop body */
+  CSR_LPCOUNT1       = 0x812, /**< 0x812 - lpcount1 (r/w): Hardware loop 1 (outer) remaining iterations */
+
   /* machine counters and timers */
   CSR_MCYCLE         = 0xb00, /**< 0xb00 - mcycle   (r/w): Machine cycle counter low word */
   CSR_MINSTRET       = 0xb02, /**< 0xb02 - minstret (r/w): Machine instructions-retired counter low word */
@@ -206,6 +263,9 @@ enum CELLRV32_CSR_enum {
   CSR_MHPMCOUNTER30H = 0xb9e, /**< 0xb9e - mhpmcounter30h (r/w): Machine hardware performance monitor 30 counter high word */
   CSR_MHPMCOUNTER31H = 0xb9f, /**< 0xb9f - mhpmcounter31h (r/w): Machine hardware performance monitor 31 counter high word */
 
+  /* counter overflow status */
+  CSR_SCOUNTOVF      = 0xda0, /**< 0xda0 - scountovf (r/-): Counter overflow flags (mhpmevent*h.OF), machine-mode only (Sscofpmf) */
+
   /* user counters and timers */
   CSR_CYCLE          = 0xc00, /**< 0xc00 - cycle   (r/-): Cycle counter low word (from MCYCLE) */
   CSR_INSTRET        = 0xc02, /**< 0xc02 - instret (r/-): Instructions-retired counter low word (from MINSTRET) */
@@ -297,6 +357,55 @@ enum CELLRV32_CSR_MSTATUS_enum {
 };
 
 
+/**********************************************************************//**
+ * CPU <b>mirqcfg</b> CSR (r/w): Interrupt level configuration (CELLRV32-specific)
+ **************************************************************************/
+enum CELLRV32_CSR_MIRQCFG_enum {
+  CSR_MIRQCFG_NLBITS_LSB =  0, /**< CPU mirqcfg CSR  (0): NLBITS - Number of level bits in mirqctl* nibbles, 0..4, LSB (r/w) */
+  CSR_MIRQCFG_NLBITS_MSB =  2, /**< CPU mirqcfg CSR  (2): NLBITS - Number of level bits in mirqctl* nibbles, 0..4, MSB (r/w) */
+  CSR_MIRQCFG_THRESH_LSB =  8, /**< CPU mirqcfg CSR  (8): THRESH - Interrupt level threshold, LSB (r/w) */
+  CSR_MIRQCFG_THRESH_MSB = 11, /**< CPU mirqcfg CSR (11): THRESH - Interrupt level threshold, MSB (r/w) */
+  CSR_MIRQCFG_MPIL_LSB   = 16, /**< CPU mirqcfg CSR (16): MPIL - Previous interrupt level, LSB (r/w) */
+  CSR_MIRQCFG_MPIL_MSB   = 19, /**< CPU mirqcfg CSR (19): MPIL - Previous interrupt level, MSB (r/w) */
+  CSR_MIRQCFG_MIL_LSB    = 24, /**< CPU mirqcfg CSR (24): MIL - Current interrupt level, LSB (r/-) */
+  CSR_MIRQCFG_MIL_MSB    = 27  /**< CPU mirqcfg CSR (27): MIL - Current interrupt level, MSB (r/-) */
+};
+
+
+/**********************************************************************//**
+ * CPU <b>mshadowctl</b> CSR (r/w): Shadow register bank status (CELLRV32-specific)
+ **************************************************************************/
+enum CELLRV32_CSR_MSHADOWCTL_enum {
+  CSR_MSHADOWCTL_BANK   = 0, /**< CPU mshadowctl CSR (0): BANK - Shadow bank of caller-saved registers is active (r/-) */
+  CSR_MSHADOWCTL_MPBANK = 1  /**< CPU mshadowctl CSR (1): MPBANK - Register bank of the interrupted context (r/w) */
+};
+
+
+/**********************************************************************//**
+ * CPU <b>micachectl</b> CSR (r/w): i-cache way locking (CELLRV32-specific)
+ **************************************************************************/
+enum CELLRV32_CSR_MICACHECTL_enum {
+  CSR_MICACHECTL_LOCK_LSB =  0, /**< CPU micachectl CSR (0):  LOCK - Way is excluded from replacement, one bit per way, LSB (r/w) */
+  CSR_MICACHECTL_LOCK_MSB =  7, /**< CPU micachectl CSR (7):  LOCK - Way is excluded from replacement, one bit per way, MSB (r/w) */
+  CSR_MICACHECTL_WAY_LSB  =  8, /**< CPU micachectl CSR (8):  WAY - Target way of block preloads, LSB (r/w) */
+  CSR_MICACHECTL_WAY_MSB  = 10, /**< CPU micachectl CSR (10): WAY - Target way of block preloads, MSB (r/w) */
+  CSR_MICACHECTL_BUSY     = 31  /**< CPU micachectl CSR (31): BUSY - Block preload in progress (r/-) */
+};
+
+
+/**********************************************************************//**
+ * CPU <b>mhpmevent*h</b> CSRs (r/w): HPM counter overflow and mode filter (Sscofpmf)
+ **************************************************************************/
+enum CELLRV32_CSR_MHPMEVENTH_enum {
+  CSR_MHPMEVENTH_IC_EVICT = 0, /**< CPU mhpmevent*h CSR (0): Event 32 - Instruction cache valid block replaced (r/w) */
+  CSR_MHPMEVENTH_IC_WAIT  = 1, /**< CPU mhpmevent*h CSR (1): Event 33 - Instruction cache miss-handling cycle (r/w) */
+
+  CSR_MHPMEVENTH_UINH = 28, /**< CPU mhpmevent*h CSR (28): UINH - Inhibit counting in user mode (r/w) */
+  CSR_MHPMEVENTH_MINH = 30, /**< CPU mhpmevent*h CSR (30): MINH - Inhibit counting in machine mode (r/w) */
+  CSR_MHPMEVENTH_OF   = 31  /**< CPU mhpmevent*h CSR (31): OF - Counter overflow; LCOFI is raised on overflow while cleared (r/w) */
+};
+
+
 /**********************************************************************//**
  * CPU <b>mcountinhibit</b> CSR (r/w): Machine counter-inhibit
  **************************************************************************/
@@ -343,6 +452,7 @@ enum CELLRV32_CSR_MIE_enum {
   CSR_MIE_MSIE    =  3, /**< CPU mie CSR  (3): MSIE - Machine software interrupt enable (r/w) */
   CSR_MIE_MTIE    =  7, /**< CPU mie CSR  (7): MTIE - Machine timer interrupt enable bit (r/w) */
   CSR_MIE_MEIE    = 11, /**< CPU mie CSR (11): MEIE - Machine external interrupt enable bit (r/w) */
+  CSR_MIE_LCOFIE  = 13, /**< CPU mie CSR (13): LCOFIE - Local counter-overflow interrupt enable bit (r/w) */
 
   CSR_MIE_FIRQ0E  = 16, /**< CPU mie CSR (16): FIRQ0E - Fast interrupt channel 0 enable bit (r/w) */
   CSR_MIE_FIRQ1E  = 17, /**< CPU mie CSR (17): FIRQ1E - Fast interrupt channel 1 enable bit (r/w) */
@@ -370,6 +480,7 @@ enum CELLRV32_CSR_MIP_enum {
   CSR_MIP_MSIP    =  3, /**< CPU mip CSR  (3): MSIP - Machine software interrupt pending (r/c) */
   CSR_MIP_MTIP    =  7, /**< CPU mip CSR  (7): MTIP - Machine timer interrupt pending (r/c) */
   CSR_MIP_MEIP    = 11, /**< CPU mip CSR (11): MEIP - Machine external interrupt pending (r/c) */
+  CSR_MIP_LCOFIP  = 13, /**< CPU mip CSR (13): LCOFIP - Local counter-overflow interrupt pending (r/c) */
 
   /* CELLRV32-specific extension */
   CSR_MIP_FIRQ0P  = 16, /**< CPU mip CSR (16): FIRQ0P - Fast interrupt channel 0 pending (r/c) */
@@ -422,7 +533,7 @@ enum CELLRV32_CSR_XISA_enum {
   CSR_MXISA_ZXCFU     =  3, /**< CPU mxisa CSR  (3): custom RISC-V instructions (r/-)*/
   CSR_MXISA_ZICOND    =  4, /**< CPU mxisa CSR  (4): conditional operations (r/-)*/
   CSR_MXISA_ZFINX     =  5, /**< CPU mxisa CSR  (5): Single-Precision FPU using x registers, "F-alternative" (r/-)*/
-
+  CSR_MXISA_ZKN       =  6, /**< CPU mxisa CSR  (6): scalar cryptography, NIST suite (Zbkb, Zbkc, Zbkx, Zkne, Zknd, Zknh) (r/-)*/
   CSR_MXISA_ZICNTR    =  7, /**< CPU mxisa CSR  (7): standard instruction, cycle and time counter CSRs (r/-)*/
   CSR_MXISA_PMP       =  8, /**< CPU mxisa CSR  (8): physical memory protection (also "Smpmp") (r/-)*/
   CSR_MXISA_ZIHPM     =  9, /**< CPU mxisa CSR  (9): hardware performance monitors (r/-)*/
@@ -432,11 +543,26 @@ enum CELLRV32_CSR_XISA_enum {
   CSR_MXISA_ZHINX     = 12, /**< CPU mxisa CSR (12): Half-Precision FPU using x registers, "H-alternative" (r/-)*/
   
   CSR_MXISA_VECTOR    = 13, /**< CPU mxisa CSR (13): Vector extension (r/-)*/
+  CSR_MXISA_XHWLOOP   = 14, /**< CPU mxisa CSR (14): zero-overhead hardware loops (r/-)*/
+  CSR_MXISA_XHSIMD    = 15, /**< CPU mxisa CSR (15): packed-SIMD 2x FP16 operations + half-precision FMA (Zhinx only) (r/-)*/
+  CSR_MXISA_XPSIMD    = 16, /**< CPU mxisa CSR (16): packed-SIMD integer DSP operations (P extension subset) (r/-)*/
+  CSR_MXISA_ZCMP      = 17, /**< CPU mxisa CSR (17): compressed push/pop/move (r/-)*/
+  CSR_MXISA_ZCMT      = 18, /**< CPU mxisa CSR (18): compressed table jumps, jvt CSR (r/-)*/
 
   // Misc
   CSR_MXISA_IS_SIM    = 20, /**< CPU mxisa CSR (20): this might be a simulation when set (r/-)*/
 
   // Tuning options
+  CSR_MXISA_FPU       = 19, /**< CPU mxisa CSR (19): FPU barrel shifters + fused multiply-add (Zfinx only) (r/-)*/
+  CSR_MXISA_MULDIV    = 21, /**< CPU mxisa CSR (21): DSP multiplier + radix-4 early-out divider (M extensions only) (r/-)*/
+  CSR_MXISA_MALIGN    = 22, /**< CPU mxisa CSR (22): misaligned loads/stores in hardware (r/-)*/
+  CSR_MXISA_SB        = 23, /**< CPU mxisa CSR (23): store buffer (r/-)*/
+  CSR_MXISA_NBLOAD    = 24, /**< CPU mxisa CSR (24): non-blocking loads (r/-)*/
+  CSR_MXISA_FUSION    = 25, /**< CPU mxisa CSR (25): macro-op fusion (r/-)*/
+  CSR_MXISA_FETCH64   = 26, /**< CPU mxisa CSR (26): 64-bit instruction fetch (r/-)*/
+  CSR_MXISA_DUAL      = 27, /**< CPU mxisa CSR (27): dual-issue of simple ALU operations (r/-)*/
+  CSR_MXISA_PIPE      = 28, /**< CPU mxisa CSR (28): pipelined dispatch of single-cycle ALU operations (r/-)*/
+  CSR_MXISA_BP        = 29, /**< CPU mxisa CSR (29): dynamic branch prediction (BHT + BTB) (r/-)*/
   CSR_MXISA_FASTMUL   = 30, /**< CPU mxisa CSR (30): DSP-based multiplication (M extensions only) (r/-)*/
   CSR_MXISA_FASTSHIFT = 31  /**< CPU mxisa CSR (31): parallel logic for shifts (barrel shifters) (r/-)*/
 };
@@ -462,7 +588,25 @@ enum CELLRV32_HPMCNT_EVENT_enum {
   HPMCNT_EVENT_TBRANCH = 12, /**< CPU mhpmevent CSR (12): Conditional taken branch */
 
   HPMCNT_EVENT_TRAP    = 13, /**< CPU mhpmevent CSR (13): Entered trap */
-  HPMCNT_EVENT_ILLEGAL = 14  /**< CPU mhpmevent CSR (14): Illegal instruction exception */
+  HPMCNT_EVENT_ILLEGAL = 14, /**< CPU mhpmevent CSR (14): Illegal instruction exception */
+  HPMCNT_EVENT_RAS_HIT = 15, /**< CPU mhpmevent CSR (15): Return correctly predicted by return address stack */
+  HPMCNT_EVENT_RAS_MISS= 16, /**< CPU mhpmevent CSR (16): Return mispredicted */
+  HPMCNT_EVENT_DUAL    = 17, /**< CPU mhpmevent CSR (17): Dual-issued cycle (two instructions executed) */
+  HPMCNT_EVENT_SINGLE  = 18, /**< CPU mhpmevent CSR (18): Single-issued cycle (one instruction executed) */
+  HPMCNT_EVENT_FUSED   = 19, /**< CPU mhpmevent CSR (19): Fused instruction pair (macro-op fusion) */
+  HPMCNT_EVENT_NBLOAD  = 20, /**< CPU mhpmevent CSR (20): Instruction executed while a non-blocking load is outstanding */
+
+  HPMCNT_EVENT_IC_HIT  = 21, /**< CPU mhpmevent CSR (21): Instruction cache hit */
+  HPMCNT_EVENT_IC_MISS = 22, /**< CPU mhpmevent CSR (22): Instruction cache miss */
+  HPMCNT_EVENT_BR_MISS = 23, /**< CPU mhpmevent CSR (23): Control-flow redirect not predicted (front-end flush) */
+  HPMCNT_EVENT_VEC_BSY = 24, /**< CPU mhpmevent CSR (24): Vector unit busy cycle */
+  HPMCNT_EVENT_VEC_STL = 25, /**< CPU mhpmevent CSR (25): Vector unit memory stall cycle */
+  HPMCNT_EVENT_CP_ALU  = 26, /**< CPU mhpmevent CSR (26): Co-processor busy: shifter / bit-manipulation / conditional ops */
+  HPMCNT_EVENT_CP_MD   = 27, /**< CPU mhpmevent CSR (27): Co-processor busy: multiplier/divider */
+  HPMCNT_EVENT_CP_FPU  = 28, /**< CPU mhpmevent CSR (28): Co-processor busy: floating-point unit(s) */
+  HPMCNT_EVENT_CP_CST  = 29, /**< CPU mhpmevent CSR (29): Co-processor busy: CFU / packed-SIMD unit */
+  HPMCNT_EVENT_ARB     = 30, /**< CPU mhpmevent CSR (30): Bus switch arbitration wait cycle */
+  HPMCNT_EVENT_XIP     = 31  /**< CPU mhpmevent CSR (31): XIP access wait cycle */
 };
 
 
@@ -504,6 +648,7 @@ enum CELLRV32_EXCEPTION_CODES_enum {
   TRAP_CODE_MSI          = 0x80000003U, /**< 1.3:  Machine software interrupt */
   TRAP_CODE_MTI          = 0x80000007U, /**< 1.7:  Machine timer interrupt */
   TRAP_CODE_MEI          = 0x8000000bU, /**< 1.11: Machine external interrupt */
+  TRAP_CODE_LCOFI        = 0x8000000dU, /**< 1.13: Local counter-overflow interrupt */
   TRAP_CODE_FIRQ_0       = 0x80000010U, /**< 1.16: Fast interrupt channel 0 */
   TRAP_CODE_FIRQ_1       = 0x80000011U, /**< 1.17: Fast interrupt channel 1 */
   TRAP_CODE_FIRQ_2       = 0x80000012U, /**< 1.18: Fast interrupt channel 2 */
@@ -679,6 +824,7 @@ enum CELLRV32_CLOCK_PRSC_enum {
 #define CELLRV32_GPTMR_BASE     (0xFFFFFF60U) /**< General Purpose Timer (GPTMR) */
 #define CELLRV32_PWM_BASE       (0xFFFFFF50U) /**< Pulse Width Modulation Controller (PWM) */
 #define CELLRV32_XIP_BASE       (0xFFFFFF40U) /**< Execute In Place Module (XIP) */
+#define CELLRV32_TRACE_BASE     (0xFFFFFF10U) /**< Instruction Trace Buffer (TRACE) */
 #define CELLRV32_SDI_BASE       (0xFFFFFF00U) /**< Serial Data Interface (SDI) */
 #define CELLRV32_CFS_BASE       (0xFFFFFE00U) /**< Custom Functions Subsystem (CFS) */
 #define CELLRV32_DM_BASE        (0xFFFFF800U) /**< On-Chip Debugger */
@@ -711,6 +857,7 @@ enum CELLRV32_CLOCK_PRSC_enum {
 #include "cellrv32_sdi.h"
 #include "cellrv32_spi.h"
 #include "cellrv32_sysinfo.h"
+#include "cellrv32_trace.h"
 #include "cellrv32_trng.h"
 #include "cellrv32_twi.h"
 #include "cellrv32_uart.h"
@@ -20,6 +20,7 @@
 /**@{*/
 void     cellrv32_cpu_irq_enable(int irq_sel);
 void     cellrv32_cpu_irq_disable(int irq_sel);
+void     cellrv32_cpu_irq_set_ctl(int irq_sel, uint32_t ctl);
 uint64_t cellrv32_cpu_get_cycle(void);
 void     cellrv32_cpu_set_mcycle(uint64_t value);
 uint64_t cellrv32_cpu_get_instret(void);
@@ -31,10 +32,27 @@ uint32_t cellrv32_cpu_pmp_get_granularity(void);
 int      cellrv32_cpu_pmp_configure_region(uint32_t index, uint32_t base, uint8_t config);
 uint32_t cellrv32_cpu_hpm_get_num_counters(void);
 uint32_t cellrv32_cpu_hpm_get_size(void);
+int      cellrv32_cpu_icache_lock_range(uint32_t base, uint32_t size, int way);
+int      cellrv32_cpu_icache_lock_section(int way);
+void     cellrv32_cpu_icache_unlock(void);
+int      cellrv32_cpu_cbo_zero_range(uint32_t base, uint32_t size);
 void     cellrv32_cpu_goto_user_mode(void);
 /**@}*/
 
 
+/**********************************************************************//**
+ * Place a function in the ".isr_locked" section, which is preloaded and locked in the i-cache by
+ * cellrv32_cpu_icache_lock_section().
+ **************************************************************************/
+#define CELLRV32_ICACHE_LOCKED __attribute__ ((section(".isr_locked"),noinline))
+
+
+/**********************************************************************//**
+ * Cache-block size in bytes used by the Zicbop/Zicboz instructions.
+ **************************************************************************/
+#define CELLRV32_CBO_BLOCK_SIZE 64
+
+
 /**********************************************************************//**
  * Prototype for "after-main handler". This function is called if main() returns.
  *
@@ -257,4 +275,64 @@ inline void __attribute__ ((always_inline)) cellrv32_cpu_sleep(void) {
 }
 
 
+/**********************************************************************//**
+ * Instruction prefetch hint (Zicbop "prefetch.i").
+ *
+ * @note This is a hint only (executed as "ori zero, addr, 0" if Zicbop is not implemented).
+ *
+ * @param[in] addr Address of the instruction block to be prefetched into the i-cache.
+ **************************************************************************/
+inline void __attribute__ ((always_inline)) cellrv32_cpu_prefetch_i(uint32_t addr) {
+
+  uint32_t reg_addr = addr;
+
+  asm volatile (".insn i 0x13, 6, x0, %[ad], 0" : : [ad] "r" (reg_addr));
+}
+
+
+/**********************************************************************//**
+ * Data read prefetch hint (Zicbop "prefetch.r").
+ *
+ * @note This is a hint only (executed as "ori zero, addr, 1" if Zicbop is not implemented).
+ *
+ * @param[in] addr Address of the data block to be prefetched into the d-cache.
+ **************************************************************************/
+inline void __attribute__ ((always_inline)) cellrv32_cpu_prefetch_r(uint32_t addr) {
+
+  uint32_t reg_addr = addr;
+
+  asm volatile (".insn i 0x13, 6, x0, %[ad], 1" : : [ad] "r" (reg_addr));
+}
+
+
+/**********************************************************************//**
+ * Data write prefetch hint (Zicbop "prefetch.w").
+ *
+ * @note This is a hint only (executed as "ori zero, addr, 3" if Zicbop is not implemented).
+ *
+ * @param[in] addr Address of the data block to be prefetched into the d-cache.
+ **************************************************************************/
+inline void __attribute__ ((always_inline)) cellrv32_cpu_prefetch_w(uint32_t addr) {
+
+  uint32_t reg_addr = addr;
+
+  asm volatile (".insn i 0x13, 6, x0, %[ad], 3" : : [ad] "r" (reg_addr));
+}
+
+
+/**********************************************************************//**
+ * Zero a whole cache block (Zicboz "cbo.zero").
+ *
+ * @warning This will raise an illegal instruction exception if Zicboz is not implemented.
+ *
+ * @param[in] addr Any address inside the #CELLRV32_CBO_BLOCK_SIZE-aligned block to be cleared.
+ **************************************************************************/
+inline void __attribute__ ((always_inline)) cellrv32_cpu_cbo_zero(uint32_t addr) {
+
+  uint32_t reg_addr = addr;
+
+  asm volatile (".insn i 0x0f, 2, x0, %[ad], 4" : : [ad] "r" (reg_addr) : "memory");
+}
+
+
 #endif // cellrv32_cpu_h
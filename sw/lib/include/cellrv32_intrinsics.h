@@ -374,4 +374,50 @@ asm(".set RISCV_OPCODE_CUSTOM3 , 0b1111011");
 })
 
 
+// ****************************************************************************************************************************
+// Hardware Loop Intrinsics ('Xhwloop', CPU_HWLOOP)
+// ****************************************************************************************************************************
+
+/**********************************************************************//**
+ * @name Hardware loop (zero-overhead loop) intrinsics
+ *
+ * Use HWLOOP_BEGIN / HWLOOP_END to wrap the loop body of an inline-assembly statement. The body is executed
+ * max(count, 1) times without any compare-and-branch overhead. Context 0 is the inner loop, context 1 the
+ * outer loop; a nested inner loop has to be set up inside the body of the outer loop.
+ *
+ * @code
+ * asm volatile (
+ *   HWLOOP_BEGIN(0, "%[n]")
+ *   "lw   t0, 0(%[src])  \n"
+ *   "add  %[sum], %[sum], t0 \n"
+ *   "addi %[src], %[src], 4  \n"
+ *   HWLOOP_END(0)
+ *   : [sum] "+r" (sum), [src] "+r" (src) : [n] "r" (n) : "t0", "t6", "memory");
+ * @endcode
+ *
+ * @note The loop body is assembled without compressed instructions so it ends at a 32-bit boundary.
+ * @note Leaving the loop body early (branch/jump) does not terminate the loop; write zero to the according
+ * loop count CSR (CSR_LPCOUNT0/1) in that case.
+ * @note Register t6 is used (clobbered) by HWLOOP_BEGIN.
+ * @warning NOT RISC-V-standard, CELLRV32-specific!
+ **************************************************************************/
+/**@{*/
+/** Setup hardware loop context ctx (0 or 1) with iteration count register cnt (operand string) and start loop body */
+#define HWLOOP_BEGIN(ctx, cnt)                       \
+  ".option push                                \n" \
+  ".option norvc                               \n" \
+  "lla  t6, 8" #ctx "0f                        \n" \
+  "csrw 0x8" #ctx "0, t6                        \n" \
+  "lla  t6, 8" #ctx "1f                        \n" \
+  "csrw 0x8" #ctx "1, t6                        \n" \
+  "csrw 0x8" #ctx "2, " cnt "                   \n" \
+  ".balign 4                                   \n" \
+  "8" #ctx "0:                                 \n"
+/** End of hardware loop context ctx body */
+#define HWLOOP_END(ctx)                              \
+  "8" #ctx "1:                                 \n" \
+  ".option pop                                 \n"
+/**@}*/
+
+
 #endif // cellrv32_intrinsics_h
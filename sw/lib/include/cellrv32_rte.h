@@ -17,7 +17,7 @@
 /**********************************************************************//**
  * CELLRV32 runtime environment: Number of available traps.
  **************************************************************************/
-#define CELLRV32_RTE_NUM_TRAPS 29
+#define CELLRV32_RTE_NUM_TRAPS 30
 
 
 /**********************************************************************//**
@@ -52,15 +52,70 @@ enum CELLRV32_RTE_TRAP_enum {
   RTE_TRAP_FIRQ_12      = 25, /**< Fast interrupt channel 12 */
   RTE_TRAP_FIRQ_13      = 26, /**< Fast interrupt channel 13 */
   RTE_TRAP_FIRQ_14      = 27, /**< Fast interrupt channel 14 */
-  RTE_TRAP_FIRQ_15      = 28  /**< Fast interrupt channel 15 */
+  RTE_TRAP_FIRQ_15      = 28, /**< Fast interrupt channel 15 */
+  RTE_TRAP_LCOFI        = 29  /**< Local counter-overflow interrupt (Sscofpmf) */
 };
 
 
+/**********************************************************************//**
+ * @name Vectored interrupt mode: direct interrupt handlers (see cellrv32_rte_setup_vectored(void)).
+ * These are weak symbols pointing to the RTE core; override them with functions using the "interrupt" attribute.
+ **************************************************************************/
+/**@{*/
+void cellrv32_rte_vector_exc(void);
+void cellrv32_rte_vector_msi(void);
+void cellrv32_rte_vector_mti(void);
+void cellrv32_rte_vector_mei(void);
+void cellrv32_rte_vector_lcofi(void);
+void cellrv32_rte_vector_firq0(void);
+void cellrv32_rte_vector_firq1(void);
+void cellrv32_rte_vector_firq2(void);
+void cellrv32_rte_vector_firq3(void);
+void cellrv32_rte_vector_firq4(void);
+void cellrv32_rte_vector_firq5(void);
+void cellrv32_rte_vector_firq6(void);
+void cellrv32_rte_vector_firq7(void);
+void cellrv32_rte_vector_firq8(void);
+void cellrv32_rte_vector_firq9(void);
+void cellrv32_rte_vector_firq10(void);
+void cellrv32_rte_vector_firq11(void);
+void cellrv32_rte_vector_firq12(void);
+void cellrv32_rte_vector_firq13(void);
+void cellrv32_rte_vector_firq14(void);
+void cellrv32_rte_vector_firq15(void);
+/**@}*/
+
+
+/**********************************************************************//**
+ * Define a register-saving-free interrupt entry for the shadow register bank (CPU_RF_SHADOW).
+ *
+ * GCC's "interrupt" attribute always saves all registers used by the handler. If the interrupt
+ * is enabled in the <b>mshadowen</b> CSR the hardware already switches all caller-saved registers
+ * (ra, t0..t6, a0..a7) to the shadow bank, so the entry only needs to call a plain C function
+ * (which preserves s0..s11 itself according to the ABI) and return via mret.
+ *
+ * @note Example: CELLRV32_RTE_SHADOW_ISR(cellrv32_rte_vector_mti, my_timer_handler) together with
+ * cellrv32_rte_setup_vectored() and cellrv32_cpu_csr_set(CSR_MSHADOWEN, 1 << CSR_MIE_MTIE).
+ *
+ * @warning The handler must not re-enable interrupts (there is only one shadow bank) and must not
+ * use the FPU CSRs (fflags/frm are not banked).
+ *
+ * @param[in] entry Name of the entry function (e.g. one of the cellrv32_rte_vector_* symbols).
+ * @param[in] handler Plain C handler function (void handler(void)).
+ **************************************************************************/
+#define CELLRV32_RTE_SHADOW_ISR(entry, handler) \
+  void __attribute__ ((naked, aligned(4))) entry(void) { \
+    asm volatile ("call " #handler " \n" \
+                  "mret              \n"); \
+  }
+
+
 /**********************************************************************//**
  * @name Prototypes
  **************************************************************************/
 /**@{*/
 void cellrv32_rte_setup(void);
+int  cellrv32_rte_setup_vectored(void);
 int  cellrv32_rte_handler_install(uint8_t id, void (*handler)(void));
 int  cellrv32_rte_handler_uninstall(uint8_t id);
 
@@ -0,0 +1,76 @@
+// #################################################################################################
+// # << CELLRV32: cellrv32_trace.h - Instruction Trace Buffer (TRACE) HW Driver >>                 #
+// # ********************************************************************************************* #
+// # The CELLRV32 Processor - https://github.com/DatNguyen97-VN/cellrv32            (c) Dat Nguyen #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file cellrv32_trace.h
+ * @brief Instruction trace buffer (TRACE) HW driver header file.
+ *
+ * @note These functions should only be used if the TRACE unit was synthesized (IO_TRACE_EN = true).
+ **************************************************************************/
+
+#ifndef cellrv32_trace_h
+#define cellrv32_trace_h
+
+/**********************************************************************//**
+ * @name IO Device: Instruction Trace Buffer (TRACE)
+ **************************************************************************/
+/**@{*/
+/** TRACE module prototype */
+typedef volatile struct __attribute__((packed,aligned(4))) {
+  uint32_t       CTRL; /**< offset  0: control register (#CELLRV32_TRACE_CTRL_enum) */
+  const uint32_t WPTR; /**< offset  4: write pointer (next free word) and start pointer (#CELLRV32_TRACE_WPTR_enum) */
+  uint32_t       RPTR; /**< offset  8: read pointer */
+  const uint32_t DATA; /**< offset 12: trace RAM data at RPTR, RPTR auto-increments on read */
+} cellrv32_trace_t;
+
+/** TRACE module hardware access (#cellrv32_trace_t) */
+#define CELLRV32_TRACE ((cellrv32_trace_t*) (CELLRV32_TRACE_BASE))
+
+/** TRACE control register bits */
+enum CELLRV32_TRACE_CTRL_enum {
+  TRACE_CTRL_EN      =  0, /**< TRACE control register(0)  (r/w): Trace enable */
+  TRACE_CTRL_MODE    =  1, /**< TRACE control register(1)  (r/w): Buffer mode: 0=circular, 1=stop when full */
+  TRACE_CTRL_CLR     =  2, /**< TRACE control register(2)  (-/w): Clear buffer and status flags, auto-clears */
+
+  TRACE_CTRL_WRAP    =  8, /**< TRACE control register(8)  (r/-): Circular buffer has wrapped around */
+  TRACE_CTRL_FULL    =  9, /**< TRACE control register(9)  (r/-): Buffer is full, recording stopped */
+  TRACE_CTRL_LOST    = 10, /**< TRACE control register(10) (r/-): Packets were lost due to encoder overflow */
+  TRACE_CTRL_BUSY    = 11, /**< TRACE control register(11) (r/-): Packets pending in encoder FIFO */
+
+  TRACE_CTRL_DEPTH_LSB = 16, /**< TRACE control register(16) (r/-): log2(buffer size in words), LSB */
+  TRACE_CTRL_DEPTH_MSB = 20  /**< TRACE control register(20) (r/-): log2(buffer size in words), MSB */
+};
+
+/** TRACE write pointer register fields */
+enum CELLRV32_TRACE_WPTR_enum {
+  TRACE_WPTR_WPTR_LSB =  0, /**< TRACE write pointer register(0)  (r/-): Write pointer (next free word), LSB */
+  TRACE_WPTR_SPTR_LSB = 16  /**< TRACE write pointer register(16) (r/-): Start pointer (header of oldest complete packet), LSB */
+};
+
+/** TRACE buffer modes */
+enum CELLRV32_TRACE_MODE_enum {
+  TRACE_MODE_CIRCULAR = 0, /**< Keep the most recent packets */
+  TRACE_MODE_STOP     = 1  /**< Keep the first packets, stop recording when full */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Prototypes
+ **************************************************************************/
+/**@{*/
+int      cellrv32_trace_available(void);
+uint32_t cellrv32_trace_get_depth(void);
+void     cellrv32_trace_start(int mode);
+void     cellrv32_trace_stop(void);
+uint32_t cellrv32_trace_get_size(void);
+uint32_t cellrv32_trace_read(uint32_t *buffer, uint32_t num);
+void     cellrv32_trace_dump(void);
+/**@}*/
+
+
+#endif // cellrv32_trace_h
@@ -67,6 +67,31 @@ void cellrv32_cpu_irq_disable(int irq_sel) {
 }
 
 
+/**********************************************************************//**
+ * Set priority/level of a specific interrupt channel (vectored interrupt controller).
+ *
+ * @note The upper mirqcfg.NLBITS bits of ctl define the preemption level, all bits
+ * define the arbitration priority (higher value = higher priority).
+ * @warning This function requires the vectored interrupt controller (CPU_IRQ_VECTORED).
+ *
+ * @param[in] irq_sel CPU interrupt select. See #CELLRV32_CSR_MIE_enum.
+ * @param[in] ctl Priority/level (4-bit).
+ **************************************************************************/
+void cellrv32_cpu_irq_set_ctl(int irq_sel, uint32_t ctl) {
+
+  uint32_t shift = (irq_sel & 7) * 4;
+  uint32_t mask  = 0xf << shift;
+  uint32_t data  = (ctl & 0xf) << shift;
+
+  switch ((irq_sel >> 3) & 3) {
+    case 0:  cellrv32_cpu_csr_write(CSR_MIRQCTL0, (cellrv32_cpu_csr_read(CSR_MIRQCTL0) & ~mask) | data); break;
+    case 1:  cellrv32_cpu_csr_write(CSR_MIRQCTL1, (cellrv32_cpu_csr_read(CSR_MIRQCTL1) & ~mask) | data); break;
+    case 2:  cellrv32_cpu_csr_write(CSR_MIRQCTL2, (cellrv32_cpu_csr_read(CSR_MIRQCTL2) & ~mask) | data); break;
+    default: cellrv32_cpu_csr_write(CSR_MIRQCTL3, (cellrv32_cpu_csr_read(CSR_MIRQCTL3) & ~mask) | data); break;
+  }
+}
+
+
 /**********************************************************************//**
  * Get cycle counter from cycle[h].
  *
@@ -526,6 +551,138 @@ uint32_t cellrv32_cpu_hpm_get_size(void) {
 }
 
 
+/**********************************************************************//**
+ * Preload an address range into the i-cache and lock the cache way holding it. Host misses will
+ * not replace blocks of a locked way anymore, so the range is executed without cache misses.
+ *
+ * @warning fence.i invalidates the whole i-cache including locked ways. Re-run this function after fence.i.
+ *
+ * @note The range has to fit into a single way (ICACHE_NUM_BLOCKS * ICACHE_BLOCK_SIZE bytes).
+ * Host misses are no longer cached if all ways are locked.
+ *
+ * @param[in] base Start address of the range.
+ * @param[in] size Size of the range in bytes.
+ * @param[in] way Cache way (0..associativity-1) that will hold the range.
+ * @return 0 if success, -1 if no i-cache, -2 if invalid way, -3 if range does not fit into one way.
+ **************************************************************************/
+int cellrv32_cpu_icache_lock_range(uint32_t base, uint32_t size, int way) {
+
+  // i-cache implemented at all?
+  if ((CELLRV32_SYSINFO->SOC & (1 << SYSINFO_SOC_ICACHE)) == 0) {
+    return -1;
+  }
+
+  uint32_t block_size = 1 << ((CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_IC_BLOCK_SIZE_0)    & 0x0F);
+  uint32_t num_blocks = 1 << ((CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_IC_NUM_BLOCKS_0)    & 0x0F);
+  uint32_t num_ways   = 1 << ((CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_IC_ASSOCIATIVITY_0) & 0x0F);
+
+  if ((way < 0) || ((uint32_t)way >= num_ways)) {
+    return -2;
+  }
+
+  if (size == 0) {
+    return 0;
+  }
+
+  // block-aligned range
+  uint32_t first = base & ~(block_size-1);
+  uint32_t last  = (base + size - 1) & ~(block_size-1);
+  if (((last - first) / block_size) >= num_blocks) {
+    return -3;
+  }
+
+  // lock target way first; preloads ignore the lock, so our own code misses go to the other ways
+  uint32_t tmp = cellrv32_cpu_csr_read(CSR_MICACHECTL) & (0xff << CSR_MICACHECTL_LOCK_LSB);
+  tmp |= (uint32_t)(1 << way) << CSR_MICACHECTL_LOCK_LSB;
+  tmp |= (uint32_t)(way & 0x07) << CSR_MICACHECTL_WAY_LSB;
+  cellrv32_cpu_csr_write(CSR_MICACHECTL, tmp);
+
+  // preload block by block
+  uint32_t addr = first;
+  while (1) {
+    cellrv32_cpu_csr_write(CSR_MICACHEFILL, addr);
+    while (cellrv32_cpu_csr_read(CSR_MICACHECTL) & (1 << CSR_MICACHECTL_BUSY)); // wait for download
+    if (addr == last) {
+      break;
+    }
+    addr += block_size;
+  }
+
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Preload the ".isr_locked" section (see #CELLRV32_ICACHE_LOCKED) into the i-cache and lock it.
+ *
+ * @param[in] way Cache way (0..associativity-1) that will hold the section.
+ * @return 0 if success, see cellrv32_cpu_icache_lock_range() for error codes.
+ **************************************************************************/
+int cellrv32_cpu_icache_lock_section(int way) {
+
+  extern const uint8_t __isr_locked_start[], __isr_locked_end[];
+
+  uint32_t base = (uint32_t)__isr_locked_start;
+  uint32_t size = (uint32_t)__isr_locked_end - base;
+
+  return cellrv32_cpu_icache_lock_range(base, size, way);
+}
+
+
+/**********************************************************************//**
+ * Unlock all i-cache ways. Locked blocks stay valid and are replaced by regular misses again.
+ **************************************************************************/
+void cellrv32_cpu_icache_unlock(void) {
+
+  if (CELLRV32_SYSINFO->SOC & (1 << SYSINFO_SOC_ICACHE)) {
+    cellrv32_cpu_csr_clr(CSR_MICACHECTL, 0xff << CSR_MICACHECTL_LOCK_LSB);
+  }
+}
+
+
+/**********************************************************************//**
+ * Clear a memory range using cbo.zero for all complete cache blocks and plain stores for the rest.
+ *
+ * @param[in] base Start address of the range (has to be word-aligned).
+ * @param[in] size Size of the range in bytes (has to be a multiple of 4).
+ * @return 0 if success, -1 if Zicboz is not implemented, -2 if range is not word-aligned.
+ **************************************************************************/
+int cellrv32_cpu_cbo_zero_range(uint32_t base, uint32_t size) {
+
+  // Zicboz implemented at all?
+  if ((CELLRV32_SYSINFO->SOC & (1 << SYSINFO_SOC_ZICBOZ)) == 0) {
+    return -1;
+  }
+
+  if ((base & 3) || (size & 3)) {
+    return -2;
+  }
+
+  uint32_t addr = base;
+  uint32_t end  = base + size;
+
+  // head: words up to the first block boundary
+  while ((addr < end) && (addr & (CELLRV32_CBO_BLOCK_SIZE-1))) {
+    cellrv32_cpu_store_unsigned_word(addr, 0);
+    addr += 4;
+  }
+
+  // complete blocks
+  while ((end - addr) >= CELLRV32_CBO_BLOCK_SIZE) {
+    cellrv32_cpu_cbo_zero(addr);
+    addr += CELLRV32_CBO_BLOCK_SIZE;
+  }
+
+  // tail
+  while (addr < end) {
+    cellrv32_cpu_store_unsigned_word(addr, 0);
+    addr += 4;
+  }
+
+  return 0;
+}
+
+
 /**********************************************************************//**
  * Switch from privilege mode MACHINE to privilege mode USER.
  *
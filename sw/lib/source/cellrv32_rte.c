@@ -26,6 +26,83 @@ static void __cellrv32_rte_print_hex_word(uint32_t num);
 static void __cellrv32_rte_print_hex_half(uint16_t num);
 
 
+/**********************************************************************//**
+ * Vectored interrupt mode: default handlers for all vector table entries.
+ * All entries point to the RTE core by default; the application can override each
+ * of them by defining a function with the same name and the "interrupt" attribute.
+ **************************************************************************/
+void cellrv32_rte_vector_exc(void)    __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_msi(void)    __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_mti(void)    __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_mei(void)    __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_lcofi(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq0(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq1(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq2(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq3(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq4(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq5(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq6(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq7(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq8(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq9(void)  __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq10(void) __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq11(void) __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq12(void) __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq13(void) __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq14(void) __attribute__((weak, alias("__cellrv32_rte_core")));
+void cellrv32_rte_vector_firq15(void) __attribute__((weak, alias("__cellrv32_rte_core")));
+
+
+/**********************************************************************//**
+ * Vectored interrupt mode: trap vector table (mtvec.MODE = 1). Exceptions start at
+ * entry 0, interrupts at entry mcause[4:0]. Each entry is a single (uncompressed!) jump.
+ **************************************************************************/
+extern const uint32_t __cellrv32_rte_vector_table[32];
+asm (
+  ".pushsection .text.__cellrv32_rte_vector_table, \"ax\", @progbits \n"
+  ".option push                     \n"
+  ".option norvc                    \n"
+  ".balign 128                      \n"
+  ".globl __cellrv32_rte_vector_table \n"
+  "__cellrv32_rte_vector_table:     \n"
+  "  j cellrv32_rte_vector_exc      \n" //  0: exceptions
+  "  j cellrv32_rte_vector_exc      \n" //  1
+  "  j cellrv32_rte_vector_exc      \n" //  2
+  "  j cellrv32_rte_vector_msi      \n" //  3: machine software interrupt
+  "  j cellrv32_rte_vector_exc      \n" //  4
+  "  j cellrv32_rte_vector_exc      \n" //  5
+  "  j cellrv32_rte_vector_exc      \n" //  6
+  "  j cellrv32_rte_vector_mti      \n" //  7: machine timer interrupt
+  "  j cellrv32_rte_vector_exc      \n" //  8
+  "  j cellrv32_rte_vector_exc      \n" //  9
+  "  j cellrv32_rte_vector_exc      \n" // 10
+  "  j cellrv32_rte_vector_mei      \n" // 11: machine external interrupt
+  "  j cellrv32_rte_vector_exc      \n" // 12
+  "  j cellrv32_rte_vector_lcofi    \n" // 13: local counter-overflow interrupt
+  "  j cellrv32_rte_vector_exc      \n" // 14
+  "  j cellrv32_rte_vector_exc      \n" // 15
+  "  j cellrv32_rte_vector_firq0    \n" // 16: fast interrupt channel 0
+  "  j cellrv32_rte_vector_firq1    \n" // 17
+  "  j cellrv32_rte_vector_firq2    \n" // 18
+  "  j cellrv32_rte_vector_firq3    \n" // 19
+  "  j cellrv32_rte_vector_firq4    \n" // 20
+  "  j cellrv32_rte_vector_firq5    \n" // 21
+  "  j cellrv32_rte_vector_firq6    \n" // 22
+  "  j cellrv32_rte_vector_firq7    \n" // 23
+  "  j cellrv32_rte_vector_firq8    \n" // 24
+  "  j cellrv32_rte_vector_firq9    \n" // 25
+  "  j cellrv32_rte_vector_firq10   \n" // 26
+  "  j cellrv32_rte_vector_firq11   \n" // 27
+  "  j cellrv32_rte_vector_firq12   \n" // 28
+  "  j cellrv32_rte_vector_firq13   \n" // 29
+  "  j cellrv32_rte_vector_firq14   \n" // 30
+  "  j cellrv32_rte_vector_firq15   \n" // 31: fast interrupt channel 15
+  ".option pop                      \n"
+  ".popsection                      \n"
+);
+
+
 /**********************************************************************//**
  * Setup CELLRV32 runtime environment.
  *
@@ -55,6 +132,30 @@ void cellrv32_rte_setup(void) {
 }
 
 
+/**********************************************************************//**
+ * Switch CELLRV32 runtime environment to vectored interrupt mode.
+ *
+ * @note Call this after cellrv32_rte_setup(void). Interrupts jump directly to the according
+ * cellrv32_rte_vector_* function (e.g. cellrv32_rte_vector_firq0) if the application defines one
+ * (it has to use the "interrupt" attribute); all other traps are still handled by the RTE core
+ * and the handlers installed via cellrv32_rte_handler_install(uint8_t id, void (*handler)(void)).
+ *
+ * @return 0 if success, 1 if error (vectored mode not supported by the hardware, CPU_IRQ_VECTORED).
+ **************************************************************************/
+int cellrv32_rte_setup_vectored(void) {
+
+  // configure trap vector table base address and vectored mode
+  cellrv32_cpu_csr_write(CSR_MTVEC, ((uint32_t)(&__cellrv32_rte_vector_table[0])) | 1);
+
+  // mtvec.MODE is WARL: check if vectored mode is supported at all
+  // (if not, all traps still reach the RTE core via entry 0 of the table)
+  if ((cellrv32_cpu_csr_read(CSR_MTVEC) & 3) != 1) {
+    return 1;
+  }
+  return 0;
+}
+
+
 /**********************************************************************//**
  * Install trap handler function to CELLRV32 runtime environment.
  *
@@ -65,7 +166,7 @@ void cellrv32_rte_setup(void) {
 int cellrv32_rte_handler_install(uint8_t id, void (*handler)(void)) {
 
   // id valid?
-  if ((id >= RTE_TRAP_I_MISALIGNED) && (id <= RTE_TRAP_FIRQ_15)) {
+  if ((id >= RTE_TRAP_I_MISALIGNED) && (id <= RTE_TRAP_LCOFI)) {
     __cellrv32_rte_vector_lut[id] = (uint32_t)handler; // install handler
     return 0;
   }
@@ -83,7 +184,7 @@ int cellrv32_rte_handler_install(uint8_t id, void (*handler)(void)) {
 int cellrv32_rte_handler_uninstall(uint8_t id) {
 
   // id valid?
-  if ((id >= RTE_TRAP_I_MISALIGNED) && (id <= RTE_TRAP_FIRQ_15)) {
+  if ((id >= RTE_TRAP_I_MISALIGNED) && (id <= RTE_TRAP_LCOFI)) {
     __cellrv32_rte_vector_lut[id] = (uint32_t)(&__cellrv32_rte_debug_handler); // use dummy handler in case the trap is accidentally triggered
     return 0;
   }
@@ -132,6 +233,7 @@ static void __attribute__((__interrupt__)) __attribute__((aligned(4))) __cellrv3
     case TRAP_CODE_FIRQ_13:      rte_handler = __cellrv32_rte_vector_lut[RTE_TRAP_FIRQ_13]; break;
     case TRAP_CODE_FIRQ_14:      rte_handler = __cellrv32_rte_vector_lut[RTE_TRAP_FIRQ_14]; break;
     case TRAP_CODE_FIRQ_15:      rte_handler = __cellrv32_rte_vector_lut[RTE_TRAP_FIRQ_15]; break;
+    case TRAP_CODE_LCOFI:        rte_handler = __cellrv32_rte_vector_lut[RTE_TRAP_LCOFI]; break;
     default:                     rte_handler = (uint32_t)(&__cellrv32_rte_debug_handler); break;
   }
 
@@ -191,6 +293,7 @@ static void __cellrv32_rte_debug_handler(void) {
     case TRAP_CODE_MSI:          cellrv32_uart0_puts("Machine software IRQ"); break;
     case TRAP_CODE_MTI:          cellrv32_uart0_puts("Machine timer IRQ"); break;
     case TRAP_CODE_MEI:          cellrv32_uart0_puts("Machine external IRQ"); break;
+    case TRAP_CODE_LCOFI:        cellrv32_uart0_puts("Counter overflow IRQ"); break;
     case TRAP_CODE_FIRQ_0:
     case TRAP_CODE_FIRQ_1:
     case TRAP_CODE_FIRQ_2:
@@ -214,6 +317,10 @@ static void __cellrv32_rte_debug_handler(void) {
   if ((trap_cause >= TRAP_CODE_FIRQ_0) && (trap_cause <= TRAP_CODE_FIRQ_15)) {
     cellrv32_cpu_csr_clr(CSR_MIP, 1 << trap_cause & 0xf); // clear pending FIRQ
   }
+  // check if counter overflow
+  else if (trap_cause == TRAP_CODE_LCOFI) {
+    cellrv32_cpu_csr_clr(CSR_MIP, 1 << CSR_MIP_LCOFIP); // clear pending LCOFI
+  }
   // check specific cause if bus access fault exception
   else if ((trap_cause == TRAP_CODE_I_ACCESS) || (trap_cause == TRAP_CODE_L_ACCESS) || (trap_cause == TRAP_CODE_S_ACCESS)) {
     uint32_t bus_err = CELLRV32_BUSKEEPER->CTRL;
@@ -338,6 +445,15 @@ void cellrv32_rte_print_hw_config(void) {
   if (tmp & (1<<CSR_MXISA_ZHINX)) {
     cellrv32_uart0_printf("Zhinx ");
   }
+  if (tmp & (1<<CSR_MXISA_ZKN)) {
+    cellrv32_uart0_printf("Zkn ");
+  }
+  if (tmp & (1<<CSR_MXISA_ZCMP)) {
+    cellrv32_uart0_printf("Zcmp ");
+  }
+  if (tmp & (1<<CSR_MXISA_ZCMT)) {
+    cellrv32_uart0_printf("Zcmt ");
+  }
   if (tmp & (1<<CSR_MXISA_ZIHPM)) {
     cellrv32_uart0_printf("Zihpm ");
   }
@@ -353,6 +469,22 @@ void cellrv32_rte_print_hw_config(void) {
   if (tmp & (1<<CSR_MXISA_SDTRIG)) {
     cellrv32_uart0_printf("Sdtrig ");
   }
+  if (tmp & (1<<CSR_MXISA_XHWLOOP)) {
+    cellrv32_uart0_printf("Xhwloop ");
+  }
+  if (tmp & (1<<CSR_MXISA_XHSIMD)) {
+    cellrv32_uart0_printf("Xhsimd ");
+  }
+  if (tmp & (1<<CSR_MXISA_XPSIMD)) {
+    cellrv32_uart0_printf("Xpsimd ");
+  }
+  // no space left in mxisa; these are reported by SYSINFO
+  if (CELLRV32_SYSINFO->SOC & (1<<SYSINFO_SOC_ZICBOP)) {
+    cellrv32_uart0_printf("Zicbop ");
+  }
+  if (CELLRV32_SYSINFO->SOC & (1<<SYSINFO_SOC_ZICBOZ)) {
+    cellrv32_uart0_printf("Zicboz ");
+  }
 
   // CPU tuning options
   cellrv32_uart0_printf("\nTuning options:    ");
@@ -362,6 +494,36 @@ void cellrv32_rte_print_hw_config(void) {
   if (tmp & (1<<CSR_MXISA_FASTSHIFT)) {
     cellrv32_uart0_printf("FAST_SHIFT ");
   }
+  if (tmp & (1<<CSR_MXISA_MULDIV)) {
+    cellrv32_uart0_printf("MULDIV_PERF ");
+  }
+  if (tmp & (1<<CSR_MXISA_FPU)) {
+    cellrv32_uart0_printf("FPU_PERF ");
+  }
+  if (tmp & (1<<CSR_MXISA_BP)) {
+    cellrv32_uart0_printf("BRANCH_PRED ");
+  }
+  if (tmp & (1<<CSR_MXISA_PIPE)) {
+    cellrv32_uart0_printf("PIPELINE ");
+  }
+  if (tmp & (1<<CSR_MXISA_DUAL)) {
+    cellrv32_uart0_printf("DUAL_ISSUE ");
+  }
+  if (tmp & (1<<CSR_MXISA_FETCH64)) {
+    cellrv32_uart0_printf("FETCH64 ");
+  }
+  if (tmp & (1<<CSR_MXISA_FUSION)) {
+    cellrv32_uart0_printf("FUSION ");
+  }
+  if (tmp & (1<<CSR_MXISA_NBLOAD)) {
+    cellrv32_uart0_printf("NB_LOAD ");
+  }
+  if (tmp & (1<<CSR_MXISA_SB)) {
+    cellrv32_uart0_printf("STORE_BUF ");
+  }
+  if (tmp & (1<<CSR_MXISA_MALIGN)) {
+    cellrv32_uart0_printf("MISALIGNED ");
+  }
 
   // check physical memory protection
   cellrv32_uart0_printf("\nPhys. Mem. Prot.:  ");
@@ -447,6 +609,9 @@ void cellrv32_rte_print_hw_config(void) {
     else if (((CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_IC_REPLACEMENT_0) & 0x0F) == 1) {
       cellrv32_uart0_printf(" (LRU replacement policy)\n");
     }
+    else if (((CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_IC_REPLACEMENT_0) & 0x0F) == 2) {
+      cellrv32_uart0_printf(" (pseudo-LRU replacement policy)\n");
+    }
     else {
       cellrv32_uart0_printf("\n");
     }
@@ -455,6 +620,45 @@ void cellrv32_rte_print_hw_config(void) {
     cellrv32_uart0_printf("no\n");
   }
 
+  // d-cache
+  cellrv32_uart0_printf("Internal d-cache:    ");
+  if (CELLRV32_SYSINFO->SOC & (1 << SYSINFO_SOC_DCACHE)) {
+    cellrv32_uart0_printf("yes, ");
+
+    uint32_t dc_block_size = (CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_DC_BLOCK_SIZE_0) & 0x0F;
+    if (dc_block_size) {
+      dc_block_size = 1 << dc_block_size;
+    }
+    else {
+      dc_block_size = 0;
+    }
+
+    uint32_t dc_num_blocks = (CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_DC_NUM_BLOCKS_0) & 0x0F;
+    if (dc_num_blocks) {
+      dc_num_blocks = 1 << dc_num_blocks;
+    }
+    else {
+      dc_num_blocks = 0;
+    }
+
+    uint32_t dc_associativity = (CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_DC_ASSOCIATIVITY_0) & 0x0F;
+    dc_associativity = 1 << dc_associativity;
+
+    cellrv32_uart0_printf("%u bytes, %u set(s), %u block(s) per set, %u bytes per block", dc_associativity*dc_num_blocks*dc_block_size, dc_associativity, dc_num_blocks, dc_block_size);
+    if (dc_associativity == 1) {
+      cellrv32_uart0_printf(" (direct-mapped, write-back)\n");
+    }
+    else if (((CELLRV32_SYSINFO->CACHE >> SYSINFO_CACHE_DC_REPLACEMENT_0) & 0x0F) == 1) {
+      cellrv32_uart0_printf(" (LRU replacement policy, write-back)\n");
+    }
+    else {
+      cellrv32_uart0_printf(" (write-back)\n");
+    }
+  }
+  else {
+    cellrv32_uart0_printf("no\n");
+  }
+
   cellrv32_uart0_printf("Ext. bus interface:  ");
   __cellrv32_rte_print_true_false(CELLRV32_SYSINFO->SOC & (1 << SYSINFO_SOC_MEM_EXT));
   cellrv32_uart0_printf("Ext. bus endianness: ");
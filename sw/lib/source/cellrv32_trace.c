@@ -0,0 +1,162 @@
+// #################################################################################################
+// # << CELLRV32: cellrv32_trace.c - Instruction Trace Buffer (TRACE) HW Driver >>                 #
+// # ********************************************************************************************* #
+// # The CELLRV32 Processor - https://github.com/DatNguyen97-VN/cellrv32            (c) Dat Nguyen #
+// #################################################################################################
+
+
+/**********************************************************************//**
+ * @file cellrv32_trace.c
+ * @brief Instruction trace buffer (TRACE) HW driver source file.
+ *
+ * @note These functions should only be used if the TRACE unit was synthesized (IO_TRACE_EN = true).
+ **************************************************************************/
+
+#include "cellrv32.h"
+#include "cellrv32_trace.h"
+
+// private functions
+static uint32_t __cellrv32_trace_get_start(void);
+
+
+/**********************************************************************//**
+ * Check if instruction trace buffer unit was synthesized.
+ *
+ * @return 0 if TRACE was not synthesized, 1 if TRACE is available.
+ **************************************************************************/
+int cellrv32_trace_available(void) {
+
+  if (CELLRV32_SYSINFO->SOC & (1 << SYSINFO_SOC_TRACE)) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Get trace buffer size.
+ *
+ * @return Trace buffer size in 32-bit words.
+ **************************************************************************/
+uint32_t cellrv32_trace_get_depth(void) {
+
+  uint32_t tmp = (CELLRV32_TRACE->CTRL >> TRACE_CTRL_DEPTH_LSB) & 0x1f;
+  return (uint32_t)(1 << tmp);
+}
+
+
+/**********************************************************************//**
+ * Clear trace buffer and start recording.
+ *
+ * @param[in] mode Buffer mode (#CELLRV32_TRACE_MODE_enum).
+ **************************************************************************/
+void cellrv32_trace_start(int mode) {
+
+  CELLRV32_TRACE->CTRL = 1 << TRACE_CTRL_CLR; // disable and clear
+
+  uint32_t tmp = 0;
+  tmp |= (uint32_t)(1    & 0x01) << TRACE_CTRL_EN;
+  tmp |= (uint32_t)(mode & 0x01) << TRACE_CTRL_MODE;
+
+  CELLRV32_TRACE->CTRL = tmp;
+}
+
+
+/**********************************************************************//**
+ * Stop recording. Returns when all pending packets have been written to the trace buffer.
+ **************************************************************************/
+void cellrv32_trace_stop(void) {
+
+  CELLRV32_TRACE->CTRL &= ~(1 << TRACE_CTRL_EN);
+  while (CELLRV32_TRACE->CTRL & (1 << TRACE_CTRL_BUSY)); // wait for encoder to drain
+}
+
+
+/**********************************************************************//**
+ * Get index of the oldest valid word in the trace buffer.
+ *
+ * @note If the circular buffer has wrapped around, this is the header of the oldest complete
+ * packet (partly overwritten packets are skipped).
+ *
+ * @return Index of the oldest valid word.
+ **************************************************************************/
+static uint32_t __cellrv32_trace_get_start(void) {
+
+  if (CELLRV32_TRACE->CTRL & (1 << TRACE_CTRL_WRAP)) {
+    return (CELLRV32_TRACE->WPTR >> TRACE_WPTR_SPTR_LSB) & 0xffff;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Get number of valid words in the trace buffer.
+ *
+ * @return Number of valid 32-bit words.
+ **************************************************************************/
+uint32_t cellrv32_trace_get_size(void) {
+
+  uint32_t depth = cellrv32_trace_get_depth();
+  uint32_t wptr  = (CELLRV32_TRACE->WPTR >> TRACE_WPTR_WPTR_LSB) & 0xffff;
+
+  if (CELLRV32_TRACE->CTRL & (1 << TRACE_CTRL_WRAP)) { // from start pointer to write pointer
+    return ((wptr - __cellrv32_trace_get_start() - 1) & (depth - 1)) + 1;
+  }
+  else if (CELLRV32_TRACE->CTRL & (1 << TRACE_CTRL_FULL)) {
+    return depth;
+  }
+  else {
+    return wptr;
+  }
+}
+
+
+/**********************************************************************//**
+ * Copy trace buffer content (oldest word first). Recording should be stopped before.
+ *
+ * @param[in,out] buffer Pointer to destination array.
+ * @param[in] num Maximum number of words to copy.
+ * @return Number of words copied.
+ **************************************************************************/
+uint32_t cellrv32_trace_read(uint32_t *buffer, uint32_t num) {
+
+  uint32_t size = cellrv32_trace_get_size();
+  uint32_t i;
+
+  if (num > size) {
+    num = size;
+  }
+
+  // start at the oldest complete packet
+  CELLRV32_TRACE->RPTR = __cellrv32_trace_get_start();
+
+  for (i=0; i<num; i++) {
+    buffer[i] = CELLRV32_TRACE->DATA;
+  }
+
+  return num;
+}
+
+
+/**********************************************************************//**
+ * Print trace buffer content via UART0 (oldest word first) in the format expected by the
+ * host-side trace decoder (sw/trace_dec). Recording should be stopped before.
+ **************************************************************************/
+void cellrv32_trace_dump(void) {
+
+  uint32_t size = cellrv32_trace_get_size();
+  uint32_t ctrl = CELLRV32_TRACE->CTRL;
+  uint32_t i;
+
+  CELLRV32_TRACE->RPTR = __cellrv32_trace_get_start(); // start at the oldest complete packet
+
+  cellrv32_uart_printf(CELLRV32_UART0, "TRACE_BEGIN %x\n", ctrl);
+  for (i=0; i<size; i++) {
+    cellrv32_uart_printf(CELLRV32_UART0, "%x\n", CELLRV32_TRACE->DATA);
+  }
+  cellrv32_uart_printf(CELLRV32_UART0, "TRACE_END\n");
+}
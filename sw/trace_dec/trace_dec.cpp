@@ -0,0 +1,555 @@
+// #################################################################################################
+// # << CELLRV32 - Instruction trace decoder >>                                                    #
+// # ********************************************************************************************* #
+// # Rebuilds the executed PC stream from a trace buffer dump (TRACE module, see                   #
+// # rtl/core/cellrv32_trace.sv) and the ELF file of the traced application. The trace only        #
+// # contains information that cannot be inferred from the program image (branch outcomes,         #
+// # indirect jump/trap targets), so everything else is recovered by walking the executable code.  #
+// # ********************************************************************************************* #
+// # The CELLRV32 Processor - https://github.com/datNguyen97-VN/cellrv32            (c) Dat Nguyen #
+// #################################################################################################
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+// -------------------------------------------------------------------------------------------------
+// Trace packet format (has to match rtl/core/cellrv32_trace.sv)
+// -------------------------------------------------------------------------------------------------
+enum packet_type_t {
+  PKT_BMAP = 1, // [29:25] = number of branches, [24:0] = taken flags (LSB = oldest branch)
+  PKT_ADDR = 2, // [29] = sync, [28:27] = type, [26:20] = cause, [19:0] = cycle delta; + source word + target word
+  PKT_TIME = 3  // [19:0] = cycle delta
+};
+
+enum addr_type_t {
+  ADDR_BR   = 0, // conditional branch (sync packets only)
+  ADDR_JMP  = 1, // uninferable jump (indirect jump, hardware loop wrap)
+  ADDR_TRAP = 2, // trap entry
+  ADDR_TRET = 3  // trap return
+};
+
+struct packet_t {
+  int      type;
+  uint32_t hdr;
+  uint32_t src;
+  uint32_t tgt;
+};
+
+
+// -------------------------------------------------------------------------------------------------
+// Program image (ELF32, little-endian)
+// -------------------------------------------------------------------------------------------------
+struct symbol_t {
+  uint32_t    addr;
+  uint32_t    size;
+  std::string name;
+};
+
+class image_t {
+public:
+  bool load(const char *fname);
+  bool fetch(uint32_t addr, uint32_t &instr, int &len) const;
+  std::string symbol(uint32_t addr) const;
+
+private:
+  std::map<uint32_t, std::vector<uint8_t> > segments; // base address -> content
+  std::vector<symbol_t> symbols; // sorted by address
+
+  bool read16(uint32_t addr, uint16_t &data) const;
+};
+
+
+static uint32_t rd32(const std::vector<uint8_t> &d, size_t i) {
+  return (uint32_t)d[i] | ((uint32_t)d[i+1] << 8) | ((uint32_t)d[i+2] << 16) | ((uint32_t)d[i+3] << 24);
+}
+
+static uint16_t rd16(const std::vector<uint8_t> &d, size_t i) {
+  return (uint16_t)(d[i] | (d[i+1] << 8));
+}
+
+
+bool image_t::load(const char *fname) {
+
+  std::ifstream f(fname, std::ios::binary);
+  if (!f) {
+    fprintf(stderr, "ERROR: Cannot open ELF file '%s'!\n", fname);
+    return false;
+  }
+  std::vector<uint8_t> d((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+  if ((d.size() < 52) || (memcmp(d.data(), "\x7f" "ELF", 4) != 0) || (d[4] != 1) || (d[5] != 1)) {
+    fprintf(stderr, "ERROR: '%s' is not a 32-bit little-endian ELF file!\n", fname);
+    return false;
+  }
+
+  // loadable segments
+  uint32_t phoff = rd32(d, 28), phentsize = rd16(d, 42), phnum = rd16(d, 44);
+  for (uint32_t i=0; i<phnum; i++) {
+    size_t p = phoff + i*phentsize;
+    if ((p + 32) > d.size()) {
+      break;
+    }
+    uint32_t p_type = rd32(d, p), p_offset = rd32(d, p+4), p_paddr = rd32(d, p+12), p_filesz = rd32(d, p+16);
+    if ((p_type != 1) || (p_filesz == 0) || ((size_t)p_offset + p_filesz > d.size())) { // PT_LOAD only
+      continue;
+    }
+    // [NOTE] use load (physical) address: code is executed from where it is stored
+    segments[p_paddr] = std::vector<uint8_t>(d.begin() + p_offset, d.begin() + p_offset + p_filesz);
+  }
+
+  // function symbols
+  uint32_t shoff = rd32(d, 32), shentsize = rd16(d, 46), shnum = rd16(d, 48);
+  for (uint32_t i=0; i<shnum; i++) {
+    size_t s = shoff + i*shentsize;
+    if ((s + 40) > d.size() || (rd32(d, s+4) != 2)) { // SHT_SYMTAB only
+      continue;
+    }
+    uint32_t sym_off = rd32(d, s+16), sym_size = rd32(d, s+20), link = rd32(d, s+24);
+    size_t   l = shoff + link*shentsize;
+    if ((l + 40) > d.size()) {
+      continue;
+    }
+    uint32_t str_off = rd32(d, l+16), str_size = rd32(d, l+20);
+    for (uint32_t e=sym_off; (e + 16) <= (sym_off + sym_size) && (e + 16) <= d.size(); e+=16) {
+      uint32_t name = rd32(d, e), value = rd32(d, e+4), size = rd32(d, e+8);
+      uint8_t  info = d[e+12];
+      if (((info & 0xf) != 2) || (name >= str_size) || ((size_t)str_off + name >= d.size())) { // STT_FUNC only
+        continue;
+      }
+      symbols.push_back({value, size, std::string((const char*)&d[str_off + name])});
+    }
+  }
+  std::sort(symbols.begin(), symbols.end(), [](const symbol_t &a, const symbol_t &b) { return a.addr < b.addr; });
+
+  if (segments.empty()) {
+    fprintf(stderr, "ERROR: No loadable segments in '%s'!\n", fname);
+    return false;
+  }
+  return true;
+}
+
+
+bool image_t::read16(uint32_t addr, uint16_t &data) const {
+
+  auto it = segments.upper_bound(addr);
+  if (it == segments.begin()) {
+    return false;
+  }
+  --it;
+  uint32_t offs = addr - it->first;
+  if ((offs + 2) > it->second.size()) {
+    return false;
+  }
+  data = rd16(it->second, offs);
+  return true;
+}
+
+
+bool image_t::fetch(uint32_t addr, uint32_t &instr, int &len) const {
+
+  uint16_t lo, hi;
+  if (!read16(addr, lo)) {
+    return false;
+  }
+  if ((lo & 3) != 3) { // compressed
+    instr = lo;
+    len   = 2;
+    return true;
+  }
+  if (!read16(addr + 2, hi)) {
+    return false;
+  }
+  instr = ((uint32_t)hi << 16) | lo;
+  len   = 4;
+  return true;
+}
+
+
+std::string image_t::symbol(uint32_t addr) const {
+
+  auto it = std::upper_bound(symbols.begin(), symbols.end(), addr,
+                             [](uint32_t a, const symbol_t &s) { return a < s.addr; });
+  if (it == symbols.begin()) {
+    return "";
+  }
+  --it;
+  if ((it->size != 0) && (addr >= (it->addr + it->size))) {
+    return "";
+  }
+  char buf[16];
+  snprintf(buf, sizeof(buf), "+0x%x", addr - it->addr);
+  return "  <" + it->name + buf + ">";
+}
+
+
+// -------------------------------------------------------------------------------------------------
+// Instruction classification
+// -------------------------------------------------------------------------------------------------
+enum flow_t {
+  FLOW_LINEAR,   // next sequential instruction
+  FLOW_BRANCH,   // conditional branch (outcome from trace)
+  FLOW_JUMP,     // direct jump (target from image)
+  FLOW_INDIRECT  // uninferable (target from trace)
+};
+
+static int32_t sext(uint32_t x, int bits) {
+  return (int32_t)(x << (32 - bits)) >> (32 - bits);
+}
+
+static flow_t classify(uint32_t i, int len, int32_t &offs) {
+
+  offs = 0;
+  if (len == 4) {
+    switch (i & 0x7f) {
+      case 0x63: // BRANCH
+        offs = sext((((i >> 31) & 1) << 12) | (((i >> 7) & 1) << 11) | (((i >> 25) & 0x3f) << 5) | (((i >> 8) & 0xf) << 1), 13);
+        return FLOW_BRANCH;
+      case 0x6f: // JAL
+        offs = sext((((i >> 31) & 1) << 20) | (((i >> 12) & 0xff) << 12) | (((i >> 20) & 1) << 11) | (((i >> 21) & 0x3ff) << 1), 21);
+        return FLOW_JUMP;
+      case 0x67: // JALR
+        return FLOW_INDIRECT;
+      case 0x73: // SYSTEM: mret, dret
+        if ((i == 0x30200073) || (i == 0x7b200073)) {
+          return FLOW_INDIRECT;
+        }
+        return FLOW_LINEAR;
+      default:
+        return FLOW_LINEAR;
+    }
+  }
+
+  uint32_t op = i & 3, f3 = (i >> 13) & 7;
+  if ((op == 1) && ((f3 == 1) || (f3 == 5))) { // c.jal, c.j
+    offs = sext((((i >> 12) & 1) << 11) | (((i >> 8) & 1) << 10) | (((i >> 9) & 3) << 8) | (((i >> 6) & 1) << 7) |
+                (((i >> 7) & 1) << 6) | (((i >> 2) & 1) << 5) | (((i >> 11) & 1) << 4) | (((i >> 3) & 7) << 1), 12);
+    return FLOW_JUMP;
+  }
+  if ((op == 1) && ((f3 == 6) || (f3 == 7))) { // c.beqz, c.bnez
+    offs = sext((((i >> 12) & 1) << 8) | (((i >> 5) & 3) << 6) | (((i >> 2) & 1) << 5) | (((i >> 10) & 3) << 3) |
+                (((i >> 3) & 3) << 1), 9);
+    return FLOW_BRANCH;
+  }
+  if ((op == 2) && (f3 == 4) && (((i >> 2) & 0x1f) == 0) && (((i >> 7) & 0x1f) != 0)) { // c.jr, c.jalr
+    return FLOW_INDIRECT;
+  }
+  if ((op == 2) && (f3 == 5)) { // Zcmp: cm.popret(z); Zcmt: cm.jt, cm.jalt
+    uint32_t f = (i >> 8) & 0x1f;
+    if ((f == 0x1c) || (f == 0x1e) || (((i >> 10) & 7) == 0)) {
+      return FLOW_INDIRECT;
+    }
+  }
+  return FLOW_LINEAR;
+}
+
+
+// fused "auipc rd, hi; jalr rd, lo(rd)" pair (same non-zero rd, see macro-op fusion in the CPU control unit)
+static bool is_fused_jump(uint32_t a, int a_len, uint32_t b, int b_len) {
+
+  uint32_t rd = (a >> 7) & 0x1f;
+  return (a_len == 4) && (b_len == 4) && ((a & 0x7f) == 0x17) && (rd != 0) &&          // auipc rd
+         ((b & 0x7f) == 0x67) && (((b >> 12) & 7) == 0) &&                              // jalr
+         (((b >> 7) & 0x1f) == rd) && (((b >> 15) & 0x1f) == rd);                       // rd = rs1 = auipc.rd
+}
+
+
+// -------------------------------------------------------------------------------------------------
+// Decoder
+// -------------------------------------------------------------------------------------------------
+class decoder_t {
+public:
+  decoder_t(const image_t &img, bool events_only) : img(img), events_only(events_only) {}
+  void run(const std::vector<packet_t> &pkts);
+
+private:
+  const image_t     &img;
+  bool               events_only;
+  bool               pc_valid = false;
+  uint32_t           pc       = 0;
+  uint64_t           cycle    = 0;
+  uint64_t           icount   = 0;
+  uint64_t           nsync    = 0;
+  std::deque<bool>   bits;
+
+  void emit(uint32_t addr, uint32_t instr, int len);
+  void desync(const char *reason);
+  void walk(bool to_src, uint32_t src, bool incl_src);
+};
+
+
+void decoder_t::emit(uint32_t addr, uint32_t instr, int len) {
+
+  icount++;
+  if (!events_only) {
+    if (len == 2) {
+      printf("  %08x:     %04x%s\n", addr, instr, img.symbol(addr).c_str());
+    }
+    else {
+      printf("  %08x: %08x%s\n", addr, instr, img.symbol(addr).c_str());
+    }
+  }
+}
+
+
+void decoder_t::desync(const char *reason) {
+
+  printf("# lost synchronization at 0x%08x: %s\n", pc, reason);
+  pc_valid = false;
+  bits.clear();
+}
+
+
+// follow the program from the current PC; stop at <src> (if set) or when no more branch information is available
+void decoder_t::walk(bool to_src, uint32_t src, bool incl_src) {
+
+  uint64_t steps = 0;
+  while (pc_valid) {
+    if (to_src && (pc == src) && !incl_src) {
+      return;
+    }
+    uint32_t instr;
+    int      len;
+    int32_t  offs;
+    if (!img.fetch(pc, instr, len)) {
+      desync("address outside of program image");
+      return;
+    }
+    flow_t flow = classify(instr, len, offs);
+    if (!to_src && ((flow == FLOW_INDIRECT) || ((flow == FLOW_BRANCH) && bits.empty()))) {
+      return; // end of reconstructable stream
+    }
+    emit(pc, instr, len);
+    if (to_src && (pc == src)) {
+      // fused auipc+jalr: the jump is reported with the address of the auipc
+      uint32_t next;
+      int      next_len;
+      if (img.fetch(pc + len, next, next_len) && is_fused_jump(instr, len, next, next_len)) {
+        emit(pc + len, next, next_len);
+      }
+      return;
+    }
+    switch (flow) {
+      case FLOW_BRANCH:
+        if (bits.empty()) {
+          desync("branch without trace information");
+          return;
+        }
+        pc = bits.front() ? (pc + offs) : (pc + len);
+        bits.pop_front();
+        break;
+      case FLOW_JUMP:
+        pc += offs;
+        break;
+      case FLOW_INDIRECT:
+        desync("indirect jump does not match trace");
+        return;
+      default:
+        pc += len;
+        break;
+    }
+    if (++steps > 100000000) {
+      desync("no progress");
+      return;
+    }
+  }
+}
+
+
+void decoder_t::run(const std::vector<packet_t> &pkts) {
+
+  static const char *type_str[4] = {"BRANCH", "JUMP  ", "TRAP  ", "TRET  "};
+
+  for (const packet_t &p : pkts) {
+    switch (p.type) {
+
+      case PKT_BMAP: {
+        uint32_t num = (p.hdr >> 25) & 0x1f;
+        for (uint32_t i=0; i<num; i++) {
+          if (pc_valid) {
+            bits.push_back((p.hdr >> i) & 1);
+          }
+        }
+        break;
+      }
+
+      case PKT_TIME:
+        cycle += p.hdr & 0xfffff;
+        break;
+
+      case PKT_ADDR: {
+        uint32_t type  = (p.hdr >> 27) & 3;
+        uint32_t cause = (p.hdr >> 20) & 0x7f;
+        bool     sync  = (p.hdr >> 29) & 1;
+        cycle += p.hdr & 0xfffff;
+        if (sync || !pc_valid) {
+          nsync++;
+          printf("@%-12llu SYNC   -> 0x%08x%s\n", (unsigned long long)cycle, p.tgt, img.symbol(p.tgt).c_str());
+        }
+        else {
+          walk(true, p.src, (type != ADDR_TRAP)); // trapping instruction is not completed
+          if (type == ADDR_TRAP) {
+            printf("@%-12llu %s 0x%08x -> 0x%08x%s (mcause 0x%08x)\n", (unsigned long long)cycle, type_str[type], p.src, p.tgt,
+                   img.symbol(p.tgt).c_str(), ((cause & 0x40) << 25) | (cause & 0x1f));
+          }
+          else {
+            printf("@%-12llu %s 0x%08x -> 0x%08x%s\n", (unsigned long long)cycle, type_str[type], p.src, p.tgt,
+                   img.symbol(p.tgt).c_str());
+          }
+        }
+        pc       = p.tgt;
+        pc_valid = true;
+        bits.clear();
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+
+  walk(false, 0, false); // remaining branch information
+  printf("# %llu instructions, %llu cycles, %llu sync point(s)\n",
+         (unsigned long long)icount, (unsigned long long)cycle, (unsigned long long)nsync);
+}
+
+
+// -------------------------------------------------------------------------------------------------
+// Trace dump parsing
+// -------------------------------------------------------------------------------------------------
+static int packet_words(uint32_t hdr) {
+
+  switch (hdr >> 30) {
+    case PKT_BMAP: return (((hdr >> 25) & 0x1f) != 0) ? 1 : 0;
+    case PKT_ADDR: return 3;
+    case PKT_TIME: return 1;
+    default:       return 0; // invalid
+  }
+}
+
+// split word stream into packets; returns false if the stream is inconsistent (truncated last packet is ignored)
+static bool parse_packets(const std::vector<uint32_t> &w, size_t start, std::vector<packet_t> &pkts) {
+
+  pkts.clear();
+  size_t i = start;
+  while (i < w.size()) {
+    int n = packet_words(w[i]);
+    if (n == 0) {
+      return false;
+    }
+    if ((i + n) > w.size()) {
+      break;
+    }
+    packet_t p = {(int)(w[i] >> 30), w[i], (n == 3) ? w[i+1] : 0, (n == 3) ? w[i+2] : 0};
+    pkts.push_back(p);
+    i += n;
+  }
+  return true;
+}
+
+// read UART dump (TRACE_BEGIN <ctrl> ... TRACE_END, see cellrv32_trace_dump()) or plain hex words
+static bool read_text(const char *fname, std::vector<uint32_t> &w) {
+
+  std::ifstream f(fname);
+  if (!f) {
+    fprintf(stderr, "ERROR: Cannot open trace file '%s'!\n", fname);
+    return false;
+  }
+  std::string line;
+  bool marker = false, inside = false;
+  while (std::getline(f, line)) {
+    std::istringstream ls(line);
+    std::string tok;
+    if (!(ls >> tok)) {
+      continue;
+    }
+    if (tok == "TRACE_BEGIN") {
+      w.clear();
+      marker = inside = true;
+      continue;
+    }
+    if (tok == "TRACE_END") {
+      inside = false;
+      continue;
+    }
+    if (marker && !inside) {
+      continue;
+    }
+    char *end;
+    uint32_t v = (uint32_t)strtoul(tok.c_str(), &end, 16);
+    if (*end == '\0') {
+      w.push_back(v);
+    }
+  }
+  return true;
+}
+
+// read raw memory dump of the trace buffer (little-endian words, oldest packet first)
+static bool read_binary(const char *fname, std::vector<uint32_t> &w) {
+
+  std::ifstream f(fname, std::ios::binary);
+  if (!f) {
+    fprintf(stderr, "ERROR: Cannot open trace file '%s'!\n", fname);
+    return false;
+  }
+  std::vector<uint8_t> d((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+  for (size_t i=0; (i+4)<=d.size(); i+=4) {
+    w.push_back(rd32(d, i));
+  }
+  return true;
+}
+
+
+int main(int argc, char *argv[]) {
+
+  bool binary = false, events_only = false;
+  std::vector<const char*> files;
+
+  for (int i=1; i<argc; i++) {
+    if      (strcmp(argv[i], "-b") == 0) { binary = true; }
+    else if (strcmp(argv[i], "-e") == 0) { events_only = true; }
+    else                                 { files.push_back(argv[i]); }
+  }
+
+  if (files.size() != 2) {
+    printf("<<< CELLRV32 instruction trace decoder >>>\n"
+           "Usage: trace_dec [options] <main.elf> <trace dump>\n"
+           "Options:\n"
+           " -b : trace dump is a raw binary memory image (little-endian words, starting at the oldest packet;\n"
+           "      for a wrapped circular buffer this is the start pointer, TRACE WPTR register bits 31:16)\n"
+           " -e : print trace events (jumps, traps, timing) only, no instruction stream\n"
+           "Text dumps are generated by cellrv32_trace_dump() (UART0) or contain one hex word per line.\n");
+    return 0;
+  }
+
+  image_t img;
+  if (!img.load(files[0])) {
+    return 1;
+  }
+
+  std::vector<uint32_t> words;
+  if (!(binary ? read_binary(files[1], words) : read_text(files[1], words))) {
+    return 1;
+  }
+
+  // [NOTE] the hardware keeps a start pointer to the header of the oldest complete packet, so a dump always
+  // begins on a packet boundary - even if the circular buffer has wrapped around
+  std::vector<packet_t> pkts;
+  if (!parse_packets(words, 0, pkts)) {
+    fprintf(stderr, "ERROR: Invalid trace data!\n");
+    return 1;
+  }
+
+  decoder_t dec(img, events_only);
+  dec.run(pkts);
+  return 0;
+}